@@ -148,14 +148,17 @@
 #
 # Compile data resources into application binary::
 #
-#  corrade_add_resource(<name> <resources.conf>)
+#  corrade_add_resource(<name> <resources.conf> [INCBIN])
 #
 # Depends on ``Corrade::rc``, which is part of Corrade utilities. This command
 # generates resource data using given configuration file in current build
 # directory. Argument name is name under which the resources can be explicitly
 # loaded. Variable ``<name>`` contains compiled resource filename, which is
 # then used for compiling library / executable. On CMake >= 3.1 the
-# `resources.conf` file can contain UTF-8-encoded filenames. Example usage::
+# `resources.conf` file can contain UTF-8-encoded filenames. With ``INCBIN``
+# the data are not converted to C++ source but embedded using the ``.incbin``
+# assembler directive, which is much faster to compile for large files, but
+# works only with GCC and Clang on ELF and Apple platforms. Example usage::
 #
 #  corrade_add_resource(app_resources resources.conf)
 #  add_executable(app source1 source2 ... ${app_resources})
@@ -460,6 +463,13 @@ foreach(_component ${Corrade_FIND_COMPONENTS})
                 set_property(TARGET Corrade::${_component} APPEND PROPERTY
                     INTERFACE_LINK_LIBRARIES "log")
             endif()
+
+            # Directory::readChunks() needs threads
+            if(NOT CORRADE_TARGET_EMSCRIPTEN)
+                find_package(Threads REQUIRED)
+                set_property(TARGET Corrade::${_component} APPEND PROPERTY
+                    INTERFACE_LINK_LIBRARIES ${CMAKE_THREAD_LIBS_INIT})
+            endif()
         endif()
 
         # Find library includes
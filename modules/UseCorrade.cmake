@@ -378,6 +378,19 @@ function(corrade_add_test test_name)
 endfunction()
 
 function(corrade_add_resource name configurationFile)
+    # Parse options
+    set(incbin OFF)
+    foreach(arg ${ARGN})
+        if(arg STREQUAL INCBIN)
+            set(incbin ON)
+        else()
+            message(SEND_ERROR "corrade_add_resource(): unknown argument ${arg}")
+        endif()
+    endforeach()
+    if(incbin AND (NOT CMAKE_CXX_COMPILER_ID MATCHES "GNU|Clang" OR CORRADE_TARGET_WINDOWS OR CORRADE_TARGET_EMSCRIPTEN))
+        message(SEND_ERROR "corrade_add_resource(): INCBIN is supported only with GCC and Clang on ELF and Apple platforms")
+    endif()
+
     # Parse dependencies from the file
     set(dependencies )
     set(filenameRegex "^[ \t]*filename[ \t]*=[ \t]*\"?([^\"]+)\"?[ \t]*$")
@@ -410,13 +423,25 @@ function(corrade_add_resource name configurationFile)
     # deletions are not recognized automatically)
     configure_file(${configurationFile} ${outDepends} COPYONLY)
 
-    # Run command
-    add_custom_command(
-        OUTPUT "${out}"
-        COMMAND Corrade::rc ${name} "${configurationFile}" "${out}"
-        DEPENDS Corrade::rc ${outDepends} ${dependencies} ${name}-dependencies
-        COMMENT "Compiling data resource file ${out}"
-        WORKING_DIRECTORY "${CMAKE_CURRENT_SOURCE_DIR}")
+    # Run command. With INCBIN the data go to a separate file referenced from
+    # the generated source, so it needs to be recompiled when it changes.
+    if(incbin)
+        set(outData "${CMAKE_CURRENT_BINARY_DIR}/resource_${name}.bin")
+        add_custom_command(
+            OUTPUT "${out}" "${outData}"
+            COMMAND Corrade::rc ${name} "${configurationFile}" "${out}" --incbin "${outData}"
+            DEPENDS Corrade::rc ${outDepends} ${dependencies} ${name}-dependencies
+            COMMENT "Compiling data resource file ${out}"
+            WORKING_DIRECTORY "${CMAKE_CURRENT_SOURCE_DIR}")
+        set_source_files_properties("${out}" PROPERTIES OBJECT_DEPENDS "${outData}")
+    else()
+        add_custom_command(
+            OUTPUT "${out}"
+            COMMAND Corrade::rc ${name} "${configurationFile}" "${out}"
+            DEPENDS Corrade::rc ${outDepends} ${dependencies} ${name}-dependencies
+            COMMENT "Compiling data resource file ${out}"
+            WORKING_DIRECTORY "${CMAKE_CURRENT_SOURCE_DIR}")
+    endif()
 
     # Save output filename
     set(${name} "${out}" PARENT_SCOPE)
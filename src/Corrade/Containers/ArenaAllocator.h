@@ -0,0 +1,324 @@
+#ifndef Corrade_Containers_ArenaAllocator_h
+#define Corrade_Containers_ArenaAllocator_h
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Corrade::Containers::ArenaAllocator
+ */
+
+#include <cstdint>
+#include <new>
+#include <utility>
+
+#include "Corrade/Containers/Array.h"
+#include "Corrade/Containers/Tags.h"
+
+namespace Corrade { namespace Containers {
+
+namespace Implementation {
+    /* Memory is owned by the arena, so the deleter only calls destructors */
+    template<class T> void arenaDeleter(T* data, std::size_t size) {
+        for(std::size_t i = 0; i != size; ++i) data[i].~T();
+    }
+}
+
+/**
+@brief Arena allocator
+
+A monotonic bump allocator for many short-lived arrays. Memory is taken from
+large blocks by just advancing a pointer, and the whole batch is then released
+at once with @ref reset() or @ref rewind() instead of going through the global
+heap for every allocation. Example usage:
+
+@code{.cpp}
+Containers::ArenaAllocator arena;
+
+for(;;) {
+    Containers::Array<int> indices = arena.allocate<int>(16);
+    Containers::Array<char> name = arena.allocate<char>(Containers::ValueInit, 32);
+    // ...
+
+    // Release everything allocated in this frame at once
+    arena.reset();
+}
+@endcode
+
+The allocations are returned as regular @ref Array instances with a deleter
+that only calls destructors of the items, the memory itself is owned by the
+arena. That means the arrays can be passed around and moved freely, but they
+have to be destroyed before the arena is reset, rewound past them or destroyed
+itself, otherwise they point to memory that gets reused. Arrays allocated from
+an arena are not growable --- calling @ref arrayAppend() or similar on them
+moves the contents to a new heap allocation, leaving the arena memory
+untouched.
+
+@section Containers-ArenaAllocator-markers Markers
+
+A @ref mark() captures the current allocation position, @ref rewind() to it
+then releases everything that was allocated after it while keeping older
+allocations intact. Useful for nested scopes with temporary data:
+
+@code{.cpp}
+Containers::Array<int> persistent = arena.allocate<int>(1000);
+
+Containers::ArenaAllocator::Marker marker = arena.mark();
+{
+    Containers::Array<float> temporary = arena.allocate<float>(5000);
+    // ...
+}
+arena.rewind(marker); // persistent is still valid
+@endcode
+
+@section Containers-ArenaAllocator-blocks Block management
+
+Memory is allocated in blocks of the size passed to the constructor, or
+larger if a single allocation doesn't fit. Blocks are never freed by
+@ref reset() or @ref rewind(), only on arena destruction, and are reused
+for subsequent allocations, so a steady-state workload stops touching the
+heap completely after the first iteration.
+*/
+class ArenaAllocator {
+    public:
+        /**
+         * @brief Allocation position marker
+         *
+         * @see @ref mark(), @ref rewind()
+         */
+        class Marker {
+            friend ArenaAllocator;
+
+            public:
+                /** @brief Default constructor, marks an empty arena */
+                constexpr /*implicit*/ Marker() noexcept: _block{}, _offset{} {}
+
+            private:
+                constexpr explicit Marker(void* block, std::size_t offset) noexcept: _block{block}, _offset{offset} {}
+
+                void* _block;
+                std::size_t _offset;
+        };
+
+        /**
+         * @brief Constructor
+         * @param blockSize     Size of a single memory block in bytes
+         *
+         * No memory is allocated until the first call to @ref allocate().
+         */
+        explicit ArenaAllocator(std::size_t blockSize = 65536) noexcept: _blockSize{blockSize}, _first{}, _current{}, _offset{} {}
+
+        /** @brief Copying is not allowed */
+        ArenaAllocator(const ArenaAllocator&) = delete;
+
+        /** @brief Move constructor */
+        ArenaAllocator(ArenaAllocator&& other) noexcept: _blockSize{other._blockSize}, _first{other._first}, _current{other._current}, _offset{other._offset} {
+            other._first = other._current = nullptr;
+            other._offset = 0;
+        }
+
+        /**
+         * @brief Destructor
+         *
+         * Frees all blocks. Arrays allocated from the arena are expected to
+         * be destroyed before.
+         */
+        ~ArenaAllocator();
+
+        /** @brief Copying is not allowed */
+        ArenaAllocator& operator=(const ArenaAllocator&) = delete;
+
+        /** @brief Move assignment */
+        ArenaAllocator& operator=(ArenaAllocator&& other) noexcept {
+            std::swap(_blockSize, other._blockSize);
+            std::swap(_first, other._first);
+            std::swap(_current, other._current);
+            std::swap(_offset, other._offset);
+            return *this;
+        }
+
+        /** @brief Block size */
+        std::size_t blockSize() const { return _blockSize; }
+
+        /** @brief Count of allocated blocks */
+        std::size_t blockCount() const;
+
+        /**
+         * @brief Allocate a default-initialized array
+         *
+         * Trivial types are left uninitialized, other types are
+         * default-constructed, equivalently to
+         * @ref Array::Array(DefaultInitT, std::size_t). If @p size is zero,
+         * returns an empty array without touching the arena.
+         */
+        template<class T> Array<T> allocate(DefaultInitT, std::size_t size);
+
+        /**
+         * @brief Allocate a value-initialized array
+         *
+         * Trivial types are zero-initialized, other types are
+         * default-constructed, equivalently to
+         * @ref Array::Array(ValueInitT, std::size_t).
+         */
+        template<class T> Array<T> allocate(ValueInitT, std::size_t size);
+
+        /**
+         * @brief Allocate an uninitialized array
+         *
+         * The items are expected to be constructed using placement-new before
+         * the array is destroyed, equivalently to
+         * @ref Array::Array(NoInitT, std::size_t).
+         */
+        template<class T> Array<T> allocate(NoInitT, std::size_t size);
+
+        /**
+         * @brief Allocate an array
+         *
+         * Alias to @ref allocate(DefaultInitT, std::size_t).
+         */
+        template<class T> Array<T> allocate(std::size_t size) {
+            return allocate<T>(DefaultInit, size);
+        }
+
+        /**
+         * @brief Allocate raw memory
+         *
+         * Returns memory of @p size bytes aligned to @p alignment, which is
+         * expected to be a power of two. Used internally by the typed
+         * variants.
+         */
+        void* allocate(std::size_t size, std::size_t alignment);
+
+        /**
+         * @brief Mark current allocation position
+         *
+         * @see @ref rewind()
+         */
+        Marker mark() const { return Marker{_current, _offset}; }
+
+        /**
+         * @brief Rewind to a marker
+         *
+         * Releases all allocations done after @p marker was taken, keeping
+         * the older ones intact. The marker is expected to come from this
+         * arena and there should be no rewind past it since it was taken.
+         */
+        void rewind(const Marker& marker) {
+            _current = static_cast<Block*>(marker._block);
+            _offset = marker._offset;
+        }
+
+        /**
+         * @brief Release all allocations
+         *
+         * Equivalent to rewinding to a default-constructed @ref Marker. The
+         * blocks are kept for reuse.
+         */
+        void reset() {
+            _current = nullptr;
+            _offset = 0;
+        }
+
+    private:
+        struct Block {
+            Block* next;
+            std::size_t capacity;
+
+            char* data() { return reinterpret_cast<char*>(this + 1); }
+        };
+
+        std::size_t _blockSize;
+        Block* _first;
+        Block* _current;
+        std::size_t _offset;
+};
+
+inline ArenaAllocator::~ArenaAllocator() {
+    for(Block* block = _first; block; ) {
+        Block* const next = block->next;
+        block->~Block();
+        delete[] reinterpret_cast<char*>(block);
+        block = next;
+    }
+}
+
+inline std::size_t ArenaAllocator::blockCount() const {
+    std::size_t count = 0;
+    for(Block* block = _first; block; block = block->next) ++count;
+    return count;
+}
+
+inline void* ArenaAllocator::allocate(const std::size_t size, const std::size_t alignment) {
+    /* Fits into the current block, the fast path */
+    if(_current) {
+        const std::uintptr_t begin = reinterpret_cast<std::uintptr_t>(_current->data());
+        const std::size_t offset = ((begin + _offset + alignment - 1) & ~std::uintptr_t(alignment - 1)) - begin;
+        if(offset + size <= _current->capacity) {
+            _offset = offset + size;
+            return _current->data() + offset;
+        }
+    }
+
+    /* Reuse the next block if it's large enough, otherwise insert a new one
+       before it. The worst-case alignment padding has to fit as well. */
+    Block* next = _current ? _current->next : _first;
+    const std::size_t required = size + alignment - 1;
+    if(!next || next->capacity < required) {
+        const std::size_t capacity = required > _blockSize ? required : _blockSize;
+        Block* const block = new(new char[sizeof(Block) + capacity]) Block{next, capacity};
+        if(_current) _current->next = block;
+        else _first = block;
+        next = block;
+    }
+
+    _current = next;
+    const std::uintptr_t begin = reinterpret_cast<std::uintptr_t>(_current->data());
+    const std::size_t offset = ((begin + alignment - 1) & ~std::uintptr_t(alignment - 1)) - begin;
+    _offset = offset + size;
+    return _current->data() + offset;
+}
+
+template<class T> Array<T> ArenaAllocator::allocate(DefaultInitT, const std::size_t size) {
+    if(!size) return {};
+    T* const data = static_cast<T*>(allocate(size*sizeof(T), alignof(T)));
+    for(std::size_t i = 0; i != size; ++i) new(data + i) T;
+    return Array<T>{data, size, Implementation::arenaDeleter<T>};
+}
+
+template<class T> Array<T> ArenaAllocator::allocate(ValueInitT, const std::size_t size) {
+    if(!size) return {};
+    T* const data = static_cast<T*>(allocate(size*sizeof(T), alignof(T)));
+    for(std::size_t i = 0; i != size; ++i) new(data + i) T();
+    return Array<T>{data, size, Implementation::arenaDeleter<T>};
+}
+
+template<class T> Array<T> ArenaAllocator::allocate(NoInitT, const std::size_t size) {
+    if(!size) return {};
+    T* const data = static_cast<T*>(allocate(size*sizeof(T), alignof(T)));
+    return Array<T>{data, size, Implementation::arenaDeleter<T>};
+}
+
+}}
+
+#endif
@@ -177,6 +177,31 @@ char* data = reinterpret_cast<char*>(glMapNamedBuffer(buffer, GL_READ_WRITE));
 Containers::Array<char, UnmapBuffer> array{data, bufferSize, UnmapBuffer{buffer}};
 @endcode
 
+@section Containers-Array-growable Growable arrays
+
+The class by itself has a fixed size, but it's possible to grow it in-place
+with geometric capacity growth using the @ref arrayAppend(),
+@ref arrayReserve(), @ref arrayResize() and @ref arrayRemoveSuffix() functions
+from the @ref GrowableArray.h header. These make use of the deleter mechanism
+described above --- a growable array stores its capacity in front of the data
+and has the deleter set to a function of given @ref ArrayAllocator, which is
+also how a growable array is recognized. The type of the array stays the same,
+so growable arrays can be passed everywhere a regular @ref Array is expected.
+
+@code{.cpp}
+Containers::Array<int> a;
+Containers::arrayAppend(a, 5);
+Containers::arrayAppend(a, {17, -3});
+Containers::arrayResize(a, Containers::ValueInit, 10); // a.size() == 10
+@endcode
+
+Trivially copyable types are reallocated using @ref std::realloc() via
+@ref ArrayMallocAllocator, other types via @ref ArrayNewAllocator that
+move-constructs the elements to a new location. Arrays that aren't growable
+(for example ones constructed directly or wrapping external memory) are moved
+to a growable storage on the first growing operation. Use @ref arrayShrink() to
+convert a growable array back to a regular one.
+
 @see @ref arrayCast(Array<T, D>&)
 
 @todo Something like ArrayTuple to create more than one array with single
@@ -68,8 +68,8 @@ Containers::ArrayView<const int> c{data2, 3};
     and the size includes also the zero-terminator (thus in case of
     @cpp "hello" @ce the size would be 6, not 5, as one might expect).
 
-@see @ref ArrayView<const void>, @ref StaticArrayView, @ref arrayView(),
-    @ref arrayCast(ArrayView<T>)
+@see @ref ArrayView<const void>, @ref StaticArrayView,
+    @ref StridedArrayView, @ref arrayView(), @ref arrayCast(ArrayView<T>)
 */
 /* All member functions are const because the view doesn't own the data */
 template<class T> class ArrayView {
@@ -148,7 +148,7 @@ template<class T> class ArrayView {
         /** @brief Whether the array is non-empty */
         /* Disabled on MSVC <= 2017 to avoid ambiguous operator+() when doing
            pointer arithmetic. */
-        explicit operator bool() const { return _data; }
+        constexpr explicit operator bool() const { return _data; }
         #endif
 
         /** @brief Conversion to array type */
@@ -168,8 +168,8 @@ template<class T> class ArrayView {
         constexpr T* cbegin() const { return _data; }   /**< @overload */
 
         /** @brief Pointer to (one item after) last element */
-        T* end() const { return _data+_size; }
-        T* cend() const { return _data+_size; }         /**< @overload */
+        constexpr T* end() const { return _data+_size; }
+        constexpr T* cend() const { return _data+_size; } /**< @overload */
 
         /**
          * @brief Array slice
@@ -497,7 +497,7 @@ template<std::size_t size_, class T> class StaticArrayView {
         /** @brief Whether the array is non-empty */
         /* Disabled on MSVC <= 2017 to avoid ambiguous operator+() when doing
            pointer arithmetic. */
-        explicit operator bool() const { return _data; }
+        constexpr explicit operator bool() const { return _data; }
         #endif
 
         /** @brief Conversion to array type */
@@ -517,8 +517,8 @@ template<std::size_t size_, class T> class StaticArrayView {
         constexpr T* cbegin() const { return _data; }   /**< @overload */
 
         /** @brief Pointer to (one item after) last element */
-        T* end() const { return _data + size_; }
-        T* cend() const { return _data + size_; }       /**< @overload */
+        constexpr T* end() const { return _data + size_; }
+        constexpr T* cend() const { return _data + size_; } /**< @overload */
 
         /** @copydoc ArrayView::slice(T*, T*) const */
         ArrayView<T> slice(T* begin, T* end) const {
@@ -0,0 +1,225 @@
+#ifndef Corrade_Containers_BitArray_h
+#define Corrade_Containers_BitArray_h
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Corrade::Containers::BitArray
+ */
+
+#include "Corrade/Containers/Array.h"
+#include "Corrade/Containers/BitArrayView.h"
+
+namespace Corrade { namespace Containers {
+
+/**
+@brief Bit array
+
+Owning counterpart to @ref BitArrayView, storing the bits tightly packed in
+an @ref Array of bytes. The bit offset of an owning array is always zero.
+Implicitly convertible to a @ref MutableBitArrayView and @ref BitArrayView,
+which is also the way to use the @ref bitwiseAnd(), @ref bitwiseOr() and
+@ref bitwiseXor() operations.
+
+@code{.cpp}
+Containers::BitArray visible{Containers::ValueInit, 1000};
+visible.set(17);
+visible.set(512);
+
+Containers::BitArray occluded{Containers::ValueInit, 1000};
+occluded.set(512);
+
+// Visible and not occluded
+Containers::bitwiseXor(occluded, occluded, visible);
+Containers::bitwiseAnd(visible, visible, occluded);
+// visible.count() == 1
+@endcode
+
+Initialization options are similar to @ref Array:
+
+-   @ref BitArray(ValueInitT, std::size_t) resets all bits.
+-   @ref BitArray(DirectInitT, std::size_t, bool) sets all bits to given
+    value.
+-   @ref BitArray(NoInitT, std::size_t) leaves the contents uninitialized.
+-   @ref BitArray(std::size_t) is an alias to
+    @ref BitArray(ValueInitT, std::size_t).
+
+The class is move-only, same as @ref Array.
+*/
+class BitArray {
+    public:
+        /**
+         * @brief Default constructor
+         *
+         * Creates a zero-sized array with no allocation.
+         */
+        /*implicit*/ BitArray(std::nullptr_t = nullptr) noexcept: _size{} {}
+
+        /**
+         * @brief Construct a zero-initialized array
+         * @param size      Size in bits
+         */
+        explicit BitArray(ValueInitT, std::size_t size): _data{ValueInit, (size + 7)/8}, _size{size} {}
+
+        /**
+         * @brief Construct an array with all bits set to given value
+         * @param size      Size in bits
+         * @param value     Bit value
+         */
+        explicit BitArray(DirectInitT, std::size_t size, bool value): _data{DirectInit, (size + 7)/8, char(value ? 0xff : 0)}, _size{size} {}
+
+        /**
+         * @brief Construct an array without initializing its contents
+         * @param size      Size in bits
+         */
+        explicit BitArray(NoInitT, std::size_t size): _data{NoInit, (size + 7)/8}, _size{size} {}
+
+        /**
+         * @brief Construct a zero-initialized array
+         *
+         * Alias to @ref BitArray(ValueInitT, std::size_t).
+         */
+        explicit BitArray(std::size_t size): BitArray{ValueInit, size} {}
+
+        /** @brief Copying is not allowed */
+        BitArray(const BitArray&) = delete;
+
+        /** @brief Move constructor */
+        BitArray(BitArray&& other) noexcept: _data{std::move(other._data)}, _size{other._size} {
+            other._size = 0;
+        }
+
+        /** @brief Copying is not allowed */
+        BitArray& operator=(const BitArray&) = delete;
+
+        /** @brief Move assignment */
+        BitArray& operator=(BitArray&& other) noexcept {
+            std::swap(_data, other._data);
+            std::swap(_size, other._size);
+            return *this;
+        }
+
+        /** @brief Convert to a mutable view */
+        /*implicit*/ operator MutableBitArrayView() {
+            return MutableBitArrayView{_data.data(), 0, _size};
+        }
+
+        /** @brief Convert to a const view */
+        /*implicit*/ operator BitArrayView() const {
+            return BitArrayView{_data.data(), 0, _size};
+        }
+
+        /** @brief Pointer to the first byte */
+        char* data() { return _data.data(); }
+        const char* data() const { return _data.data(); } /**< @overload */
+
+        /** @brief Size in bits */
+        std::size_t size() const { return _size; }
+
+        /** @brief Whether the array is empty */
+        bool empty() const { return !_size; }
+
+        /** @brief Bit at given position */
+        bool operator[](std::size_t i) const { return view()[i]; }
+
+        /** @brief Set a bit */
+        void set(std::size_t i) { mutableView().set(i); }
+
+        /** @brief Set a bit to given value */
+        void set(std::size_t i, bool value) { mutableView().set(i, value); }
+
+        /** @brief Reset a bit */
+        void reset(std::size_t i) { mutableView().reset(i); }
+
+        /** @brief Flip a bit */
+        void flip(std::size_t i) { mutableView().flip(i); }
+
+        /** @brief Set all bits */
+        void setAll() { mutableView().setAll(); }
+
+        /** @brief Reset all bits */
+        void resetAll() { mutableView().resetAll(); }
+
+        /** @copydoc BasicBitArrayView::count() */
+        std::size_t count() const { return view().count(); }
+
+        /** @copydoc BasicBitArrayView::findFirstSet() */
+        std::size_t findFirstSet() const { return view().findFirstSet(); }
+
+        /** @copydoc BasicBitArrayView::findNextSet() */
+        std::size_t findNextSet(std::size_t from) const {
+            return view().findNextSet(from);
+        }
+
+        /**
+         * @brief Array slice
+         *
+         * Equivalent to @ref BasicBitArrayView::slice().
+         */
+        MutableBitArrayView slice(std::size_t begin, std::size_t end) {
+            return mutableView().slice(begin, end);
+        }
+        /** @overload */
+        BitArrayView slice(std::size_t begin, std::size_t end) const {
+            return view().slice(begin, end);
+        }
+
+        /**
+         * @brief Array prefix
+         *
+         * Equivalent to @ref BasicBitArrayView::prefix().
+         */
+        MutableBitArrayView prefix(std::size_t end) {
+            return mutableView().prefix(end);
+        }
+        /** @overload */
+        BitArrayView prefix(std::size_t end) const {
+            return view().prefix(end);
+        }
+
+        /**
+         * @brief Array suffix
+         *
+         * Equivalent to @ref BasicBitArrayView::suffix().
+         */
+        MutableBitArrayView suffix(std::size_t begin) {
+            return mutableView().suffix(begin);
+        }
+        /** @overload */
+        BitArrayView suffix(std::size_t begin) const {
+            return view().suffix(begin);
+        }
+
+    private:
+        MutableBitArrayView mutableView() { return *this; }
+        BitArrayView view() const { return *this; }
+
+        Array<char> _data;
+        std::size_t _size;
+};
+
+}}
+
+#endif
@@ -0,0 +1,462 @@
+#ifndef Corrade_Containers_BitArrayView_h
+#define Corrade_Containers_BitArrayView_h
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Corrade::Containers::BasicBitArrayView, typedef @ref Corrade::Containers::BitArrayView, @ref Corrade::Containers::MutableBitArrayView, function @ref Corrade::Containers::bitwiseAnd(), @ref Corrade::Containers::bitwiseOr(), @ref Corrade::Containers::bitwiseXor()
+ */
+
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#include "Corrade/configure.h"
+#include "Corrade/Containers/Containers.h"
+#include "Corrade/Utility/Assert.h"
+#include "Corrade/Utility/Endianness.h"
+
+#ifdef CORRADE_TARGET_SSE2
+#include <emmintrin.h>
+#endif
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+
+namespace Corrade { namespace Containers {
+
+namespace Implementation {
+    /* Bits are numbered from the least significant bit of the first byte,
+       so a little-endian load of eight bytes gives 64 consecutive bits */
+
+    /* Loads 1 to 64 bits starting at given bit position, touching only the
+       bytes that contain them */
+    inline std::uint64_t bitLoad(const char* const data, const std::size_t position, const std::size_t count) {
+        const char* const bytes = data + (position >> 3);
+        const std::size_t shift = position & 7;
+        const std::size_t byteCount = (shift + count + 7) >> 3;
+
+        std::uint64_t value = 0;
+        std::memcpy(&value, bytes, byteCount < 8 ? byteCount : 8);
+        value = Utility::Endianness::littleEndian(value) >> shift;
+        /* The ninth byte is needed only for an unaligned load of more than
+           56 bits, in which case shift is never zero */
+        if(byteCount == 9)
+            value |= std::uint64_t(std::uint8_t(bytes[8])) << (64 - shift);
+        return count == 64 ? value : value & ((std::uint64_t{1} << count) - 1);
+    }
+
+    /* Stores 1 to 64 bits starting at given bit position, keeping the
+       surrounding bits intact */
+    inline void bitStore(char* const data, const std::size_t position, const std::size_t count, std::uint64_t value) {
+        char* const bytes = data + (position >> 3);
+        const std::size_t shift = position & 7;
+        const std::size_t byteCount = (shift + count + 7) >> 3;
+        const std::size_t wordByteCount = byteCount < 8 ? byteCount : 8;
+        const std::uint64_t mask = count == 64 ? ~std::uint64_t{} : (std::uint64_t{1} << count) - 1;
+        value &= mask;
+
+        std::uint64_t word = 0;
+        std::memcpy(&word, bytes, wordByteCount);
+        word = Utility::Endianness::littleEndian(word);
+        word = (word & ~(mask << shift)) | (value << shift);
+        word = Utility::Endianness::littleEndian(word);
+        std::memcpy(bytes, &word, wordByteCount);
+
+        if(byteCount == 9) {
+            const std::uint8_t highMask = std::uint8_t(mask >> (64 - shift));
+            bytes[8] = char((std::uint8_t(bytes[8]) & ~highMask) | std::uint8_t(value >> (64 - shift)));
+        }
+    }
+
+    inline std::size_t bitPopcount(std::uint64_t value) {
+        #if defined(__GNUC__) || defined(__clang__)
+        return __builtin_popcountll(value);
+        #else
+        /* MSVC has __popcnt64(), but it's not guaranteed to be supported by
+           the CPU, so it's a classic SWAR reduction instead */
+        value = value - ((value >> 1) & 0x5555555555555555ull);
+        value = (value & 0x3333333333333333ull) + ((value >> 2) & 0x3333333333333333ull);
+        value = (value + (value >> 4)) & 0x0f0f0f0f0f0f0f0full;
+        return (value*0x0101010101010101ull) >> 56;
+        #endif
+    }
+
+    inline std::size_t bitCountTrailingZeros(std::uint64_t value) {
+        #if defined(__GNUC__) || defined(__clang__)
+        return __builtin_ctzll(value);
+        #elif defined(_MSC_VER) && defined(_WIN64)
+        unsigned long index;
+        _BitScanForward64(&index, value);
+        return index;
+        #elif defined(_MSC_VER)
+        unsigned long index;
+        if(_BitScanForward(&index, std::uint32_t(value))) return index;
+        _BitScanForward(&index, std::uint32_t(value >> 32));
+        return index + 32;
+        #else
+        std::size_t index = 0;
+        for(; !(value & 1); value >>= 1) ++index;
+        return index;
+        #endif
+    }
+
+    struct BitwiseAnd {
+        static std::uint64_t apply(std::uint64_t a, std::uint64_t b) { return a & b; }
+        #ifdef CORRADE_TARGET_SSE2
+        static __m128i apply(__m128i a, __m128i b) { return _mm_and_si128(a, b); }
+        #endif
+    };
+
+    struct BitwiseOr {
+        static std::uint64_t apply(std::uint64_t a, std::uint64_t b) { return a | b; }
+        #ifdef CORRADE_TARGET_SSE2
+        static __m128i apply(__m128i a, __m128i b) { return _mm_or_si128(a, b); }
+        #endif
+    };
+
+    struct BitwiseXor {
+        static std::uint64_t apply(std::uint64_t a, std::uint64_t b) { return a ^ b; }
+        #ifdef CORRADE_TARGET_SSE2
+        static __m128i apply(__m128i a, __m128i b) { return _mm_xor_si128(a, b); }
+        #endif
+    };
+
+    template<class Operation> void bitwiseOperation(char* const out, const std::size_t outOffset, const char* const a, const std::size_t aOffset, const char* const b, const std::size_t bOffset, const std::size_t size) {
+        std::size_t i = 0;
+
+        /* If all views start at the same bit offset, whole bytes can be
+           processed directly. Otherwise every chunk needs to be shifted. */
+        if(outOffset == aOffset && outOffset == bOffset) {
+            /* Leading bits up to the first byte boundary */
+            if(outOffset) {
+                const std::size_t count = 8 - outOffset < size ? 8 - outOffset : size;
+                bitStore(out, outOffset, count, Operation::apply(bitLoad(a, aOffset, count), bitLoad(b, bOffset, count)));
+                i = count;
+            }
+
+            const std::size_t byteBegin = (outOffset + i) >> 3;
+            const std::size_t byteEnd = (outOffset + size) >> 3;
+            std::size_t j = byteBegin;
+            #ifdef CORRADE_TARGET_SSE2
+            for(; j + 16 <= byteEnd; j += 16) {
+                const __m128i va = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + j));
+                const __m128i vb = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + j));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(out + j), Operation::apply(va, vb));
+            }
+            #endif
+            for(; j + 8 <= byteEnd; j += 8) {
+                std::uint64_t va, vb;
+                std::memcpy(&va, a + j, 8);
+                std::memcpy(&vb, b + j, 8);
+                const std::uint64_t result = Operation::apply(va, vb);
+                std::memcpy(out + j, &result, 8);
+            }
+            i += (j - byteBegin)*8;
+        }
+
+        for(; i < size; i += 64) {
+            const std::size_t count = size - i < 64 ? size - i : 64;
+            bitStore(out, outOffset + i, count, Operation::apply(bitLoad(a, aOffset + i, count), bitLoad(b, bOffset + i, count)));
+        }
+    }
+}
+
+/**
+@brief Bit array view
+@tparam T   Either @cpp char @ce or @cpp const char @ce
+
+A non-owning view on a contiguous range of bits, i.e. an @ref ArrayView
+counterpart for bits. As bits can't be addressed directly, the view is
+defined by a byte pointer, bit offset and size in bits. Bit @f$ i @f$ of the
+view is bit @f$ (o + i) \mod 8 @f$ of byte @f$ \lfloor (o + i) / 8 \rfloor @f$,
+where @f$ o @f$ is the offset. Compared to @ref EnumSet, the size is not
+limited by a width of an integer type.
+
+Use the @ref BitArrayView and @ref MutableBitArrayView typedefs instead of
+this class directly. A mutable view is implicitly convertible to a const one.
+For an owning variant see @ref BitArray.
+
+@code{.cpp}
+char data[4]{};
+Containers::MutableBitArrayView bits{data, 3, 26};
+bits.set(0);    // sets the fourth bit of the first byte
+bits.set(10);
+bits.flip(25);
+
+std::size_t count = bits.count(); // 3
+for(std::size_t i = bits.findFirstSet(); i < bits.size(); i = bits.findNextSet(i + 1)) {
+    // i is 0, 10 and 25
+}
+@endcode
+
+Population count, bit scanning and the @ref bitwiseAnd(), @ref bitwiseOr()
+and @ref bitwiseXor() operations process 64 bits at a time, the bitwise
+operations additionally use SSE2 if @ref CORRADE_TARGET_SSE2 is defined and
+all views start at the same bit offset.
+
+Similarly to @ref ArrayView, modifying functions are @cpp const @ce, as they
+don't modify the view itself.
+*/
+template<class T> class BasicBitArrayView {
+    static_assert(std::is_same<typename std::remove_const<T>::type, char>::value,
+        "only char and const char is supported as the type");
+
+    public:
+        /**
+         * @brief Default constructor
+         *
+         * Creates an empty view.
+         */
+        /*implicit*/ BasicBitArrayView(std::nullptr_t = nullptr) noexcept: _data{}, _offset{}, _size{} {}
+
+        /**
+         * @brief Constructor
+         * @param data      Data pointer
+         * @param offset    Bit offset from @p data
+         * @param size      Size in bits
+         *
+         * The offset can be larger than @cpp 7 @ce, in which case it's
+         * normalized so @ref offset() is always less than @cpp 8 @ce.
+         */
+        explicit BasicBitArrayView(T* data, std::size_t offset, std::size_t size) noexcept: _data{data + (offset >> 3)}, _offset{offset & 7}, _size{size} {}
+
+        /** @brief Construct a const view from a mutable view */
+        template<class U, class = typename std::enable_if<std::is_same<const U, T>::value && !std::is_same<U, T>::value>::type> /*implicit*/ BasicBitArrayView(const BasicBitArrayView<U>& other) noexcept: _data{other._data}, _offset{other._offset}, _size{other._size} {}
+
+        /** @brief Pointer to the first byte */
+        T* data() const { return _data; }
+
+        /** @brief Bit offset from the first byte, always less than @cpp 8 @ce */
+        std::size_t offset() const { return _offset; }
+
+        /** @brief Size in bits */
+        std::size_t size() const { return _size; }
+
+        /** @brief Whether the view is empty */
+        bool empty() const { return !_size; }
+
+        /** @brief Bit at given position */
+        bool operator[](std::size_t i) const {
+            const std::size_t position = _offset + i;
+            return _data[position >> 3] & (1 << (position & 7));
+        }
+
+        /**
+         * @brief Set a bit
+         *
+         * Available only on mutable views.
+         */
+        void set(std::size_t i) const {
+            const std::size_t position = _offset + i;
+            _data[position >> 3] |= char(1 << (position & 7));
+        }
+
+        /**
+         * @brief Set a bit to given value
+         *
+         * Available only on mutable views.
+         */
+        void set(std::size_t i, bool value) const {
+            value ? set(i) : reset(i);
+        }
+
+        /**
+         * @brief Reset a bit
+         *
+         * Available only on mutable views.
+         */
+        void reset(std::size_t i) const {
+            const std::size_t position = _offset + i;
+            _data[position >> 3] &= char(~(1 << (position & 7)));
+        }
+
+        /**
+         * @brief Flip a bit
+         *
+         * Available only on mutable views.
+         */
+        void flip(std::size_t i) const {
+            const std::size_t position = _offset + i;
+            _data[position >> 3] ^= char(1 << (position & 7));
+        }
+
+        /**
+         * @brief Set all bits
+         *
+         * Available only on mutable views.
+         */
+        void setAll() const { fill(~std::uint64_t{}); }
+
+        /**
+         * @brief Reset all bits
+         *
+         * Available only on mutable views.
+         */
+        void resetAll() const { fill(0); }
+
+        /** @brief Count of set bits */
+        std::size_t count() const {
+            std::size_t count = 0;
+            std::size_t i = 0;
+            /* Whole words can be loaded directly if there's no offset */
+            if(!_offset) for(; i + 64 <= _size; i += 64) {
+                std::uint64_t word;
+                std::memcpy(&word, _data + i/8, 8);
+                count += Implementation::bitPopcount(word);
+            }
+            for(; i < _size; i += 64)
+                count += Implementation::bitPopcount(Implementation::bitLoad(_data, _offset + i, _size - i < 64 ? _size - i : 64));
+            return count;
+        }
+
+        /**
+         * @brief Position of the first set bit
+         *
+         * Returns @ref size() if no bit is set.
+         */
+        std::size_t findFirstSet() const { return findNextSet(0); }
+
+        /**
+         * @brief Position of the first set bit at or after given position
+         *
+         * Returns @ref size() if no bit in range @f$ [ from ; size ) @f$
+         * is set.
+         */
+        std::size_t findNextSet(std::size_t from) const {
+            for(std::size_t i = from; i < _size; i += 64) {
+                const std::uint64_t word = Implementation::bitLoad(_data, _offset + i, _size - i < 64 ? _size - i : 64);
+                if(word) return i + Implementation::bitCountTrailingZeros(word);
+            }
+            return _size;
+        }
+
+        /**
+         * @brief View slice
+         *
+         * Both arguments are bit positions. Expects that
+         * @cpp begin <= end && end <= size() @ce.
+         */
+        BasicBitArrayView<T> slice(std::size_t begin, std::size_t end) const;
+
+        /**
+         * @brief View prefix
+         *
+         * Equivalent to @cpp slice(0, end) @ce.
+         */
+        BasicBitArrayView<T> prefix(std::size_t end) const {
+            return slice(0, end);
+        }
+
+        /**
+         * @brief View suffix
+         *
+         * Equivalent to @cpp slice(begin, size()) @ce.
+         */
+        BasicBitArrayView<T> suffix(std::size_t begin) const {
+            return slice(begin, _size);
+        }
+
+    private:
+        template<class> friend class BasicBitArrayView;
+
+        void fill(std::uint64_t value) const {
+            for(std::size_t i = 0; i < _size; i += 64)
+                Implementation::bitStore(_data, _offset + i, _size - i < 64 ? _size - i : 64, value);
+        }
+
+        T* _data;
+        std::size_t _offset;
+        std::size_t _size;
+};
+
+/**
+@brief Const bit array view
+
+@see @ref MutableBitArrayView
+*/
+typedef BasicBitArrayView<const char> BitArrayView;
+
+/**
+@brief Mutable bit array view
+
+@see @ref BitArrayView
+*/
+typedef BasicBitArrayView<char> MutableBitArrayView;
+
+/**
+@brief Bitwise AND of two bit arrays
+
+Stores @cpp a[i] & b[i] @ce into @cpp out[i] @ce for all bits. Expects that
+all views have the same size. The output is allowed to be the same view as
+one of the inputs.
+@see @ref bitwiseOr(), @ref bitwiseXor()
+*/
+inline void bitwiseAnd(const MutableBitArrayView& out, const BitArrayView& a, const BitArrayView& b) {
+    CORRADE_ASSERT(a.size() == out.size() && b.size() == out.size(),
+        "Containers::bitwiseAnd(): expected views of the same size, got" << out.size() << Utility::Debug::nospace << "," << a.size() << "and" << b.size() << "bits", );
+    Implementation::bitwiseOperation<Implementation::BitwiseAnd>(out.data(), out.offset(), a.data(), a.offset(), b.data(), b.offset(), out.size());
+}
+
+/**
+@brief Bitwise OR of two bit arrays
+
+Stores @cpp a[i] | b[i] @ce into @cpp out[i] @ce for all bits. Expects that
+all views have the same size. The output is allowed to be the same view as
+one of the inputs.
+@see @ref bitwiseAnd(), @ref bitwiseXor()
+*/
+inline void bitwiseOr(const MutableBitArrayView& out, const BitArrayView& a, const BitArrayView& b) {
+    CORRADE_ASSERT(a.size() == out.size() && b.size() == out.size(),
+        "Containers::bitwiseOr(): expected views of the same size, got" << out.size() << Utility::Debug::nospace << "," << a.size() << "and" << b.size() << "bits", );
+    Implementation::bitwiseOperation<Implementation::BitwiseOr>(out.data(), out.offset(), a.data(), a.offset(), b.data(), b.offset(), out.size());
+}
+
+/**
+@brief Bitwise XOR of two bit arrays
+
+Stores @cpp a[i] ^ b[i] @ce into @cpp out[i] @ce for all bits. Expects that
+all views have the same size. The output is allowed to be the same view as
+one of the inputs.
+@see @ref bitwiseAnd(), @ref bitwiseOr()
+*/
+inline void bitwiseXor(const MutableBitArrayView& out, const BitArrayView& a, const BitArrayView& b) {
+    CORRADE_ASSERT(a.size() == out.size() && b.size() == out.size(),
+        "Containers::bitwiseXor(): expected views of the same size, got" << out.size() << Utility::Debug::nospace << "," << a.size() << "and" << b.size() << "bits", );
+    Implementation::bitwiseOperation<Implementation::BitwiseXor>(out.data(), out.offset(), a.data(), a.offset(), b.data(), b.offset(), out.size());
+}
+
+template<class T> BasicBitArrayView<T> BasicBitArrayView<T>::slice(const std::size_t begin, const std::size_t end) const {
+    CORRADE_ASSERT(begin <= end && end <= _size,
+        "Containers::BitArrayView::slice(): slice [" << Utility::Debug::nospace
+        << begin << Utility::Debug::nospace << ":" << Utility::Debug::nospace
+        << end << Utility::Debug::nospace << "] out of range for" << _size
+        << "bits", nullptr);
+    return BasicBitArrayView<T>{_data, _offset + begin, end - begin};
+}
+
+}}
+
+#endif
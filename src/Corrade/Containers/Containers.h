@@ -29,6 +29,7 @@
  * @brief Forward declarations for @ref Corrade::Containers namespace
  */
 
+#include <functional>
 #include <type_traits>
 
 #include "Corrade/configure.h"
@@ -38,17 +39,37 @@
 
 namespace Corrade { namespace Containers {
 
+class ArenaAllocator;
 template<class T, class = void(*)(T*, std::size_t)> class Array;
+template<class> struct ArrayNewAllocator;
+template<class> struct ArrayMallocAllocator;
 template<class> class ArrayView;
 #ifdef CORRADE_BUILD_DEPRECATED
 template<class T> using ArrayReference CORRADE_DEPRECATED_ALIAS("use ArrayView.h and ArrayView instead") = ArrayView<T>;
 #endif
+template<class> class BasicBitArrayView;
+typedef BasicBitArrayView<const char> BitArrayView;
+typedef BasicBitArrayView<char> MutableBitArrayView;
+class BitArray;
+class PackedIntArray;
+template<class Key, class Value, class = std::less<Key>> class FlatMap;
+template<class Key, class = std::less<Key>> class FlatSet;
+template<class> struct HashMapTraits;
+template<class Key, class Value, class = HashMapTraits<Key>> class HashMap;
+template<class> class MpmcQueue;
+template<std::size_t, class> class SmallArray;
+template<class> class SpscQueue;
 template<std::size_t, class> class StaticArrayView;
 template<std::size_t, class> class StaticArray;
+template<unsigned, class> class StridedDimensions;
+template<unsigned, class> class StridedArrayView;
+template<unsigned, class> class StridedIterator;
 
 template<class T, typename std::underlying_type<T>::type fullValue = typename std::underlying_type<T>::type(~0)> class EnumSet;
 template<class> class LinkedList;
 template<class Derived, class List = LinkedList<Derived>> class LinkedListItem;
+template<class> class ObjectPool;
+template<class> class PooledObject;
 
 template<class T> class Optional;
 
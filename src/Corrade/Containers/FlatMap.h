@@ -0,0 +1,430 @@
+#ifndef Corrade_Containers_FlatMap_h
+#define Corrade_Containers_FlatMap_h
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Corrade::Containers::FlatMap, @ref Corrade::Containers::FlatSet
+ */
+
+#include <algorithm>
+#include <functional>
+#include <initializer_list>
+#include <utility>
+
+#include "Corrade/Containers/Array.h"
+#include "Corrade/Containers/GrowableArray.h"
+
+namespace Corrade { namespace Containers {
+
+namespace Implementation {
+    template<class T> struct FlatSetKey {
+        static const T& get(const T& value) { return value; }
+    };
+
+    template<class Key, class Value> struct FlatMapKey {
+        static const Key& get(const std::pair<Key, Value>& value) {
+            return value.first;
+        }
+    };
+
+    /* Branchless binary search, halving the range using a conditional move
+       instead of a hard-to-predict branch */
+    template<class Projection, class Compare, class T, class Key> std::size_t flatLowerBound(const T* const data, const std::size_t size, const Key& key) {
+        if(!size) return 0;
+
+        const Compare compare{};
+        const T* base = data;
+        std::size_t n = size;
+        while(n > 1) {
+            const std::size_t half = n/2;
+            base = compare(Projection::get(base[half]), key) ? base + half : base;
+            n -= half;
+        }
+        return std::size_t(base - data) + compare(Projection::get(*base), key);
+    }
+
+    template<class Projection, class Compare, class T, class Key> std::size_t flatUpperBound(const T* const data, const std::size_t size, const Key& key) {
+        if(!size) return 0;
+
+        const Compare compare{};
+        const T* base = data;
+        std::size_t n = size;
+        while(n > 1) {
+            const std::size_t half = n/2;
+            base = !compare(key, Projection::get(base[half])) ? base + half : base;
+            n -= half;
+        }
+        return std::size_t(base - data) + !compare(key, Projection::get(*base));
+    }
+
+    /* Sorts the array and removes duplicates, keeping the first occurence
+       of each key */
+    template<class Projection, class Compare, class T> void flatSortUnique(Array<T>& data) {
+        const Compare compare{};
+        std::stable_sort(data.begin(), data.end(), [&compare](const T& a, const T& b) {
+            return compare(Projection::get(a), Projection::get(b));
+        });
+        T* const end = std::unique(data.begin(), data.end(), [&compare](const T& a, const T& b) {
+            return !compare(Projection::get(a), Projection::get(b));
+        });
+        arrayRemoveSuffix(data, std::size_t(data.end() - end));
+    }
+}
+
+/**
+@brief Sorted flat map
+@tparam Key     Key type
+@tparam Value   Value type
+@tparam Compare Key comparison function object
+
+Stores key/value pairs sorted by key in a single contiguous @ref Array. A
+lookup is a branchless binary search that touches only a logarithmic count of
+cache lines and no pointers, compared to a pointer chase through
+separately allocated nodes of @ref std::map. Insertion and removal have to
+move all entries after the affected position, so the container is meant for
+read-mostly data that's constructed once and then only queried.
+
+Usage example:
+
+@code{.cpp}
+Containers::FlatMap<std::string, int> map{Containers::InPlaceInit, {
+    {"cherry", 3},
+    {"apple", 7},
+    {"banana", 5}
+}};
+
+int* banana = map.find("banana");
+
+// All entries with keys in range ["a", "c")
+for(const std::pair<std::string, int>& entry: map.range("a", "c"))
+    Utility::Debug{} << entry.first << entry.second;
+@endcode
+
+The fastest way to construct a map from a large unsorted input is
+@ref FlatMap(Array<std::pair<Key, Value>>&&), which sorts the data once in
+place. If a key is present more than once, the first occurence wins.
+
+Keys can't be modified through the map interface as that would break the
+ordering, values are accessible through @ref find(). Growing the map through
+@ref insert() uses @ref arrayAppend() internally, so the storage grows
+geometrically.
+@see @ref FlatSet, @ref HashMap
+*/
+template<class Key, class Value, class Compare
+    #ifdef DOXYGEN_GENERATING_OUTPUT
+    = std::less<Key>
+    #endif
+> class FlatMap {
+    public:
+        /**
+         * @brief Default constructor
+         *
+         * Creates an empty map with no allocation.
+         */
+        /*implicit*/ FlatMap() noexcept = default;
+
+        /**
+         * @brief Construct from unsorted data
+         *
+         * Takes over the array, sorts it by key and removes entries with
+         * duplicate keys, keeping the first occurence. If there are no
+         * duplicates, no allocation is done.
+         */
+        explicit FlatMap(Array<std::pair<Key, Value>>&& data): _data{std::move(data)} {
+            Implementation::flatSortUnique<Projection, Compare>(_data);
+        }
+
+        /**
+         * @brief Construct from an initializer list
+         *
+         * Equivalent to calling @ref FlatMap(Array<std::pair<Key, Value>>&&)
+         * with an array created from @p list.
+         */
+        /*implicit*/ FlatMap(InPlaceInitT, std::initializer_list<std::pair<Key, Value>> list): FlatMap{Array<std::pair<Key, Value>>{InPlaceInit, list}} {}
+
+        /** @brief Count of entries in the map */
+        std::size_t size() const { return _data.size(); }
+
+        /** @brief Whether the map is empty */
+        bool empty() const { return _data.empty(); }
+
+        /** @brief All entries, sorted by key */
+        ArrayView<const std::pair<Key, Value>> entries() const { return _data; }
+
+        /** @brief Pointer to the first entry */
+        const std::pair<Key, Value>* begin() const { return _data.begin(); }
+        const std::pair<Key, Value>* cbegin() const { return _data.begin(); } /**< @overload */
+
+        /** @brief Pointer to (one item after) the last entry */
+        const std::pair<Key, Value>* end() const { return _data.end(); }
+        const std::pair<Key, Value>* cend() const { return _data.end(); } /**< @overload */
+
+        /**
+         * @brief Index of the first entry with key not less than @p key
+         *
+         * Returns @ref size() if there's no such entry.
+         */
+        std::size_t lowerBound(const Key& key) const {
+            return Implementation::flatLowerBound<Projection, Compare>(_data.data(), _data.size(), key);
+        }
+
+        /**
+         * @brief Index of the first entry with key greater than @p key
+         *
+         * Returns @ref size() if there's no such entry.
+         */
+        std::size_t upperBound(const Key& key) const {
+            return Implementation::flatUpperBound<Projection, Compare>(_data.data(), _data.size(), key);
+        }
+
+        /**
+         * @brief Find a value
+         *
+         * Returns a pointer to the value corresponding to @p key or
+         * @cpp nullptr @ce if the key isn't present.
+         */
+        Value* find(const Key& key) {
+            const std::size_t index = findIndex(key);
+            return index == _data.size() ? nullptr : &_data[index].second;
+        }
+
+        /** @overload */
+        const Value* find(const Key& key) const {
+            const std::size_t index = findIndex(key);
+            return index == _data.size() ? nullptr : &_data[index].second;
+        }
+
+        /** @brief Whether the map contains given key */
+        bool contains(const Key& key) const {
+            return findIndex(key) != _data.size();
+        }
+
+        /**
+         * @brief Entries in given key range
+         *
+         * Returns a view on all entries with keys in range
+         * @f$ [ from ; to ) @f$. If @p to is not greater than @p from,
+         * returns an empty view.
+         */
+        ArrayView<const std::pair<Key, Value>> range(const Key& from, const Key& to) const {
+            const std::size_t begin = lowerBound(from);
+            const std::size_t end = lowerBound(to);
+            return {_data.data() + begin, begin < end ? end - begin : 0};
+        }
+
+        /**
+         * @brief Insert a value
+         *
+         * If @p key is not present yet, inserts it at a position that keeps
+         * the map sorted. Returns a pointer to the value corresponding to
+         * @p key and @cpp true @ce if the entry was inserted, or
+         * @cpp false @ce if the key was already present and the map was not
+         * modified. Moves all entries after the insertion point.
+         */
+        std::pair<Value*, bool> insert(Key key, Value value) {
+            const std::size_t index = lowerBound(key);
+            if(index != _data.size() && !Compare{}(key, _data[index].first))
+                return {&_data[index].second, false};
+
+            arrayAppend(_data, InPlaceInit, std::move(key), std::move(value));
+            std::rotate(_data.begin() + index, _data.end() - 1, _data.end());
+            return {&_data[index].second, true};
+        }
+
+        /**
+         * @brief Erase an entry
+         *
+         * Returns @cpp true @ce if an entry for @p key was present,
+         * @cpp false @ce otherwise. Moves all entries after the erased one.
+         */
+        bool erase(const Key& key) {
+            const std::size_t index = findIndex(key);
+            if(index == _data.size()) return false;
+
+            std::move(_data.begin() + index + 1, _data.end(), _data.begin() + index);
+            arrayRemoveSuffix(_data);
+            return true;
+        }
+
+        /**
+         * @brief Release the underlying array
+         *
+         * Returns the sorted entries and leaves the map empty.
+         */
+        Array<std::pair<Key, Value>> release() { return std::move(_data); }
+
+    private:
+        typedef Implementation::FlatMapKey<Key, Value> Projection;
+
+        std::size_t findIndex(const Key& key) const {
+            const std::size_t index = lowerBound(key);
+            return index != _data.size() && !Compare{}(key, _data[index].first) ? index : _data.size();
+        }
+
+        Array<std::pair<Key, Value>> _data;
+};
+
+/**
+@brief Sorted flat set
+@tparam Key     Key type
+@tparam Compare Key comparison function object
+
+Stores unique keys sorted in a single contiguous @ref Array. See
+@ref FlatMap for more information, the set has the same characteristics.
+
+@code{.cpp}
+Containers::FlatSet<int> set{Containers::InPlaceInit, {5, 1, 3, 1}};
+// set.entries() == {1, 3, 5}
+
+bool hasThree = set.contains(3);
+@endcode
+
+@see @ref HashMap
+*/
+template<class Key, class Compare
+    #ifdef DOXYGEN_GENERATING_OUTPUT
+    = std::less<Key>
+    #endif
+> class FlatSet {
+    public:
+        /**
+         * @brief Default constructor
+         *
+         * Creates an empty set with no allocation.
+         */
+        /*implicit*/ FlatSet() noexcept = default;
+
+        /**
+         * @brief Construct from unsorted data
+         *
+         * Takes over the array, sorts it and removes duplicates. If there are
+         * no duplicates, no allocation is done.
+         */
+        explicit FlatSet(Array<Key>&& data): _data{std::move(data)} {
+            Implementation::flatSortUnique<Projection, Compare>(_data);
+        }
+
+        /**
+         * @brief Construct from an initializer list
+         *
+         * Equivalent to calling @ref FlatSet(Array<Key>&&) with an array
+         * created from @p list.
+         */
+        /*implicit*/ FlatSet(InPlaceInitT, std::initializer_list<Key> list): FlatSet{Array<Key>{InPlaceInit, list}} {}
+
+        /** @brief Count of keys in the set */
+        std::size_t size() const { return _data.size(); }
+
+        /** @brief Whether the set is empty */
+        bool empty() const { return _data.empty(); }
+
+        /** @brief All keys, sorted */
+        ArrayView<const Key> entries() const { return _data; }
+
+        /** @brief Pointer to the first key */
+        const Key* begin() const { return _data.begin(); }
+        const Key* cbegin() const { return _data.begin(); } /**< @overload */
+
+        /** @brief Pointer to (one item after) the last key */
+        const Key* end() const { return _data.end(); }
+        const Key* cend() const { return _data.end(); } /**< @overload */
+
+        /** @copydoc FlatMap::lowerBound() */
+        std::size_t lowerBound(const Key& key) const {
+            return Implementation::flatLowerBound<Projection, Compare>(_data.data(), _data.size(), key);
+        }
+
+        /** @copydoc FlatMap::upperBound() */
+        std::size_t upperBound(const Key& key) const {
+            return Implementation::flatUpperBound<Projection, Compare>(_data.data(), _data.size(), key);
+        }
+
+        /** @brief Whether the set contains given key */
+        bool contains(const Key& key) const {
+            const std::size_t index = lowerBound(key);
+            return index != _data.size() && !Compare{}(key, _data[index]);
+        }
+
+        /**
+         * @brief Keys in given range
+         *
+         * Returns a view on all keys in range @f$ [ from ; to ) @f$. If
+         * @p to is not greater than @p from, returns an empty view.
+         */
+        ArrayView<const Key> range(const Key& from, const Key& to) const {
+            const std::size_t begin = lowerBound(from);
+            const std::size_t end = lowerBound(to);
+            return {_data.data() + begin, begin < end ? end - begin : 0};
+        }
+
+        /**
+         * @brief Insert a key
+         *
+         * Returns @cpp true @ce if the key was inserted, @cpp false @ce if
+         * it was already present. Moves all keys after the insertion point.
+         */
+        bool insert(Key key) {
+            const std::size_t index = lowerBound(key);
+            if(index != _data.size() && !Compare{}(key, _data[index]))
+                return false;
+
+            arrayAppend(_data, std::move(key));
+            std::rotate(_data.begin() + index, _data.end() - 1, _data.end());
+            return true;
+        }
+
+        /**
+         * @brief Erase a key
+         *
+         * Returns @cpp true @ce if @p key was present, @cpp false @ce
+         * otherwise. Moves all keys after the erased one.
+         */
+        bool erase(const Key& key) {
+            const std::size_t index = lowerBound(key);
+            if(index == _data.size() || Compare{}(key, _data[index]))
+                return false;
+
+            std::move(_data.begin() + index + 1, _data.end(), _data.begin() + index);
+            arrayRemoveSuffix(_data);
+            return true;
+        }
+
+        /**
+         * @brief Release the underlying array
+         *
+         * Returns the sorted keys and leaves the set empty.
+         */
+        Array<Key> release() { return std::move(_data); }
+
+    private:
+        typedef Implementation::FlatSetKey<Key> Projection;
+
+        Array<Key> _data;
+};
+
+}}
+
+#endif
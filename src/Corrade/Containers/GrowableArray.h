@@ -0,0 +1,562 @@
+#ifndef Corrade_Containers_GrowableArray_h
+#define Corrade_Containers_GrowableArray_h
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Corrade::Containers::ArrayNewAllocator, @ref Corrade::Containers::ArrayMallocAllocator, alias @ref Corrade::Containers::ArrayAllocator, function @ref Corrade::Containers::arrayAppend(), @ref Corrade::Containers::arrayReserve(), @ref Corrade::Containers::arrayResize(), @ref Corrade::Containers::arrayRemoveSuffix(), @ref Corrade::Containers::arrayShrink(), @ref Corrade::Containers::arrayCapacity(), @ref Corrade::Containers::arrayIsGrowable()
+ */
+
+#include <cstdlib>
+#include <cstring>
+#include <initializer_list>
+#include <new>
+
+#include "Corrade/Containers/Array.h"
+#include "Corrade/Utility/TypeTraits.h"
+
+namespace Corrade { namespace Containers {
+
+namespace Implementation {
+    /* Geometric growth. Small arrays start at 16 bytes to avoid reallocating
+       on each of the first few appends. */
+    inline std::size_t arrayGrowth(std::size_t currentCapacity, std::size_t desiredCapacity, std::size_t typeSize) {
+        const std::size_t grown = currentCapacity ?
+            currentCapacity*2 : (16 + typeSize - 1)/typeSize;
+        return grown > desiredCapacity ? grown : desiredCapacity;
+    }
+
+    template<class T> inline void arrayMoveConstruct(T* src, T* dst, std::size_t count, std::true_type) {
+        /* Apparently memcpy() can't be called with null pointers, even if
+           size is zero. I call that bullying. */
+        if(count) std::memcpy(dst, src, count*sizeof(T));
+    }
+
+    template<class T> inline void arrayMoveConstruct(T* src, T* dst, std::size_t count, std::false_type) {
+        for(T* end = src + count; src != end; ++src, ++dst)
+            new(dst) T(std::move(*src));
+    }
+
+    template<class T> inline void arrayMoveConstruct(T* src, T* dst, std::size_t count) {
+        arrayMoveConstruct(src, dst, count, std::integral_constant<bool, Utility::IsTriviallyCopyable<T>::value>{});
+    }
+
+    template<class T> inline void arrayDestruct(T* begin, T* end) {
+        for(; begin != end; ++begin) begin->~T();
+    }
+}
+
+/**
+@brief New-based allocator for growable arrays
+@tparam T   Element type
+
+An @ref ArrayAllocator that allocates and deallocates memory using the C++
+@cpp new[] @ce / @cpp delete[] @ce constructs, reserving extra space in front
+of the data to store array capacity. All reallocations are done by allocating
+new memory, move-constructing the elements there and destructing the original
+elements.
+
+This allocator is chosen by default for types that are not trivially
+copyable. See @ref ArrayMallocAllocator for an alternative that makes use of
+@ref std::realloc() for trivially copyable types.
+@see @ref Containers-Array-growable
+*/
+template<class T> struct ArrayNewAllocator {
+    typedef T Type; /**< @brief Element type */
+
+    enum: std::size_t {
+        /**
+         * Offset at which the data are stored from the start of the
+         * allocation. The capacity is stored right before the data, the
+         * offset is enlarged if the type has an alignment requirement larger
+         * than @cpp sizeof(std::size_t) @ce.
+         */
+        AllocationOffset = alignof(T) > sizeof(std::size_t) ? alignof(T) : sizeof(std::size_t)
+    };
+
+    /**
+     * @brief Allocate (but not construct) an array of given capacity
+     *
+     * @cpp new[] @ce-allocates a @cpp char @ce array with an extra space to
+     * store @p capacity *before* the front, returning it cast to @cpp T* @ce.
+     */
+    static T* allocate(std::size_t capacity) {
+        char* const memory = new char[capacity*sizeof(T) + AllocationOffset];
+        reinterpret_cast<std::size_t*>(memory + AllocationOffset)[-1] = capacity;
+        return reinterpret_cast<T*>(memory + AllocationOffset);
+    }
+
+    /**
+     * @brief Reallocate an array to given capacity
+     *
+     * Calls @ref allocate(), move-constructs @p prevSize elements from
+     * @p array into the new allocation, calls destructors on the original
+     * elements, calls @ref deallocate() and updates @p array to point to the
+     * new memory.
+     */
+    static void reallocate(T*& array, std::size_t prevSize, std::size_t newCapacity) {
+        T* const newArray = allocate(newCapacity);
+        Implementation::arrayMoveConstruct<T>(array, newArray, prevSize);
+        Implementation::arrayDestruct<T>(array, array + prevSize);
+        deallocate(array);
+        array = newArray;
+    }
+
+    /**
+     * @brief Deallocate (but not destruct) an array
+     *
+     * Calls @cpp delete[] @ce on the pointer offset by
+     * @ref AllocationOffset. Does nothing if @p data is @cpp nullptr @ce.
+     */
+    static void deallocate(T* data) {
+        if(data) delete[] (reinterpret_cast<char*>(data) - AllocationOffset);
+    }
+
+    /**
+     * @brief Array capacity
+     *
+     * Retrieves the capacity stored in front of the array.
+     */
+    static std::size_t capacity(const T* array) {
+        return reinterpret_cast<const std::size_t*>(array)[-1];
+    }
+
+    /**
+     * @brief Array deleter
+     *
+     * Calls destructors on @p size elements and then delegates into
+     * @ref deallocate(). Its identity is used to recognize that an array is
+     * growable with this allocator.
+     */
+    static void deleter(T* data, std::size_t size) {
+        if(data) Implementation::arrayDestruct<T>(data, data + size);
+        deallocate(data);
+    }
+};
+
+/**
+@brief Malloc-based allocator for growable arrays
+@tparam T   Element type
+
+An @ref ArrayAllocator that allocates and deallocates memory using the C
+@ref std::malloc() / @ref std::free() constructs in order to be able to use
+@ref std::realloc() for fast reallocations. Similarly to
+@ref ArrayNewAllocator, it reserves extra space in front of the data to store
+array capacity.
+
+As the data are moved by @ref std::realloc() without calling any
+constructors, this allocator is usable only with trivially copyable types and
+is chosen by default for them.
+@see @ref Containers-Array-growable, @ref Utility::IsTriviallyCopyable
+*/
+template<class T> struct ArrayMallocAllocator {
+    static_assert(Utility::IsTriviallyCopyable<T>::value, "only trivially copyable types are usable with this allocator");
+
+    typedef T Type; /**< @brief Element type */
+
+    enum: std::size_t {
+        /** @copydoc ArrayNewAllocator::AllocationOffset */
+        AllocationOffset = alignof(T) > sizeof(std::size_t) ? alignof(T) : sizeof(std::size_t)
+    };
+
+    /**
+     * @brief Allocate an array of given capacity
+     *
+     * @ref std::malloc()'s a @cpp char @ce array with an extra space to store
+     * @p capacity *before* the front, returning it cast to @cpp T* @ce.
+     */
+    static T* allocate(std::size_t capacity) {
+        char* const memory = static_cast<char*>(std::malloc(capacity*sizeof(T) + AllocationOffset));
+        CORRADE_INTERNAL_ASSERT(memory);
+        reinterpret_cast<std::size_t*>(memory + AllocationOffset)[-1] = capacity;
+        return reinterpret_cast<T*>(memory + AllocationOffset);
+    }
+
+    /**
+     * @brief Reallocate an array to given capacity
+     *
+     * Calls @ref std::realloc() on @p array (offset by
+     * @ref AllocationOffset) and updates it to point to the new memory.
+     * As the type is trivially copyable, no constructors or destructors are
+     * called and the memory may be extended in place.
+     */
+    static void reallocate(T*& array, std::size_t, std::size_t newCapacity) {
+        char* const memory = static_cast<char*>(std::realloc(reinterpret_cast<char*>(array) - AllocationOffset, newCapacity*sizeof(T) + AllocationOffset));
+        CORRADE_INTERNAL_ASSERT(memory);
+        reinterpret_cast<std::size_t*>(memory + AllocationOffset)[-1] = newCapacity;
+        array = reinterpret_cast<T*>(memory + AllocationOffset);
+    }
+
+    /**
+     * @brief Deallocate an array
+     *
+     * Calls @ref std::free() on the pointer offset by @ref AllocationOffset.
+     * Does nothing if @p data is @cpp nullptr @ce.
+     */
+    static void deallocate(T* data) {
+        if(data) std::free(reinterpret_cast<char*>(data) - AllocationOffset);
+    }
+
+    /** @copydoc ArrayNewAllocator::capacity() */
+    static std::size_t capacity(const T* array) {
+        return reinterpret_cast<const std::size_t*>(array)[-1];
+    }
+
+    /**
+     * @brief Array deleter
+     *
+     * Since the type is trivially destructible, directly delegates into
+     * @ref deallocate(). Its identity is used to recognize that an array is
+     * growable with this allocator.
+     */
+    static void deleter(T* data, std::size_t) {
+        deallocate(data);
+    }
+};
+
+/**
+@brief Growable array allocator to use for given type
+
+Aliases to @ref ArrayMallocAllocator for trivially copyable types and to
+@ref ArrayNewAllocator otherwise. An allocator is a class with static
+@cpp allocate() @ce, @cpp reallocate() @ce, @cpp deallocate() @ce,
+@cpp capacity() @ce and @cpp deleter() @ce functions with signatures matching
+the above two classes. A custom allocator can be passed as a second template
+argument to all growable array functions.
+@see @ref Containers-Array-growable
+*/
+template<class T> using ArrayAllocator = typename std::conditional<Utility::IsTriviallyCopyable<T>::value, ArrayMallocAllocator<T>, ArrayNewAllocator<T>>::type;
+
+/**
+@brief Whether an array is growable with given allocator
+
+Returns @cpp true @ce if the array is non-empty and its deleter is
+@p Allocator's @cpp deleter() @ce, @cpp false @ce otherwise. Arrays that are
+not growable get reallocated into a growable storage on the first growing
+operation.
+@attention Since the check is done via function pointer identity, an array
+    made growable inside a shared library may not be recognized as growable
+    outside of it (and vice versa) on platforms that don't deduplicate
+    template instances across library boundaries. In that case the next
+    growing operation does a reallocation, which is slower but otherwise
+    harmless.
+*/
+template<class T, class Allocator = ArrayAllocator<T>> bool arrayIsGrowable(Array<T>& array) {
+    return array.data() && array.deleter() == Allocator::deleter;
+}
+
+/**
+@brief Array capacity
+
+For a growable array returns its capacity, for a non-growable array returns
+@ref Array::size().
+@see @ref arrayIsGrowable(), @ref arrayReserve()
+*/
+template<class T, class Allocator = ArrayAllocator<T>> std::size_t arrayCapacity(Array<T>& array) {
+    if(arrayIsGrowable<T, Allocator>(array))
+        return Allocator::capacity(array.data());
+    return array.size();
+}
+
+namespace Implementation {
+    /* Changes array size without touching the data or the deleter */
+    template<class T> inline void arraySetSize(Array<T>& array, std::size_t size) {
+        const auto deleter = array.deleter();
+        T* const data = array.release();
+        array = Array<T>{data, size, deleter};
+    }
+
+    /* Moves first `size` elements into a growable storage with given
+       capacity. The rest, if any, is destroyed together with the original
+       array. */
+    template<class T, class Allocator> void arrayReallocate(Array<T>& array, std::size_t size, std::size_t capacity) {
+        if(arrayIsGrowable<T, Allocator>(array)) {
+            CORRADE_INTERNAL_ASSERT(size == array.size());
+            T* data = array.release();
+            Allocator::reallocate(data, size, capacity);
+            array = Array<T>{data, size, Allocator::deleter};
+        } else {
+            T* const data = Allocator::allocate(capacity);
+            arrayMoveConstruct<T>(array.data(), data, size);
+            array = Array<T>{data, size, Allocator::deleter};
+        }
+    }
+
+    /* Grows the array by `count` uninitialized elements, returning pointer
+       to the first of them */
+    template<class T, class Allocator> T* arrayGrowBy(Array<T>& array, std::size_t count) {
+        const std::size_t size = array.size();
+        const std::size_t desired = size + count;
+        const std::size_t capacity = arrayCapacity<T, Allocator>(array);
+        if(desired > capacity)
+            arrayReallocate<T, Allocator>(array, size, arrayGrowth(capacity, desired, sizeof(T)));
+        arraySetSize(array, desired);
+        return array.data() + size;
+    }
+
+    /* Shrinks or enlarges the array to exactly `size` elements, the new
+       elements are left uninitialized. Returns pointer to the first of them
+       or end of the array if shrinking. */
+    template<class T, class Allocator> T* arrayResizeNoInit(Array<T>& array, std::size_t size) {
+        const std::size_t oldSize = array.size();
+        if(size < oldSize) {
+            if(arrayIsGrowable<T, Allocator>(array)) {
+                arrayDestruct<T>(array.data() + size, array.end());
+                arraySetSize(array, size);
+            } else arrayReallocate<T, Allocator>(array, size, size);
+        } else if(size > oldSize) {
+            if(arrayCapacity<T, Allocator>(array) < size)
+                arrayReallocate<T, Allocator>(array, oldSize, size);
+            arraySetSize(array, size);
+        }
+        return array.data() + oldSize;
+    }
+}
+
+/**
+@brief Reserve given capacity in an array
+@return New capacity of the array
+
+If current capacity is already large enough, the function returns the current
+capacity and doesn't touch the array, otherwise the array is reallocated
+(made growable if it wasn't already) to exactly @p capacity elements, and the
+existing contents are moved there. The array size stays the same.
+@see @ref arrayCapacity(), @ref arrayResize(), @ref arrayAppend()
+*/
+template<class T, class Allocator = ArrayAllocator<T>> std::size_t arrayReserve(Array<T>& array, std::size_t capacity) {
+    const std::size_t currentCapacity = arrayCapacity<T, Allocator>(array);
+    if(currentCapacity >= capacity) return currentCapacity;
+
+    Implementation::arrayReallocate<T, Allocator>(array, array.size(), capacity);
+    return capacity;
+}
+
+/**
+@brief Resize an array to given size, leaving new elements uninitialized
+
+If the array is growable and @p size is not larger than its capacity, the
+operation is done in-place. Otherwise the array is reallocated (made growable
+if it wasn't already) to exactly @p size elements and existing contents moved
+there. If the array shrinks, excessive elements are destructed. New elements
+are not constructed, use placement new to initialize them.
+@see @ref arrayReserve(), @ref arrayAppend(Array<T>&, NoInitT, std::size_t)
+*/
+template<class T, class Allocator = ArrayAllocator<T>> void arrayResize(Array<T>& array, NoInitT, std::size_t size) {
+    Implementation::arrayResizeNoInit<T, Allocator>(array, size);
+}
+
+/**
+@brief Resize an array to given size, default-initializing new elements
+
+Same as @ref arrayResize(Array<T>&, NoInitT, std::size_t), but new elements
+are default-initialized (i.e., trivial types are not initialized and default
+constructor is called otherwise).
+*/
+template<class T, class Allocator = ArrayAllocator<T>> void arrayResize(Array<T>& array, DefaultInitT, std::size_t size) {
+    const std::size_t oldSize = array.size();
+    T* const it = Implementation::arrayResizeNoInit<T, Allocator>(array, size);
+    if(size > oldSize) for(T *i = it, *end = array.end(); i != end; ++i)
+        new(i) T;
+}
+
+/**
+@brief Resize an array to given size, value-initializing new elements
+
+Same as @ref arrayResize(Array<T>&, NoInitT, std::size_t), but new elements
+are value-initialized (i.e., trivial types are zero-initialized and default
+constructor is called otherwise).
+*/
+template<class T, class Allocator = ArrayAllocator<T>> void arrayResize(Array<T>& array, ValueInitT, std::size_t size) {
+    const std::size_t oldSize = array.size();
+    T* const it = Implementation::arrayResizeNoInit<T, Allocator>(array, size);
+    if(size > oldSize) for(T *i = it, *end = array.end(); i != end; ++i)
+        new(i) T();
+}
+
+/**
+@brief Resize an array to given size, constructing new elements using provided arguments
+
+Same as @ref arrayResize(Array<T>&, NoInitT, std::size_t), but new elements
+are constructed using placement new with forwarded @p args.
+*/
+template<class T, class Allocator = ArrayAllocator<T>, class ...Args> void arrayResize(Array<T>& array, DirectInitT, std::size_t size, Args&&... args) {
+    const std::size_t oldSize = array.size();
+    T* const it = Implementation::arrayResizeNoInit<T, Allocator>(array, size);
+    if(size > oldSize) for(T *i = it, *end = array.end(); i != end; ++i)
+        new(i) T{std::forward<Args>(args)...};
+}
+
+/**
+@brief Resize an array to given size
+
+Alias to @ref arrayResize(Array<T>&, DefaultInitT, std::size_t).
+*/
+template<class T, class Allocator = ArrayAllocator<T>> void arrayResize(Array<T>& array, std::size_t size) {
+    arrayResize<T, Allocator>(array, DefaultInit, size);
+}
+
+/**
+@brief Append given number of uninitialized values to an array
+@return View on the newly appended items
+
+If the array is growable and has enough capacity, the operation is done
+in-place. Otherwise the array is reallocated (made growable if it wasn't
+already) with capacity growing geometrically to ensure amortized constant
+complexity of the append operations. New elements are not constructed, use
+placement new to initialize them.
+@see @ref arrayResize(Array<T>&, NoInitT, std::size_t)
+*/
+template<class T, class Allocator = ArrayAllocator<T>> ArrayView<T> arrayAppend(Array<T>& array, NoInitT, std::size_t count) {
+    return {Implementation::arrayGrowBy<T, Allocator>(array, count), count};
+}
+
+/**
+@brief Copy-append an item to an array
+@return Reference to the newly appended item
+
+Grows the array the same way as @ref arrayAppend(Array<T>&, NoInitT, std::size_t)
+and then copy-constructs the new item. The @p value is allowed to reference an
+item in @p array.
+*/
+template<class T, class Allocator = ArrayAllocator<T>> T& arrayAppend(Array<T>& array, const typename std::common_type<T>::type& value) {
+    /* If the value is in the array itself, it would be dangling after a
+       reallocation, so copy it first */
+    if(&value >= array.begin() && &value < array.end()) {
+        T copy(value);
+        T* const it = Implementation::arrayGrowBy<T, Allocator>(array, 1);
+        new(it) T(std::move(copy));
+        return *it;
+    }
+
+    T* const it = Implementation::arrayGrowBy<T, Allocator>(array, 1);
+    new(it) T(value);
+    return *it;
+}
+
+/**
+@brief Move-append an item to an array
+@return Reference to the newly appended item
+
+Grows the array the same way as @ref arrayAppend(Array<T>&, NoInitT, std::size_t)
+and then move-constructs the new item. The @p value is allowed to reference an
+item in @p array.
+*/
+template<class T, class Allocator = ArrayAllocator<T>> T& arrayAppend(Array<T>& array, typename std::common_type<T>::type&& value) {
+    if(&value >= array.begin() && &value < array.end()) {
+        T copy(std::move(value));
+        T* const it = Implementation::arrayGrowBy<T, Allocator>(array, 1);
+        new(it) T(std::move(copy));
+        return *it;
+    }
+
+    T* const it = Implementation::arrayGrowBy<T, Allocator>(array, 1);
+    new(it) T(std::move(value));
+    return *it;
+}
+
+/**
+@brief In-place append an item to an array
+@return Reference to the newly appended item
+
+Grows the array the same way as @ref arrayAppend(Array<T>&, NoInitT, std::size_t)
+and then constructs the new item using placement new with forwarded @p args.
+Unlike with @ref arrayAppend(Array<T>&, const typename std::common_type<T>::type&),
+the arguments are *not* allowed to reference items in @p array.
+*/
+template<class T, class Allocator = ArrayAllocator<T>, class ...Args> T& arrayAppend(Array<T>& array, InPlaceInitT, Args&&... args) {
+    T* const it = Implementation::arrayGrowBy<T, Allocator>(array, 1);
+    new(it) T{std::forward<Args>(args)...};
+    return *it;
+}
+
+/**
+@brief Copy-append a list of items to an array
+@return View on the newly appended items
+
+Grows the array the same way as @ref arrayAppend(Array<T>&, NoInitT, std::size_t)
+and then copy-constructs the new items. The @p values are allowed to reference
+items in @p array.
+*/
+template<class T, class Allocator = ArrayAllocator<T>> ArrayView<T> arrayAppend(Array<T>& array, typename std::common_type<ArrayView<const T>>::type values) {
+    const std::size_t count = values.size();
+
+    /* If the values are in the array itself, they would be dangling after a
+       reallocation, so remember their position and refresh the pointer */
+    const T* src = values.data();
+    const bool aliased = src >= array.begin() && src < array.end();
+    const std::size_t offset = aliased ? src - array.begin() : 0;
+    if(aliased && array.size() + count > arrayCapacity<T, Allocator>(array)) {
+        arrayReserve<T, Allocator>(array, Implementation::arrayGrowth(arrayCapacity<T, Allocator>(array), array.size() + count, sizeof(T)));
+        src = array.data() + offset;
+    }
+
+    T* const it = Implementation::arrayGrowBy<T, Allocator>(array, count);
+    for(std::size_t i = 0; i != count; ++i)
+        new(it + i) T(src[i]);
+    return {it, count};
+}
+
+/** @overload */
+template<class T, class Allocator = ArrayAllocator<T>> ArrayView<T> arrayAppend(Array<T>& array, std::initializer_list<typename std::common_type<T>::type> values) {
+    return arrayAppend<T, Allocator>(array, ArrayView<const T>{values.begin(), values.size()});
+}
+
+/**
+@brief Remove a suffix from an array
+
+Expects that @p count is not larger than @ref Array::size(). If the array is
+growable, the trailing elements are destructed and the operation is done
+in-place, without reallocating. Otherwise the remaining elements are moved to
+a new growable allocation of exactly the remaining size.
+@see @ref arrayShrink()
+*/
+template<class T, class Allocator = ArrayAllocator<T>> void arrayRemoveSuffix(Array<T>& array, std::size_t count = 1) {
+    CORRADE_ASSERT(count <= array.size(),
+        "Containers::arrayRemoveSuffix(): can't remove" << count << "elements from an array of size" << array.size(), );
+    if(!count) return;
+
+    Implementation::arrayResizeNoInit<T, Allocator>(array, array.size() - count);
+}
+
+/**
+@brief Convert an array back to non-growable
+
+If the array is growable, allocates a new array of exactly @ref Array::size()
+elements the same way as @ref Array::Array(NoInitT, std::size_t) would, moves
+the contents there and frees the original allocation. This is useful when the
+array is passed to code that expects the default deleter or when excessive
+capacity should be released. If the array is not growable, does nothing.
+*/
+template<class T, class Allocator = ArrayAllocator<T>> void arrayShrink(Array<T>& array) {
+    if(!arrayIsGrowable<T, Allocator>(array)) return;
+
+    Array<T> newArray{NoInit, array.size()};
+    Implementation::arrayMoveConstruct<T>(array.data(), newArray.data(), array.size());
+    array = std::move(newArray);
+}
+
+}}
+
+#endif
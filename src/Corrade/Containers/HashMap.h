@@ -0,0 +1,720 @@
+#ifndef Corrade_Containers_HashMap_h
+#define Corrade_Containers_HashMap_h
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Corrade::Containers::HashMap, @ref Corrade::Containers::HashMapTraits
+ */
+
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <new>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include "Corrade/configure.h"
+#include "Corrade/Containers/ArrayView.h"
+#include "Corrade/Containers/Containers.h"
+#include "Corrade/Containers/Tags.h"
+#include "Corrade/Utility/Endianness.h"
+#include "Corrade/Utility/TypeTraits.h"
+
+#ifdef CORRADE_TARGET_SSE2
+#include <emmintrin.h>
+#endif
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+
+namespace Corrade { namespace Containers {
+
+namespace Implementation {
+    /* Control byte values. Full slots have the highest bit cleared and store
+       the lowest 7 bits of the hash, the special values have it set. */
+    enum: std::int8_t {
+        HashMapEmpty = -128,    /* 0b10000000 */
+        HashMapDeleted = -2     /* 0b11111110 */
+    };
+
+    /* Finalizer from MurmurHash3, makes every input bit affect every output
+       bit. Needed because the map uses the lowest bits of the hash for
+       in-group matching and the upper bits for selecting the group. */
+    inline std::uint64_t hashMapMix(std::uint64_t value) {
+        value ^= value >> 33;
+        value *= 0xff51afd7ed558ccdull;
+        value ^= value >> 33;
+        value *= 0xc4ceb9fe1a85ec53ull;
+        value ^= value >> 33;
+        return value;
+    }
+
+    /* Processes eight bytes at a time, the result is not portable across
+       platforms of different endianness, but it doesn't need to be */
+    inline std::uint64_t hashMapBytes(const char* data, std::size_t size) {
+        constexpr std::uint64_t multiplier = 0x9e3779b97f4a7c15ull;
+        std::uint64_t hash = multiplier ^ size;
+        for(; size >= 8; data += 8, size -= 8) {
+            std::uint64_t chunk;
+            std::memcpy(&chunk, data, 8);
+            hash = (hash ^ chunk)*multiplier;
+            hash ^= hash >> 29;
+        }
+        if(size) {
+            std::uint64_t chunk = 0;
+            std::memcpy(&chunk, data, size);
+            hash = (hash ^ chunk)*multiplier;
+        }
+        return hashMapMix(hash);
+    }
+
+    inline std::size_t hashMapCountTrailingZeros(std::uint64_t value) {
+        #if defined(__GNUC__) || defined(__clang__)
+        return __builtin_ctzll(value);
+        #elif defined(_MSC_VER) && defined(_WIN64)
+        unsigned long index;
+        _BitScanForward64(&index, value);
+        return index;
+        #elif defined(_MSC_VER)
+        unsigned long index;
+        if(_BitScanForward(&index, std::uint32_t(value))) return index;
+        _BitScanForward(&index, std::uint32_t(value >> 32));
+        return index + 32;
+        #else
+        std::size_t index = 0;
+        for(; !(value & 1); value >>= 1) ++index;
+        return index;
+        #endif
+    }
+
+    /* Set of slots in a group that matched a query. With SSE2 there's one bit
+       per slot, with the SWAR fallback it's the highest bit of every byte,
+       hence the shift. */
+    template<std::size_t shift> class HashMapBitMask {
+        public:
+            explicit HashMapBitMask(std::uint64_t mask): _mask{mask} {}
+
+            explicit operator bool() const { return _mask; }
+
+            std::size_t lowest() const {
+                return hashMapCountTrailingZeros(_mask) >> shift;
+            }
+
+            void clearLowest() { _mask &= _mask - 1; }
+
+        private:
+            std::uint64_t _mask;
+    };
+
+    #ifdef CORRADE_TARGET_SSE2
+    class HashMapGroup {
+        public:
+            enum: std::size_t { Width = 16 };
+
+            typedef HashMapBitMask<0> BitMask;
+
+            explicit HashMapGroup(const std::int8_t* control): _control{_mm_loadu_si128(reinterpret_cast<const __m128i*>(control))} {}
+
+            BitMask match(std::int8_t hash) const {
+                return BitMask{std::uint32_t(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(hash), _control)))};
+            }
+
+            BitMask matchEmpty() const { return match(HashMapEmpty); }
+
+            BitMask matchEmptyOrDeleted() const {
+                return BitMask{std::uint32_t(_mm_movemask_epi8(_control))};
+            }
+
+        private:
+            __m128i _control;
+    };
+    #else
+    class HashMapGroup {
+        public:
+            enum: std::size_t { Width = 8 };
+
+            typedef HashMapBitMask<3> BitMask;
+
+            explicit HashMapGroup(const std::int8_t* control) {
+                std::memcpy(&_control, control, 8);
+                _control = Utility::Endianness::littleEndian(_control);
+            }
+
+            /* May report a false positive for a byte directly following a
+               real match, which is harmless as the keys get compared anyway */
+            BitMask match(std::int8_t hash) const {
+                const std::uint64_t x = _control ^ (Lsbs*std::uint8_t(hash));
+                return BitMask{(x - Lsbs) & ~x & Msbs};
+            }
+
+            /* Empty is the only special value that has the highest bit set
+               and the second-lowest bit cleared */
+            BitMask matchEmpty() const {
+                return BitMask{_control & ~(_control << 6) & Msbs};
+            }
+
+            BitMask matchEmptyOrDeleted() const {
+                return BitMask{_control & Msbs};
+            }
+
+        private:
+            enum: std::uint64_t {
+                Lsbs = 0x0101010101010101ull,
+                Msbs = 0x8080808080808080ull
+            };
+
+            std::uint64_t _control;
+    };
+    #endif
+
+    /* Converts a heterogeneous key to the stored key type using
+       Traits::key() if the traits provide a matching overload, otherwise
+       the key is passed to the Key constructor as-is */
+    template<class Traits, class K> auto hashMapKey(K&& key, int) -> decltype(Traits::key(std::forward<K>(key))) {
+        return Traits::key(std::forward<K>(key));
+    }
+    template<class Traits, class K> K&& hashMapKey(K&& key, ...) {
+        return std::forward<K>(key);
+    }
+}
+
+/**
+@brief Hash map traits
+@tparam Key     Key type
+
+Provides hashing and comparison for @ref HashMap keys. The default
+implementation handles all integer and enum types, specializations are
+provided for pointers and @ref std::string. Specialize the class for other key
+types. The @cpp hash() @ce function is expected to return a well-distributed
+64-bit value --- all bits of the result are used.
+
+Additional overloads of @cpp hash() @ce and @cpp equal() @ce can be added to
+allow heterogeneous lookup, i.e. looking up a key without having to construct
+the full @p Key type. The @ref std::string specialization uses that to accept
+@ref ArrayView "ArrayView<const char>" and plain C strings.
+
+If a heterogeneous key can't be used to construct @p Key directly or the
+conversion wouldn't preserve the data the hash was calculated from, provide
+also a @cpp key() @ce overload returning @p Key for it. It's used by
+@ref HashMap::emplace() and @ref HashMap::operator[]() when inserting a new
+entry, keys for which no @cpp key() @ce overload exists are passed to the
+@p Key constructor directly.
+*/
+template<class Key> struct HashMapTraits {
+    static_assert(std::is_integral<Key>::value || std::is_enum<Key>::value,
+        "HashMapTraits needs to be specialized for this key type");
+
+    /** @brief Hash a key */
+    static std::uint64_t hash(Key key) {
+        return Implementation::hashMapMix(std::uint64_t(key));
+    }
+
+    /** @brief Compare two keys */
+    static bool equal(Key a, Key b) { return a == b; }
+};
+
+/**
+@brief Hash map traits for pointers
+
+Hashes the pointer value, not the pointed-to data.
+*/
+template<class T> struct HashMapTraits<T*> {
+    /** @brief Hash a key */
+    static std::uint64_t hash(T* key) {
+        return Implementation::hashMapMix(reinterpret_cast<std::uintptr_t>(key));
+    }
+
+    /** @brief Compare two keys */
+    static bool equal(T* a, T* b) { return a == b; }
+};
+
+/**
+@brief Hash map traits for strings
+
+Allows lookup using @ref ArrayView "ArrayView<const char>" and
+@cpp const char* @ce, so a @ref std::string doesn't need to be allocated just
+for a lookup. All overloads produce the same hash for the same character data.
+*/
+template<> struct HashMapTraits<std::string> {
+    /** @brief Hash a key */
+    static std::uint64_t hash(const std::string& key) {
+        return Implementation::hashMapBytes(key.data(), key.size());
+    }
+
+    /** @overload */
+    static std::uint64_t hash(ArrayView<const char> key) {
+        return Implementation::hashMapBytes(key.data(), key.size());
+    }
+
+    /** @overload */
+    static std::uint64_t hash(const char* key) {
+        return Implementation::hashMapBytes(key, std::strlen(key));
+    }
+
+    /** @brief Compare two keys */
+    static bool equal(const std::string& a, const std::string& b) {
+        return a == b;
+    }
+
+    /** @overload */
+    static bool equal(const std::string& a, ArrayView<const char> b) {
+        return a.size() == b.size() && (b.empty() || std::memcmp(a.data(), b.data(), b.size()) == 0);
+    }
+
+    /** @overload */
+    static bool equal(const std::string& a, const char* b) {
+        return a == b;
+    }
+
+    /**
+     * @brief Convert a heterogeneous key to a key
+     *
+     * Constructs the string from the view data and size, as going through
+     * the implicit pointer conversion would read past the end of the view.
+     */
+    static std::string key(ArrayView<const char> key) {
+        return std::string{key.data(), key.size()};
+    }
+
+    /** @overload */
+    static std::string key(const char* key) {
+        return std::string{key};
+    }
+};
+
+/**
+@brief Open-addressing hash map
+@tparam Key     Key type
+@tparam Value   Value type
+@tparam Traits  Hashing and comparison traits
+
+Unlike @ref std::map or @ref std::unordered_map, which allocate every entry
+separately, all entries are stored in a single contiguous allocation together
+with an array of one-byte control values. The control byte of every occupied
+slot stores seven bits of the key hash, so a lookup first compares a whole
+group of control bytes at once --- using SSE2 if
+@ref CORRADE_TARGET_SSE2 is defined and eight bytes at a time in a plain
+64-bit integer otherwise --- and only compares keys for which the hash bits
+match. The map grows by doubling its capacity once it's @f$ \frac{7}{8} @f$
+full.
+
+Usage example:
+
+@code{.cpp}
+Containers::HashMap<std::string, int> map;
+map.insert("apple", 3);
+map["banana"] = 5;
+
+// Lookup doesn't need to allocate a std::string
+if(int* apples = map.find(Containers::ArrayView<const char>{"apple", 5}))
+    *apples += 1;
+
+for(auto& entry: map)
+    Utility::Debug{} << entry.key() << entry.value();
+@endcode
+
+Iteration order is unspecified. Inserting into the map may move the existing
+entries, which invalidates all pointers and iterators to them. Erasing doesn't
+move anything, it invalidates only pointers to the erased entry. The class is
+move-only.
+
+Lookup functions are templated on the key type and pass it to
+@ref HashMapTraits::hash() and @ref HashMapTraits::equal(), see the traits
+documentation for information about heterogeneous lookup.
+@see @ref ArrayView, @ref Array
+*/
+template<class Key, class Value, class Traits
+    #ifdef DOXYGEN_GENERATING_OUTPUT
+    = HashMapTraits<Key>
+    #endif
+> class HashMap {
+    public:
+        /** @brief Map entry */
+        class Entry {
+            public:
+                /** @brief Key */
+                const Key& key() const { return _key; }
+
+                /** @brief Value */
+                Value& value() { return _value; }
+                const Value& value() const { return _value; } /**< @overload */
+
+            private:
+                friend HashMap;
+
+                template<class K, class ...Args> explicit Entry(K&& key, Args&&... args): _key(std::forward<K>(key)), _value(std::forward<Args>(args)...) {}
+
+                Key _key;
+                Value _value;
+        };
+
+        #ifndef DOXYGEN_GENERATING_OUTPUT
+        template<class T> class IteratorImplementation;
+        #endif
+
+        /** @brief Iterator */
+        typedef IteratorImplementation<Entry> Iterator;
+
+        /** @brief Const iterator */
+        typedef IteratorImplementation<const Entry> ConstIterator;
+
+        /**
+         * @brief Default constructor
+         *
+         * Creates an empty map with no allocation.
+         */
+        /*implicit*/ HashMap() noexcept: _control{}, _entries{}, _capacity{}, _size{}, _growthLeft{} {}
+
+        /**
+         * @brief Construct a map with reserved capacity
+         *
+         * Equivalent to calling @ref reserve() on a default-constructed map.
+         */
+        explicit HashMap(std::size_t capacity): HashMap{} { reserve(capacity); }
+
+        /**
+         * @brief Construct a map from a list of key/value pairs
+         *
+         * If a key is present more than once, the first occurence wins.
+         */
+        /*implicit*/ HashMap(InPlaceInitT, std::initializer_list<std::pair<Key, Value>> list): HashMap{list.size()} {
+            for(const std::pair<Key, Value>& i: list) emplace(i.first, i.second);
+        }
+
+        /** @brief Copying is not allowed */
+        HashMap(const HashMap<Key, Value, Traits>&) = delete;
+
+        /** @brief Move constructor */
+        HashMap(HashMap<Key, Value, Traits>&& other) noexcept: HashMap{} {
+            swap(other);
+        }
+
+        /** @brief Copying is not allowed */
+        HashMap<Key, Value, Traits>& operator=(const HashMap<Key, Value, Traits>&) = delete;
+
+        /** @brief Move assignment */
+        HashMap<Key, Value, Traits>& operator=(HashMap<Key, Value, Traits>&& other) noexcept {
+            swap(other);
+            return *this;
+        }
+
+        ~HashMap() {
+            destructEntries();
+            deallocate();
+        }
+
+        /** @brief Count of entries in the map */
+        std::size_t size() const { return _size; }
+
+        /** @brief Whether the map is empty */
+        bool empty() const { return !_size; }
+
+        /**
+         * @brief Count of allocated slots
+         *
+         * Always either zero or a power of two. At most
+         * @f$ \frac{7}{8} @f$ of the slots can be occupied.
+         */
+        std::size_t capacity() const { return _capacity; }
+
+        /**
+         * @brief Find a value
+         *
+         * Returns a pointer to the value corresponding to @p key or
+         * @cpp nullptr @ce if the key isn't present.
+         */
+        template<class K> Value* find(const K& key) {
+            const std::size_t index = findIndex(key, Traits::hash(key));
+            return index == NotFound ? nullptr : &_entries[index]._value;
+        }
+
+        /** @overload */
+        template<class K> const Value* find(const K& key) const {
+            const std::size_t index = findIndex(key, Traits::hash(key));
+            return index == NotFound ? nullptr : &_entries[index]._value;
+        }
+
+        /** @brief Whether the map contains given key */
+        template<class K> bool contains(const K& key) const {
+            return findIndex(key, Traits::hash(key)) != NotFound;
+        }
+
+        /**
+         * @brief Construct a value in place
+         *
+         * If @p key is not present yet, constructs a new entry from @p key
+         * and @p args. Returns a pointer to the value corresponding to
+         * @p key and @cpp true @ce if the entry was inserted, or
+         * @cpp false @ce if the key was already present and the map was not
+         * modified. The key is converted using @cpp Traits::key() @ce, if
+         * the traits provide an overload for @p K, see @ref HashMapTraits
+         * for more information.
+         */
+        template<class K, class ...Args> std::pair<Value*, bool> emplace(K&& key, Args&&... args);
+
+        /**
+         * @brief Insert a value
+         *
+         * Equivalent to calling @ref emplace() with @p key and @p value.
+         */
+        std::pair<Value*, bool> insert(Key key, Value value) {
+            return emplace(std::move(key), std::move(value));
+        }
+
+        /**
+         * @brief Value corresponding to given key
+         *
+         * If the key is not present yet, inserts a default-constructed value.
+         */
+        template<class K> Value& operator[](K&& key) {
+            return *emplace(std::forward<K>(key)).first;
+        }
+
+        /**
+         * @brief Erase an entry
+         *
+         * Returns @cpp true @ce if an entry for @p key was present,
+         * @cpp false @ce otherwise. Doesn't shrink the allocation.
+         */
+        template<class K> bool erase(const K& key);
+
+        /**
+         * @brief Erase all entries
+         *
+         * Keeps the allocated capacity.
+         */
+        void clear();
+
+        /**
+         * @brief Reserve capacity for given count of entries
+         *
+         * If @p size entries don't fit into current capacity, reallocates
+         * the map to a capacity that can hold them without further
+         * reallocations. Otherwise does nothing.
+         */
+        void reserve(std::size_t size) {
+            const std::size_t capacity = capacityFor(size);
+            if(capacity > _capacity) rehash(capacity);
+        }
+
+        /** @brief Swap with another map */
+        void swap(HashMap<Key, Value, Traits>& other) noexcept {
+            std::swap(_control, other._control);
+            std::swap(_entries, other._entries);
+            std::swap(_capacity, other._capacity);
+            std::swap(_size, other._size);
+            std::swap(_growthLeft, other._growthLeft);
+        }
+
+        /** @brief Iterator to the first entry */
+        Iterator begin() { return Iterator{_control, _entries, 0, _capacity}; }
+        ConstIterator begin() const { return ConstIterator{_control, _entries, 0, _capacity}; } /**< @overload */
+        ConstIterator cbegin() const { return begin(); } /**< @overload */
+
+        /** @brief Iterator to (one item after) the last entry */
+        Iterator end() { return Iterator{_control, _entries, _capacity, _capacity}; }
+        ConstIterator end() const { return ConstIterator{_control, _entries, _capacity, _capacity}; } /**< @overload */
+        ConstIterator cend() const { return end(); } /**< @overload */
+
+    private:
+        typedef Implementation::HashMapGroup Group;
+
+        enum: std::size_t { NotFound = ~std::size_t{} };
+
+        static std::size_t maxLoad(std::size_t capacity) {
+            return capacity - capacity/8;
+        }
+
+        static std::size_t capacityFor(std::size_t size) {
+            if(!size) return 0;
+            std::size_t capacity = Group::Width;
+            while(maxLoad(capacity) < size) capacity *= 2;
+            return capacity;
+        }
+
+        /* Triangular probing over a power-of-two group count visits every
+           group exactly once. There's always at least one empty slot so the
+           loops terminate. */
+        template<class K> std::size_t findIndex(const K& key, std::uint64_t hash) const {
+            if(!_capacity) return NotFound;
+
+            const std::int8_t h2 = std::int8_t(hash & 0x7f);
+            const std::size_t groupMask = _capacity/Group::Width - 1;
+            std::size_t group = (hash >> 7) & groupMask;
+            for(std::size_t i = 1; ; ++i) {
+                const Group g{_control + group*Group::Width};
+                for(auto match = g.match(h2); match; match.clearLowest()) {
+                    const std::size_t index = group*Group::Width + match.lowest();
+                    if(Traits::equal(_entries[index]._key, key)) return index;
+                }
+                if(g.matchEmpty()) return NotFound;
+                group = (group + i) & groupMask;
+            }
+        }
+
+        std::size_t findInsertIndex(std::uint64_t hash) const {
+            const std::size_t groupMask = _capacity/Group::Width - 1;
+            std::size_t group = (hash >> 7) & groupMask;
+            for(std::size_t i = 1; ; ++i) {
+                const auto match = Group{_control + group*Group::Width}.matchEmptyOrDeleted();
+                if(match) return group*Group::Width + match.lowest();
+                group = (group + i) & groupMask;
+            }
+        }
+
+        void rehash(std::size_t capacity);
+        void destructEntries();
+        void deallocate() {
+            delete[] reinterpret_cast<char*>(_entries);
+        }
+
+        std::int8_t* _control;
+        Entry* _entries;
+        std::size_t _capacity, _size, _growthLeft;
+};
+
+#ifndef DOXYGEN_GENERATING_OUTPUT
+template<class Key, class Value, class Traits> template<class T> class HashMap<Key, Value, Traits>::IteratorImplementation {
+    public:
+        T& operator*() const { return _entries[_i]; }
+        T* operator->() const { return _entries + _i; }
+
+        IteratorImplementation<T>& operator++() {
+            ++_i;
+            skipEmpty();
+            return *this;
+        }
+
+        bool operator==(const IteratorImplementation<T>& other) const {
+            return _i == other._i;
+        }
+
+        bool operator!=(const IteratorImplementation<T>& other) const {
+            return _i != other._i;
+        }
+
+    private:
+        friend HashMap<Key, Value, Traits>;
+
+        explicit IteratorImplementation(const std::int8_t* control, T* entries, std::size_t i, std::size_t capacity): _control{control}, _entries{entries}, _i{i}, _capacity{capacity} {
+            skipEmpty();
+        }
+
+        void skipEmpty() {
+            while(_i != _capacity && _control[_i] < 0) ++_i;
+        }
+
+        const std::int8_t* _control;
+        T* _entries;
+        std::size_t _i, _capacity;
+};
+
+template<class Key, class Value, class Traits> template<class K, class ...Args> std::pair<Value*, bool> HashMap<Key, Value, Traits>::emplace(K&& key, Args&&... args) {
+    const std::uint64_t hash = Traits::hash(key);
+    std::size_t index = findIndex(key, hash);
+    if(index != NotFound) return {&_entries[index]._value, false};
+
+    /* Taking over a deleted slot doesn't need any growth budget, an empty
+       slot does. If there's no budget left, either grow or, if a large
+       enough part of the budget was eaten by deleted slots, only rehash in
+       place to get rid of them. */
+    if(!_capacity) rehash(Group::Width);
+    index = findInsertIndex(hash);
+    if(!_growthLeft && _control[index] != Implementation::HashMapDeleted) {
+        rehash(_size*32 <= _capacity*25 ? _capacity : _capacity*2);
+        index = findInsertIndex(hash);
+    }
+
+    new(_entries + index) Entry{Implementation::hashMapKey<Traits>(std::forward<K>(key), 0), std::forward<Args>(args)...};
+    if(_control[index] == Implementation::HashMapEmpty) --_growthLeft;
+    _control[index] = std::int8_t(hash & 0x7f);
+    ++_size;
+    return {&_entries[index]._value, true};
+}
+
+template<class Key, class Value, class Traits> template<class K> bool HashMap<Key, Value, Traits>::erase(const K& key) {
+    const std::size_t index = findIndex(key, Traits::hash(key));
+    if(index == NotFound) return false;
+
+    _entries[index].~Entry();
+    --_size;
+
+    /* If the group still has an empty slot, no probe sequence could have
+       continued past it and the slot can be marked as empty again.
+       Otherwise it has to be a tombstone so lookups don't stop here. */
+    if(Group{_control + index/Group::Width*Group::Width}.matchEmpty()) {
+        _control[index] = Implementation::HashMapEmpty;
+        ++_growthLeft;
+    } else _control[index] = Implementation::HashMapDeleted;
+
+    return true;
+}
+
+template<class Key, class Value, class Traits> void HashMap<Key, Value, Traits>::clear() {
+    destructEntries();
+    if(_capacity) std::memset(_control, Implementation::HashMapEmpty, _capacity);
+    _size = 0;
+    _growthLeft = maxLoad(_capacity);
+}
+
+template<class Key, class Value, class Traits> void HashMap<Key, Value, Traits>::rehash(const std::size_t capacity) {
+    std::int8_t* const oldControl = _control;
+    Entry* const oldEntries = _entries;
+    const std::size_t oldCapacity = _capacity;
+
+    /* Entries and control bytes share a single allocation, entries first so
+       they're suitably aligned */
+    char* const memory = new char[capacity*sizeof(Entry) + capacity];
+    _entries = reinterpret_cast<Entry*>(memory);
+    _control = reinterpret_cast<std::int8_t*>(memory + capacity*sizeof(Entry));
+    _capacity = capacity;
+    _growthLeft = maxLoad(capacity) - _size;
+    std::memset(_control, Implementation::HashMapEmpty, capacity);
+
+    for(std::size_t i = 0; i != oldCapacity; ++i) {
+        if(oldControl[i] < 0) continue;
+
+        const std::uint64_t hash = Traits::hash(oldEntries[i]._key);
+        const std::size_t index = findInsertIndex(hash);
+        new(_entries + index) Entry(std::move(oldEntries[i]));
+        oldEntries[i].~Entry();
+        _control[index] = std::int8_t(hash & 0x7f);
+    }
+
+    delete[] reinterpret_cast<char*>(oldEntries);
+}
+
+template<class Key, class Value, class Traits> void HashMap<Key, Value, Traits>::destructEntries() {
+    if(Utility::IsTriviallyDestructible<Entry>::value) return;
+    for(std::size_t i = 0; i != _capacity; ++i)
+        if(_control[i] >= 0) _entries[i].~Entry();
+}
+#endif
+
+}}
+
+#endif
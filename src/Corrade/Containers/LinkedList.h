@@ -103,6 +103,14 @@ class Object: public LinkedListItem<Object, ObjectGroup> {
 };
 @endcode
 
+@section Containers-LinkedList-pool-allocation Pool allocation
+
+Items are usually allocated one by one on the heap, which scatters them
+around memory and makes list traversal cache-hostile. Deriving the item from
+@ref PooledObject makes them allocated from contiguous slabs of an
+@ref ObjectPool instead, with @ref erase() and @ref clear() returning them to
+the pool. See @ref Containers-ObjectPool-linked-list for more information.
+
 @section Containers-LinkedList-private-inheritance Using private inheritance
 
 You might want to subclass LinkedList and LinkedListItem privately and for
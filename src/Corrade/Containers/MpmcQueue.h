@@ -0,0 +1,274 @@
+#ifndef Corrade_Containers_MpmcQueue_h
+#define Corrade_Containers_MpmcQueue_h
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Corrade::Containers::MpmcQueue
+ */
+
+#include <cstdint>
+
+/* For the shared cache line padding and capacity helpers */
+#include "Corrade/Containers/SpscQueue.h"
+
+namespace Corrade { namespace Containers {
+
+/**
+@brief Lock-free multi-producer multi-consumer queue
+@tparam T   Item type
+
+Bounded ring buffer that can be pushed to and popped from by any number of
+threads at the same time. If there's just one producer and one consumer,
+@ref SpscQueue is faster. Operations never block --- they return
+@cpp false @ce or zero if the queue is full or empty, and it's up to the caller
+what to do in that case.
+
+@code{.cpp}
+Containers::MpmcQueue<Job> queue{1024};
+
+// Any producer thread
+while(!queue.tryPush(job)) std::this_thread::yield();
+
+// Any consumer thread
+Job job;
+if(queue.tryPop(job)) process(job);
+@endcode
+
+Every slot has an associated sequence number that tells whether it's ready to
+be written or read at given position, threads claim positions by a
+compare-and-swap on the producer or consumer index. Both indices are placed
+on separate cache lines. The batch variants @ref tryPush(ArrayView<const T>)
+and @ref tryPop(ArrayView<T>) claim the whole range with a single
+compare-and-swap.
+
+The class is neither copyable nor movable. The item type is required to be
+move-constructible and move-assignable.
+*/
+template<class T> class MpmcQueue {
+    public:
+        /**
+         * @brief Constructor
+         *
+         * The @p capacity is rounded up to the next power of two, with a
+         * minimum of @cpp 2 @ce.
+         */
+        explicit MpmcQueue(std::size_t capacity): _cells{Implementation::queueCapacity(capacity)}, _mask{_cells.size() - 1} {
+            for(std::size_t i = 0; i != _cells.size(); ++i)
+                _cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+
+        /** @brief Copying is not allowed */
+        MpmcQueue(const MpmcQueue<T>&) = delete;
+
+        /** @brief Moving is not allowed */
+        MpmcQueue(MpmcQueue<T>&&) = delete;
+
+        /**
+         * @brief Destructor
+         *
+         * Destructs all items remaining in the queue. Expects that no other
+         * thread is accessing the queue anymore.
+         */
+        ~MpmcQueue() {
+            const std::size_t tail = _tail.value.load(std::memory_order_acquire);
+            for(std::size_t i = _head.value.load(std::memory_order_acquire); i != tail; ++i)
+                item(_cells[i & _mask]).~T();
+        }
+
+        /** @brief Copying is not allowed */
+        MpmcQueue<T>& operator=(const MpmcQueue<T>&) = delete;
+
+        /** @brief Moving is not allowed */
+        MpmcQueue<T>& operator=(MpmcQueue<T>&&) = delete;
+
+        /** @brief Count of items the queue can hold */
+        std::size_t capacity() const { return _cells.size(); }
+
+        /**
+         * @brief Count of items in the queue
+         *
+         * If called while other threads are pushing or popping, the value
+         * is only approximate. Includes items that are being pushed or popped
+         * at the moment.
+         */
+        std::size_t size() const {
+            const std::size_t head = _head.value.load(std::memory_order_acquire);
+            const std::size_t tail = _tail.value.load(std::memory_order_acquire);
+            return tail > head ? tail - head : 0;
+        }
+
+        /**
+         * @brief Whether the queue is empty
+         *
+         * Same caveats as with @ref size() apply.
+         */
+        bool empty() const { return !size(); }
+
+        /**
+         * @brief Try to construct an item in place
+         *
+         * Returns @cpp false @ce if the queue is full, otherwise constructs
+         * the item from @p args and returns @cpp true @ce.
+         */
+        template<class ...Args> bool tryEmplace(Args&&... args) {
+            std::size_t count = 1;
+            const std::size_t position = claim(_tail, 0, count);
+            if(position == NotClaimed) return false;
+
+            Cell& cell = _cells[position & _mask];
+            new(&cell.storage) T(std::forward<Args>(args)...);
+            cell.sequence.store(position + 1, std::memory_order_release);
+            return true;
+        }
+
+        /**
+         * @brief Try to push an item
+         *
+         * Equivalent to calling @ref tryEmplace() with @p value.
+         */
+        bool tryPush(const T& value) { return tryEmplace(value); }
+
+        /** @overload */
+        bool tryPush(T&& value) { return tryEmplace(std::move(value)); }
+
+        /**
+         * @brief Try to push a range of items
+         *
+         * Copies as many items from the front of @p values as there's space
+         * for and returns their count. The items are guaranteed to occupy
+         * consecutive positions in the queue.
+         */
+        std::size_t tryPush(ArrayView<const T> values) {
+            std::size_t count = values.size();
+            const std::size_t position = claim(_tail, 0, count);
+            if(position == NotClaimed) return 0;
+
+            for(std::size_t i = 0; i != count; ++i) {
+                Cell& cell = _cells[(position + i) & _mask];
+                new(&cell.storage) T(values[i]);
+                cell.sequence.store(position + i + 1, std::memory_order_release);
+            }
+            return count;
+        }
+
+        /**
+         * @brief Try to pop an item
+         *
+         * Returns @cpp false @ce if the queue is empty, otherwise moves the
+         * front item to @p out and returns @cpp true @ce.
+         */
+        bool tryPop(T& out) {
+            std::size_t count = 1;
+            const std::size_t position = claim(_head, 1, count);
+            if(position == NotClaimed) return false;
+
+            Cell& cell = _cells[position & _mask];
+            out = std::move(item(cell));
+            item(cell).~T();
+            cell.sequence.store(position + _mask + 1, std::memory_order_release);
+            return true;
+        }
+
+        /**
+         * @brief Try to pop a range of items
+         *
+         * Moves as many consecutive items as available, but at most
+         * @cpp out.size() @ce, to the front of @p out and returns their
+         * count.
+         */
+        std::size_t tryPop(ArrayView<T> out) {
+            std::size_t count = out.size();
+            const std::size_t position = claim(_head, 1, count);
+            if(position == NotClaimed) return 0;
+
+            for(std::size_t i = 0; i != count; ++i) {
+                Cell& cell = _cells[(position + i) & _mask];
+                out[i] = std::move(item(cell));
+                item(cell).~T();
+                cell.sequence.store(position + i + _mask + 1, std::memory_order_release);
+            }
+            return count;
+        }
+
+    private:
+        enum: std::size_t { NotClaimed = ~std::size_t{} };
+
+        struct Cell {
+            std::atomic<std::size_t> sequence;
+            typename std::aligned_storage<sizeof(T), alignof(T)>::type storage;
+        };
+
+        static T& item(Cell& cell) {
+            return *reinterpret_cast<T*>(&cell.storage);
+        }
+
+        /* Claims up to `count` consecutive positions from given index. A cell
+           is ready when its sequence is equal to the position plus `offset`,
+           which is 0 for producers and 1 for consumers. Cells that are ready
+           can't change state until their position is claimed, so if the
+           compare-and-swap succeeds, all checked cells are owned by this
+           thread. Returns the first claimed position and updates `count` to
+           the actually claimed count, or returns NotClaimed. */
+        std::size_t claim(Implementation::QueueIndex& index, const std::size_t offset, std::size_t& count) {
+            if(!count) return NotClaimed;
+
+            std::size_t position = index.value.load(std::memory_order_relaxed);
+            for(;;) {
+                std::size_t ready = 0;
+                std::ptrdiff_t difference = 0;
+                for(; ready != count && ready != _cells.size(); ++ready) {
+                    const std::size_t sequence = _cells[(position + ready) & _mask].sequence.load(std::memory_order_acquire);
+                    difference = std::ptrdiff_t(sequence - (position + ready + offset));
+                    if(difference) break;
+                }
+
+                if(ready) {
+                    if(index.value.compare_exchange_weak(position, position + ready, std::memory_order_relaxed)) {
+                        count = ready;
+                        return position;
+                    }
+
+                /* The first cell is still occupied by the previous lap, so
+                   the queue is full (or empty) */
+                } else if(difference < 0) {
+                    return NotClaimed;
+
+                /* Another thread claimed the position meanwhile, retry */
+                } else position = index.value.load(std::memory_order_relaxed);
+            }
+        }
+
+        /* Read-only after construction */
+        Array<Cell> _cells;
+        std::size_t _mask;
+
+        /* Tail is written by producers, head by consumers */
+        Implementation::QueueIndex _tail, _head;
+};
+
+}}
+
+#endif
@@ -0,0 +1,343 @@
+#ifndef Corrade_Containers_ObjectPool_h
+#define Corrade_Containers_ObjectPool_h
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Corrade::Containers::ObjectPool, @ref Corrade::Containers::PooledObject
+ */
+
+#include <algorithm>
+#include <functional>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "Corrade/Containers/GrowableArray.h"
+#include "Corrade/Utility/Assert.h"
+
+namespace Corrade { namespace Containers {
+
+/**
+@brief Object pool
+@tparam T   Object type
+
+Allocates objects of a single type from contiguous slabs and recycles freed
+objects through an intrusive free list, without going through the global heap
+for every allocation. Primarily meant for items of an intrusive
+@ref LinkedList, which otherwise end up scattered across the heap, making
+list traversal cache-hostile. Example usage:
+
+@code{.cpp}
+Containers::ObjectPool<Object> pool;
+
+Object* a = pool.create(3, "hello");
+// ...
+pool.destroy(a);
+@endcode
+
+@section Containers-ObjectPool-slabs Slab management
+
+Memory is allocated in slabs of the count of objects passed to the constructor.
+Fresh slots are handed out sequentially from the most recently allocated slab
+and destroyed objects are put into a free list, from which new objects are
+taken first, the most recently freed slot first. Slabs are never freed before
+the pool is destroyed, so a steady-state workload stops touching the heap
+completely after the first iteration.
+
+When objects are created in the same order as they're inserted into a list,
+the list traversal order matches memory order. After many insertions and
+removals in random order, however, the free list ends up shuffled and newly
+created objects end up in arbitrary places. Similarly, clearing a whole list
+puts the slots into the free list in reverse order. Calling @ref sortFreeList()
+puts the free slots back into memory order so subsequent allocations go from
+lower to higher addresses again.
+
+@section Containers-ObjectPool-linked-list Usage with linked lists
+
+Because @ref LinkedList::erase() and @ref LinkedList::clear() destroy the
+items using @cpp delete @ce, items allocated with @ref create() would need to
+be cut from the list and passed to @ref destroy() manually. A more convenient
+way is deriving the item from @ref PooledObject, which makes @cpp new @ce and
+@cpp delete @ce of given type go through a pool:
+
+@code{.cpp}
+class Object: public Containers::LinkedListItem<Object>,
+              public Containers::PooledObject<Object> {
+    // ...
+};
+
+Containers::LinkedList<Object> list;
+list.insert(new Object{...}); // allocated from PooledObject<Object>::pool()
+list.erase(list.first());     // returned to the pool
+@endcode
+
+@attention Destroying the pool frees all slabs without calling destructors of
+    objects that are still alive. Their destruction is the responsibility of
+    the user --- in the linked list case that means the list should be
+    destroyed before the pool.
+*/
+template<class T> class ObjectPool {
+    public:
+        /**
+         * @brief Constructor
+         * @param slabSize      Count of objects in a single slab
+         *
+         * No memory is allocated until the first call to @ref create() or
+         * @ref allocate().
+         */
+        explicit ObjectPool(std::size_t slabSize = 256) noexcept: _slabSize{slabSize}, _free{}, _next{}, _end{}, _size{} {
+            CORRADE_ASSERT(slabSize, "Containers::ObjectPool: slab size can't be zero", );
+        }
+
+        /** @brief Copying is not allowed */
+        ObjectPool(const ObjectPool<T>&) = delete;
+
+        /** @brief Move constructor */
+        ObjectPool(ObjectPool<T>&& other) noexcept: _slabSize{other._slabSize}, _slabs{std::move(other._slabs)}, _free{other._free}, _next{other._next}, _end{other._end}, _size{other._size} {
+            other._free = other._next = other._end = nullptr;
+            other._size = 0;
+        }
+
+        /**
+         * @brief Destructor
+         *
+         * Frees all slabs. Objects allocated from the pool are expected to be
+         * destroyed before.
+         */
+        ~ObjectPool() {
+            for(Slot* slab: _slabs) delete[] slab;
+        }
+
+        /** @brief Copying is not allowed */
+        ObjectPool<T>& operator=(const ObjectPool<T>&) = delete;
+
+        /** @brief Move assignment */
+        ObjectPool<T>& operator=(ObjectPool<T>&& other) noexcept {
+            std::swap(_slabSize, other._slabSize);
+            std::swap(_slabs, other._slabs);
+            std::swap(_free, other._free);
+            std::swap(_next, other._next);
+            std::swap(_end, other._end);
+            std::swap(_size, other._size);
+            return *this;
+        }
+
+        /** @brief Count of objects in a single slab */
+        std::size_t slabSize() const { return _slabSize; }
+
+        /** @brief Count of allocated slabs */
+        std::size_t slabCount() const { return _slabs.size(); }
+
+        /**
+         * @brief Count of live objects
+         *
+         * @see @ref capacity()
+         */
+        std::size_t size() const { return _size; }
+
+        /**
+         * @brief Object capacity
+         *
+         * Count of objects that can be alive at the same time without
+         * allocating a new slab.
+         * @see @ref size(), @ref slabCount()
+         */
+        std::size_t capacity() const { return _slabs.size()*_slabSize; }
+
+        /**
+         * @brief Whether the pool owns given memory
+         *
+         * Returns @cpp true @ce if @p pointer points to a slot in any of the
+         * slabs, regardless of whether it's alive or not. Linear in the count
+         * of slabs.
+         */
+        bool owns(const void* pointer) const;
+
+        /**
+         * @brief Create an object
+         *
+         * Allocates a slot using @ref allocate() and constructs the object in
+         * it using placement-new, forwarding @p args to its constructor.
+         * @see @ref destroy()
+         */
+        template<class ...Args> T* create(Args&&... args) {
+            return new(allocate()) T{std::forward<Args>(args)...};
+        }
+
+        /**
+         * @brief Destroy an object
+         *
+         * Calls the object destructor and returns its slot to the pool using
+         * @ref deallocate(). The object is expected to be created from this
+         * pool, passing @cpp nullptr @ce is a no-op.
+         */
+        void destroy(T* object) {
+            if(!object) return;
+            object->~T();
+            deallocate(object);
+        }
+
+        /**
+         * @brief Allocate a slot
+         *
+         * Returns uninitialized memory suitable for one object of type @p T.
+         * The memory is taken from the free list if not empty, otherwise from
+         * the current slab, allocating a new one if it's full.
+         */
+        void* allocate() {
+            ++_size;
+            if(Slot* const slot = _free) {
+                _free = slot->next;
+                return slot;
+            }
+            if(_next == _end) allocateSlab();
+            return _next++;
+        }
+
+        /**
+         * @brief Deallocate a slot
+         *
+         * Puts @p memory to the free list. The memory is expected to come
+         * from @ref allocate() and the object in it to be already destroyed,
+         * passing @cpp nullptr @ce is a no-op.
+         */
+        void deallocate(void* memory) {
+            if(!memory) return;
+            CORRADE_ASSERT(_size, "Containers::ObjectPool::deallocate(): the pool has no live objects", );
+            --_size;
+            Slot* const slot = static_cast<Slot*>(memory);
+            slot->next = _free;
+            _free = slot;
+        }
+
+        /**
+         * @brief Sort the free list
+         *
+         * Puts the free slots into memory order, so subsequent allocations
+         * go from lower addresses to higher. Useful after a lot of
+         * insertions and removals in random order to make traversal of newly
+         * created objects cache-friendly again. Done in
+         * @f$ \mathcal{O}(n \log n) @f$ time with @f$ n @f$ being the count of
+         * free slots.
+         */
+        void sortFreeList();
+
+    private:
+        union Slot {
+            Slot* next;
+            typename std::aligned_storage<sizeof(T), alignof(T)>::type storage;
+        };
+
+        void allocateSlab();
+
+        std::size_t _slabSize;
+        Array<Slot*> _slabs;
+        Slot* _free;
+        Slot* _next;
+        Slot* _end;
+        std::size_t _size;
+};
+
+/**
+@brief Base for objects allocated from a pool
+@tparam Derived     Derived object type
+
+Overloads @cpp new @ce and @cpp delete @ce of @p Derived to allocate from a
+global per-type @ref ObjectPool, accessible through @ref pool(). That makes
+it possible to use pooled objects with APIs that allocate and free objects
+themselves, such as @ref LinkedList::erase(). See
+@ref Containers-ObjectPool-linked-list for an example.
+
+Only objects of exactly the @p Derived type are allocated from the pool,
+allocation of types derived further with a different size falls back to the
+global allocator. Note that in order to return the memory to correct place,
+either the destructor has to be virtual or the objects have to be always
+deleted through a pointer to their actual type. Array allocations are not
+affected.
+
+@attention The global pool is not thread-safe, use an @ref ObjectPool
+    directly together with some synchronization if you need that. The pool
+    is also destroyed at program exit like any other function-local static,
+    so objects in global containers have to be destroyed before that.
+*/
+template<class Derived> class PooledObject {
+    public:
+        /**
+         * @brief Global pool for this type
+         *
+         * Created on first use.
+         */
+        static ObjectPool<Derived>& pool() {
+            static ObjectPool<Derived> pool;
+            return pool;
+        }
+
+        /** @brief Allocate an object from the pool */
+        static void* operator new(std::size_t size) {
+            return size == sizeof(Derived) ? pool().allocate() : ::operator new(size);
+        }
+
+        /** @brief Return an object to the pool */
+        static void operator delete(void* memory, std::size_t size) {
+            if(size == sizeof(Derived)) pool().deallocate(memory);
+            else ::operator delete(memory);
+        }
+
+    protected:
+        ~PooledObject() = default;
+};
+
+template<class T> bool ObjectPool<T>::owns(const void* const pointer) const {
+    const Slot* const slot = static_cast<const Slot*>(pointer);
+    for(const Slot* slab: _slabs)
+        if(slot >= slab && slot < slab + _slabSize) return true;
+    return false;
+}
+
+template<class T> void ObjectPool<T>::allocateSlab() {
+    Slot* const slab = new Slot[_slabSize];
+    arrayAppend(_slabs, slab);
+    _next = slab;
+    _end = slab + _slabSize;
+}
+
+template<class T> void ObjectPool<T>::sortFreeList() {
+    Array<Slot*> slots;
+    for(Slot* slot = _free; slot; slot = slot->next)
+        arrayAppend(slots, slot);
+    std::sort(slots.begin(), slots.end(), std::less<Slot*>{});
+
+    Slot* next = nullptr;
+    for(std::size_t i = slots.size(); i != 0; --i) {
+        slots[i - 1]->next = next;
+        next = slots[i - 1];
+    }
+    _free = next;
+}
+
+}}
+
+#endif
@@ -0,0 +1,344 @@
+#ifndef Corrade_Containers_PackedIntArray_h
+#define Corrade_Containers_PackedIntArray_h
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Corrade::Containers::PackedIntArray
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+#include "Corrade/configure.h"
+#include "Corrade/Containers/Array.h"
+#include "Corrade/Utility/Assert.h"
+#include "Corrade/Utility/Endianness.h"
+
+#ifdef CORRADE_TARGET_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace Corrade { namespace Containers {
+
+namespace Implementation {
+    /* Values are stored as a little-endian bit stream, value i occupying
+       bits i*bits to (i + 1)*bits - 1. Since the width is at most 32 bits
+       and the start is at most 7 bits into a byte, a single eight-byte load
+       always contains the whole value. The storage is padded with
+       PackedIntArrayPadding bytes to make that load safe for the last
+       value. */
+    enum: std::size_t { PackedIntArrayPadding = 7 };
+
+    inline std::uint64_t packedIntLoad(const char* const data) {
+        std::uint64_t word;
+        std::memcpy(&word, data, 8);
+        return Utility::Endianness::littleEndian(word);
+    }
+
+    inline void packedIntStore(char* const data, std::uint64_t word) {
+        word = Utility::Endianness::littleEndian(word);
+        std::memcpy(data, &word, 8);
+    }
+
+    /* Eight consecutive values always span exactly `bits` bytes, so with a
+       compile-time width all offsets, shifts and masks inside a block are
+       constants and the loop gets fully unrolled */
+    template<unsigned bits> void packedIntUnpack(const char* data, std::uint32_t* out, std::size_t blockCount) {
+        constexpr std::uint64_t mask = (std::uint64_t{1} << bits) - 1;
+        for(std::size_t i = 0; i != blockCount; ++i) {
+            for(std::size_t j = 0; j != 8; ++j)
+                out[j] = std::uint32_t((packedIntLoad(data + j*bits/8) >> (j*bits%8)) & mask);
+            data += bits;
+            out += 8;
+        }
+    }
+
+    #ifdef CORRADE_TARGET_SSE2
+    /* Byte-sized widths are just zero-extensions, done sixteen bytes at a
+       time. SSE2 implies a little-endian target. */
+    template<> inline void packedIntUnpack<8>(const char* data, std::uint32_t* out, std::size_t blockCount) {
+        const __m128i zero = _mm_setzero_si128();
+        for(; blockCount >= 2; blockCount -= 2, data += 16, out += 16) {
+            const __m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+            const __m128i lo = _mm_unpacklo_epi8(in, zero);
+            const __m128i hi = _mm_unpackhi_epi8(in, zero);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out), _mm_unpacklo_epi16(lo, zero));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out + 4), _mm_unpackhi_epi16(lo, zero));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out + 8), _mm_unpacklo_epi16(hi, zero));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out + 12), _mm_unpackhi_epi16(hi, zero));
+        }
+        for(std::size_t i = 0; i != blockCount*8; ++i)
+            out[i] = std::uint8_t(data[i]);
+    }
+
+    template<> inline void packedIntUnpack<16>(const char* data, std::uint32_t* out, std::size_t blockCount) {
+        const __m128i zero = _mm_setzero_si128();
+        for(std::size_t i = 0; i != blockCount; ++i, data += 16, out += 8) {
+            const __m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out), _mm_unpacklo_epi16(in, zero));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out + 4), _mm_unpackhi_epi16(in, zero));
+        }
+    }
+
+    template<> inline void packedIntUnpack<32>(const char* data, std::uint32_t* out, std::size_t blockCount) {
+        std::memcpy(out, data, blockCount*32);
+    }
+    #endif
+
+    typedef void(*PackedIntUnpacker)(const char*, std::uint32_t*, std::size_t);
+
+    inline PackedIntUnpacker packedIntUnpacker(const unsigned bits) {
+        static const PackedIntUnpacker unpackers[]{
+            packedIntUnpack<1>, packedIntUnpack<2>, packedIntUnpack<3>, packedIntUnpack<4>,
+            packedIntUnpack<5>, packedIntUnpack<6>, packedIntUnpack<7>, packedIntUnpack<8>,
+            packedIntUnpack<9>, packedIntUnpack<10>, packedIntUnpack<11>, packedIntUnpack<12>,
+            packedIntUnpack<13>, packedIntUnpack<14>, packedIntUnpack<15>, packedIntUnpack<16>,
+            packedIntUnpack<17>, packedIntUnpack<18>, packedIntUnpack<19>, packedIntUnpack<20>,
+            packedIntUnpack<21>, packedIntUnpack<22>, packedIntUnpack<23>, packedIntUnpack<24>,
+            packedIntUnpack<25>, packedIntUnpack<26>, packedIntUnpack<27>, packedIntUnpack<28>,
+            packedIntUnpack<29>, packedIntUnpack<30>, packedIntUnpack<31>, packedIntUnpack<32>
+        };
+        return unpackers[bits - 1];
+    }
+}
+
+/**
+@brief Packed integer array
+
+Stores unsigned integers using a fixed number of bits per value, chosen at
+construction time. Useful for large arrays of small values such as indices
+into a few thousand items, which would otherwise waste most of each
+@cpp std::uint32_t @ce. The values are tightly packed one after another,
+with no padding between them.
+
+@code{.cpp}
+// A million 12-bit indices take 1.5 MB instead of 4 MB
+Containers::PackedIntArray indices{Containers::ValueInit, 1000000, 12};
+indices.set(0, 4095);
+indices.set(1, 17);
+
+std::uint32_t second = indices[1]; // 17
+@endcode
+
+Initialization options are similar to @ref Array:
+
+-   @ref PackedIntArray(ValueInitT, std::size_t, unsigned) zeroes all values.
+-   @ref PackedIntArray(NoInitT, std::size_t, unsigned) leaves the contents
+    uninitialized.
+-   @ref PackedIntArray(std::size_t, unsigned) is an alias to
+    @ref PackedIntArray(ValueInitT, std::size_t, unsigned).
+-   @ref PackedIntArray(ArrayView<const std::uint32_t>, unsigned) packs
+    existing values.
+
+The class is move-only, same as @ref Array.
+
+@section Containers-PackedIntArray-access Element access
+
+Random access using @ref operator[]() is a single unaligned load, a shift and
+a mask. For sequential access prefer @ref unpack(), which decodes whole blocks
+of eight values with the width being a compile-time constant, and
+zero-extends using SSE2 instructions for 8-, 16- and 32-bit widths where
+available. Writing a value with @ref set() is a read-modify-write of the
+surrounding bytes, so concurrently writing neighboring values from different
+threads is not safe.
+
+@see @ref BitArray
+*/
+class PackedIntArray {
+    public:
+        /**
+         * @brief Default constructor
+         *
+         * Creates a zero-sized array with no allocation. The bit width is
+         * zero.
+         */
+        /*implicit*/ PackedIntArray(std::nullptr_t = nullptr) noexcept: _size{}, _bits{} {}
+
+        /**
+         * @brief Construct a zero-initialized array
+         * @param size      Value count
+         * @param bits      Bit width of each value, expected to be in range
+         *      @f$ [1, 32] @f$
+         */
+        explicit PackedIntArray(ValueInitT, std::size_t size, unsigned bits): _data{ValueInit, byteSize(size, bits)}, _size{size}, _bits{bits} {}
+
+        /**
+         * @brief Construct an array without initializing its contents
+         * @param size      Value count
+         * @param bits      Bit width of each value, expected to be in range
+         *      @f$ [1, 32] @f$
+         *
+         * Only the trailing padding is zeroed out.
+         */
+        explicit PackedIntArray(NoInitT, std::size_t size, unsigned bits): _data{NoInit, byteSize(size, bits)}, _size{size}, _bits{bits} {
+            std::memset(_data + _data.size() - Implementation::PackedIntArrayPadding, 0, Implementation::PackedIntArrayPadding);
+        }
+
+        /**
+         * @brief Construct a zero-initialized array
+         *
+         * Alias to @ref PackedIntArray(ValueInitT, std::size_t, unsigned).
+         */
+        explicit PackedIntArray(std::size_t size, unsigned bits): PackedIntArray{ValueInit, size, bits} {}
+
+        /**
+         * @brief Construct an array from a list of values
+         *
+         * Each value is expected to fit into @p bits.
+         * @see @ref pack()
+         */
+        explicit PackedIntArray(ArrayView<const std::uint32_t> values, unsigned bits): PackedIntArray{ValueInit, values.size(), bits} {
+            pack(0, values);
+        }
+
+        /** @brief Copying is not allowed */
+        PackedIntArray(const PackedIntArray&) = delete;
+
+        /** @brief Move constructor */
+        PackedIntArray(PackedIntArray&& other) noexcept: _data{std::move(other._data)}, _size{other._size}, _bits{other._bits} {
+            other._size = 0;
+            other._bits = 0;
+        }
+
+        /** @brief Copying is not allowed */
+        PackedIntArray& operator=(const PackedIntArray&) = delete;
+
+        /** @brief Move assignment */
+        PackedIntArray& operator=(PackedIntArray&& other) noexcept {
+            std::swap(_data, other._data);
+            std::swap(_size, other._size);
+            std::swap(_bits, other._bits);
+            return *this;
+        }
+
+        /**
+         * @brief Packed data
+         *
+         * The first @cpp (size()*bits() + 7)/8 @ce bytes contain the packed
+         * values, followed by a few bytes of padding.
+         */
+        char* data() { return _data.data(); }
+        const char* data() const { return _data.data(); } /**< @overload */
+
+        /** @brief Value count */
+        std::size_t size() const { return _size; }
+
+        /** @brief Whether the array is empty */
+        bool empty() const { return !_size; }
+
+        /** @brief Bit width of each value */
+        unsigned bits() const { return _bits; }
+
+        /** @brief Largest value that can be stored */
+        std::uint32_t maxValue() const {
+            return std::uint32_t((std::uint64_t{1} << _bits) - 1);
+        }
+
+        /** @brief Value at given position */
+        std::uint32_t operator[](std::size_t i) const {
+            const std::size_t position = i*_bits;
+            return std::uint32_t((Implementation::packedIntLoad(_data + (position >> 3)) >> (position & 7)) & maxValue());
+        }
+
+        /**
+         * @brief Set a value
+         *
+         * Expects that @p value fits into @ref bits().
+         */
+        void set(std::size_t i, std::uint32_t value) {
+            CORRADE_ASSERT(value <= maxValue(),
+                "Containers::PackedIntArray::set(): value" << value << "doesn't fit into" << _bits << "bits", );
+            const std::size_t position = i*_bits;
+            const std::size_t shift = position & 7;
+            char* const bytes = _data + (position >> 3);
+            const std::uint64_t word = Implementation::packedIntLoad(bytes);
+            Implementation::packedIntStore(bytes, (word & ~(std::uint64_t{maxValue()} << shift)) | (std::uint64_t{value} << shift));
+        }
+
+        /**
+         * @brief Unpack a range of values
+         *
+         * Decodes @cpp out.size() @ce values starting at @p offset into
+         * @p out, expecting that the range is in bounds. Significantly faster
+         * than calling @ref operator[]() for each value.
+         */
+        void unpack(std::size_t offset, ArrayView<std::uint32_t> out) const;
+
+        /**
+         * @brief Pack a range of values
+         *
+         * Equivalent to calling @ref set() for each value in @p values,
+         * starting at @p offset. Expects that the range is in bounds.
+         */
+        void pack(std::size_t offset, ArrayView<const std::uint32_t> values);
+
+    private:
+        static std::size_t byteSize(std::size_t size, unsigned bits) {
+            CORRADE_ASSERT(bits >= 1 && bits <= 32,
+                "Containers::PackedIntArray: expected bit width to be in range [1, 32] but got" << bits, Implementation::PackedIntArrayPadding);
+            return (size*bits + 7)/8 + Implementation::PackedIntArrayPadding;
+        }
+
+        Array<char> _data;
+        std::size_t _size;
+        unsigned _bits;
+};
+
+inline void PackedIntArray::unpack(std::size_t offset, const ArrayView<std::uint32_t> out) const {
+    CORRADE_ASSERT(offset + out.size() <= _size,
+        "Containers::PackedIntArray::unpack(): range [" << Utility::Debug::nospace
+        << offset << Utility::Debug::nospace << ":"
+        << Utility::Debug::nospace << offset + out.size()
+        << Utility::Debug::nospace << "] out of range for" << _size
+        << "elements", );
+
+    /* Values until the next multiple of eight one by one, then whole blocks
+       and then the remainder again one by one */
+    std::size_t i = 0;
+    const std::size_t head = std::min((8 - (offset & 7)) & 7, out.size());
+    for(; i != head; ++i) out[i] = (*this)[offset + i];
+
+    const std::size_t blockCount = (out.size() - i)/8;
+    Implementation::packedIntUnpacker(_bits)(_data + (offset + i)/8*_bits, out + i, blockCount);
+    i += blockCount*8;
+
+    for(; i != out.size(); ++i) out[i] = (*this)[offset + i];
+}
+
+inline void PackedIntArray::pack(std::size_t offset, const ArrayView<const std::uint32_t> values) {
+    CORRADE_ASSERT(offset + values.size() <= _size,
+        "Containers::PackedIntArray::pack(): range [" << Utility::Debug::nospace
+        << offset << Utility::Debug::nospace << ":"
+        << Utility::Debug::nospace << offset + values.size()
+        << Utility::Debug::nospace << "] out of range for" << _size
+        << "elements", );
+    for(std::size_t i = 0; i != values.size(); ++i) set(offset + i, values[i]);
+}
+
+}}
+
+#endif
@@ -0,0 +1,649 @@
+#ifndef Corrade_Containers_SmallArray_h
+#define Corrade_Containers_SmallArray_h
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Corrade::Containers::SmallArray
+ */
+
+#include <initializer_list>
+#include <new>
+#include <utility>
+
+#include "Corrade/Containers/ArrayView.h"
+#include "Corrade/Containers/GrowableArray.h"
+#include "Corrade/Containers/Tags.h"
+
+namespace Corrade { namespace Containers {
+
+/**
+@brief Array with small buffer optimization
+@tparam inlineCapacity  Count of items stored inline
+@tparam T               Element type
+
+Keeps up to @p inlineCapacity items directly inside the object and moves them
+to a heap allocation only when the array grows beyond that. Useful for arrays
+that usually hold just a few items, where the heap allocation done by
+@ref Array would dominate. Unlike @ref StaticArray, the size is not fixed at
+compile time and the array can grow, similarly to @ref arrayAppend() and
+related functions on @ref Array. The heap storage grows geometrically, once
+it's allocated the array never moves back to the inline storage.
+
+Usage example:
+
+@code{.cpp}
+Containers::SmallArray<4, int> a;
+a.append(3);
+a.append(7); // still inline, no heap allocation
+
+Containers::SmallArray<4, int> b{Containers::InPlaceInit, {1, 2, 3, 4, 5}};
+// b.isSmall() == false, the items are on the heap
+
+// Convertible to an array view, the same as Array
+Containers::ArrayView<const int> view = b;
+@endcode
+
+The class is move-only, same as @ref Array. Moving an array that's on heap
+is just a pointer swap, moving an inline array moves the items one by one.
+
+Initialization options for the constructor are the same as for @ref Array:
+
+-   @ref SmallArray(DefaultInitT, std::size_t) leaves trivial types
+    uninitialized and calls the default constructor elsewhere.
+-   @ref SmallArray(ValueInitT, std::size_t) zero-initializes trivial types
+    and calls the default constructor elsewhere.
+-   @ref SmallArray(DirectInitT, std::size_t, Args&&... args) constructs all
+    elements of the array using provided arguments.
+-   @ref SmallArray(InPlaceInitT, std::initializer_list<T>) allocates
+    unitialized memory and then copy-constructs all elements from the
+    initializer list.
+-   @ref SmallArray(NoInitT, std::size_t) does not initialize anything and
+    you need to call the constructor on all elements manually using placement
+    new.
+
+The heap storage doesn't respect alignment larger than the default one of
+the platform allocator, types with larger alignment (such as SIMD types) are
+not supported to avoid the items being suddenly misaligned once the array
+grows past the inline storage.
+
+@see @ref arrayView(SmallArray<inlineCapacity, T>&)
+*/
+template<std::size_t inlineCapacity, class T> class SmallArray {
+    static_assert(inlineCapacity, "SmallArray with zero inline capacity doesn't make sense");
+    /* The heap storage is allocated with new char[], which is aligned to at
+       least two pointers on all supported platforms. Not using
+       std::max_align_t as it's missing in the GCC 4.7 standard library. */
+    static_assert(alignof(T) <= 2*sizeof(std::size_t), "over-aligned types are not supported by SmallArray");
+
+    public:
+        enum: std::size_t {
+            InlineCapacity = inlineCapacity /**< Inline capacity */
+        };
+
+        typedef T Type;     /**< @brief Element type */
+
+        /**
+         * @brief Default constructor
+         *
+         * Creates an empty array using the inline storage.
+         */
+        /*implicit*/ SmallArray() noexcept: _data{_inline}, _size{0}, _capacity{inlineCapacity} {}
+
+        /** @brief Conversion from `nullptr` */
+        /*implicit*/ SmallArray(std::nullptr_t) noexcept: SmallArray{} {}
+
+        /**
+         * @brief Construct default-initialized array
+         *
+         * Creates array of given size, the contents are default-initialized
+         * (i.e. builtin types are not initialized). If the size is larger
+         * than @p inlineCapacity, the items are allocated on heap.
+         * @see @ref DefaultInit, @ref SmallArray(ValueInitT, std::size_t)
+         */
+        explicit SmallArray(DefaultInitT, std::size_t size): SmallArray{NoInit, size} {
+            for(T& i: *this) new(&i) T;
+        }
+
+        /**
+         * @brief Construct value-initialized array
+         *
+         * Creates array of given size, the contents are value-initialized
+         * (i.e. builtin types are zero-initialized).
+         * @see @ref ValueInit, @ref SmallArray(DefaultInitT, std::size_t)
+         */
+        explicit SmallArray(ValueInitT, std::size_t size): SmallArray{NoInit, size} {
+            for(T& i: *this) new(&i) T();
+        }
+
+        /**
+         * @brief Construct the array without initializing its contents
+         *
+         * The contents are *not* initialized. Useful if you will be
+         * overwriting all elements later anyway. Destructors of all items
+         * are called on destruction, so the items are expected to be
+         * constructed using placement new before.
+         * @see @ref NoInit
+         */
+        explicit SmallArray(NoInitT, std::size_t size): _data{size > inlineCapacity ? reinterpret_cast<T*>(new char[size*sizeof(T)]) : _inline}, _size{size}, _capacity{size > inlineCapacity ? size : std::size_t(inlineCapacity)} {}
+
+        /**
+         * @brief Construct direct-initialized array
+         *
+         * Constructs the array using the @ref SmallArray(NoInitT, std::size_t)
+         * constructor and then initializes each element with
+         * @cpp T{std::forward<Args>(args)...} @ce.
+         * @see @ref DirectInit
+         */
+        template<class ...Args> explicit SmallArray(DirectInitT, std::size_t size, Args&&... args): SmallArray{NoInit, size} {
+            for(T& i: *this) new(&i) T{std::forward<Args>(args)...};
+        }
+
+        /**
+         * @brief Construct list-initialized array
+         *
+         * Copy-constructs all elements from the initializer list.
+         * @see @ref InPlaceInit
+         */
+        explicit SmallArray(InPlaceInitT, std::initializer_list<T> list): SmallArray{NoInit, list.size()} {
+            std::size_t i = 0;
+            for(const T& item: list) new(_data + i++) T(item);
+        }
+
+        /**
+         * @brief Construct default-initialized array
+         *
+         * Alias to @ref SmallArray(DefaultInitT, std::size_t).
+         */
+        explicit SmallArray(std::size_t size): SmallArray{DefaultInit, size} {}
+
+        /** @brief Copying is not allowed */
+        SmallArray(const SmallArray<inlineCapacity, T>&) = delete;
+
+        /**
+         * @brief Move constructor
+         *
+         * If @p other is on heap, the pointer is taken over, otherwise the
+         * items are moved one by one. In both cases @p other is left empty.
+         */
+        SmallArray(SmallArray<inlineCapacity, T>&& other) noexcept: SmallArray{} {
+            moveFrom(other);
+        }
+
+        /**
+         * @brief Destructor
+         *
+         * Calls destructors on all items and frees the heap allocation, if
+         * any.
+         */
+        ~SmallArray() { destroy(); }
+
+        /** @brief Copying is not allowed */
+        SmallArray<inlineCapacity, T>& operator=(const SmallArray<inlineCapacity, T>&) = delete;
+
+        /**
+         * @brief Move assignment
+         *
+         * Destroys the current contents and then behaves the same as the
+         * move constructor.
+         */
+        SmallArray<inlineCapacity, T>& operator=(SmallArray<inlineCapacity, T>&& other) noexcept {
+            if(&other != this) {
+                destroy();
+                _data = _inline;
+                _size = 0;
+                _capacity = inlineCapacity;
+                moveFrom(other);
+            }
+            return *this;
+        }
+
+        /**
+         * @brief Convert to @ref ArrayView
+         *
+         * Enabled only if @cpp T* @ce is implicitly convertible to @cpp U* @ce.
+         * Expects that both types have the same size.
+         * @see @ref arrayView(SmallArray<inlineCapacity, T>&)
+         */
+        #ifdef DOXYGEN_GENERATING_OUTPUT
+        template<class U>
+        #else
+        template<class U, class = typename std::enable_if<!std::is_void<U>::value && std::is_convertible<T*, U*>::value>::type>
+        #endif
+        /*implicit*/ operator ArrayView<U>() noexcept {
+            static_assert(sizeof(T) == sizeof(U), "type sizes are not compatible");
+            return {_data, _size};
+        }
+
+        /**
+         * @brief Convert to const @ref ArrayView
+         *
+         * Enabled only if @cpp T* @ce or @cpp const T* @ce is implicitly
+         * convertible to @cpp U* @ce. Expects that both types have the same
+         * size.
+         * @see @ref arrayView(const SmallArray<inlineCapacity, T>&)
+         */
+        #ifdef DOXYGEN_GENERATING_OUTPUT
+        template<class U>
+        #else
+        template<class U, class = typename std::enable_if<std::is_convertible<T*, U*>::value || std::is_convertible<T*, const U*>::value>::type>
+        #endif
+        /*implicit*/ operator ArrayView<const U>() const noexcept {
+            static_assert(sizeof(T) == sizeof(U), "type sizes are not compatible");
+            return {_data, _size};
+        }
+
+        /** @overload */
+        /*implicit*/ operator ArrayView<const void>() const noexcept {
+            /* Yes, the size is properly multiplied by sizeof(T) by the constructor */
+            return {_data, _size};
+        }
+
+        /* Pointer conversion on rvalues would result in a dangling pointer
+           to the inline storage, disallowing it the same way as in Array */
+
+        /** @brief Conversion to array type */
+        /*implicit*/ operator T*()
+        #ifndef CORRADE_GCC47_COMPATIBILITY
+        &
+        #endif
+        { return _data; }
+
+        /** @overload */
+        /*implicit*/ operator const T*() const
+        #ifndef CORRADE_GCC47_COMPATIBILITY
+        &
+        #endif
+        { return _data; }
+
+        /** @brief Array data */
+        T* data() { return _data; }
+        const T* data() const { return _data; }         /**< @overload */
+
+        /** @brief Array size */
+        std::size_t size() const { return _size; }
+
+        /**
+         * @brief Array capacity
+         *
+         * Equal to @p inlineCapacity if the array is inline.
+         * @see @ref isSmall(), @ref reserve()
+         */
+        std::size_t capacity() const { return _capacity; }
+
+        /** @brief Whether the array is empty */
+        bool empty() const { return !_size; }
+
+        /**
+         * @brief Whether the items are stored inline
+         *
+         * @see @ref capacity()
+         */
+        bool isSmall() const { return _data == _inline; }
+
+        /** @brief Pointer to first element */
+        T* begin() { return _data; }
+        const T* begin() const { return _data; }        /**< @overload */
+        const T* cbegin() const { return _data; }       /**< @overload */
+
+        /** @brief Pointer to (one item after) last element */
+        T* end() { return _data + _size; }
+        const T* end() const { return _data + _size; }  /**< @overload */
+        const T* cend() const { return _data + _size; } /**< @overload */
+
+        /**
+         * @brief First element
+         *
+         * Expects there is at least one element.
+         */
+        T& front();
+        const T& front() const; /**< @overload */
+
+        /**
+         * @brief Last element
+         *
+         * Expects there is at least one element.
+         */
+        T& back();
+        const T& back() const; /**< @overload */
+
+        /**
+         * @brief Reference to array slice
+         *
+         * Equivalent to @ref ArrayView::slice().
+         */
+        ArrayView<T> slice(T* begin, T* end) {
+            return ArrayView<T>(*this).slice(begin, end);
+        }
+        /** @overload */
+        ArrayView<const T> slice(const T* begin, const T* end) const {
+            return ArrayView<const T>(*this).slice(begin, end);
+        }
+        /** @overload */
+        ArrayView<T> slice(std::size_t begin, std::size_t end) {
+            return slice(_data + begin, _data + end);
+        }
+        /** @overload */
+        ArrayView<const T> slice(std::size_t begin, std::size_t end) const {
+            return slice(_data + begin, _data + end);
+        }
+
+        /**
+         * @brief Array prefix
+         *
+         * Equivalent to @ref ArrayView::prefix().
+         */
+        ArrayView<T> prefix(T* end) {
+            return ArrayView<T>(*this).prefix(end);
+        }
+        /** @overload */
+        ArrayView<const T> prefix(const T* end) const {
+            return ArrayView<const T>(*this).prefix(end);
+        }
+        ArrayView<T> prefix(std::size_t end) { return prefix(_data + end); } /**< @overload */
+        ArrayView<const T> prefix(std::size_t end) const { return prefix(_data + end); } /**< @overload */
+
+        /**
+         * @brief Array suffix
+         *
+         * Equivalent to @ref ArrayView::suffix().
+         */
+        ArrayView<T> suffix(T* begin) {
+            return ArrayView<T>(*this).suffix(begin);
+        }
+        /** @overload */
+        ArrayView<const T> suffix(const T* begin) const {
+            return ArrayView<const T>(*this).suffix(begin);
+        }
+        ArrayView<T> suffix(std::size_t begin) { return suffix(_data + begin); } /**< @overload */
+        ArrayView<const T> suffix(std::size_t begin) const { return suffix(_data + begin); } /**< @overload */
+
+        /**
+         * @brief Reserve given capacity
+         *
+         * If current capacity is not large enough, moves the items to a heap
+         * allocation of exactly @p capacity items. Returns new capacity.
+         * @see @ref capacity(), @ref arrayReserve()
+         */
+        std::size_t reserve(std::size_t capacity);
+
+        /**
+         * @brief Resize the array
+         *
+         * If the array is growing, the new items are default-initialized, if
+         * it's shrinking, the superfluous items are destructed. The capacity
+         * grows geometrically, shrinking doesn't change it.
+         * @see @ref arrayResize()
+         */
+        void resize(DefaultInitT, std::size_t size);
+
+        /**
+         * @brief Resize the array with value-initialized items
+         *
+         * Same as @ref resize(DefaultInitT, std::size_t), but the new items are
+         * value-initialized.
+         */
+        void resize(ValueInitT, std::size_t size);
+
+        /**
+         * @brief Resize the array
+         *
+         * Alias to @ref resize(DefaultInitT, std::size_t).
+         */
+        void resize(std::size_t size) { resize(DefaultInit, size); }
+
+        /**
+         * @brief Copy-append an item
+         *
+         * Moves the items to a heap allocation with geometrically growing
+         * capacity if the current capacity is not large enough. The @p value
+         * is allowed to point to an item of the array itself. Returns a
+         * reference to the newly appended item.
+         * @see @ref arrayAppend()
+         */
+        T& append(const T& value);
+
+        /**
+         * @brief Move-append an item
+         *
+         * Same as @ref append(const T&), but moving the item.
+         */
+        T& append(T&& value);
+
+        /**
+         * @brief In-place append an item
+         *
+         * Same as @ref append(const T&), but constructing the item in-place
+         * using provided arguments.
+         */
+        template<class ...Args> T& append(InPlaceInitT, Args&&... args);
+
+        /**
+         * @brief Copy-append a list of items
+         *
+         * Same as @ref append(const T&), but appending all items of @p values.
+         * Returns a view on the newly appended items.
+         */
+        ArrayView<T> append(ArrayView<const T> values);
+
+        /** @overload */
+        ArrayView<T> append(std::initializer_list<T> values) {
+            return append(ArrayView<const T>{values.begin(), values.size()});
+        }
+
+        /**
+         * @brief Remove a suffix
+         *
+         * Destructs last @p count items. Expects that @p count is not larger
+         * than @ref size(). Capacity is kept unchanged.
+         * @see @ref arrayRemoveSuffix()
+         */
+        void removeSuffix(std::size_t count = 1);
+
+        /**
+         * @brief Clear the array
+         *
+         * Destructs all items. Capacity is kept unchanged.
+         */
+        void clear() { removeSuffix(_size); }
+
+    private:
+        void destroy();
+        void moveFrom(SmallArray<inlineCapacity, T>& other);
+        void reallocate(std::size_t capacity);
+        T* growBy(std::size_t count);
+
+        T* _data;
+        std::size_t _size;
+        std::size_t _capacity;
+        union {
+            T _inline[inlineCapacity];
+        };
+};
+
+/** @relatesalso SmallArray
+@brief Make view on @ref SmallArray
+
+Convenience alternative to calling @ref SmallArray::operator ArrayView<U>()
+explicitly. The following two lines are equivalent:
+
+@code{.cpp}
+Containers::SmallArray<4, std::uint32_t> data;
+
+Containers::ArrayView<std::uint32_t> a{data};
+auto b = Containers::arrayView(data);
+@endcode
+*/
+template<std::size_t inlineCapacity, class T> ArrayView<T> arrayView(SmallArray<inlineCapacity, T>& array) {
+    return ArrayView<T>{array};
+}
+
+/** @relatesalso SmallArray
+@brief Make view on const @ref SmallArray
+
+Convenience alternative to calling @ref SmallArray::operator ArrayView<U>()
+explicitly. The following two lines are equivalent:
+
+@code{.cpp}
+const Containers::SmallArray<4, std::uint32_t> data;
+
+Containers::ArrayView<const std::uint32_t> a{data};
+auto b = Containers::arrayView(data);
+@endcode
+*/
+template<std::size_t inlineCapacity, class T> ArrayView<const T> arrayView(const SmallArray<inlineCapacity, T>& array) {
+    return ArrayView<const T>{array};
+}
+
+template<std::size_t inlineCapacity, class T> void SmallArray<inlineCapacity, T>::destroy() {
+    Implementation::arrayDestruct<T>(_data, _data + _size);
+    if(!isSmall()) delete[] reinterpret_cast<char*>(_data);
+}
+
+template<std::size_t inlineCapacity, class T> void SmallArray<inlineCapacity, T>::moveFrom(SmallArray<inlineCapacity, T>& other) {
+    /* Expects that this is empty and inline */
+    if(other.isSmall()) {
+        Implementation::arrayMoveConstruct<T>(other._data, _data, other._size);
+        Implementation::arrayDestruct<T>(other._data, other._data + other._size);
+        _size = other._size;
+    } else {
+        _data = other._data;
+        _size = other._size;
+        _capacity = other._capacity;
+        other._data = other._inline;
+        other._capacity = inlineCapacity;
+    }
+    other._size = 0;
+}
+
+template<std::size_t inlineCapacity, class T> void SmallArray<inlineCapacity, T>::reallocate(const std::size_t capacity) {
+    T* const data = reinterpret_cast<T*>(new char[capacity*sizeof(T)]);
+    Implementation::arrayMoveConstruct<T>(_data, data, _size);
+    Implementation::arrayDestruct<T>(_data, _data + _size);
+    if(!isSmall()) delete[] reinterpret_cast<char*>(_data);
+    _data = data;
+    _capacity = capacity;
+}
+
+template<std::size_t inlineCapacity, class T> T* SmallArray<inlineCapacity, T>::growBy(const std::size_t count) {
+    const std::size_t desired = _size + count;
+    /* When spilling out of the inline storage, grow geometrically from the
+       inline capacity, otherwise a loop crossing it would reallocate again
+       right after */
+    if(desired > _capacity)
+        reallocate(Implementation::arrayGrowth(_capacity, desired, sizeof(T)));
+    T* const it = _data + _size;
+    _size = desired;
+    return it;
+}
+
+template<std::size_t inlineCapacity, class T> T& SmallArray<inlineCapacity, T>::front() {
+    CORRADE_ASSERT(_size, "Containers::SmallArray::front(): array is empty", _data[0]);
+    return _data[0];
+}
+
+template<std::size_t inlineCapacity, class T> const T& SmallArray<inlineCapacity, T>::front() const {
+    CORRADE_ASSERT(_size, "Containers::SmallArray::front(): array is empty", _data[0]);
+    return _data[0];
+}
+
+template<std::size_t inlineCapacity, class T> T& SmallArray<inlineCapacity, T>::back() {
+    CORRADE_ASSERT(_size, "Containers::SmallArray::back(): array is empty", _data[0]);
+    return _data[_size - 1];
+}
+
+template<std::size_t inlineCapacity, class T> const T& SmallArray<inlineCapacity, T>::back() const {
+    CORRADE_ASSERT(_size, "Containers::SmallArray::back(): array is empty", _data[0]);
+    return _data[_size - 1];
+}
+
+template<std::size_t inlineCapacity, class T> std::size_t SmallArray<inlineCapacity, T>::reserve(const std::size_t capacity) {
+    if(capacity > _capacity) reallocate(capacity);
+    return _capacity;
+}
+
+template<std::size_t inlineCapacity, class T> void SmallArray<inlineCapacity, T>::resize(DefaultInitT, const std::size_t size) {
+    if(size < _size) removeSuffix(_size - size);
+    else for(T* it = growBy(size - _size), *end = _data + _size; it != end; ++it)
+        new(it) T;
+}
+
+template<std::size_t inlineCapacity, class T> void SmallArray<inlineCapacity, T>::resize(ValueInitT, const std::size_t size) {
+    if(size < _size) removeSuffix(_size - size);
+    else for(T* it = growBy(size - _size), *end = _data + _size; it != end; ++it)
+        new(it) T();
+}
+
+template<std::size_t inlineCapacity, class T> T& SmallArray<inlineCapacity, T>::append(const T& value) {
+    /* If the value points inside the array and the array is about to be
+       reallocated, it would be destroyed before getting copied. Copy it
+       aside first in that case. */
+    if(_size == _capacity && &value >= _data && &value < _data + _size) {
+        T copy(value);
+        return *new(growBy(1)) T(std::move(copy));
+    }
+    return *new(growBy(1)) T(value);
+}
+
+template<std::size_t inlineCapacity, class T> T& SmallArray<inlineCapacity, T>::append(T&& value) {
+    if(_size == _capacity && &value >= _data && &value < _data + _size) {
+        T copy(std::move(value));
+        return *new(growBy(1)) T(std::move(copy));
+    }
+    return *new(growBy(1)) T(std::move(value));
+}
+
+template<std::size_t inlineCapacity, class T> template<class ...Args> T& SmallArray<inlineCapacity, T>::append(InPlaceInitT, Args&&... args) {
+    /* Arguments can't alias the array the same way as in append(const T&),
+       as they would need to be of type T */
+    return *new(growBy(1)) T(std::forward<Args>(args)...);
+}
+
+template<std::size_t inlineCapacity, class T> ArrayView<T> SmallArray<inlineCapacity, T>::append(const ArrayView<const T> values) {
+    /* If the values are a part of the array, they get moved on reallocation.
+       Remember where they were and take them from the new location. */
+    const T* source = values.data();
+    if(source >= _data && source < _data + _size && _size + values.size() > _capacity) {
+        const std::size_t offset = source - _data;
+        reserve(Implementation::arrayGrowth(_capacity, _size + values.size(), sizeof(T)));
+        source = _data + offset;
+    }
+
+    T* const it = growBy(values.size());
+    for(std::size_t i = 0; i != values.size(); ++i)
+        new(it + i) T(source[i]);
+    return {it, values.size()};
+}
+
+template<std::size_t inlineCapacity, class T> void SmallArray<inlineCapacity, T>::removeSuffix(const std::size_t count) {
+    CORRADE_ASSERT(count <= _size,
+        "Containers::SmallArray::removeSuffix(): can't remove" << count << "elements from an array of size" << _size, );
+    Implementation::arrayDestruct<T>(_data + _size - count, _data + _size);
+    _size -= count;
+}
+
+}}
+
+#endif
@@ -0,0 +1,264 @@
+#ifndef Corrade_Containers_SpscQueue_h
+#define Corrade_Containers_SpscQueue_h
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Corrade::Containers::SpscQueue
+ */
+
+#include <atomic>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "Corrade/Containers/Array.h"
+#include "Corrade/Containers/ArrayView.h"
+
+namespace Corrade { namespace Containers {
+
+namespace Implementation {
+    /* Assumed cache line size */
+    enum: std::size_t { QueueCacheLineSize = 64 };
+
+    /* Index written by one side of a queue, padded on both sides so it
+       doesn't share a cache line with anything else. The cached value is a
+       copy of the other side's index, used only by SpscQueue. */
+    struct QueueIndex {
+        explicit QueueIndex(): value{0}, cached{0} {}
+
+        char paddingBefore[QueueCacheLineSize];
+        std::atomic<std::size_t> value;
+        std::size_t cached;
+        char paddingAfter[QueueCacheLineSize];
+    };
+
+    inline std::size_t queueCapacity(std::size_t capacity) {
+        std::size_t out = 2;
+        while(out < capacity) out <<= 1;
+        return out;
+    }
+}
+
+/**
+@brief Lock-free single-producer single-consumer queue
+@tparam T   Item type
+
+Bounded ring buffer for passing items from one thread to another. Exactly one
+thread is allowed to push and exactly one thread is allowed to pop at the same
+time, for multiple producers or consumers use @ref MpmcQueue. All operations
+are wait-free and never block --- they return @cpp false @ce or zero if the
+queue is full or empty and it's up to the caller what to do in that case.
+
+@code{.cpp}
+Containers::SpscQueue<Job> queue{1024};
+
+// Producer thread
+while(!queue.tryPush(job)) std::this_thread::yield();
+
+// Consumer thread
+Job job;
+if(queue.tryPop(job)) process(job);
+@endcode
+
+The producer and consumer indices are placed on separate cache lines and each
+side keeps a cached copy of the other side's index, so the threads touch each
+other's data only when the queue appears full or empty. The batch variants
+@ref tryPush(ArrayView<const T>) and @ref tryPop(ArrayView<T>) publish the
+whole range with a single atomic store.
+
+The class is neither copyable nor movable. The item type is required to be
+move-constructible and move-assignable.
+*/
+template<class T> class SpscQueue {
+    public:
+        /**
+         * @brief Constructor
+         *
+         * The @p capacity is rounded up to the next power of two, with a
+         * minimum of @cpp 2 @ce.
+         */
+        explicit SpscQueue(std::size_t capacity): _data{NoInit, Implementation::queueCapacity(capacity)}, _mask{_data.size() - 1} {}
+
+        /** @brief Copying is not allowed */
+        SpscQueue(const SpscQueue<T>&) = delete;
+
+        /** @brief Moving is not allowed */
+        SpscQueue(SpscQueue<T>&&) = delete;
+
+        /**
+         * @brief Destructor
+         *
+         * Destructs all items remaining in the queue. Expects that no other
+         * thread is accessing the queue anymore.
+         */
+        ~SpscQueue() {
+            const std::size_t tail = _tail.value.load(std::memory_order_acquire);
+            for(std::size_t i = _head.value.load(std::memory_order_acquire); i != tail; ++i)
+                slot(i).~T();
+        }
+
+        /** @brief Copying is not allowed */
+        SpscQueue<T>& operator=(const SpscQueue<T>&) = delete;
+
+        /** @brief Moving is not allowed */
+        SpscQueue<T>& operator=(SpscQueue<T>&&) = delete;
+
+        /** @brief Count of items the queue can hold */
+        std::size_t capacity() const { return _data.size(); }
+
+        /**
+         * @brief Count of items in the queue
+         *
+         * If called while other threads are pushing or popping, the value
+         * may be out of date already when returned.
+         */
+        std::size_t size() const {
+            const std::size_t head = _head.value.load(std::memory_order_acquire);
+            return _tail.value.load(std::memory_order_acquire) - head;
+        }
+
+        /**
+         * @brief Whether the queue is empty
+         *
+         * Same caveats as with @ref size() apply.
+         */
+        bool empty() const { return !size(); }
+
+        /**
+         * @brief Try to construct an item in place
+         *
+         * Returns @cpp false @ce if the queue is full, otherwise constructs
+         * the item from @p args and returns @cpp true @ce. Can be called only
+         * from the producer thread.
+         */
+        template<class ...Args> bool tryEmplace(Args&&... args) {
+            const std::size_t tail = _tail.value.load(std::memory_order_relaxed);
+            if(freeSlots(tail) == 0) return false;
+
+            new(&slot(tail)) T(std::forward<Args>(args)...);
+            _tail.value.store(tail + 1, std::memory_order_release);
+            return true;
+        }
+
+        /**
+         * @brief Try to push an item
+         *
+         * Equivalent to calling @ref tryEmplace() with @p value.
+         */
+        bool tryPush(const T& value) { return tryEmplace(value); }
+
+        /** @overload */
+        bool tryPush(T&& value) { return tryEmplace(std::move(value)); }
+
+        /**
+         * @brief Try to push a range of items
+         *
+         * Copies as many items from the front of @p values as there's space
+         * for and returns their count. Can be called only from the producer
+         * thread.
+         */
+        std::size_t tryPush(ArrayView<const T> values) {
+            const std::size_t tail = _tail.value.load(std::memory_order_relaxed);
+            const std::size_t free = freeSlots(tail, values.size());
+            const std::size_t count = free < values.size() ? free : values.size();
+
+            for(std::size_t i = 0; i != count; ++i)
+                new(&slot(tail + i)) T(values[i]);
+            if(count) _tail.value.store(tail + count, std::memory_order_release);
+            return count;
+        }
+
+        /**
+         * @brief Try to pop an item
+         *
+         * Returns @cpp false @ce if the queue is empty, otherwise moves the
+         * front item to @p out and returns @cpp true @ce. Can be called only
+         * from the consumer thread.
+         */
+        bool tryPop(T& out) {
+            const std::size_t head = _head.value.load(std::memory_order_relaxed);
+            if(usedSlots(head) == 0) return false;
+
+            T& item = slot(head);
+            out = std::move(item);
+            item.~T();
+            _head.value.store(head + 1, std::memory_order_release);
+            return true;
+        }
+
+        /**
+         * @brief Try to pop a range of items
+         *
+         * Moves as many items as available, but at most @cpp out.size() @ce,
+         * to the front of @p out and returns their count. Can be called only
+         * from the consumer thread.
+         */
+        std::size_t tryPop(ArrayView<T> out) {
+            const std::size_t head = _head.value.load(std::memory_order_relaxed);
+            const std::size_t used = usedSlots(head, out.size());
+            const std::size_t count = used < out.size() ? used : out.size();
+
+            for(std::size_t i = 0; i != count; ++i) {
+                T& item = slot(head + i);
+                out[i] = std::move(item);
+                item.~T();
+            }
+            if(count) _head.value.store(head + count, std::memory_order_release);
+            return count;
+        }
+
+    private:
+        typedef typename std::aligned_storage<sizeof(T), alignof(T)>::type Storage;
+
+        T& slot(std::size_t i) {
+            return *reinterpret_cast<T*>(&_data[i & _mask]);
+        }
+
+        /* The cached index of the other side is refreshed only if it doesn't
+           indicate enough space */
+        std::size_t freeSlots(std::size_t tail, std::size_t wanted = 1) {
+            if(_data.size() - (tail - _tail.cached) < wanted)
+                _tail.cached = _head.value.load(std::memory_order_acquire);
+            return _data.size() - (tail - _tail.cached);
+        }
+
+        std::size_t usedSlots(std::size_t head, std::size_t wanted = 1) {
+            if(_head.cached - head < wanted)
+                _head.cached = _tail.value.load(std::memory_order_acquire);
+            return _head.cached - head;
+        }
+
+        /* Read-only after construction */
+        Array<Storage> _data;
+        std::size_t _mask;
+
+        /* Tail is written by the producer, head by the consumer */
+        Implementation::QueueIndex _tail, _head;
+};
+
+}}
+
+#endif
@@ -35,6 +35,8 @@
 #include "Corrade/configure.h"
 #include "Corrade/Containers/ArrayView.h"
 #include "Corrade/Containers/Tags.h"
+#include "Corrade/Containers/sequenceHelpers.h"
+#include "Corrade/Utility/TypeTraits.h"
 
 #ifdef CORRADE_BUILD_DEPRECATED
 #include "Corrade/Utility/Macros.h"
@@ -42,6 +44,35 @@
 
 namespace Corrade { namespace Containers {
 
+namespace Implementation {
+    /* Storage is split into a base so the array is a literal type (and thus
+       usable in constexpr context) for trivially destructible types, which
+       requires it to not have a user-provided destructor */
+    template<std::size_t size_, class T, bool = Utility::IsTriviallyDestructible<T>::value> struct StaticArrayData {
+        explicit StaticArrayData(NoInitT) {}
+        constexpr explicit StaticArrayData(ValueInitT): _data{} {}
+        template<class ...Args> constexpr explicit StaticArrayData(InPlaceInitT, Args&&... args): _data{std::forward<Args>(args)...} {}
+
+        union {
+            T _data[size_];
+        };
+    };
+
+    template<std::size_t size_, class T> struct StaticArrayData<size_, T, false> {
+        explicit StaticArrayData(NoInitT) {}
+        explicit StaticArrayData(ValueInitT): _data{} {}
+        template<class ...Args> explicit StaticArrayData(InPlaceInitT, Args&&... args): _data{std::forward<Args>(args)...} {}
+
+        ~StaticArrayData() {
+            for(T& i: _data) i.~T();
+        }
+
+        union {
+            T _data[size_];
+        };
+    };
+}
+
 /**
 @brief Static array wrapper
 @tparam size_   Array size
@@ -81,6 +112,8 @@ is possible to initialize the array in a different way using so-called *tags*:
 -   @ref StaticArray(NoInitT) does not initialize anything and you need to call
     the constructor on all elements manually using placement new,
     @ref std::uninitialized_copy() or similar. This is the dangerous option.
+-   @ref StaticArray(GeneratorInitT, F&&) initializes each element with
+    a value returned by a function called with the element index.
 
 Example:
 
@@ -111,11 +144,41 @@ int index = 0;
 for(Foo& f: e) new(&f) Foo(index++);
 @endcode
 
+@section Containers-StaticArray-constexpr Compile-time lookup tables
+
+If @p T is trivially destructible, the array is a literal type and the
+@ref StaticArray(ValueInitT), @ref StaticArray(InPlaceInitT, Args&&... args)
+and @ref StaticArray(GeneratorInitT, F&&) constructors together with
+all @cpp const @ce element access can be used in a @cpp constexpr @ce context.
+That makes it possible to compute lookup tables at compile time instead of
+filling them in a static initializer on startup:
+
+@code{.cpp}
+constexpr std::uint32_t crc32(std::uint32_t c, int i = 0) {
+    return i == 8 ? c : crc32(c & 1 ? 0xedb88320u ^ (c >> 1) : c >> 1, i + 1);
+}
+constexpr std::uint32_t crc32Entry(std::size_t i) {
+    return crc32(std::uint32_t(i));
+}
+
+// Table of 256 values, computed by the compiler
+constexpr Containers::StaticArray<256, std::uint32_t> Crc32Table{
+    Containers::GeneratorInit, crc32Entry};
+static_assert(Crc32Table[1] == 0x77073096u, "");
+@endcode
+
+Note that C++11 @cpp constexpr @ce functions are restricted to a single
+@cpp return @ce statement, lambdas can't be used as generators until C++17.
+
 @see @ref arrayCast(StaticArray<size, T>&)
 */
 /* Underscore at the end to avoid conflict with member size(). It's ugly, but
    having count instead of size_ would make the naming horribly inconsistent. */
-template<std::size_t size_, class T> class StaticArray {
+template<std::size_t size_, class T> class StaticArray
+    #ifndef DOXYGEN_GENERATING_OUTPUT
+    : Implementation::StaticArrayData<size_, T>
+    #endif
+{
     public:
         enum: std::size_t {
             Size = size_    /**< Array size */
@@ -142,7 +205,7 @@ template<std::size_t size_, class T> class StaticArray {
          * them to zero.
          * @see @ref ValueInit, @ref StaticArray(DefaultInitT)
          */
-        explicit StaticArray(ValueInitT): _data{} {}
+        constexpr explicit StaticArray(ValueInitT): Data{ValueInit} {}
 
         /**
          * @brief Construct the array without initializing its contents
@@ -156,7 +219,7 @@ template<std::size_t size_, class T> class StaticArray {
          *      of whether they were properly constructed or not.
          * @see @ref NoInit, @ref StaticArray(DirectInitT, Args&&... args)
          */
-        explicit StaticArray(NoInitT) {}
+        explicit StaticArray(NoInitT): Data{NoInit} {}
 
         /**
          * @brief Construct direct-initialized array
@@ -174,10 +237,22 @@ template<std::size_t size_, class T> class StaticArray {
          * The arguments are forwarded to the array constructor.
          * @see @ref StaticArray(DirectInitT, Args&&... args)
          */
-        template<class ...Args> explicit StaticArray(InPlaceInitT, Args&&... args): _data{std::forward<Args>(args)...} {
+        template<class ...Args> constexpr explicit StaticArray(InPlaceInitT, Args&&... args): Data{InPlaceInit, std::forward<Args>(args)...} {
             static_assert(sizeof...(args) == size_, "Containers::StaticArray: wrong number of initializers");
         }
 
+        /**
+         * @brief Construct array using a generator function
+         *
+         * Initializes each element with @cpp generator(i) @ce, where @p i is
+         * the element index, converted to @p T. If @p generator is a
+         * @cpp constexpr @ce function or a functor with a @cpp constexpr @ce
+         * call operator, the array can be constructed at compile time. See
+         * @ref Containers-StaticArray-constexpr for an example.
+         * @see @ref StaticArray(InPlaceInitT, Args&&... args)
+         */
+        template<class F> constexpr explicit StaticArray(GeneratorInitT, F&& generator): StaticArray{GeneratorInit, typename Implementation::GenerateSequence<size_>::Type{}, generator} {}
+
         /**
          * @brief Construct default-initialized array
          *
@@ -195,7 +270,7 @@ template<std::size_t size_, class T> class StaticArray {
         #ifdef DOXYGEN_GENERATING_OUTPUT
         template<class ...Args> explicit StaticArray(Args&&... args);
         #else
-        template<class First, class ...Next> explicit StaticArray(First&& first, Next&&... next): StaticArray{InPlaceInit, std::forward<First>(first), std::forward<Next>(next)...} {}
+        template<class First, class ...Next> constexpr explicit StaticArray(First&& first, Next&&... next): StaticArray{InPlaceInit, std::forward<First>(first), std::forward<Next>(next)...} {}
         #endif
 
         /** @brief Copying is not allowed */
@@ -204,8 +279,6 @@ template<std::size_t size_, class T> class StaticArray {
         /** @brief Moving is not allowed */
         StaticArray(StaticArray<size_, T>&&) = delete;
 
-        ~StaticArray();
-
         /** @brief Copying is not allowed */
         StaticArray<size_, T>& operator=(const StaticArray<size_, T>&) = delete;
 
@@ -242,13 +315,13 @@ template<std::size_t size_, class T> class StaticArray {
         #else
         template<class U, class V = typename std::enable_if<std::is_convertible<T*, U*>::value || std::is_convertible<T*, const U*>::value>::type>
         #endif
-        /*implicit*/ operator ArrayView<const U>() const noexcept {
+        constexpr /*implicit*/ operator ArrayView<const U>() const noexcept {
             static_assert(sizeof(T) == sizeof(U), "type sizes are not compatible");
             return {_data, size_};
         }
 
         /** @overload */
-        /*implicit*/ operator ArrayView<const void>() const noexcept {
+        constexpr /*implicit*/ operator ArrayView<const void>() const noexcept {
             /* Yes, the size is properly multiplied by sizeof(T) by the constructor */
             return {_data, size_};
         }
@@ -283,7 +356,7 @@ template<std::size_t size_, class T> class StaticArray {
         #else
         template<class U, class V = typename std::enable_if<std::is_convertible<T*, U*>::value || std::is_convertible<T*, const U*>::value>::type>
         #endif
-        /*implicit*/ operator StaticArrayView<size_, const U>() const noexcept {
+        constexpr /*implicit*/ operator StaticArrayView<size_, const U>() const noexcept {
             static_assert(sizeof(T) == sizeof(U), "type sizes are not compatible");
             return StaticArrayView<size_, const U>{_data};
         }
@@ -300,7 +373,7 @@ template<std::size_t size_, class T> class StaticArray {
         { return _data; }
 
         /** @overload */
-        /*implicit*/ operator const T*() const
+        constexpr /*implicit*/ operator const T*() const
         #ifndef CORRADE_GCC47_COMPATIBILITY
         &
         #endif
@@ -308,7 +381,7 @@ template<std::size_t size_, class T> class StaticArray {
 
         /** @brief Array data */
         T* data() { return _data; }
-        const T* data() const { return _data; }             /**< @overload */
+        constexpr const T* data() const { return _data; }   /**< @overload */
 
         /**
          * @brief Array size
@@ -326,13 +399,13 @@ template<std::size_t size_, class T> class StaticArray {
 
         /** @brief Pointer to first element */
         T* begin() { return _data; }
-        const T* begin() const { return _data; }            /**< @overload */
-        const T* cbegin() const { return _data; }           /**< @overload */
+        constexpr const T* begin() const { return _data; }  /**< @overload */
+        constexpr const T* cbegin() const { return _data; } /**< @overload */
 
         /** @brief Pointer to (one item after) last element */
         T* end() { return _data + size_; }
-        const T* end() const { return _data + size_; }      /**< @overload */
-        const T* cend() const { return _data + size_; }     /**< @overload */
+        constexpr const T* end() const { return _data + size_; } /**< @overload */
+        constexpr const T* cend() const { return _data + size_; } /**< @overload */
 
         /**
          * @brief Reference to array slice
@@ -408,21 +481,22 @@ template<std::size_t size_, class T> class StaticArray {
         ArrayView<const T> suffix(std::size_t begin) const { return suffix(_data + begin); } /**< @overload */
 
     private:
-        explicit StaticArray(DefaultInitT, std::true_type) {}
+        typedef Implementation::StaticArrayData<size_, T> Data;
+        using Data::_data;
+
+        explicit StaticArray(DefaultInitT, std::true_type): Data{NoInit} {}
         /* GCC 5.3 is not able to initialize non-movable types inside
            constructor initializer list. Reported here:
            https://gcc.gnu.org/bugzilla/show_bug.cgi?id=70395 */
         #if !defined(__GNUC__) || defined(__clang__)
-        explicit StaticArray(DefaultInitT, std::false_type): _data{} {}
+        explicit StaticArray(DefaultInitT, std::false_type): Data{ValueInit} {}
         #else
-        explicit StaticArray(DefaultInitT, std::false_type) {
+        explicit StaticArray(DefaultInitT, std::false_type): Data{NoInit} {
             for(T& i: _data) new(&i) T{};
         }
         #endif
 
-        union {
-            T _data[size_];
-        };
+        template<class F, std::size_t ...sequence> constexpr explicit StaticArray(GeneratorInitT, Implementation::Sequence<sequence...>, F& generator): Data{InPlaceInit, static_cast<T>(generator(sequence))...} {}
 };
 
 /** @relatesalso StaticArray
@@ -527,10 +601,6 @@ template<std::size_t size_, class T> template<class ...Args> StaticArray<size_,
     }
 }
 
-template<std::size_t size_, class T> StaticArray<size_, T>::~StaticArray() {
-    for(T& i: _data) i.~T();
-}
-
 }}
 
 #endif
@@ -0,0 +1,637 @@
+#ifndef Corrade_Containers_StridedArrayView_h
+#define Corrade_Containers_StridedArrayView_h
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Corrade::Containers::StridedArrayView, @ref Corrade::Containers::StridedDimensions, @ref Corrade::Containers::StridedIterator, alias @ref Corrade::Containers::StridedArrayView1D, @ref Corrade::Containers::StridedArrayView2D, @ref Corrade::Containers::StridedArrayView3D
+ */
+
+#include <cstddef>
+#include <type_traits>
+
+#include "Corrade/Containers/ArrayView.h"
+#include "Corrade/Utility/Assert.h"
+
+namespace Corrade { namespace Containers {
+
+namespace Implementation {
+    template<unsigned, class> struct StridedElement;
+    template<class T, unsigned dimensions> StridedDimensions<dimensions, std::ptrdiff_t> stridesFor(const StridedDimensions<dimensions, std::size_t>& size);
+}
+
+/**
+@brief Multi-dimensional size and stride for @ref StridedArrayView
+
+Fixed-size array of @p dimensions values, used as
+@ref StridedArrayView::Size (with @p T being @ref std::size_t) and
+@ref StridedArrayView::Stride (with @p T being @ref std::ptrdiff_t). The
+one-dimensional variant is implicitly convertible from and to @p T.
+*/
+template<unsigned dimensions, class T> class StridedDimensions {
+    static_assert(dimensions, "can't have zero dimensions");
+
+    public:
+        typedef T Type; /**< @brief Underlying type */
+
+        /** @brief Default constructor, zero-initializes all values */
+        constexpr /*implicit*/ StridedDimensions() noexcept: _data{} {}
+
+        /**
+         * @brief Constructor
+         *
+         * Expects exactly @p dimensions values.
+         */
+        template<class ...Args> constexpr /*implicit*/ StridedDimensions(T first, Args... next) noexcept: _data{first, T(next)...} {
+            static_assert(sizeof...(Args) + 1 == dimensions, "wrong value count");
+        }
+
+        /** @brief Conversion to the underlying type, available only if @p dimensions is 1 */
+        template<unsigned d = dimensions, class = typename std::enable_if<d == 1>::type> constexpr /*implicit*/ operator T() const {
+            return _data[0];
+        }
+
+        /** @brief Equality comparison */
+        bool operator==(const StridedDimensions<dimensions, T>& other) const {
+            for(std::size_t i = 0; i != dimensions; ++i)
+                if(_data[i] != other._data[i]) return false;
+            return true;
+        }
+
+        /** @brief Non-equality comparison */
+        bool operator!=(const StridedDimensions<dimensions, T>& other) const {
+            return !operator==(other);
+        }
+
+        /** @brief Value at given position */
+        T& operator[](std::size_t i) { return _data[i]; }
+        constexpr T operator[](std::size_t i) const { return _data[i]; } /**< @overload */
+
+        /** @brief Pointer to first value */
+        T* begin() { return _data; }
+        constexpr const T* begin() const { return _data; } /**< @overload */
+        constexpr const T* cbegin() const { return _data; } /**< @overload */
+
+        /** @brief Pointer to (one item after) last value */
+        T* end() { return _data + dimensions; }
+        constexpr const T* end() const { return _data + dimensions; } /**< @overload */
+        constexpr const T* cend() const { return _data + dimensions; } /**< @overload */
+
+    private:
+        T _data[dimensions];
+};
+
+/**
+@brief Multi-dimensional array view with size and stride information
+
+Immutable wrapper around a range of data where consecutive items are not
+necessarily contiguous in memory, for example a single field of an array of
+structs. Each dimension has a size and a *byte* stride, which can be also
+zero (repeating the same item) or negative (iterating backwards). Similarly to
+@ref ArrayView, the class doesn't do any memory management and all operations
+on it, including slicing, transposition and flipping, are done without copying
+the data.
+
+Usage example:
+
+@code{.cpp}
+struct Vertex {
+    float position[3];
+    std::uint32_t color;
+};
+
+Containers::ArrayView<Vertex> vertices;
+
+// A view on colors of all vertices
+Containers::StridedArrayView1D<std::uint32_t> colors{vertices,
+    &vertices[0].color, vertices.size(), sizeof(Vertex)};
+
+// Every color in reverse order
+for(std::uint32_t c: colors.flipped<0>()) { ... }
+@endcode
+
+A view with more than one dimension returns a view of one dimension less
+from @ref operator[](), a one-dimensional view returns a reference to the
+item. The dimensions can be arbitrarily rearranged with @ref transposed()
+--- for example, interpreting an image as a 2D view of pixels, a transposed
+view goes over columns instead of rows:
+
+@code{.cpp}
+Containers::ArrayView<const std::uint32_t> pixels;
+
+// 256 rows of 128 pixels each
+Containers::StridedArrayView2D<const std::uint32_t> image{pixels,
+    {256, 128}, {128*4, 4}};
+
+// 128 columns of 256 pixels each
+Containers::StridedArrayView2D<const std::uint32_t> columns =
+    image.transposed<0, 1>();
+@endcode
+
+@section Containers-StridedArrayView-contiguous Contiguous views
+
+Contiguous multi-dimensional data such as images can be viewed with just a
+size, the strides are then calculated so the last dimension is tightly packed:
+
+@code{.cpp}
+// The same as above, strides are {128*4, 4}
+Containers::StridedArrayView2D<const std::uint32_t> image{pixels, {256, 128}};
+@endcode
+
+A view can be queried whether it's contiguous with @ref isContiguous(), either
+as a whole or just from given dimension onward, and a contiguous view can be
+converted back to an @ref ArrayView using @ref asContiguous(). Slicing a
+contiguous image to a sub-rectangle makes it non-contiguous in the first
+dimension, but the rows are still contiguous. That's what
+@ref Utility::copy() uses to copy whole rows at once instead of going
+element by element.
+
+A contiguous @ref ArrayView or @ref StaticArrayView is implicitly convertible
+to a one-dimensional strided view. Views on data memory-mapped using
+@ref Utility::Directory::mapRead() can be created directly from the mapped
+@ref Array, as it converts to @ref ArrayView.
+
+@see @ref StridedArrayView1D, @ref StridedArrayView2D,
+    @ref StridedArrayView3D
+*/
+/* All member functions are const because the view doesn't own the data */
+template<unsigned dimensions, class T> class StridedArrayView {
+    static_assert(dimensions, "can't have zero dimensions");
+
+    public:
+        typedef T Type; /**< @brief Underlying type */
+
+        /**
+         * @brief Element type
+         *
+         * For @ref StridedArrayView1D equivalent to a reference to @ref Type,
+         * for higher dimensions a strided view of one dimension less.
+         */
+        typedef typename std::conditional<dimensions == 1, T&, StridedArrayView<dimensions - 1, T>>::type ElementType;
+
+        /** @brief Type for the erased data pointer */
+        typedef typename std::conditional<std::is_const<T>::value, const void, void>::type ErasedType;
+
+        /** @brief Size values */
+        typedef StridedDimensions<dimensions, std::size_t> Size;
+
+        /** @brief Stride values */
+        typedef StridedDimensions<dimensions, std::ptrdiff_t> Stride;
+
+        /** @brief Conversion from `nullptr` */
+        constexpr /*implicit*/ StridedArrayView(std::nullptr_t) noexcept: _data{}, _size{}, _stride{} {}
+
+        /**
+         * @brief Default constructor
+         *
+         * Creates an empty view. Copy a non-empty @ref Array or
+         * @ref ArrayView onto the instance to make it useful.
+         */
+        constexpr /*implicit*/ StridedArrayView() noexcept: _data{}, _size{}, _stride{} {}
+
+        /**
+         * @brief Construct a view with explicit size and stride
+         * @param data      Continuous view on the data
+         * @param member    Pointer to the first member of the strided view
+         * @param size      Data size
+         * @param stride    Data stride in bytes
+         *
+         * The @p data view is used only for a bounds check --- expects that
+         * all items addressed by @p member, @p size and @p stride lie inside
+         * @p data. If any of the @p size values is zero, the view is empty
+         * and no check is done.
+         */
+        StridedArrayView(ArrayView<const void> data, T* member, const Size& size, const Stride& stride) noexcept;
+
+        /**
+         * @brief Construct a view with explicit size and stride
+         *
+         * Equivalent to calling @ref StridedArrayView(ArrayView<const void>, T*, const Size&, const Stride&)
+         * with @p data as the first parameter and @cpp data.data() @ce as the
+         * second parameter.
+         */
+        StridedArrayView(ArrayView<T> data, const Size& size, const Stride& stride) noexcept: StridedArrayView{data, data.data(), size, stride} {}
+
+        /**
+         * @brief Construct a contiguous view
+         *
+         * Equivalent to calling @ref StridedArrayView(ArrayView<T>, const Size&, const Stride&)
+         * with stride of the last dimension being @cpp sizeof(T) @ce and
+         * each preceding stride being a product of the next stride and size.
+         * @see @ref isContiguous()
+         */
+        StridedArrayView(ArrayView<T> data, const Size& size) noexcept: StridedArrayView{data, data.data(), size, Implementation::stridesFor<T>(size)} {}
+
+        /**
+         * @brief Construct a view on @ref ArrayView
+         *
+         * Enabled only on one-dimensional views and if @cpp U* @ce is
+         * implicitly convertible to @cpp T* @ce and both have the same size.
+         * The stride is set to @cpp sizeof(T) @ce.
+         */
+        template<class U, unsigned d = dimensions, class = typename std::enable_if<d == 1 && std::is_convertible<U*, T*>::value && sizeof(U) == sizeof(T)>::type> constexpr /*implicit*/ StridedArrayView(ArrayView<U> view) noexcept: _data{view.data()}, _size{view.size()}, _stride{std::ptrdiff_t(sizeof(T))} {}
+
+        /**
+         * @brief Construct a view on @ref StaticArrayView
+         *
+         * Enabled only on one-dimensional views and if @cpp U* @ce is
+         * implicitly convertible to @cpp T* @ce and both have the same size.
+         * The stride is set to @cpp sizeof(T) @ce.
+         */
+        template<std::size_t size, class U, unsigned d = dimensions, class = typename std::enable_if<d == 1 && std::is_convertible<U*, T*>::value && sizeof(U) == sizeof(T)>::type> constexpr /*implicit*/ StridedArrayView(StaticArrayView<size, U> view) noexcept: _data{view.data()}, _size{size}, _stride{std::ptrdiff_t(sizeof(T))} {}
+
+        /**
+         * @brief Construct a view on a fixed-size array
+         *
+         * Enabled only on one-dimensional views and if @cpp U* @ce is
+         * implicitly convertible to @cpp T* @ce and both have the same size.
+         * The stride is set to @cpp sizeof(T) @ce.
+         */
+        template<std::size_t size, class U, unsigned d = dimensions, class = typename std::enable_if<d == 1 && std::is_convertible<U*, T*>::value && sizeof(U) == sizeof(T)>::type> constexpr /*implicit*/ StridedArrayView(U(&data)[size]) noexcept: _data{data}, _size{size}, _stride{std::ptrdiff_t(sizeof(T))} {}
+
+        /**
+         * @brief Construct a view on @ref StridedArrayView
+         *
+         * Enabled only if @p T is @cpp const U @ce.
+         */
+        template<class U, class = typename std::enable_if<std::is_same<const U, T>::value>::type> constexpr /*implicit*/ StridedArrayView(StridedArrayView<dimensions, U> view) noexcept: _data{view._data}, _size{view._size}, _stride{view._stride} {}
+
+        /** @brief Type-erased data pointer, pointing to the first item */
+        constexpr ErasedType* data() const { return _data; }
+
+        /**
+         * @brief Array size
+         *
+         * Returns just @ref std::size_t instead of @ref Size for the
+         * one-dimensional case so the usual numeric operations work as
+         * expected.
+         */
+        constexpr typename std::conditional<dimensions == 1, std::size_t, const Size&>::type size() const { return _size; }
+
+        /**
+         * @brief Array stride
+         *
+         * Returns just @ref std::ptrdiff_t instead of @ref Stride for the
+         * one-dimensional case so the usual numeric operations work as
+         * expected.
+         */
+        constexpr typename std::conditional<dimensions == 1, std::ptrdiff_t, const Stride&>::type stride() const { return _stride; }
+
+        /** @brief Whether the array is empty in any dimension */
+        bool empty() const {
+            for(std::size_t i = 0; i != dimensions; ++i)
+                if(!_size[i]) return true;
+            return false;
+        }
+
+        /**
+         * @brief Whether the view is contiguous from given dimension further
+         *
+         * The view is contiguous if the stride of the last dimension is
+         * @cpp sizeof(T) @ce and stride of each preceding dimension up to
+         * @p dimension is a product of the next stride and size. Strides of
+         * dimensions with size @cpp 1 @ce are not taken into account.
+         * @see @ref asContiguous()
+         */
+        template<unsigned dimension = 0> bool isContiguous() const;
+
+        /**
+         * @brief Convert the view to a contiguous one
+         *
+         * Returns a view containing all elements. Expects that the view is
+         * contiguous in all dimensions.
+         * @see @ref isContiguous()
+         */
+        ArrayView<T> asContiguous() const;
+
+        /** @brief Element access */
+        ElementType operator[](std::size_t i) const;
+
+        /** @brief Iterator to first element */
+        StridedIterator<dimensions, T> begin() const { return {_data, _size, _stride, 0}; }
+        /** @overload */
+        StridedIterator<dimensions, T> cbegin() const { return {_data, _size, _stride, 0}; }
+
+        /** @brief Iterator to (one item after) last element */
+        StridedIterator<dimensions, T> end() const { return {_data, _size, _stride, _size[0]}; }
+        /** @overload */
+        StridedIterator<dimensions, T> cend() const { return {_data, _size, _stride, _size[0]}; }
+
+        /**
+         * @brief First element
+         *
+         * Expects there is at least one element.
+         */
+        ElementType front() const;
+
+        /**
+         * @brief Last element
+         *
+         * Expects there is at least one element.
+         */
+        ElementType back() const;
+
+        /**
+         * @brief Array slice
+         *
+         * Both arguments are expected to be in range, @p begin not larger
+         * than @p end in any dimension. Stride is kept unchanged.
+         */
+        StridedArrayView<dimensions, T> slice(const Size& begin, const Size& end) const;
+
+        /**
+         * @brief Array prefix
+         *
+         * Equivalent to @cpp data.slice({}, end) @ce.
+         */
+        StridedArrayView<dimensions, T> prefix(const Size& end) const {
+            return slice({}, end);
+        }
+
+        /**
+         * @brief Array suffix
+         *
+         * Equivalent to @cpp data.slice(begin, data.size()) @ce.
+         */
+        StridedArrayView<dimensions, T> suffix(const Size& begin) const {
+            return slice(begin, _size);
+        }
+
+        /**
+         * @brief Transpose two dimensions
+         *
+         * Exchanges dimensions @p dimensionA and @p dimensionB by swapping
+         * their size and stride values. The data pointer is kept unchanged.
+         */
+        template<unsigned dimensionA, unsigned dimensionB> StridedArrayView<dimensions, T> transposed() const;
+
+        /**
+         * @brief Flip a dimension
+         *
+         * Flips given @p dimension by making its stride negative and moving
+         * the data pointer to the last item in that dimension.
+         */
+        template<unsigned dimension> StridedArrayView<dimensions, T> flipped() const;
+
+    private:
+        template<unsigned, class> friend class StridedArrayView;
+        friend StridedIterator<dimensions, T>;
+        template<unsigned, class> friend struct Implementation::StridedElement;
+
+        typedef typename std::conditional<std::is_const<T>::value, const char, char>::type ByteType;
+
+        /* Used by element access and slicing to avoid the bounds check */
+        constexpr explicit StridedArrayView(const Size& size, const Stride& stride, ErasedType* data) noexcept: _data{data}, _size{size}, _stride{stride} {}
+
+        ErasedType* _data;
+        Size _size;
+        Stride _stride;
+};
+
+/**
+@brief One-dimensional strided array view
+
+Convenience alternative to @cpp StridedArrayView<1, T> @ce. See
+@ref StridedArrayView for more information.
+@see @ref StridedArrayView2D, @ref StridedArrayView3D
+*/
+template<class T> using StridedArrayView1D = StridedArrayView<1, T>;
+
+/**
+@brief Two-dimensional strided array view
+
+Convenience alternative to @cpp StridedArrayView<2, T> @ce. See
+@ref StridedArrayView for more information.
+@see @ref StridedArrayView1D, @ref StridedArrayView3D
+*/
+template<class T> using StridedArrayView2D = StridedArrayView<2, T>;
+
+/**
+@brief Three-dimensional strided array view
+
+Convenience alternative to @cpp StridedArrayView<3, T> @ce. See
+@ref StridedArrayView for more information.
+@see @ref StridedArrayView1D, @ref StridedArrayView2D
+*/
+template<class T> using StridedArrayView3D = StridedArrayView<3, T>;
+
+/**
+@brief Strided array view iterator
+
+Used by @ref StridedArrayView to provide iterator access to its items.
+*/
+template<unsigned dimensions, class T> class StridedIterator {
+    public:
+        /** @brief Element type */
+        typedef typename StridedArrayView<dimensions, T>::ElementType ElementType;
+
+        #ifndef DOXYGEN_GENERATING_OUTPUT
+        /* Used only by StridedArrayView::begin() and end() */
+        /*implicit*/ StridedIterator(typename StridedArrayView<dimensions, T>::ErasedType* data, const StridedDimensions<dimensions, std::size_t>& size, const StridedDimensions<dimensions, std::ptrdiff_t>& stride, std::size_t i) noexcept: _data{data}, _size{size}, _stride{stride}, _i{i} {}
+        #endif
+
+        /** @brief Equality comparison */
+        bool operator==(const StridedIterator<dimensions, T>& other) const {
+            return _data == other._data && _stride == other._stride && _i == other._i;
+        }
+
+        /** @brief Non-equality comparison */
+        bool operator!=(const StridedIterator<dimensions, T>& other) const {
+            return !operator==(other);
+        }
+
+        /** @brief Less than comparison */
+        bool operator<(const StridedIterator<dimensions, T>& other) const {
+            return _i < other._i;
+        }
+
+        /** @brief Add an offset */
+        StridedIterator<dimensions, T> operator+(std::ptrdiff_t i) const {
+            return {_data, _size, _stride, _i + i};
+        }
+
+        /** @brief Subtract an offset */
+        StridedIterator<dimensions, T> operator-(std::ptrdiff_t i) const {
+            return {_data, _size, _stride, _i - i};
+        }
+
+        /** @brief Iterator difference */
+        std::ptrdiff_t operator-(const StridedIterator<dimensions, T>& it) const {
+            return std::ptrdiff_t(_i) - std::ptrdiff_t(it._i);
+        }
+
+        /** @brief Go back to previous position */
+        StridedIterator<dimensions, T>& operator--() {
+            --_i;
+            return *this;
+        }
+
+        /** @brief Advance to next position */
+        StridedIterator<dimensions, T>& operator++() {
+            ++_i;
+            return *this;
+        }
+
+        /** @brief Dereference */
+        ElementType operator*() const {
+            return StridedArrayView<dimensions, T>{_size, _stride, _data}[_i];
+        }
+
+    private:
+        typename StridedArrayView<dimensions, T>::ErasedType* _data;
+        StridedDimensions<dimensions, std::size_t> _size;
+        StridedDimensions<dimensions, std::ptrdiff_t> _stride;
+        std::size_t _i;
+};
+
+namespace Implementation {
+    template<unsigned dimensions, class T> struct StridedElement {
+        static StridedArrayView<dimensions - 1, T> get(typename StridedArrayView<dimensions, T>::ErasedType* data, const StridedDimensions<dimensions, std::size_t>& size, const StridedDimensions<dimensions, std::ptrdiff_t>& stride) {
+            StridedDimensions<dimensions - 1, std::size_t> sizeTail;
+            StridedDimensions<dimensions - 1, std::ptrdiff_t> strideTail;
+            for(std::size_t i = 1; i != dimensions; ++i) {
+                sizeTail[i - 1] = size[i];
+                strideTail[i - 1] = stride[i];
+            }
+            return StridedArrayView<dimensions - 1, T>{sizeTail, strideTail, data};
+        }
+    };
+    template<class T> struct StridedElement<1, T> {
+        static T& get(typename StridedArrayView<1, T>::ErasedType* data, const StridedDimensions<1, std::size_t>&, const StridedDimensions<1, std::ptrdiff_t>&) {
+            return *static_cast<T*>(data);
+        }
+    };
+
+    /* Strides of a contiguous view with the last dimension tightly packed */
+    template<class T, unsigned dimensions> StridedDimensions<dimensions, std::ptrdiff_t> stridesFor(const StridedDimensions<dimensions, std::size_t>& size) {
+        StridedDimensions<dimensions, std::ptrdiff_t> stride;
+        std::ptrdiff_t nextStride = sizeof(T);
+        for(std::size_t i = dimensions; i != 0; --i) {
+            stride[i - 1] = nextStride;
+            nextStride *= size[i - 1];
+        }
+        return stride;
+    }
+}
+
+template<unsigned dimensions, class T> StridedArrayView<dimensions, T>::StridedArrayView(const ArrayView<const void> data, T* const member, const Size& size, const Stride& stride) noexcept: _data{member}, _size{size}, _stride{stride} {
+    #ifndef CORRADE_NO_ASSERT
+    /* Find the lowest and highest addressed byte relative to the data begin,
+       negative strides extend the range to the front */
+    const std::ptrdiff_t offset = static_cast<const char*>(static_cast<const void*>(member)) - static_cast<const char*>(data.data());
+    std::ptrdiff_t min = offset, max = offset + std::ptrdiff_t(sizeof(T));
+    bool empty = false;
+    for(std::size_t i = 0; i != dimensions; ++i) {
+        if(!size[i]) empty = true;
+        const std::ptrdiff_t extent = std::ptrdiff_t(size[i] - 1)*stride[i];
+        if(extent < 0) min += extent;
+        else max += extent;
+    }
+    CORRADE_ASSERT(empty || (min >= 0 && std::size_t(max) <= data.size()),
+        "Containers::StridedArrayView: data size" << data.size() << "is not enough for the view, expected bytes [" << Utility::Debug::nospace << min << Utility::Debug::nospace << ":" << Utility::Debug::nospace << max << Utility::Debug::nospace << "]", );
+    #else
+    static_cast<void>(data);
+    #endif
+}
+
+template<unsigned dimensions, class T> template<unsigned dimension> bool StridedArrayView<dimensions, T>::isContiguous() const {
+    static_assert(dimension < dimensions, "dimension out of range");
+
+    std::size_t nextStride = sizeof(T);
+    for(std::size_t i = dimensions; i != dimension; --i) {
+        if(_size[i - 1] != 1 && _stride[i - 1] != std::ptrdiff_t(nextStride))
+            return false;
+        nextStride *= _size[i - 1];
+    }
+    return true;
+}
+
+template<unsigned dimensions, class T> ArrayView<T> StridedArrayView<dimensions, T>::asContiguous() const {
+    CORRADE_ASSERT(isContiguous(), "Containers::StridedArrayView::asContiguous(): the view is not contiguous", {});
+    std::size_t size = 1;
+    for(std::size_t i = 0; i != dimensions; ++i) size *= _size[i];
+    return {static_cast<T*>(_data), size};
+}
+
+template<unsigned dimensions, class T> auto StridedArrayView<dimensions, T>::operator[](const std::size_t i) const -> ElementType {
+    CORRADE_ASSERT(i < _size[0], "Containers::StridedArrayView::operator[](): index" << i << "out of range for" << _size[0] << "elements",
+        (Implementation::StridedElement<dimensions, T>::get(_data, _size, _stride)));
+    return Implementation::StridedElement<dimensions, T>::get(static_cast<ByteType*>(_data) + i*_stride[0], _size, _stride);
+}
+
+template<unsigned dimensions, class T> auto StridedArrayView<dimensions, T>::front() const -> ElementType {
+    CORRADE_ASSERT(_size[0], "Containers::StridedArrayView::front(): view is empty",
+        (Implementation::StridedElement<dimensions, T>::get(_data, _size, _stride)));
+    return Implementation::StridedElement<dimensions, T>::get(_data, _size, _stride);
+}
+
+template<unsigned dimensions, class T> auto StridedArrayView<dimensions, T>::back() const -> ElementType {
+    CORRADE_ASSERT(_size[0], "Containers::StridedArrayView::back(): view is empty",
+        (Implementation::StridedElement<dimensions, T>::get(_data, _size, _stride)));
+    return Implementation::StridedElement<dimensions, T>::get(static_cast<ByteType*>(_data) + (_size[0] - 1)*_stride[0], _size, _stride);
+}
+
+template<unsigned dimensions, class T> StridedArrayView<dimensions, T> StridedArrayView<dimensions, T>::slice(const Size& begin, const Size& end) const {
+    ByteType* data = static_cast<ByteType*>(_data);
+    Size size;
+    for(std::size_t i = 0; i != dimensions; ++i) {
+        CORRADE_ASSERT(begin[i] <= end[i] && end[i] <= _size[i],
+            "Containers::StridedArrayView::slice(): slice [" << Utility::Debug::nospace
+            << begin << Utility::Debug::nospace << ":"
+            << Utility::Debug::nospace << end << Utility::Debug::nospace
+            << "] out of range for" << _size << "elements in dimension" << i, {});
+        data += std::ptrdiff_t(begin[i])*_stride[i];
+        size[i] = end[i] - begin[i];
+    }
+    return StridedArrayView<dimensions, T>{size, _stride, data};
+}
+
+template<unsigned dimensions, class T> template<unsigned dimensionA, unsigned dimensionB> StridedArrayView<dimensions, T> StridedArrayView<dimensions, T>::transposed() const {
+    static_assert(dimensionA < dimensions && dimensionB < dimensions,
+        "dimensions out of range");
+
+    Size size = _size;
+    Stride stride = _stride;
+    std::swap(size[dimensionA], size[dimensionB]);
+    std::swap(stride[dimensionA], stride[dimensionB]);
+    return StridedArrayView<dimensions, T>{size, stride, _data};
+}
+
+template<unsigned dimensions, class T> template<unsigned dimension> StridedArrayView<dimensions, T> StridedArrayView<dimensions, T>::flipped() const {
+    static_assert(dimension < dimensions, "dimension out of range");
+
+    /* An empty dimension has nothing to flip around, keep the pointer as-is
+       to avoid pointing outside of the original range */
+    ByteType* data = static_cast<ByteType*>(_data);
+    if(_size[dimension])
+        data += std::ptrdiff_t(_size[dimension] - 1)*_stride[dimension];
+    Stride stride = _stride;
+    stride[dimension] *= -1;
+    return StridedArrayView<dimensions, T>{_size, stride, data};
+}
+
+}}
+
+#endif
@@ -26,7 +26,7 @@
 */
 
 /** @file
- * @brief Tag type @ref Corrade::Containers::ValueInitT, @ref Corrade::Containers::DefaultInitT, @ref Corrade::Containers::NoInitT, @ref Corrade::Containers::DirectInitT, tag @ref Corrade::Containers::ValueInit, @ref Corrade::Containers::DefaultInit, @ref Corrade::Containers::NoInit, @ref Corrade::Containers::DirectInit
+ * @brief Tag type @ref Corrade::Containers::ValueInitT, @ref Corrade::Containers::DefaultInitT, @ref Corrade::Containers::NoInitT, @ref Corrade::Containers::DirectInitT, @ref Corrade::Containers::InPlaceInitT, @ref Corrade::Containers::GeneratorInitT, tag @ref Corrade::Containers::ValueInit, @ref Corrade::Containers::DefaultInit, @ref Corrade::Containers::NoInit, @ref Corrade::Containers::DirectInit, @ref Corrade::Containers::InPlaceInit, @ref Corrade::Containers::GeneratorInit
  */
 
 namespace Corrade { namespace Containers {
@@ -103,6 +103,21 @@ struct InPlaceInitT {
     #endif
 };
 
+/**
+@brief Generator initialization tag type
+
+Used to distinguish construction with each element initialized from a
+generator function.
+@see @ref GeneratorInit
+*/
+/* Explicit constructor to avoid ambiguous calls when using {} */
+struct GeneratorInitT {
+    #ifndef DOXYGEN_GENERATING_OUTPUT
+    struct Init{};
+    constexpr explicit GeneratorInitT(Init) {}
+    #endif
+};
+
 /**
 @brief Default initialization tag
 
@@ -140,6 +155,13 @@ Use for construction in-place.
 */
 constexpr InPlaceInitT InPlaceInit{InPlaceInitT::Init{}};
 
+/**
+@brief Generator initialization tag
+
+Use for construction with each element initialized from a generator function.
+*/
+constexpr GeneratorInitT GeneratorInit{GeneratorInitT::Init{}};
+
 }}
 
 #endif
@@ -0,0 +1,93 @@
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Corrade/Containers/ArenaAllocator.h"
+#include "Corrade/TestSuite/Tester.h"
+
+namespace Corrade { namespace Containers { namespace Test {
+
+struct ArenaAllocatorBenchmark: TestSuite::Tester {
+    explicit ArenaAllocatorBenchmark();
+
+    void smallAllocationsHeap();
+    void smallAllocationsArena();
+    void smallAllocationsArenaMarker();
+};
+
+enum: std::size_t {
+    Count = 1000,
+    MaxSize = 64
+};
+
+ArenaAllocatorBenchmark::ArenaAllocatorBenchmark() {
+    addBenchmarks({&ArenaAllocatorBenchmark::smallAllocationsHeap,
+                   &ArenaAllocatorBenchmark::smallAllocationsArena,
+                   &ArenaAllocatorBenchmark::smallAllocationsArenaMarker}, 10);
+}
+
+void ArenaAllocatorBenchmark::smallAllocationsHeap() {
+    Array<Array<int>> arrays{Count};
+    CORRADE_BENCHMARK(10) {
+        for(std::size_t i = 0; i != Count; ++i)
+            arrays[i] = Array<int>{Containers::NoInit, 1 + i % MaxSize};
+        for(Array<int>& a: arrays) a = nullptr;
+    }
+
+    CORRADE_VERIFY(!arrays[Count - 1]);
+}
+
+void ArenaAllocatorBenchmark::smallAllocationsArena() {
+    ArenaAllocator arena;
+    Array<Array<int>> arrays{Count};
+    CORRADE_BENCHMARK(10) {
+        for(std::size_t i = 0; i != Count; ++i)
+            arrays[i] = arena.allocate<int>(Containers::NoInit, 1 + i % MaxSize);
+        for(Array<int>& a: arrays) a = nullptr;
+        arena.reset();
+    }
+
+    CORRADE_VERIFY(!arrays[Count - 1]);
+}
+
+void ArenaAllocatorBenchmark::smallAllocationsArenaMarker() {
+    ArenaAllocator arena;
+    Array<int> persistent = arena.allocate<int>(Containers::ValueInit, 100);
+    const ArenaAllocator::Marker marker = arena.mark();
+
+    Array<Array<int>> arrays{Count};
+    CORRADE_BENCHMARK(10) {
+        for(std::size_t i = 0; i != Count; ++i)
+            arrays[i] = arena.allocate<int>(Containers::NoInit, 1 + i % MaxSize);
+        for(Array<int>& a: arrays) a = nullptr;
+        arena.rewind(marker);
+    }
+
+    CORRADE_VERIFY(!arrays[Count - 1]);
+    CORRADE_COMPARE(persistent[99], 0);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Corrade::Containers::Test::ArenaAllocatorBenchmark)
@@ -0,0 +1,310 @@
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <cstdint>
+
+#include "Corrade/Containers/ArenaAllocator.h"
+#include "Corrade/Containers/GrowableArray.h"
+#include "Corrade/TestSuite/Tester.h"
+
+namespace Corrade { namespace Containers { namespace Test {
+
+struct ArenaAllocatorTest: TestSuite::Tester {
+    explicit ArenaAllocatorTest();
+
+    void construct();
+    void constructMove();
+
+    void allocate();
+    void allocateValueInit();
+    void allocateNoInit();
+    void allocateNonTrivial();
+    void allocateZeroSize();
+    void allocateAligned();
+    void allocateLargerThanBlock();
+
+    void mark();
+    void rewind();
+    void reset();
+    void resetReusesBlocks();
+
+    void growFromArena();
+};
+
+ArenaAllocatorTest::ArenaAllocatorTest() {
+    addTests({&ArenaAllocatorTest::construct,
+              &ArenaAllocatorTest::constructMove,
+
+              &ArenaAllocatorTest::allocate,
+              &ArenaAllocatorTest::allocateValueInit,
+              &ArenaAllocatorTest::allocateNoInit,
+              &ArenaAllocatorTest::allocateNonTrivial,
+              &ArenaAllocatorTest::allocateZeroSize,
+              &ArenaAllocatorTest::allocateAligned,
+              &ArenaAllocatorTest::allocateLargerThanBlock,
+
+              &ArenaAllocatorTest::mark,
+              &ArenaAllocatorTest::rewind,
+              &ArenaAllocatorTest::reset,
+              &ArenaAllocatorTest::resetReusesBlocks,
+
+              &ArenaAllocatorTest::growFromArena});
+}
+
+namespace {
+
+struct Counted {
+    static int constructed;
+    static int destructed;
+
+    Counted(): a{1337} { ++constructed; }
+    ~Counted() { ++destructed; }
+
+    int a;
+};
+
+int Counted::constructed = 0;
+int Counted::destructed = 0;
+
+struct alignas(64) Aligned {
+    char a;
+};
+
+}
+
+void ArenaAllocatorTest::construct() {
+    ArenaAllocator a{1024};
+    CORRADE_COMPARE(a.blockSize(), 1024);
+    CORRADE_COMPARE(a.blockCount(), 0);
+
+    ArenaAllocator b;
+    CORRADE_COMPARE(b.blockSize(), 65536);
+}
+
+void ArenaAllocatorTest::constructMove() {
+    ArenaAllocator a{1024};
+    Array<int> data = a.allocate<int>(Containers::ValueInit, 3);
+    CORRADE_COMPARE(a.blockCount(), 1);
+
+    ArenaAllocator b = std::move(a);
+    CORRADE_COMPARE(a.blockCount(), 0);
+    CORRADE_COMPARE(b.blockCount(), 1);
+    CORRADE_COMPARE(b.blockSize(), 1024);
+
+    ArenaAllocator c{16};
+    c = std::move(b);
+    CORRADE_COMPARE(b.blockCount(), 0);
+    CORRADE_COMPARE(c.blockCount(), 1);
+    CORRADE_COMPARE(c.blockSize(), 1024);
+
+    /* The data is still accessible */
+    data[2] = 5;
+    CORRADE_COMPARE(data[2], 5);
+}
+
+void ArenaAllocatorTest::allocate() {
+    ArenaAllocator arena{1024};
+
+    Array<int> a = arena.allocate<int>(5);
+    CORRADE_VERIFY(a);
+    CORRADE_COMPARE(a.size(), 5);
+    CORRADE_VERIFY(a.deleter() == Implementation::arenaDeleter<int>);
+
+    /* Second allocation goes right after the first */
+    Array<int> b = arena.allocate<int>(3);
+    CORRADE_COMPARE(b.data(), a.data() + 5);
+    CORRADE_COMPARE(arena.blockCount(), 1);
+
+    for(std::size_t i = 0; i != 5; ++i) a[i] = int(i);
+    for(std::size_t i = 0; i != 3; ++i) b[i] = int(i*10);
+    CORRADE_COMPARE(a[4], 4);
+    CORRADE_COMPARE(b[2], 20);
+}
+
+void ArenaAllocatorTest::allocateValueInit() {
+    ArenaAllocator arena{1024};
+
+    /* Dirty the memory first */
+    {
+        Array<int> a = arena.allocate<int>(16);
+        for(int& i: a) i = 0xbadbeef;
+    }
+    arena.reset();
+
+    Array<int> b = arena.allocate<int>(Containers::ValueInit, 16);
+    for(int i: b) CORRADE_COMPARE(i, 0);
+}
+
+void ArenaAllocatorTest::allocateNoInit() {
+    ArenaAllocator arena;
+
+    Counted::constructed = Counted::destructed = 0;
+    {
+        Array<Counted> a = arena.allocate<Counted>(Containers::NoInit, 3);
+        CORRADE_COMPARE(Counted::constructed, 0);
+
+        for(Counted& i: a) new(&i) Counted;
+        CORRADE_COMPARE(Counted::constructed, 3);
+    }
+
+    CORRADE_COMPARE(Counted::destructed, 3);
+}
+
+void ArenaAllocatorTest::allocateNonTrivial() {
+    ArenaAllocator arena;
+
+    Counted::constructed = Counted::destructed = 0;
+    {
+        Array<Counted> a = arena.allocate<Counted>(4);
+        CORRADE_COMPARE(Counted::constructed, 4);
+        CORRADE_COMPARE(a[3].a, 1337);
+    }
+
+    /* Destructors are called by the array deleter, not the arena */
+    CORRADE_COMPARE(Counted::destructed, 4);
+}
+
+void ArenaAllocatorTest::allocateZeroSize() {
+    ArenaAllocator arena;
+
+    Array<int> a = arena.allocate<int>(0);
+    CORRADE_VERIFY(!a);
+    CORRADE_VERIFY(!a.deleter());
+    CORRADE_COMPARE(arena.blockCount(), 0);
+}
+
+void ArenaAllocatorTest::allocateAligned() {
+    ArenaAllocator arena{1024};
+
+    Array<char> a = arena.allocate<char>(3);
+    Array<Aligned> b = arena.allocate<Aligned>(2);
+    Array<char> c = arena.allocate<char>(1);
+    Array<double> d = arena.allocate<double>(1);
+    CORRADE_COMPARE(reinterpret_cast<std::uintptr_t>(b.data()) % 64, 0);
+    CORRADE_COMPARE(reinterpret_cast<std::uintptr_t>(d.data()) % alignof(double), 0);
+    CORRADE_VERIFY(c.data() >= reinterpret_cast<char*>(b.data() + 2));
+    CORRADE_COMPARE(arena.blockCount(), 1);
+}
+
+void ArenaAllocatorTest::allocateLargerThanBlock() {
+    ArenaAllocator arena{64};
+
+    Array<char> a = arena.allocate<char>(16);
+    CORRADE_COMPARE(arena.blockCount(), 1);
+
+    /* Doesn't fit into the rest of the block nor a new block, a dedicated
+       larger block gets allocated */
+    Array<char> b = arena.allocate<char>(1000);
+    CORRADE_COMPARE(arena.blockCount(), 2);
+    b[999] = 'a';
+
+    /* Doesn't fit into the rest of the large block, a new one is allocated */
+    Array<char> c = arena.allocate<char>(32);
+    CORRADE_COMPARE(arena.blockCount(), 3);
+}
+
+void ArenaAllocatorTest::mark() {
+    ArenaAllocator arena{1024};
+
+    ArenaAllocator::Marker marker = arena.mark();
+    Array<int> a = arena.allocate<int>(5);
+    arena.rewind(marker);
+
+    /* Rewinding to a marker of an empty arena gives back the same memory */
+    Array<int> b = arena.allocate<int>(5);
+    CORRADE_COMPARE(b.data(), a.data());
+}
+
+void ArenaAllocatorTest::rewind() {
+    ArenaAllocator arena{64};
+
+    Array<int> a = arena.allocate<int>(Containers::ValueInit, 4);
+    a[3] = 42;
+
+    ArenaAllocator::Marker marker = arena.mark();
+    const int* firstTemporary;
+    {
+        Array<int> b = arena.allocate<int>(4);
+        Array<int> c = arena.allocate<int>(100);
+        firstTemporary = b.data();
+        CORRADE_COMPARE(arena.blockCount(), 2);
+    }
+    arena.rewind(marker);
+
+    /* Old allocations are kept, new ones reuse the released memory */
+    Array<int> d = arena.allocate<int>(4);
+    CORRADE_COMPARE(d.data(), firstTemporary);
+    CORRADE_COMPARE(a[3], 42);
+    CORRADE_COMPARE(arena.blockCount(), 2);
+}
+
+void ArenaAllocatorTest::reset() {
+    ArenaAllocator arena{1024};
+
+    const int* first;
+    {
+        Array<int> a = arena.allocate<int>(5);
+        Array<int> b = arena.allocate<int>(5);
+        first = a.data();
+    }
+    arena.reset();
+
+    Array<int> c = arena.allocate<int>(5);
+    CORRADE_COMPARE(c.data(), first);
+    CORRADE_COMPARE(arena.blockCount(), 1);
+}
+
+void ArenaAllocatorTest::resetReusesBlocks() {
+    ArenaAllocator arena{64};
+
+    for(std::size_t i = 0; i != 10; ++i) {
+        Array<char> a = arena.allocate<char>(48);
+        Array<char> b = arena.allocate<char>(48);
+        Array<char> c = arena.allocate<char>(48);
+        arena.reset();
+    }
+
+    /* Only the first iteration allocated blocks */
+    CORRADE_COMPARE(arena.blockCount(), 3);
+}
+
+void ArenaAllocatorTest::growFromArena() {
+    ArenaAllocator arena{1024};
+
+    Array<int> a = arena.allocate<int>(Containers::ValueInit, 3);
+    const int* prev = a.data();
+    CORRADE_VERIFY(!arrayIsGrowable(a));
+
+    /* Growing moves the data out of the arena to the heap */
+    arrayAppend(a, 7);
+    CORRADE_VERIFY(arrayIsGrowable(a));
+    CORRADE_VERIFY(a.data() != prev);
+    CORRADE_COMPARE(a.size(), 4);
+    CORRADE_COMPARE(a[3], 7);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Corrade::Containers::Test::ArenaAllocatorTest)
@@ -0,0 +1,191 @@
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <bitset>
+#include <memory>
+#include <vector>
+
+#include "Corrade/Containers/BitArray.h"
+#include "Corrade/TestSuite/Tester.h"
+
+namespace Corrade { namespace Containers { namespace Test {
+
+struct BitArrayBenchmark: TestSuite::Tester {
+    explicit BitArrayBenchmark();
+
+    void countVectorBool();
+    void countBitset();
+    void countBitArray();
+
+    void iterateVectorBool();
+    void iterateBitset();
+    void iterateBitArray();
+
+    void andVectorBool();
+    void andBitset();
+    void andBitArray();
+    void andBitArrayUnaligned();
+};
+
+namespace {
+
+enum: std::size_t { Size = 1 << 20 };
+
+/* Every 37th bit set, sparse enough for iteration to benefit from skipping
+   whole words */
+bool bit(std::size_t i) { return i % 37 == 0; }
+
+constexpr std::size_t Expected = (Size + 36)/37;
+
+}
+
+BitArrayBenchmark::BitArrayBenchmark() {
+    addBenchmarks({&BitArrayBenchmark::countVectorBool,
+                   &BitArrayBenchmark::countBitset,
+                   &BitArrayBenchmark::countBitArray,
+
+                   &BitArrayBenchmark::iterateVectorBool,
+                   &BitArrayBenchmark::iterateBitset,
+                   &BitArrayBenchmark::iterateBitArray,
+
+                   &BitArrayBenchmark::andVectorBool,
+                   &BitArrayBenchmark::andBitset,
+                   &BitArrayBenchmark::andBitArray,
+                   &BitArrayBenchmark::andBitArrayUnaligned}, 10);
+}
+
+void BitArrayBenchmark::countVectorBool() {
+    std::vector<bool> a(Size);
+    for(std::size_t i = 0; i != Size; ++i) a[i] = bit(i);
+
+    std::size_t count = 0;
+    CORRADE_BENCHMARK(1)
+        for(std::size_t i = 0; i != Size; ++i) if(a[i]) ++count;
+
+    CORRADE_COMPARE(count, Expected);
+}
+
+void BitArrayBenchmark::countBitset() {
+    std::unique_ptr<std::bitset<Size>> a{new std::bitset<Size>};
+    for(std::size_t i = 0; i != Size; ++i) a->set(i, bit(i));
+
+    std::size_t count = 0;
+    CORRADE_BENCHMARK(1)
+        count += a->count();
+
+    CORRADE_COMPARE(count, Expected);
+}
+
+void BitArrayBenchmark::countBitArray() {
+    BitArray a{ValueInit, Size};
+    for(std::size_t i = 0; i != Size; ++i) a.set(i, bit(i));
+
+    std::size_t count = 0;
+    CORRADE_BENCHMARK(1)
+        count += a.count();
+
+    CORRADE_COMPARE(count, Expected);
+}
+
+void BitArrayBenchmark::iterateVectorBool() {
+    std::vector<bool> a(Size);
+    for(std::size_t i = 0; i != Size; ++i) a[i] = bit(i);
+
+    std::size_t sum = 0;
+    CORRADE_BENCHMARK(1)
+        for(std::size_t i = 0; i != Size; ++i) if(a[i]) sum += i;
+
+    CORRADE_VERIFY(sum);
+}
+
+void BitArrayBenchmark::iterateBitset() {
+    std::unique_ptr<std::bitset<Size>> a{new std::bitset<Size>};
+    for(std::size_t i = 0; i != Size; ++i) a->set(i, bit(i));
+
+    std::size_t sum = 0;
+    CORRADE_BENCHMARK(1)
+        for(std::size_t i = 0; i != Size; ++i) if((*a)[i]) sum += i;
+
+    CORRADE_VERIFY(sum);
+}
+
+void BitArrayBenchmark::iterateBitArray() {
+    BitArray a{ValueInit, Size};
+    for(std::size_t i = 0; i != Size; ++i) a.set(i, bit(i));
+
+    std::size_t sum = 0;
+    CORRADE_BENCHMARK(1)
+        for(std::size_t i = a.findFirstSet(); i < Size; i = a.findNextSet(i + 1))
+            sum += i;
+
+    CORRADE_VERIFY(sum);
+}
+
+void BitArrayBenchmark::andVectorBool() {
+    std::vector<bool> a(Size, true), b(Size), out(Size);
+    for(std::size_t i = 0; i != Size; ++i) b[i] = bit(i);
+
+    CORRADE_BENCHMARK(1)
+        for(std::size_t i = 0; i != Size; ++i) out[i] = a[i] && b[i];
+
+    CORRADE_VERIFY(out[37]);
+}
+
+void BitArrayBenchmark::andBitset() {
+    std::unique_ptr<std::bitset<Size>> a{new std::bitset<Size>}, b{new std::bitset<Size>}, out{new std::bitset<Size>};
+    a->set();
+    for(std::size_t i = 0; i != Size; ++i) b->set(i, bit(i));
+
+    CORRADE_BENCHMARK(1) {
+        *out = *a;
+        *out &= *b;
+    }
+
+    CORRADE_COMPARE(out->count(), Expected);
+}
+
+void BitArrayBenchmark::andBitArray() {
+    BitArray a{DirectInit, Size, true}, b{ValueInit, Size}, out{NoInit, Size};
+    for(std::size_t i = 0; i != Size; ++i) b.set(i, bit(i));
+
+    CORRADE_BENCHMARK(1)
+        bitwiseAnd(out, a, b);
+
+    CORRADE_COMPARE(out.count(), Expected);
+}
+
+void BitArrayBenchmark::andBitArrayUnaligned() {
+    BitArray a{DirectInit, Size + 8, true}, b{ValueInit, Size + 8}, out{NoInit, Size};
+    for(std::size_t i = 0; i != Size; ++i) b.set(i + 3, bit(i));
+
+    CORRADE_BENCHMARK(1)
+        bitwiseAnd(out, a.slice(5, Size + 5), b.slice(3, Size + 3));
+
+    CORRADE_COMPARE(out.count(), Expected);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Corrade::Containers::Test::BitArrayBenchmark)
@@ -0,0 +1,208 @@
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Corrade/Containers/BitArray.h"
+#include "Corrade/TestSuite/Tester.h"
+
+namespace Corrade { namespace Containers { namespace Test {
+
+struct BitArrayTest: TestSuite::Tester {
+    explicit BitArrayTest();
+
+    void constructDefault();
+    void constructValueInit();
+    void constructDirectInit();
+    void constructNoInit();
+    void constructMove();
+
+    void convertView();
+    void access();
+    void countFind();
+    void slice();
+    void bitwise();
+};
+
+BitArrayTest::BitArrayTest() {
+    addTests({&BitArrayTest::constructDefault,
+              &BitArrayTest::constructValueInit,
+              &BitArrayTest::constructDirectInit,
+              &BitArrayTest::constructNoInit,
+              &BitArrayTest::constructMove,
+
+              &BitArrayTest::convertView,
+              &BitArrayTest::access,
+              &BitArrayTest::countFind,
+              &BitArrayTest::slice,
+              &BitArrayTest::bitwise});
+}
+
+void BitArrayTest::constructDefault() {
+    BitArray a;
+    BitArray b = nullptr;
+    CORRADE_VERIFY(!a.data());
+    CORRADE_VERIFY(!b.data());
+    CORRADE_COMPARE(a.size(), 0);
+    CORRADE_VERIFY(a.empty());
+}
+
+void BitArrayTest::constructValueInit() {
+    BitArray a{ValueInit, 75};
+    BitArray b{75};
+    CORRADE_VERIFY(a.data());
+    CORRADE_COMPARE(a.size(), 75);
+    CORRADE_COMPARE(b.size(), 75);
+    CORRADE_COMPARE(a.count(), 0);
+    CORRADE_COMPARE(b.count(), 0);
+}
+
+void BitArrayTest::constructDirectInit() {
+    BitArray a{DirectInit, 75, true};
+    CORRADE_COMPARE(a.size(), 75);
+    CORRADE_COMPARE(a.count(), 75);
+
+    BitArray b{DirectInit, 75, false};
+    CORRADE_COMPARE(b.count(), 0);
+}
+
+void BitArrayTest::constructNoInit() {
+    BitArray a{NoInit, 75};
+    CORRADE_VERIFY(a.data());
+    CORRADE_COMPARE(a.size(), 75);
+}
+
+void BitArrayTest::constructMove() {
+    BitArray a{ValueInit, 75};
+    a.set(3);
+    const char* data = a.data();
+
+    BitArray b{std::move(a)};
+    CORRADE_VERIFY(!a.data());
+    CORRADE_COMPARE(a.size(), 0);
+    CORRADE_COMPARE(b.data(), static_cast<const void*>(data));
+    CORRADE_COMPARE(b.size(), 75);
+    CORRADE_VERIFY(b[3]);
+
+    BitArray c{ValueInit, 5};
+    c = std::move(b);
+    CORRADE_COMPARE(c.size(), 75);
+    CORRADE_COMPARE(b.size(), 5);
+
+    CORRADE_VERIFY(!(std::is_copy_constructible<BitArray>::value));
+    CORRADE_VERIFY(!(std::is_copy_assignable<BitArray>::value));
+    CORRADE_VERIFY(std::is_nothrow_move_constructible<BitArray>::value);
+    CORRADE_VERIFY(std::is_nothrow_move_assignable<BitArray>::value);
+}
+
+void BitArrayTest::convertView() {
+    BitArray a{ValueInit, 75};
+    const BitArray& ca = a;
+
+    MutableBitArrayView b = a;
+    CORRADE_COMPARE(b.data(), static_cast<void*>(a.data()));
+    CORRADE_COMPARE(b.offset(), 0);
+    CORRADE_COMPARE(b.size(), 75);
+
+    BitArrayView c = ca;
+    CORRADE_COMPARE(c.data(), static_cast<const void*>(a.data()));
+    CORRADE_COMPARE(c.size(), 75);
+
+    b.set(70);
+    CORRADE_VERIFY(a[70]);
+}
+
+void BitArrayTest::access() {
+    BitArray a{ValueInit, 20};
+    a.set(1);
+    a.set(9, true);
+    a.set(15);
+    a.flip(16);
+    a.reset(15);
+    CORRADE_VERIFY(!a[0]);
+    CORRADE_VERIFY(a[1]);
+    CORRADE_VERIFY(a[9]);
+    CORRADE_VERIFY(!a[15]);
+    CORRADE_VERIFY(a[16]);
+    CORRADE_COMPARE(a.count(), 3);
+
+    a.setAll();
+    CORRADE_COMPARE(a.count(), 20);
+    a.resetAll();
+    CORRADE_COMPARE(a.count(), 0);
+}
+
+void BitArrayTest::countFind() {
+    BitArray a{ValueInit, 1000};
+    a.set(100);
+    a.set(999);
+    CORRADE_COMPARE(a.count(), 2);
+    CORRADE_COMPARE(a.findFirstSet(), 100);
+    CORRADE_COMPARE(a.findNextSet(101), 999);
+    CORRADE_COMPARE(a.findNextSet(1000), 1000);
+}
+
+void BitArrayTest::slice() {
+    BitArray a{ValueInit, 100};
+    const BitArray& ca = a;
+
+    MutableBitArrayView b = a.slice(10, 30);
+    CORRADE_COMPARE(b.data(), static_cast<void*>(a.data() + 1));
+    CORRADE_COMPARE(b.offset(), 2);
+    CORRADE_COMPARE(b.size(), 20);
+    b.set(0);
+    CORRADE_VERIFY(a[10]);
+
+    BitArrayView c = ca.slice(10, 30);
+    CORRADE_COMPARE(c.size(), 20);
+    CORRADE_COMPARE(a.prefix(5).size(), 5);
+    CORRADE_COMPARE(ca.prefix(5).size(), 5);
+    CORRADE_COMPARE(a.suffix(95).size(), 5);
+    CORRADE_COMPARE(ca.suffix(95).size(), 5);
+}
+
+void BitArrayTest::bitwise() {
+    BitArray a{ValueInit, 300};
+    BitArray b{ValueInit, 300};
+    a.set(5);
+    a.set(250);
+    b.set(250);
+    b.set(299);
+
+    BitArray out{NoInit, 300};
+    bitwiseAnd(out, a, b);
+    CORRADE_COMPARE(out.count(), 1);
+    CORRADE_VERIFY(out[250]);
+
+    bitwiseOr(out, a, b);
+    CORRADE_COMPARE(out.count(), 3);
+
+    bitwiseXor(a, a, b);
+    CORRADE_COMPARE(a.count(), 2);
+    CORRADE_VERIFY(a[5]);
+    CORRADE_VERIFY(a[299]);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Corrade::Containers::Test::BitArrayTest)
@@ -0,0 +1,363 @@
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+
+#include "Corrade/Containers/ArrayView.h"
+#include "Corrade/Containers/BitArrayView.h"
+#include "Corrade/TestSuite/Tester.h"
+
+namespace Corrade { namespace Containers { namespace Test {
+
+struct BitArrayViewTest: TestSuite::Tester {
+    explicit BitArrayViewTest();
+
+    void constructDefault();
+    void construct();
+    void constructOffsetNormalized();
+    void constructConstFromMutable();
+
+    void access();
+    void set();
+    void setAllResetAll();
+
+    void count();
+    void findSet();
+
+    void slice();
+    void sliceOutOfRange();
+
+    void bitwise();
+    void bitwiseInPlace();
+    void bitwiseSizeMismatch();
+};
+
+namespace {
+
+struct {
+    const char* name;
+    std::size_t outOffset, aOffset, bOffset, size;
+} BitwiseData[]{
+    {"aligned, one bit", 0, 0, 0, 1},
+    {"aligned, one byte", 0, 0, 0, 8},
+    {"aligned, 64 bits", 0, 0, 0, 64},
+    {"aligned, 1000 bits", 0, 0, 0, 1000},
+    {"same offset, two bits", 3, 3, 3, 2},
+    {"same offset, 1000 bits", 3, 3, 3, 1000},
+    {"different offsets, 5 bits", 1, 5, 7, 5},
+    {"different offsets, 65 bits", 1, 5, 7, 65},
+    {"different offsets, 1000 bits", 7, 0, 4, 1000}
+};
+
+/* Deterministic pseudo-random bytes */
+void fillData(char* data, std::size_t size, std::uint32_t seed) {
+    for(std::size_t i = 0; i != size; ++i) {
+        seed = seed*1103515245u + 12345u;
+        data[i] = char(seed >> 16);
+    }
+}
+
+}
+
+BitArrayViewTest::BitArrayViewTest() {
+    addTests({&BitArrayViewTest::constructDefault,
+              &BitArrayViewTest::construct,
+              &BitArrayViewTest::constructOffsetNormalized,
+              &BitArrayViewTest::constructConstFromMutable,
+
+              &BitArrayViewTest::access,
+              &BitArrayViewTest::set,
+              &BitArrayViewTest::setAllResetAll,
+
+              &BitArrayViewTest::count,
+              &BitArrayViewTest::findSet,
+
+              &BitArrayViewTest::slice,
+              &BitArrayViewTest::sliceOutOfRange});
+
+    addInstancedTests({&BitArrayViewTest::bitwise,
+                       &BitArrayViewTest::bitwiseInPlace},
+        Containers::arraySize(BitwiseData));
+
+    addTests({&BitArrayViewTest::bitwiseSizeMismatch});
+}
+
+void BitArrayViewTest::constructDefault() {
+    BitArrayView a;
+    BitArrayView b = nullptr;
+    CORRADE_VERIFY(!a.data());
+    CORRADE_VERIFY(!b.data());
+    CORRADE_COMPARE(a.offset(), 0);
+    CORRADE_COMPARE(a.size(), 0);
+    CORRADE_VERIFY(a.empty());
+    CORRADE_COMPARE(a.count(), 0);
+    CORRADE_COMPARE(a.findFirstSet(), 0);
+}
+
+void BitArrayViewTest::construct() {
+    const char data[2]{};
+    BitArrayView a{data, 5, 11};
+    CORRADE_COMPARE(a.data(), static_cast<const void*>(data));
+    CORRADE_COMPARE(a.offset(), 5);
+    CORRADE_COMPARE(a.size(), 11);
+    CORRADE_VERIFY(!a.empty());
+}
+
+void BitArrayViewTest::constructOffsetNormalized() {
+    const char data[4]{};
+    BitArrayView a{data, 19, 6};
+    CORRADE_COMPARE(a.data(), static_cast<const void*>(data + 2));
+    CORRADE_COMPARE(a.offset(), 3);
+    CORRADE_COMPARE(a.size(), 6);
+}
+
+void BitArrayViewTest::constructConstFromMutable() {
+    char data[2]{};
+    MutableBitArrayView a{data, 3, 10};
+    BitArrayView b = a;
+    CORRADE_COMPARE(b.data(), static_cast<const void*>(data));
+    CORRADE_COMPARE(b.offset(), 3);
+    CORRADE_COMPARE(b.size(), 10);
+
+    CORRADE_VERIFY((std::is_convertible<MutableBitArrayView, BitArrayView>::value));
+    CORRADE_VERIFY(!(std::is_convertible<BitArrayView, MutableBitArrayView>::value));
+}
+
+void BitArrayViewTest::access() {
+    /* 0b10110010 0b00000001 */
+    const char data[2]{char(0xb2), 0x01};
+    BitArrayView a{data, 1, 9};
+    CORRADE_VERIFY(a[0]);
+    CORRADE_VERIFY(!a[1]);
+    CORRADE_VERIFY(!a[2]);
+    CORRADE_VERIFY(a[3]);
+    CORRADE_VERIFY(a[4]);
+    CORRADE_VERIFY(!a[5]);
+    CORRADE_VERIFY(a[6]);
+    CORRADE_VERIFY(a[7]);
+    CORRADE_VERIFY(!a[8]);
+}
+
+void BitArrayViewTest::set() {
+    char data[2]{};
+    MutableBitArrayView a{data, 2, 12};
+    a.set(0);
+    a.set(6);
+    a.set(3, true);
+    CORRADE_COMPARE(int(data[0]), 0x24);
+    CORRADE_COMPARE(int(data[1]), 0x01);
+
+    a.flip(6);
+    a.flip(8);
+    a.reset(0);
+    a.set(3, false);
+    CORRADE_COMPARE(int(data[0]), 0x00);
+    CORRADE_COMPARE(int(data[1]), 0x04);
+    CORRADE_VERIFY(a[8]);
+}
+
+void BitArrayViewTest::setAllResetAll() {
+    char data[12]{};
+    MutableBitArrayView a{data, 3, 80};
+
+    a.setAll();
+    CORRADE_COMPARE(a.count(), 80);
+    /* Bits outside of the view are untouched */
+    CORRADE_COMPARE(int(std::uint8_t(data[0])), 0xf8);
+    CORRADE_COMPARE(int(std::uint8_t(data[9])), 0xff);
+    CORRADE_COMPARE(int(std::uint8_t(data[10])), 0x07);
+    CORRADE_COMPARE(int(std::uint8_t(data[11])), 0x00);
+
+    data[0] = data[10] = char(0xff);
+    a.resetAll();
+    CORRADE_COMPARE(a.count(), 0);
+    CORRADE_COMPARE(int(std::uint8_t(data[0])), 0x07);
+    CORRADE_COMPARE(int(std::uint8_t(data[5])), 0x00);
+    CORRADE_COMPARE(int(std::uint8_t(data[10])), 0xf8);
+}
+
+void BitArrayViewTest::count() {
+    char data[32];
+    fillData(data, 32, 17);
+
+    for(std::size_t offset: {0, 1, 5}) {
+        for(std::size_t size: {1, 7, 63, 64, 65, 200, 250}) {
+            BitArrayView a{data, offset, size};
+            std::size_t expected = 0;
+            for(std::size_t i = 0; i != size; ++i) if(a[i]) ++expected;
+            CORRADE_COMPARE(a.count(), expected);
+        }
+    }
+}
+
+void BitArrayViewTest::findSet() {
+    char data[32]{};
+    MutableBitArrayView a{data, 3, 250};
+    CORRADE_COMPARE(a.findFirstSet(), 250);
+
+    a.set(5);
+    a.set(63);
+    a.set(64);
+    a.set(200);
+    a.set(249);
+
+    CORRADE_COMPARE(a.findFirstSet(), 5);
+    CORRADE_COMPARE(a.findNextSet(6), 63);
+    CORRADE_COMPARE(a.findNextSet(64), 64);
+    CORRADE_COMPARE(a.findNextSet(65), 200);
+    CORRADE_COMPARE(a.findNextSet(201), 249);
+    CORRADE_COMPARE(a.findNextSet(250), 250);
+
+    /* Bits outside of the view are not found */
+    MutableBitArrayView b{data, 3, 249};
+    CORRADE_COMPARE(b.findNextSet(201), 249);
+    data[0] |= 0x01;
+    CORRADE_COMPARE((BitArrayView{data, 1, 7}.findFirstSet()), 7);
+
+    std::size_t found[5]{};
+    std::size_t count = 0;
+    for(std::size_t i = a.findFirstSet(); i < a.size(); i = a.findNextSet(i + 1))
+        found[count++] = i;
+    CORRADE_COMPARE(count, 5);
+    CORRADE_COMPARE(found[0], 5);
+    CORRADE_COMPARE(found[4], 249);
+}
+
+void BitArrayViewTest::slice() {
+    char data[4]{};
+    MutableBitArrayView a{data, 3, 28};
+
+    MutableBitArrayView b = a.slice(6, 20);
+    CORRADE_COMPARE(b.data(), static_cast<void*>(data + 1));
+    CORRADE_COMPARE(b.offset(), 1);
+    CORRADE_COMPARE(b.size(), 14);
+
+    b.set(0);
+    CORRADE_VERIFY(a[6]);
+
+    MutableBitArrayView c = a.prefix(5);
+    CORRADE_COMPARE(c.data(), static_cast<void*>(data));
+    CORRADE_COMPARE(c.offset(), 3);
+    CORRADE_COMPARE(c.size(), 5);
+
+    BitArrayView d = a.suffix(13);
+    CORRADE_COMPARE(d.data(), static_cast<const void*>(data + 2));
+    CORRADE_COMPARE(d.offset(), 0);
+    CORRADE_COMPARE(d.size(), 15);
+}
+
+void BitArrayViewTest::sliceOutOfRange() {
+    char data[4]{};
+    MutableBitArrayView a{data, 3, 28};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    a.slice(5, 29);
+    a.slice(6, 5);
+    CORRADE_COMPARE(out.str(),
+        "Containers::BitArrayView::slice(): slice [5:29] out of range for 28 bits\n"
+        "Containers::BitArrayView::slice(): slice [6:5] out of range for 28 bits\n");
+}
+
+void BitArrayViewTest::bitwise() {
+    auto&& data = BitwiseData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    char a[130], b[130];
+    fillData(a, 130, 3);
+    fillData(b, 130, 7);
+    BitArrayView va{a, data.aOffset, data.size};
+    BitArrayView vb{b, data.bOffset, data.size};
+
+    char outAnd[130], outOr[130], outXor[130];
+    fillData(outAnd, 130, 11);
+    fillData(outOr, 130, 11);
+    fillData(outXor, 130, 11);
+    const char original[2]{outAnd[0], outAnd[(data.outOffset + data.size)/8]};
+    MutableBitArrayView vAnd{outAnd, data.outOffset, data.size};
+    MutableBitArrayView vOr{outOr, data.outOffset, data.size};
+    MutableBitArrayView vXor{outXor, data.outOffset, data.size};
+
+    bitwiseAnd(vAnd, va, vb);
+    bitwiseOr(vOr, va, vb);
+    bitwiseXor(vXor, va, vb);
+
+    for(std::size_t i = 0; i != data.size; ++i) {
+        CORRADE_COMPARE(vAnd[i], va[i] && vb[i]);
+        CORRADE_COMPARE(vOr[i], va[i] || vb[i]);
+        CORRADE_COMPARE(vXor[i], va[i] != vb[i]);
+    }
+
+    /* Bits around the view are untouched */
+    BitArrayView before{original, 0, data.outOffset};
+    BitArrayView beforeOut{outAnd, 0, data.outOffset};
+    for(std::size_t i = 0; i != data.outOffset; ++i)
+        CORRADE_COMPARE(beforeOut[i], before[i]);
+    const std::size_t end = data.outOffset + data.size;
+    BitArrayView after{original + 1, end % 8, 8 - end % 8};
+    BitArrayView afterOut{outAnd + end/8, end % 8, 8 - end % 8};
+    for(std::size_t i = 0; i != after.size(); ++i)
+        CORRADE_COMPARE(afterOut[i], after[i]);
+}
+
+void BitArrayViewTest::bitwiseInPlace() {
+    auto&& data = BitwiseData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    /* Only the variants where the output offset is the same as one of the
+       inputs make sense here */
+    if(data.outOffset != data.aOffset)
+        CORRADE_SKIP("Output offset is different from the input offset");
+
+    char a[130], b[130], expected[130];
+    fillData(a, 130, 3);
+    fillData(b, 130, 7);
+    fillData(expected, 130, 3);
+    MutableBitArrayView va{a, data.aOffset, data.size};
+    BitArrayView vb{b, data.bOffset, data.size};
+    BitArrayView vexpected{expected, data.aOffset, data.size};
+
+    bitwiseXor(va, va, vb);
+    for(std::size_t i = 0; i != data.size; ++i)
+        CORRADE_COMPARE(va[i], vexpected[i] != vb[i]);
+}
+
+void BitArrayViewTest::bitwiseSizeMismatch() {
+    char data[4]{};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    bitwiseAnd(MutableBitArrayView{data, 0, 8}, BitArrayView{data, 0, 8}, BitArrayView{data, 0, 7});
+    bitwiseOr(MutableBitArrayView{data, 0, 8}, BitArrayView{data, 0, 9}, BitArrayView{data, 0, 8});
+    bitwiseXor(MutableBitArrayView{data, 0, 7}, BitArrayView{data, 0, 8}, BitArrayView{data, 0, 8});
+    CORRADE_COMPARE(out.str(),
+        "Containers::bitwiseAnd(): expected views of the same size, got 8, 8 and 7 bits\n"
+        "Containers::bitwiseOr(): expected views of the same size, got 8, 9 and 8 bits\n"
+        "Containers::bitwiseXor(): expected views of the same size, got 7, 8 and 8 bits\n");
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Corrade::Containers::Test::BitArrayViewTest)
@@ -0,0 +1,168 @@
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <map>
+#include <string>
+
+#include "Corrade/Containers/FlatMap.h"
+#include "Corrade/TestSuite/Tester.h"
+
+namespace Corrade { namespace Containers { namespace Test {
+
+struct FlatMapBenchmark: TestSuite::Tester {
+    explicit FlatMapBenchmark();
+
+    void constructStdMap();
+    void constructFlatMap();
+
+    void lookupStdMap();
+    void lookupFlatMap();
+
+    void lookupStringStdMap();
+    void lookupStringFlatMap();
+};
+
+namespace {
+
+constexpr std::size_t Sizes[]{100, 1000, 10000, 100000};
+
+/* Multiplying by an odd constant is a bijection, so the keys are unique but
+   not sorted */
+std::uint32_t key(std::size_t i) {
+    return std::uint32_t(i)*2654435761u;
+}
+
+std::string stringKey(std::size_t i) {
+    return "resource/" + std::to_string(key(i));
+}
+
+}
+
+FlatMapBenchmark::FlatMapBenchmark() {
+    addInstancedBenchmarks({&FlatMapBenchmark::constructStdMap,
+                            &FlatMapBenchmark::constructFlatMap,
+
+                            &FlatMapBenchmark::lookupStdMap,
+                            &FlatMapBenchmark::lookupFlatMap,
+
+                            &FlatMapBenchmark::lookupStringStdMap,
+                            &FlatMapBenchmark::lookupStringFlatMap}, 5,
+        Containers::arraySize(Sizes));
+}
+
+void FlatMapBenchmark::constructStdMap() {
+    const std::size_t size = Sizes[testCaseInstanceId()];
+    setTestCaseDescription(std::to_string(size));
+
+    std::map<std::uint32_t, std::uint32_t> map;
+    CORRADE_BENCHMARK(1)
+        for(std::size_t i = 0; i != size; ++i) map.emplace(key(i), i);
+
+    CORRADE_COMPARE(map.size(), size);
+}
+
+void FlatMapBenchmark::constructFlatMap() {
+    const std::size_t size = Sizes[testCaseInstanceId()];
+    setTestCaseDescription(std::to_string(size));
+
+    FlatMap<std::uint32_t, std::uint32_t> map;
+    CORRADE_BENCHMARK(1) {
+        Array<std::pair<std::uint32_t, std::uint32_t>> data{NoInit, size};
+        for(std::size_t i = 0; i != size; ++i) data[i] = {key(i), i};
+        map = FlatMap<std::uint32_t, std::uint32_t>{std::move(data)};
+    }
+
+    CORRADE_COMPARE(map.size(), size);
+}
+
+void FlatMapBenchmark::lookupStdMap() {
+    const std::size_t size = Sizes[testCaseInstanceId()];
+    setTestCaseDescription(std::to_string(size));
+
+    std::map<std::uint32_t, std::uint32_t> map;
+    for(std::size_t i = 0; i != size; ++i) map.emplace(key(i), i);
+
+    std::size_t sum = 0;
+    CORRADE_BENCHMARK(1)
+        for(std::size_t i = 0; i != size; ++i) sum += map.find(key(i))->second;
+
+    CORRADE_COMPARE(sum, size*(size - 1)/2);
+}
+
+void FlatMapBenchmark::lookupFlatMap() {
+    const std::size_t size = Sizes[testCaseInstanceId()];
+    setTestCaseDescription(std::to_string(size));
+
+    Array<std::pair<std::uint32_t, std::uint32_t>> data{NoInit, size};
+    for(std::size_t i = 0; i != size; ++i) data[i] = {key(i), i};
+    FlatMap<std::uint32_t, std::uint32_t> map{std::move(data)};
+
+    std::size_t sum = 0;
+    CORRADE_BENCHMARK(1)
+        for(std::size_t i = 0; i != size; ++i) sum += *map.find(key(i));
+
+    CORRADE_COMPARE(sum, size*(size - 1)/2);
+}
+
+void FlatMapBenchmark::lookupStringStdMap() {
+    const std::size_t size = Sizes[testCaseInstanceId()];
+    setTestCaseDescription(std::to_string(size));
+
+    Array<std::string> keys{size};
+    std::map<std::string, std::size_t> map;
+    for(std::size_t i = 0; i != size; ++i) {
+        keys[i] = stringKey(i);
+        map.emplace(keys[i], i);
+    }
+
+    std::size_t sum = 0;
+    CORRADE_BENCHMARK(1)
+        for(std::size_t i = 0; i != size; ++i) sum += map.find(keys[i])->second;
+
+    CORRADE_COMPARE(sum, size*(size - 1)/2);
+}
+
+void FlatMapBenchmark::lookupStringFlatMap() {
+    const std::size_t size = Sizes[testCaseInstanceId()];
+    setTestCaseDescription(std::to_string(size));
+
+    Array<std::string> keys{size};
+    Array<std::pair<std::string, std::size_t>> data{size};
+    for(std::size_t i = 0; i != size; ++i) {
+        keys[i] = stringKey(i);
+        data[i] = {keys[i], i};
+    }
+    FlatMap<std::string, std::size_t> map{std::move(data)};
+
+    std::size_t sum = 0;
+    CORRADE_BENCHMARK(1)
+        for(std::size_t i = 0; i != size; ++i) sum += *map.find(keys[i]);
+
+    CORRADE_COMPARE(sum, size*(size - 1)/2);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Corrade::Containers::Test::FlatMapBenchmark)
@@ -0,0 +1,280 @@
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <string>
+
+#include "Corrade/Containers/FlatMap.h"
+#include "Corrade/TestSuite/Tester.h"
+#include "Corrade/TestSuite/Compare/Container.h"
+
+namespace Corrade { namespace Containers { namespace Test {
+
+struct FlatMapTest: TestSuite::Tester {
+    explicit FlatMapTest();
+
+    void mapConstructDefault();
+    void mapConstructArray();
+    void mapConstructInPlaceInit();
+    void mapConstructDuplicates();
+    void mapFind();
+    void mapBounds();
+    void mapRange();
+    void mapInsert();
+    void mapErase();
+    void mapCustomCompare();
+    void mapRelease();
+
+    void setConstructDefault();
+    void setConstruct();
+    void setContains();
+    void setRange();
+    void setInsertErase();
+};
+
+FlatMapTest::FlatMapTest() {
+    addTests({&FlatMapTest::mapConstructDefault,
+              &FlatMapTest::mapConstructArray,
+              &FlatMapTest::mapConstructInPlaceInit,
+              &FlatMapTest::mapConstructDuplicates,
+              &FlatMapTest::mapFind,
+              &FlatMapTest::mapBounds,
+              &FlatMapTest::mapRange,
+              &FlatMapTest::mapInsert,
+              &FlatMapTest::mapErase,
+              &FlatMapTest::mapCustomCompare,
+              &FlatMapTest::mapRelease,
+
+              &FlatMapTest::setConstructDefault,
+              &FlatMapTest::setConstruct,
+              &FlatMapTest::setContains,
+              &FlatMapTest::setRange,
+              &FlatMapTest::setInsertErase});
+}
+
+typedef std::pair<std::string, int> Entry;
+
+void FlatMapTest::mapConstructDefault() {
+    FlatMap<std::string, int> a;
+    CORRADE_VERIFY(a.empty());
+    CORRADE_COMPARE(a.size(), 0);
+    CORRADE_VERIFY(!a.find("hello"));
+    CORRADE_COMPARE(a.lowerBound("hello"), 0);
+    CORRADE_COMPARE(a.upperBound("hello"), 0);
+    CORRADE_VERIFY(a.range("a", "z").empty());
+}
+
+void FlatMapTest::mapConstructArray() {
+    Array<Entry> data{InPlaceInit, {{"c", 3}, {"a", 1}, {"d", 4}, {"b", 2}}};
+    const Entry* pointer = data.data();
+
+    FlatMap<std::string, int> a{std::move(data)};
+    CORRADE_COMPARE(a.size(), 4);
+    /* No duplicates, so the array was sorted in place */
+    CORRADE_COMPARE(a.entries().data(), pointer);
+    CORRADE_COMPARE(a.begin()[0].first, "a");
+    CORRADE_COMPARE(a.begin()[1].first, "b");
+    CORRADE_COMPARE(a.begin()[2].first, "c");
+    CORRADE_COMPARE(a.begin()[3].first, "d");
+    CORRADE_COMPARE(a.end() - a.begin(), 4);
+}
+
+void FlatMapTest::mapConstructInPlaceInit() {
+    FlatMap<int, std::string> a{InPlaceInit, {{5, "five"}, {1, "one"}, {3, "three"}}};
+    CORRADE_COMPARE(a.size(), 3);
+    CORRADE_COMPARE(a.entries()[0].first, 1);
+    CORRADE_COMPARE(a.entries()[1].first, 3);
+    CORRADE_COMPARE(a.entries()[2].first, 5);
+}
+
+void FlatMapTest::mapConstructDuplicates() {
+    FlatMap<int, int> a{InPlaceInit, {{3, 30}, {1, 10}, {3, 31}, {2, 20}, {1, 11}, {3, 32}}};
+    CORRADE_COMPARE(a.size(), 3);
+
+    /* First occurence wins */
+    CORRADE_COMPARE(*a.find(1), 10);
+    CORRADE_COMPARE(*a.find(2), 20);
+    CORRADE_COMPARE(*a.find(3), 30);
+}
+
+void FlatMapTest::mapFind() {
+    FlatMap<int, int> a{InPlaceInit, {{10, 1}, {20, 2}, {30, 3}, {40, 4}, {50, 5}}};
+    const FlatMap<int, int>& ca = a;
+
+    for(int i = 0; i != 60; ++i) {
+        CORRADE_COMPARE(a.contains(i), i && i % 10 == 0 && i <= 50);
+    }
+
+    int* found = a.find(30);
+    CORRADE_VERIFY(found);
+    CORRADE_COMPARE(*found, 3);
+    *found = 33;
+    CORRADE_COMPARE(*ca.find(30), 33);
+
+    CORRADE_VERIFY(!a.find(5));
+    CORRADE_VERIFY(!a.find(55));
+    CORRADE_VERIFY(!ca.find(35));
+}
+
+void FlatMapTest::mapBounds() {
+    FlatMap<int, int> a{InPlaceInit, {{10, 1}, {20, 2}, {30, 3}}};
+
+    CORRADE_COMPARE(a.lowerBound(5), 0);
+    CORRADE_COMPARE(a.lowerBound(10), 0);
+    CORRADE_COMPARE(a.lowerBound(15), 1);
+    CORRADE_COMPARE(a.lowerBound(30), 2);
+    CORRADE_COMPARE(a.lowerBound(35), 3);
+
+    CORRADE_COMPARE(a.upperBound(5), 0);
+    CORRADE_COMPARE(a.upperBound(10), 1);
+    CORRADE_COMPARE(a.upperBound(15), 1);
+    CORRADE_COMPARE(a.upperBound(30), 3);
+    CORRADE_COMPARE(a.upperBound(35), 3);
+}
+
+void FlatMapTest::mapRange() {
+    FlatMap<std::string, int> a{InPlaceInit, {
+        {"apple", 1}, {"apricot", 2}, {"banana", 3}, {"blueberry", 4}, {"cherry", 5}}};
+
+    ArrayView<const Entry> b = a.range("b", "c");
+    CORRADE_COMPARE(b.size(), 2);
+    CORRADE_COMPARE(b[0].first, "banana");
+    CORRADE_COMPARE(b[1].first, "blueberry");
+
+    CORRADE_COMPARE(a.range("a", "z").size(), 5);
+    CORRADE_COMPARE(a.range("apricot", "banana").size(), 1);
+    CORRADE_VERIFY(a.range("c", "b").empty());
+    CORRADE_VERIFY(a.range("d", "z").empty());
+}
+
+void FlatMapTest::mapInsert() {
+    FlatMap<int, std::string> a;
+    std::pair<std::string*, bool> inserted = a.insert(20, "twenty");
+    CORRADE_VERIFY(inserted.second);
+    CORRADE_COMPARE(*inserted.first, "twenty");
+
+    CORRADE_VERIFY(a.insert(10, "ten").second);
+    CORRADE_VERIFY(a.insert(30, "thirty").second);
+    CORRADE_VERIFY(a.insert(15, "fifteen").second);
+
+    inserted = a.insert(20, "another twenty");
+    CORRADE_VERIFY(!inserted.second);
+    CORRADE_COMPARE(*inserted.first, "twenty");
+
+    CORRADE_COMPARE(a.size(), 4);
+    CORRADE_COMPARE(a.entries()[0].first, 10);
+    CORRADE_COMPARE(a.entries()[1].first, 15);
+    CORRADE_COMPARE(a.entries()[1].second, "fifteen");
+    CORRADE_COMPARE(a.entries()[2].first, 20);
+    CORRADE_COMPARE(a.entries()[3].first, 30);
+}
+
+void FlatMapTest::mapErase() {
+    FlatMap<int, std::string> a{InPlaceInit, {{1, "one"}, {2, "two"}, {3, "three"}}};
+
+    CORRADE_VERIFY(a.erase(2));
+    CORRADE_VERIFY(!a.erase(2));
+    CORRADE_VERIFY(!a.erase(4));
+    CORRADE_COMPARE(a.size(), 2);
+    CORRADE_COMPARE(*a.find(1), "one");
+    CORRADE_COMPARE(*a.find(3), "three");
+
+    CORRADE_VERIFY(a.erase(3));
+    CORRADE_VERIFY(a.erase(1));
+    CORRADE_VERIFY(a.empty());
+}
+
+void FlatMapTest::mapCustomCompare() {
+    FlatMap<int, int, std::greater<int>> a{InPlaceInit, {{1, 10}, {3, 30}, {2, 20}}};
+    CORRADE_COMPARE(a.entries()[0].first, 3);
+    CORRADE_COMPARE(a.entries()[1].first, 2);
+    CORRADE_COMPARE(a.entries()[2].first, 1);
+    CORRADE_COMPARE(*a.find(2), 20);
+    CORRADE_COMPARE(a.range(3, 1).size(), 2);
+}
+
+void FlatMapTest::mapRelease() {
+    FlatMap<int, int> a{InPlaceInit, {{2, 20}, {1, 10}}};
+    Array<std::pair<int, int>> data = a.release();
+    CORRADE_VERIFY(a.empty());
+    CORRADE_COMPARE(data.size(), 2);
+    CORRADE_COMPARE(data[0].first, 1);
+    CORRADE_COMPARE(data[1].first, 2);
+}
+
+void FlatMapTest::setConstructDefault() {
+    FlatSet<int> a;
+    CORRADE_VERIFY(a.empty());
+    CORRADE_VERIFY(!a.contains(0));
+}
+
+void FlatMapTest::setConstruct() {
+    FlatSet<int> a{InPlaceInit, {5, 1, 3, 1, 5, 2}};
+    const int expected[]{1, 2, 3, 5};
+    CORRADE_COMPARE_AS(a.entries(), ArrayView<const int>{expected},
+        TestSuite::Compare::Container);
+
+    FlatSet<int> b{Array<int>{InPlaceInit, {3, 2, 1}}};
+    CORRADE_COMPARE(b.size(), 3);
+    CORRADE_COMPARE(*b.begin(), 1);
+    CORRADE_COMPARE(*(b.end() - 1), 3);
+}
+
+void FlatMapTest::setContains() {
+    FlatSet<std::string> a{InPlaceInit, {"hello", "world", "and", "more"}};
+    CORRADE_VERIFY(a.contains("hello"));
+    CORRADE_VERIFY(a.contains("and"));
+    CORRADE_VERIFY(!a.contains("hell"));
+    CORRADE_VERIFY(!a.contains("zzz"));
+    CORRADE_COMPARE(a.lowerBound("m"), 2);
+    CORRADE_COMPARE(a.upperBound("more"), 3);
+}
+
+void FlatMapTest::setRange() {
+    FlatSet<int> a{InPlaceInit, {1, 3, 5, 7, 9}};
+    ArrayView<const int> b = a.range(3, 8);
+    CORRADE_COMPARE(b.size(), 3);
+    CORRADE_COMPARE(b[0], 3);
+    CORRADE_COMPARE(b[2], 7);
+    CORRADE_VERIFY(a.range(8, 3).empty());
+}
+
+void FlatMapTest::setInsertErase() {
+    FlatSet<int> a;
+    CORRADE_VERIFY(a.insert(5));
+    CORRADE_VERIFY(a.insert(1));
+    CORRADE_VERIFY(a.insert(3));
+    CORRADE_VERIFY(!a.insert(3));
+    CORRADE_COMPARE(a.size(), 3);
+    CORRADE_COMPARE(a.entries()[1], 3);
+
+    CORRADE_VERIFY(a.erase(1));
+    CORRADE_VERIFY(!a.erase(1));
+    CORRADE_COMPARE(a.size(), 2);
+    CORRADE_COMPARE(a.entries()[0], 3);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Corrade::Containers::Test::FlatMapTest)
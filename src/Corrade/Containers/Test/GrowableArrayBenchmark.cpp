@@ -0,0 +1,152 @@
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <string>
+#include <vector>
+
+#include "Corrade/Containers/GrowableArray.h"
+#include "Corrade/TestSuite/Tester.h"
+
+namespace Corrade { namespace Containers { namespace Test {
+
+struct GrowableArrayBenchmark: TestSuite::Tester {
+    explicit GrowableArrayBenchmark();
+
+    void appendTrivialVector();
+    void appendTrivialVectorReserved();
+    void appendTrivialArray();
+    void appendTrivialArrayNewAllocator();
+    void appendTrivialArrayReserved();
+
+    void appendNonTrivialVector();
+    void appendNonTrivialArray();
+
+    void appendBatchVector();
+    void appendBatchArray();
+};
+
+enum: std::size_t {
+    Size = 100000,
+    BatchSize = 4096
+};
+
+GrowableArrayBenchmark::GrowableArrayBenchmark() {
+    addBenchmarks({&GrowableArrayBenchmark::appendTrivialVector,
+                   &GrowableArrayBenchmark::appendTrivialVectorReserved,
+                   &GrowableArrayBenchmark::appendTrivialArray,
+                   &GrowableArrayBenchmark::appendTrivialArrayNewAllocator,
+                   &GrowableArrayBenchmark::appendTrivialArrayReserved,
+
+                   &GrowableArrayBenchmark::appendNonTrivialVector,
+                   &GrowableArrayBenchmark::appendNonTrivialArray,
+
+                   &GrowableArrayBenchmark::appendBatchVector,
+                   &GrowableArrayBenchmark::appendBatchArray}, 10);
+}
+
+void GrowableArrayBenchmark::appendTrivialVector() {
+    std::vector<int> a;
+    CORRADE_BENCHMARK(1)
+        for(std::size_t i = 0; i != Size; ++i) a.push_back(int(i));
+
+    CORRADE_COMPARE(a.size(), Size);
+}
+
+void GrowableArrayBenchmark::appendTrivialVectorReserved() {
+    std::vector<int> a;
+    a.reserve(Size);
+    CORRADE_BENCHMARK(1)
+        for(std::size_t i = 0; i != Size; ++i) a.push_back(int(i));
+
+    CORRADE_COMPARE(a.size(), Size);
+}
+
+void GrowableArrayBenchmark::appendTrivialArray() {
+    Array<int> a;
+    CORRADE_BENCHMARK(1)
+        for(std::size_t i = 0; i != Size; ++i) arrayAppend(a, int(i));
+
+    CORRADE_COMPARE(a.size(), Size);
+}
+
+void GrowableArrayBenchmark::appendTrivialArrayNewAllocator() {
+    Array<int> a;
+    CORRADE_BENCHMARK(1)
+        for(std::size_t i = 0; i != Size; ++i)
+            arrayAppend<int, ArrayNewAllocator<int>>(a, int(i));
+
+    CORRADE_COMPARE(a.size(), Size);
+}
+
+void GrowableArrayBenchmark::appendTrivialArrayReserved() {
+    Array<int> a;
+    arrayReserve(a, Size);
+    CORRADE_BENCHMARK(1)
+        for(std::size_t i = 0; i != Size; ++i) arrayAppend(a, int(i));
+
+    CORRADE_COMPARE(a.size(), Size);
+}
+
+void GrowableArrayBenchmark::appendNonTrivialVector() {
+    const std::string value = "a string that's long enough to not fit into SSO";
+    std::vector<std::string> a;
+    CORRADE_BENCHMARK(1)
+        for(std::size_t i = 0; i != Size/10; ++i) a.push_back(value);
+
+    CORRADE_COMPARE(a.size(), Size/10);
+}
+
+void GrowableArrayBenchmark::appendNonTrivialArray() {
+    const std::string value = "a string that's long enough to not fit into SSO";
+    Array<std::string> a;
+    CORRADE_BENCHMARK(1)
+        for(std::size_t i = 0; i != Size/10; ++i) arrayAppend(a, value);
+
+    CORRADE_COMPARE(a.size(), Size/10);
+}
+
+void GrowableArrayBenchmark::appendBatchVector() {
+    char data[BatchSize]{};
+    std::vector<char> a;
+    CORRADE_BENCHMARK(1)
+        for(std::size_t i = 0; i != Size/BatchSize; ++i)
+            a.insert(a.end(), data, data + BatchSize);
+
+    CORRADE_COMPARE(a.size(), Size/BatchSize*BatchSize);
+}
+
+void GrowableArrayBenchmark::appendBatchArray() {
+    char data[BatchSize]{};
+    Array<char> a;
+    CORRADE_BENCHMARK(1)
+        for(std::size_t i = 0; i != Size/BatchSize; ++i)
+            arrayAppend(a, data);
+
+    CORRADE_COMPARE(a.size(), Size/BatchSize*BatchSize);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Corrade::Containers::Test::GrowableArrayBenchmark)
@@ -0,0 +1,624 @@
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <string>
+
+#include "Corrade/Containers/GrowableArray.h"
+#include "Corrade/TestSuite/Tester.h"
+#include "Corrade/TestSuite/Compare/Numeric.h"
+
+namespace Corrade { namespace Containers { namespace Test {
+
+struct GrowableArrayTest: TestSuite::Tester {
+    explicit GrowableArrayTest();
+
+    void allocatorSelection();
+
+    template<class T> void reserveFromEmpty();
+    template<class T> void reserveFromNonGrowable();
+    template<class T> void reserveFromGrowable();
+    void reserveSmaller();
+
+    template<class T> void resizeFromEmpty();
+    template<class T> void resizeFromNonGrowable();
+    template<class T> void resizeFromGrowable();
+    void resizeShrink();
+    void resizeDefaultInit();
+    void resizeValueInit();
+    void resizeDirectInit();
+
+    template<class T> void appendFromEmpty();
+    template<class T> void appendFromNonGrowable();
+    void appendCopy();
+    void appendMove();
+    void appendInPlace();
+    void appendList();
+    void appendNoInit();
+    void appendAliased();
+    void appendListAliased();
+    void appendGrowthIsGeometric();
+    void appendNonTrivialLifetime();
+
+    void removeSuffix();
+    void removeSuffixNonGrowable();
+    void removeSuffixOutOfRange();
+
+    void shrink();
+    void shrinkNonGrowable();
+
+    void explicitAllocator();
+};
+
+struct Movable {
+    static int constructed;
+    static int destructed;
+    static int moved;
+
+    /*implicit*/ Movable(int a = 0) noexcept: a{a} { ++constructed; }
+    Movable(const Movable& other) noexcept: a{other.a} { ++constructed; }
+    Movable(Movable&& other) noexcept: a{other.a} {
+        ++constructed;
+        ++moved;
+    }
+    ~Movable() { ++destructed; }
+    Movable& operator=(const Movable&) = default;
+    Movable& operator=(Movable&& other) noexcept {
+        a = other.a;
+        ++moved;
+        return *this;
+    }
+
+    explicit operator int() const { return a; }
+
+    int a;
+};
+
+int Movable::constructed = 0;
+int Movable::destructed = 0;
+int Movable::moved = 0;
+
+GrowableArrayTest::GrowableArrayTest() {
+    addTests<GrowableArrayTest>({&GrowableArrayTest::allocatorSelection,
+
+              &GrowableArrayTest::reserveFromEmpty<int>,
+              &GrowableArrayTest::reserveFromEmpty<Movable>,
+              &GrowableArrayTest::reserveFromNonGrowable<int>,
+              &GrowableArrayTest::reserveFromNonGrowable<Movable>,
+              &GrowableArrayTest::reserveFromGrowable<int>,
+              &GrowableArrayTest::reserveFromGrowable<Movable>,
+              &GrowableArrayTest::reserveSmaller,
+
+              &GrowableArrayTest::resizeFromEmpty<int>,
+              &GrowableArrayTest::resizeFromEmpty<Movable>,
+              &GrowableArrayTest::resizeFromNonGrowable<int>,
+              &GrowableArrayTest::resizeFromNonGrowable<Movable>,
+              &GrowableArrayTest::resizeFromGrowable<int>,
+              &GrowableArrayTest::resizeFromGrowable<Movable>,
+              &GrowableArrayTest::resizeShrink,
+              &GrowableArrayTest::resizeDefaultInit,
+              &GrowableArrayTest::resizeValueInit,
+              &GrowableArrayTest::resizeDirectInit,
+
+              &GrowableArrayTest::appendFromEmpty<int>,
+              &GrowableArrayTest::appendFromEmpty<Movable>,
+              &GrowableArrayTest::appendFromNonGrowable<int>,
+              &GrowableArrayTest::appendFromNonGrowable<Movable>,
+              &GrowableArrayTest::appendCopy,
+              &GrowableArrayTest::appendMove,
+              &GrowableArrayTest::appendInPlace,
+              &GrowableArrayTest::appendList,
+              &GrowableArrayTest::appendNoInit,
+              &GrowableArrayTest::appendAliased,
+              &GrowableArrayTest::appendListAliased,
+              &GrowableArrayTest::appendGrowthIsGeometric,
+              &GrowableArrayTest::appendNonTrivialLifetime,
+
+              &GrowableArrayTest::removeSuffix,
+              &GrowableArrayTest::removeSuffixNonGrowable,
+              &GrowableArrayTest::removeSuffixOutOfRange,
+
+              &GrowableArrayTest::shrink,
+              &GrowableArrayTest::shrinkNonGrowable,
+
+              &GrowableArrayTest::explicitAllocator});
+}
+
+template<class T> struct TypeName;
+template<> struct TypeName<int> {
+    static const char* name() { return "int"; }
+};
+template<> struct TypeName<Movable> {
+    static const char* name() { return "Movable"; }
+};
+
+void GrowableArrayTest::allocatorSelection() {
+    CORRADE_VERIFY((std::is_same<ArrayAllocator<int>, ArrayMallocAllocator<int>>::value));
+    CORRADE_VERIFY((std::is_same<ArrayAllocator<Movable>, ArrayNewAllocator<Movable>>::value));
+    CORRADE_VERIFY((std::is_same<ArrayAllocator<std::string>, ArrayNewAllocator<std::string>>::value));
+}
+
+template<class T> void GrowableArrayTest::reserveFromEmpty() {
+    setTestCaseName(std::string{"reserveFromEmpty<"} + TypeName<T>::name() + ">");
+
+    {
+        Array<T> a;
+        CORRADE_VERIFY(!arrayIsGrowable(a));
+        CORRADE_COMPARE(arrayCapacity(a), 0);
+
+        CORRADE_COMPARE(arrayReserve(a, 100), 100);
+        CORRADE_VERIFY(arrayIsGrowable(a));
+        CORRADE_VERIFY(a.data());
+        CORRADE_COMPARE(a.size(), 0);
+        CORRADE_COMPARE(arrayCapacity(a), 100);
+    }
+}
+
+template<class T> void GrowableArrayTest::reserveFromNonGrowable() {
+    setTestCaseName(std::string{"reserveFromNonGrowable<"} + TypeName<T>::name() + ">");
+
+    Movable::constructed = Movable::destructed = 0;
+    {
+        Array<T> a{InPlaceInit, {2, 7, -1}};
+        const T* prev = a.data();
+        CORRADE_VERIFY(!arrayIsGrowable(a));
+        CORRADE_COMPARE(arrayCapacity(a), 3);
+
+        CORRADE_COMPARE(arrayReserve(a, 100), 100);
+        CORRADE_VERIFY(arrayIsGrowable(a));
+        CORRADE_VERIFY(a.data() != prev);
+        CORRADE_COMPARE(a.size(), 3);
+        CORRADE_COMPARE(arrayCapacity(a), 100);
+        CORRADE_COMPARE(int(a[0]), 2);
+        CORRADE_COMPARE(int(a[1]), 7);
+        CORRADE_COMPARE(int(a[2]), -1);
+    }
+
+    /* Three from the initializer list, three copied to the array, three
+       moved to the new storage */
+    if(std::is_same<T, Movable>::value) {
+        CORRADE_COMPARE(Movable::constructed, 9);
+        CORRADE_COMPARE(Movable::destructed, 9);
+    }
+}
+
+template<class T> void GrowableArrayTest::reserveFromGrowable() {
+    setTestCaseName(std::string{"reserveFromGrowable<"} + TypeName<T>::name() + ">");
+
+    Movable::constructed = Movable::destructed = 0;
+    {
+        Array<T> a;
+        arrayAppend(a, {2, 7, -1});
+        CORRADE_VERIFY(arrayIsGrowable(a));
+
+        CORRADE_COMPARE(arrayReserve(a, 100), 100);
+        CORRADE_VERIFY(arrayIsGrowable(a));
+        CORRADE_COMPARE(a.size(), 3);
+        CORRADE_COMPARE(arrayCapacity(a), 100);
+        CORRADE_COMPARE(int(a[0]), 2);
+        CORRADE_COMPARE(int(a[1]), 7);
+        CORRADE_COMPARE(int(a[2]), -1);
+    }
+
+    if(std::is_same<T, Movable>::value)
+        CORRADE_COMPARE(Movable::constructed, Movable::destructed);
+}
+
+void GrowableArrayTest::reserveSmaller() {
+    Array<int> a;
+    arrayReserve(a, 100);
+    const int* prev = a.data();
+
+    /* Reserving less than current capacity is a no-op */
+    CORRADE_COMPARE(arrayReserve(a, 50), 100);
+    CORRADE_COMPARE(a.data(), prev);
+    CORRADE_COMPARE(arrayCapacity(a), 100);
+
+    /* Non-growable arrays stay non-growable if they're large enough */
+    Array<int> b{10};
+    const int* prevB = b.data();
+    CORRADE_COMPARE(arrayReserve(b, 10), 10);
+    CORRADE_VERIFY(!arrayIsGrowable(b));
+    CORRADE_COMPARE(b.data(), prevB);
+}
+
+template<class T> void GrowableArrayTest::resizeFromEmpty() {
+    setTestCaseName(std::string{"resizeFromEmpty<"} + TypeName<T>::name() + ">");
+
+    Movable::constructed = Movable::destructed = 0;
+    {
+        Array<T> a;
+        arrayResize(a, ValueInit, 3);
+        CORRADE_VERIFY(arrayIsGrowable(a));
+        CORRADE_COMPARE(a.size(), 3);
+        CORRADE_COMPARE(arrayCapacity(a), 3);
+        CORRADE_COMPARE(int(a[0]), 0);
+        CORRADE_COMPARE(int(a[2]), 0);
+    }
+
+    if(std::is_same<T, Movable>::value) {
+        CORRADE_COMPARE(Movable::constructed, 3);
+        CORRADE_COMPARE(Movable::destructed, 3);
+    }
+}
+
+template<class T> void GrowableArrayTest::resizeFromNonGrowable() {
+    setTestCaseName(std::string{"resizeFromNonGrowable<"} + TypeName<T>::name() + ">");
+
+    Movable::constructed = Movable::destructed = 0;
+    {
+        Array<T> a{InPlaceInit, {2, 7}};
+        arrayResize(a, ValueInit, 4);
+        CORRADE_VERIFY(arrayIsGrowable(a));
+        CORRADE_COMPARE(a.size(), 4);
+        CORRADE_COMPARE(arrayCapacity(a), 4);
+        CORRADE_COMPARE(int(a[0]), 2);
+        CORRADE_COMPARE(int(a[1]), 7);
+        CORRADE_COMPARE(int(a[2]), 0);
+        CORRADE_COMPARE(int(a[3]), 0);
+    }
+
+    /* Two from the list, two copied, two moved, two new */
+    if(std::is_same<T, Movable>::value) {
+        CORRADE_COMPARE(Movable::constructed, 8);
+        CORRADE_COMPARE(Movable::destructed, 8);
+    }
+}
+
+template<class T> void GrowableArrayTest::resizeFromGrowable() {
+    setTestCaseName(std::string{"resizeFromGrowable<"} + TypeName<T>::name() + ">");
+
+    Movable::constructed = Movable::destructed = 0;
+    {
+        Array<T> a;
+        arrayReserve(a, 10);
+        arrayAppend(a, {2, 7});
+        const T* prev = a.data();
+
+        /* Fits into the capacity, no reallocation */
+        arrayResize(a, ValueInit, 5);
+        CORRADE_COMPARE(a.data(), prev);
+        CORRADE_COMPARE(a.size(), 5);
+        CORRADE_COMPARE(arrayCapacity(a), 10);
+        CORRADE_COMPARE(int(a[1]), 7);
+        CORRADE_COMPARE(int(a[4]), 0);
+
+        /* Doesn't fit, grows to exactly the requested size */
+        arrayResize(a, ValueInit, 12);
+        CORRADE_COMPARE(a.size(), 12);
+        CORRADE_COMPARE(arrayCapacity(a), 12);
+        CORRADE_COMPARE(int(a[0]), 2);
+        CORRADE_COMPARE(int(a[1]), 7);
+        CORRADE_COMPARE(int(a[11]), 0);
+    }
+
+    if(std::is_same<T, Movable>::value)
+        CORRADE_COMPARE(Movable::constructed, Movable::destructed);
+}
+
+void GrowableArrayTest::resizeShrink() {
+    Movable::constructed = Movable::destructed = 0;
+    {
+        Array<Movable> a;
+        arrayAppend(a, {1, 2, 3, 4, 5});
+        const Movable* prev = a.data();
+        const std::size_t capacity = arrayCapacity(a);
+        const int destructedBefore = Movable::destructed;
+
+        /* Shrinking a growable array is done in-place */
+        arrayResize(a, 2);
+        CORRADE_COMPARE(a.data(), prev);
+        CORRADE_COMPARE(a.size(), 2);
+        CORRADE_COMPARE(arrayCapacity(a), capacity);
+        CORRADE_COMPARE(Movable::destructed - destructedBefore, 3);
+        CORRADE_COMPARE(a[1].a, 2);
+    }
+
+    CORRADE_COMPARE(Movable::constructed, Movable::destructed);
+}
+
+void GrowableArrayTest::resizeDefaultInit() {
+    Array<Movable> a;
+    arrayResize(a, DefaultInit, 3);
+    CORRADE_COMPARE(a.size(), 3);
+    CORRADE_COMPARE(a[2].a, 0);
+
+    /* Default overload does the same */
+    arrayResize(a, 5);
+    CORRADE_COMPARE(a.size(), 5);
+    CORRADE_COMPARE(a[4].a, 0);
+}
+
+void GrowableArrayTest::resizeValueInit() {
+    Array<int> a{InPlaceInit, {3}};
+    arrayResize(a, ValueInit, 4);
+    CORRADE_COMPARE(a.size(), 4);
+    CORRADE_COMPARE(a[0], 3);
+    CORRADE_COMPARE(a[1], 0);
+    CORRADE_COMPARE(a[3], 0);
+}
+
+void GrowableArrayTest::resizeDirectInit() {
+    Array<int> a{InPlaceInit, {3}};
+    arrayResize(a, DirectInit, 4, -7);
+    CORRADE_COMPARE(a.size(), 4);
+    CORRADE_COMPARE(a[0], 3);
+    CORRADE_COMPARE(a[1], -7);
+    CORRADE_COMPARE(a[3], -7);
+}
+
+template<class T> void GrowableArrayTest::appendFromEmpty() {
+    setTestCaseName(std::string{"appendFromEmpty<"} + TypeName<T>::name() + ">");
+
+    Movable::constructed = Movable::destructed = 0;
+    {
+        Array<T> a;
+        T& appended = arrayAppend(a, T(37));
+        CORRADE_VERIFY(arrayIsGrowable(a));
+        CORRADE_COMPARE(a.size(), 1);
+        CORRADE_COMPARE(&appended, a.data());
+        CORRADE_COMPARE(int(a[0]), 37);
+
+        /* First allocation is at least 16 bytes */
+        CORRADE_COMPARE(arrayCapacity(a), (16 + sizeof(T) - 1)/sizeof(T));
+    }
+
+    if(std::is_same<T, Movable>::value)
+        CORRADE_COMPARE(Movable::constructed, Movable::destructed);
+}
+
+template<class T> void GrowableArrayTest::appendFromNonGrowable() {
+    setTestCaseName(std::string{"appendFromNonGrowable<"} + TypeName<T>::name() + ">");
+
+    Movable::constructed = Movable::destructed = 0;
+    {
+        Array<T> a{InPlaceInit, {2, 7}};
+        arrayAppend(a, T(-3));
+        CORRADE_VERIFY(arrayIsGrowable(a));
+        CORRADE_COMPARE(a.size(), 3);
+        CORRADE_COMPARE(arrayCapacity(a), 4);
+        CORRADE_COMPARE(int(a[0]), 2);
+        CORRADE_COMPARE(int(a[1]), 7);
+        CORRADE_COMPARE(int(a[2]), -3);
+    }
+
+    if(std::is_same<T, Movable>::value)
+        CORRADE_COMPARE(Movable::constructed, Movable::destructed);
+}
+
+void GrowableArrayTest::appendCopy() {
+    Array<std::string> a;
+    const std::string hello = "hello";
+    std::string& appended = arrayAppend(a, hello);
+    CORRADE_COMPARE(appended, "hello");
+    CORRADE_COMPARE(hello, "hello");
+    CORRADE_COMPARE(a.size(), 1);
+}
+
+void GrowableArrayTest::appendMove() {
+    Array<std::string> a;
+    std::string hello = "a string that's too long for small string optimization";
+    const char* data = hello.data();
+    std::string& appended = arrayAppend(a, std::move(hello));
+    CORRADE_COMPARE(appended, "a string that's too long for small string optimization");
+    CORRADE_COMPARE(static_cast<const void*>(appended.data()), static_cast<const void*>(data));
+}
+
+void GrowableArrayTest::appendInPlace() {
+    struct Pair {
+        int a;
+        float b;
+    };
+
+    Array<Pair> a;
+    Pair& appended = arrayAppend(a, InPlaceInit, 3, 1.5f);
+    CORRADE_COMPARE(appended.a, 3);
+    CORRADE_COMPARE(appended.b, 1.5f);
+    CORRADE_COMPARE(a.size(), 1);
+}
+
+void GrowableArrayTest::appendList() {
+    Array<int> a;
+    arrayAppend(a, 1);
+    ArrayView<int> appended = arrayAppend(a, {2, 3, 4});
+    CORRADE_COMPARE(appended.size(), 3);
+    CORRADE_COMPARE(appended.data(), a.data() + 1);
+
+    const int other[]{5, 6};
+    arrayAppend(a, other);
+    CORRADE_COMPARE(a.size(), 6);
+    for(std::size_t i = 0; i != a.size(); ++i)
+        CORRADE_COMPARE(a[i], i + 1);
+}
+
+void GrowableArrayTest::appendNoInit() {
+    Array<int> a;
+    ArrayView<int> appended = arrayAppend(a, NoInit, 5);
+    CORRADE_COMPARE(a.size(), 5);
+    CORRADE_COMPARE(appended.data(), a.data());
+    CORRADE_COMPARE(appended.size(), 5);
+
+    appended = arrayAppend(a, NoInit, 0);
+    CORRADE_COMPARE(a.size(), 5);
+    CORRADE_COMPARE(appended.size(), 0);
+    CORRADE_COMPARE(appended.data(), a.end());
+}
+
+void GrowableArrayTest::appendAliased() {
+    Array<std::string> a;
+    arrayAppend(a, std::string{"a string that's too long for small string optimization"});
+    CORRADE_COMPARE(arrayCapacity(a), 1);
+
+    /* This forces a reallocation, which would make the reference dangling
+       if it wasn't handled */
+    arrayAppend(a, a[0]);
+    CORRADE_COMPARE(a.size(), 2);
+    CORRADE_COMPARE(a[0], "a string that's too long for small string optimization");
+    CORRADE_COMPARE(a[1], "a string that's too long for small string optimization");
+}
+
+void GrowableArrayTest::appendListAliased() {
+    Array<std::string> a;
+    arrayAppend(a, {"first string that's too long for small string optimization",
+                    "second string that's too long for small string optimization"});
+    CORRADE_COMPARE(arrayCapacity(a), 2);
+
+    arrayAppend(a, a.prefix(2));
+    CORRADE_COMPARE(a.size(), 4);
+    CORRADE_COMPARE(a[2], "first string that's too long for small string optimization");
+    CORRADE_COMPARE(a[3], "second string that's too long for small string optimization");
+}
+
+void GrowableArrayTest::appendGrowthIsGeometric() {
+    Array<int> a;
+    std::size_t reallocations = 0;
+    const int* prev = nullptr;
+    for(int i = 0; i != 10000; ++i) {
+        arrayAppend(a, i);
+        if(a.data() != prev) {
+            ++reallocations;
+            prev = a.data();
+        }
+    }
+
+    CORRADE_COMPARE(a.size(), 10000);
+    CORRADE_COMPARE(a[9999], 9999);
+    /* Realloc can extend in place, so it can be also less */
+    CORRADE_COMPARE_AS(reallocations, 13, TestSuite::Compare::LessOrEqual);
+    CORRADE_COMPARE_AS(arrayCapacity(a), 16384, TestSuite::Compare::LessOrEqual);
+}
+
+void GrowableArrayTest::appendNonTrivialLifetime() {
+    Movable::constructed = Movable::destructed = Movable::moved = 0;
+    {
+        Array<Movable> a;
+        for(int i = 0; i != 100; ++i) arrayAppend(a, Movable{i});
+        CORRADE_COMPARE(a.size(), 100);
+        for(int i = 0; i != 100; ++i) CORRADE_COMPARE(a[i].a, i);
+
+        /* Each element was moved in and then moved on every reallocation */
+        CORRADE_COMPARE_AS(Movable::moved, 100, TestSuite::Compare::Greater);
+    }
+
+    CORRADE_COMPARE(Movable::constructed, Movable::destructed);
+}
+
+void GrowableArrayTest::removeSuffix() {
+    Movable::constructed = Movable::destructed = 0;
+    {
+        Array<Movable> a;
+        arrayAppend(a, {1, 2, 3, 4});
+        const Movable* prev = a.data();
+        const int destructedBefore = Movable::destructed;
+
+        arrayRemoveSuffix(a);
+        CORRADE_COMPARE(a.size(), 3);
+        CORRADE_COMPARE(a.data(), prev);
+        CORRADE_COMPARE(Movable::destructed - destructedBefore, 1);
+
+        arrayRemoveSuffix(a, 2);
+        CORRADE_COMPARE(a.size(), 1);
+        CORRADE_COMPARE(a.data(), prev);
+        CORRADE_COMPARE(a[0].a, 1);
+        CORRADE_COMPARE(Movable::destructed - destructedBefore, 3);
+
+        arrayRemoveSuffix(a, 0);
+        CORRADE_COMPARE(a.size(), 1);
+    }
+
+    CORRADE_COMPARE(Movable::constructed, Movable::destructed);
+}
+
+void GrowableArrayTest::removeSuffixNonGrowable() {
+    Array<int> a{InPlaceInit, {1, 2, 3, 4}};
+    arrayRemoveSuffix(a, 3);
+    CORRADE_VERIFY(arrayIsGrowable(a));
+    CORRADE_COMPARE(a.size(), 1);
+    CORRADE_COMPARE(arrayCapacity(a), 1);
+    CORRADE_COMPARE(a[0], 1);
+}
+
+void GrowableArrayTest::removeSuffixOutOfRange() {
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    Array<int> a{3};
+    arrayRemoveSuffix(a, 4);
+    CORRADE_COMPARE(a.size(), 3);
+    CORRADE_COMPARE(out.str(), "Containers::arrayRemoveSuffix(): can't remove 4 elements from an array of size 3\n");
+}
+
+void GrowableArrayTest::shrink() {
+    Movable::constructed = Movable::destructed = 0;
+    {
+        Array<Movable> a;
+        arrayAppend(a, {1, 2, 3});
+        CORRADE_VERIFY(arrayIsGrowable(a));
+        /* First allocation is rounded up to at least 16 bytes */
+        CORRADE_COMPARE(arrayCapacity(a), 4);
+        arrayAppend(a, {4, 5});
+        CORRADE_COMPARE(arrayCapacity(a), 8);
+
+        arrayShrink(a);
+        CORRADE_VERIFY(!arrayIsGrowable(a));
+        CORRADE_VERIFY(a.deleter() == Implementation::noInitDeleter<Movable>);
+        CORRADE_COMPARE(a.size(), 5);
+        CORRADE_COMPARE(arrayCapacity(a), 5);
+        CORRADE_COMPARE(a[0].a, 1);
+        CORRADE_COMPARE(a[4].a, 5);
+    }
+
+    CORRADE_COMPARE(Movable::constructed, Movable::destructed);
+}
+
+void GrowableArrayTest::shrinkNonGrowable() {
+    Array<int> a{3};
+    const int* prev = a.data();
+    arrayShrink(a);
+    CORRADE_COMPARE(a.data(), prev);
+    CORRADE_VERIFY(!a.deleter());
+}
+
+void GrowableArrayTest::explicitAllocator() {
+    /* Trivially copyable type, but explicitly using the new allocator */
+    Array<int> a;
+    arrayAppend<int, ArrayNewAllocator<int>>(a, {1, 2, 3});
+    CORRADE_VERIFY((arrayIsGrowable<int, ArrayNewAllocator<int>>(a)));
+    CORRADE_VERIFY(!arrayIsGrowable(a));
+    CORRADE_COMPARE((arrayCapacity<int, ArrayNewAllocator<int>>(a)), 4);
+    CORRADE_COMPARE(a[2], 3);
+
+    /* Growing with a different allocator moves the contents over */
+    arrayAppend(a, 4);
+    CORRADE_VERIFY(arrayIsGrowable(a));
+    CORRADE_VERIFY(!(arrayIsGrowable<int, ArrayNewAllocator<int>>(a)));
+    CORRADE_COMPARE(a.size(), 4);
+    CORRADE_COMPARE(a[0], 1);
+    CORRADE_COMPARE(a[3], 4);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Corrade::Containers::Test::GrowableArrayTest)
@@ -0,0 +1,241 @@
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <cstdlib>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "Corrade/Containers/HashMap.h"
+#include "Corrade/TestSuite/Tester.h"
+
+namespace Corrade { namespace Containers { namespace Test {
+
+struct HashMapBenchmark: TestSuite::Tester {
+    explicit HashMapBenchmark();
+
+    void insertStdMap();
+    void insertStdUnorderedMap();
+    void insertHashMap();
+
+    void lookupStdMap();
+    void lookupStdUnorderedMap();
+    void lookupHashMap();
+
+    void lookupStringStdMap();
+    void lookupStringStdUnorderedMap();
+    void lookupStringHashMap();
+};
+
+namespace {
+
+/* The two largest sizes take a lot of time and memory, especially with the
+   node-based containers, so they're run only if the
+   CORRADE_HASHMAP_BENCHMARK_ALL_SIZES environment variable is set */
+constexpr std::size_t Sizes[]{100, 1000, 10000, 100000, 1000000, 10000000};
+constexpr std::size_t DefaultSizeCount = 4;
+
+/* Keys are scrambled so they're not inserted or looked up in order.
+   Multiplying by an odd constant is a bijection, so there are no duplicates. */
+std::uint32_t key(std::size_t i) {
+    return std::uint32_t(i)*2654435761u;
+}
+
+std::vector<std::string> stringKeys(std::size_t size) {
+    std::vector<std::string> keys;
+    keys.reserve(size);
+    for(std::size_t i = 0; i != size; ++i)
+        keys.push_back("resource/" + std::to_string(key(i)));
+    return keys;
+}
+
+/* Concatenates the keys into a single buffer, simulating lookup from
+   non-owning string data such as a file */
+std::string concatenate(const std::vector<std::string>& keys) {
+    std::string out;
+    for(const std::string& key: keys) out += key;
+    return out;
+}
+
+}
+
+HashMapBenchmark::HashMapBenchmark() {
+    addInstancedBenchmarks({&HashMapBenchmark::insertStdMap,
+                            &HashMapBenchmark::insertStdUnorderedMap,
+                            &HashMapBenchmark::insertHashMap,
+
+                            &HashMapBenchmark::lookupStdMap,
+                            &HashMapBenchmark::lookupStdUnorderedMap,
+                            &HashMapBenchmark::lookupHashMap,
+
+                            &HashMapBenchmark::lookupStringStdMap,
+                            &HashMapBenchmark::lookupStringStdUnorderedMap,
+                            &HashMapBenchmark::lookupStringHashMap}, 5,
+        std::getenv("CORRADE_HASHMAP_BENCHMARK_ALL_SIZES") ? Containers::arraySize(Sizes) : DefaultSizeCount);
+}
+
+void HashMapBenchmark::insertStdMap() {
+    const std::size_t size = Sizes[testCaseInstanceId()];
+    setTestCaseDescription(std::to_string(size));
+
+    std::map<std::uint32_t, std::uint32_t> map;
+    CORRADE_BENCHMARK(1)
+        for(std::size_t i = 0; i != size; ++i) map.emplace(key(i), i);
+
+    CORRADE_COMPARE(map.size(), size);
+}
+
+void HashMapBenchmark::insertStdUnorderedMap() {
+    const std::size_t size = Sizes[testCaseInstanceId()];
+    setTestCaseDescription(std::to_string(size));
+
+    std::unordered_map<std::uint32_t, std::uint32_t> map;
+    CORRADE_BENCHMARK(1)
+        for(std::size_t i = 0; i != size; ++i) map.emplace(key(i), i);
+
+    CORRADE_COMPARE(map.size(), size);
+}
+
+void HashMapBenchmark::insertHashMap() {
+    const std::size_t size = Sizes[testCaseInstanceId()];
+    setTestCaseDescription(std::to_string(size));
+
+    HashMap<std::uint32_t, std::uint32_t> map;
+    CORRADE_BENCHMARK(1)
+        for(std::size_t i = 0; i != size; ++i) map.emplace(key(i), i);
+
+    CORRADE_COMPARE(map.size(), size);
+}
+
+void HashMapBenchmark::lookupStdMap() {
+    const std::size_t size = Sizes[testCaseInstanceId()];
+    setTestCaseDescription(std::to_string(size));
+
+    std::map<std::uint32_t, std::uint32_t> map;
+    for(std::size_t i = 0; i != size; ++i) map.emplace(key(i), i);
+
+    std::size_t sum = 0;
+    CORRADE_BENCHMARK(1)
+        for(std::size_t i = 0; i != size; ++i) sum += map.find(key(i))->second;
+
+    CORRADE_COMPARE(sum, size*(size - 1)/2);
+}
+
+void HashMapBenchmark::lookupStdUnorderedMap() {
+    const std::size_t size = Sizes[testCaseInstanceId()];
+    setTestCaseDescription(std::to_string(size));
+
+    std::unordered_map<std::uint32_t, std::uint32_t> map;
+    for(std::size_t i = 0; i != size; ++i) map.emplace(key(i), i);
+
+    std::size_t sum = 0;
+    CORRADE_BENCHMARK(1)
+        for(std::size_t i = 0; i != size; ++i) sum += map.find(key(i))->second;
+
+    CORRADE_COMPARE(sum, size*(size - 1)/2);
+}
+
+void HashMapBenchmark::lookupHashMap() {
+    const std::size_t size = Sizes[testCaseInstanceId()];
+    setTestCaseDescription(std::to_string(size));
+
+    HashMap<std::uint32_t, std::uint32_t> map;
+    for(std::size_t i = 0; i != size; ++i) map.emplace(key(i), i);
+
+    std::size_t sum = 0;
+    CORRADE_BENCHMARK(1)
+        for(std::size_t i = 0; i != size; ++i) sum += *map.find(key(i));
+
+    CORRADE_COMPARE(sum, size*(size - 1)/2);
+}
+
+void HashMapBenchmark::lookupStringStdMap() {
+    const std::size_t size = Sizes[testCaseInstanceId()];
+    setTestCaseDescription(std::to_string(size));
+
+    const std::vector<std::string> keys = stringKeys(size);
+    const std::string data = concatenate(keys);
+    std::map<std::string, std::size_t> map;
+    for(std::size_t i = 0; i != size; ++i) map.emplace(keys[i], i);
+
+    std::size_t sum = 0;
+    CORRADE_BENCHMARK(1) {
+        const char* key = data.data();
+        for(std::size_t i = 0; i != size; ++i) {
+            sum += map.find(std::string{key, keys[i].size()})->second;
+            key += keys[i].size();
+        }
+    }
+
+    CORRADE_COMPARE(sum, size*(size - 1)/2);
+}
+
+void HashMapBenchmark::lookupStringStdUnorderedMap() {
+    const std::size_t size = Sizes[testCaseInstanceId()];
+    setTestCaseDescription(std::to_string(size));
+
+    const std::vector<std::string> keys = stringKeys(size);
+    const std::string data = concatenate(keys);
+    std::unordered_map<std::string, std::size_t> map;
+    for(std::size_t i = 0; i != size; ++i) map.emplace(keys[i], i);
+
+    std::size_t sum = 0;
+    CORRADE_BENCHMARK(1) {
+        const char* key = data.data();
+        for(std::size_t i = 0; i != size; ++i) {
+            sum += map.find(std::string{key, keys[i].size()})->second;
+            key += keys[i].size();
+        }
+    }
+
+    CORRADE_COMPARE(sum, size*(size - 1)/2);
+}
+
+void HashMapBenchmark::lookupStringHashMap() {
+    const std::size_t size = Sizes[testCaseInstanceId()];
+    setTestCaseDescription(std::to_string(size));
+
+    const std::vector<std::string> keys = stringKeys(size);
+    const std::string data = concatenate(keys);
+    HashMap<std::string, std::size_t> map;
+    for(std::size_t i = 0; i != size; ++i) map.emplace(keys[i], i);
+
+    /* No temporary std::string needed */
+    std::size_t sum = 0;
+    CORRADE_BENCHMARK(1) {
+        const char* key = data.data();
+        for(std::size_t i = 0; i != size; ++i) {
+            sum += *map.find(ArrayView<const char>{key, keys[i].size()});
+            key += keys[i].size();
+        }
+    }
+
+    CORRADE_COMPARE(sum, size*(size - 1)/2);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Corrade::Containers::Test::HashMapBenchmark)
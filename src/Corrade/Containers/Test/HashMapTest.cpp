@@ -0,0 +1,483 @@
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <string>
+
+#include "Corrade/Containers/Array.h"
+#include "Corrade/Containers/HashMap.h"
+#include "Corrade/TestSuite/Tester.h"
+
+namespace Corrade { namespace Containers { namespace Test {
+
+struct HashMapTest: TestSuite::Tester {
+    explicit HashMapTest();
+
+    void constructDefault();
+    void constructReserve();
+    void constructInPlaceInit();
+    void constructMove();
+
+    void insert();
+    void insertExisting();
+    void emplace();
+    void emplaceMoveOnly();
+    void accessOperator();
+
+    void find();
+    void findEmpty();
+    void findHeterogeneous();
+    void emplaceHeterogeneous();
+    void accessOperatorHeterogeneous();
+
+    void erase();
+    void eraseNotFound();
+    void eraseReinsert();
+
+    void grow();
+    void clear();
+    void iterate();
+    void iterateEmpty();
+
+    void nonTrivial();
+    void pointerKey();
+    void enumKey();
+    void collidingHashes();
+};
+
+HashMapTest::HashMapTest() {
+    addTests({&HashMapTest::constructDefault,
+              &HashMapTest::constructReserve,
+              &HashMapTest::constructInPlaceInit,
+              &HashMapTest::constructMove,
+
+              &HashMapTest::insert,
+              &HashMapTest::insertExisting,
+              &HashMapTest::emplace,
+              &HashMapTest::emplaceMoveOnly,
+              &HashMapTest::accessOperator,
+
+              &HashMapTest::find,
+              &HashMapTest::findEmpty,
+              &HashMapTest::findHeterogeneous,
+              &HashMapTest::emplaceHeterogeneous,
+              &HashMapTest::accessOperatorHeterogeneous,
+
+              &HashMapTest::erase,
+              &HashMapTest::eraseNotFound,
+              &HashMapTest::eraseReinsert,
+
+              &HashMapTest::grow,
+              &HashMapTest::clear,
+              &HashMapTest::iterate,
+              &HashMapTest::iterateEmpty,
+
+              &HashMapTest::nonTrivial,
+              &HashMapTest::pointerKey,
+              &HashMapTest::enumKey,
+              &HashMapTest::collidingHashes});
+}
+
+void HashMapTest::constructDefault() {
+    HashMap<int, int> a;
+    CORRADE_VERIFY(a.empty());
+    CORRADE_COMPARE(a.size(), 0);
+    CORRADE_COMPARE(a.capacity(), 0);
+}
+
+void HashMapTest::constructReserve() {
+    HashMap<int, int> a{100};
+    CORRADE_VERIFY(a.empty());
+    CORRADE_COMPARE(a.capacity(), 128);
+
+    /* Filling up to the reserved size shouldn't reallocate */
+    for(int i = 0; i != 100; ++i) a.insert(i, i);
+    CORRADE_COMPARE(a.size(), 100);
+    CORRADE_COMPARE(a.capacity(), 128);
+}
+
+void HashMapTest::constructInPlaceInit() {
+    HashMap<int, std::string> a{InPlaceInit, {
+        {3, "three"},
+        {7, "seven"},
+        {3, "another three"}
+    }};
+    CORRADE_COMPARE(a.size(), 2);
+    CORRADE_VERIFY(a.find(3));
+    CORRADE_COMPARE(*a.find(3), "three");
+    CORRADE_VERIFY(a.find(7));
+    CORRADE_COMPARE(*a.find(7), "seven");
+}
+
+void HashMapTest::constructMove() {
+    HashMap<int, int> a{InPlaceInit, {{1, 10}, {2, 20}}};
+    const std::size_t capacity = a.capacity();
+
+    HashMap<int, int> b{std::move(a)};
+    CORRADE_COMPARE(a.size(), 0);
+    CORRADE_COMPARE(a.capacity(), 0);
+    CORRADE_VERIFY(!a.find(1));
+    CORRADE_COMPARE(b.size(), 2);
+    CORRADE_COMPARE(b.capacity(), capacity);
+    CORRADE_VERIFY(b.find(2));
+    CORRADE_COMPARE(*b.find(2), 20);
+
+    HashMap<int, int> c{InPlaceInit, {{5, 50}}};
+    c = std::move(b);
+    CORRADE_COMPARE(c.size(), 2);
+    CORRADE_VERIFY(c.find(1));
+    CORRADE_COMPARE(*c.find(1), 10);
+    CORRADE_COMPARE(b.size(), 1);
+    CORRADE_VERIFY(b.find(5));
+
+    CORRADE_VERIFY((std::is_nothrow_move_constructible<HashMap<int, int>>::value));
+    CORRADE_VERIFY((std::is_nothrow_move_assignable<HashMap<int, int>>::value));
+    CORRADE_VERIFY(!(std::is_copy_constructible<HashMap<int, int>>::value));
+    CORRADE_VERIFY(!(std::is_copy_assignable<HashMap<int, int>>::value));
+}
+
+void HashMapTest::insert() {
+    HashMap<std::string, int> a;
+    std::pair<int*, bool> inserted = a.insert("hello", 3);
+    CORRADE_VERIFY(inserted.second);
+    CORRADE_VERIFY(inserted.first);
+    CORRADE_COMPARE(*inserted.first, 3);
+    CORRADE_COMPARE(a.size(), 1);
+    CORRADE_VERIFY(a.contains("hello"));
+    CORRADE_VERIFY(!a.contains("hell"));
+}
+
+void HashMapTest::insertExisting() {
+    HashMap<std::string, int> a;
+    a.insert("hello", 3);
+
+    std::pair<int*, bool> inserted = a.insert("hello", 5);
+    CORRADE_VERIFY(!inserted.second);
+    CORRADE_VERIFY(inserted.first);
+    CORRADE_COMPARE(*inserted.first, 3);
+    CORRADE_COMPARE(a.size(), 1);
+}
+
+void HashMapTest::emplace() {
+    HashMap<int, std::string> a;
+    std::pair<std::string*, bool> inserted = a.emplace(1, 3, 'a');
+    CORRADE_VERIFY(inserted.second);
+    CORRADE_COMPARE(*inserted.first, "aaa");
+
+    inserted = a.emplace(1, 5, 'b');
+    CORRADE_VERIFY(!inserted.second);
+    CORRADE_COMPARE(*inserted.first, "aaa");
+}
+
+void HashMapTest::emplaceMoveOnly() {
+    HashMap<int, Array<int>> a;
+    a.emplace(5, Array<int>{ValueInit, 3});
+    a.emplace(7, ValueInit, 2);
+
+    CORRADE_VERIFY(a.find(5));
+    CORRADE_COMPARE(a.find(5)->size(), 3);
+    CORRADE_VERIFY(a.find(7));
+    CORRADE_COMPARE(a.find(7)->size(), 2);
+}
+
+void HashMapTest::accessOperator() {
+    HashMap<std::string, int> a;
+    a["hello"] = 3;
+    a["world"] += 5;
+    a["hello"] += 1;
+
+    CORRADE_COMPARE(a.size(), 2);
+    CORRADE_COMPARE(a["hello"], 4);
+    CORRADE_COMPARE(a["world"], 5);
+}
+
+void HashMapTest::find() {
+    HashMap<int, int> a{InPlaceInit, {{1, 10}, {2, 20}, {3, 30}}};
+    const HashMap<int, int>& ca = a;
+
+    int* found = a.find(2);
+    CORRADE_VERIFY(found);
+    CORRADE_COMPARE(*found, 20);
+    *found = 25;
+
+    const int* cfound = ca.find(2);
+    CORRADE_COMPARE(cfound, found);
+    CORRADE_COMPARE(*cfound, 25);
+
+    CORRADE_VERIFY(!a.find(4));
+    CORRADE_VERIFY(!ca.find(4));
+    CORRADE_VERIFY(ca.contains(3));
+    CORRADE_VERIFY(!ca.contains(0));
+}
+
+void HashMapTest::findEmpty() {
+    const HashMap<int, int> a;
+    CORRADE_VERIFY(!a.find(0));
+    CORRADE_VERIFY(!a.contains(0));
+}
+
+void HashMapTest::findHeterogeneous() {
+    HashMap<std::string, int> a;
+    a.insert("hello", 1);
+    a.insert(std::string{"a string that's long enough to span several chunks"}, 2);
+    a.insert(std::string{}, 3);
+
+    /* Hashes of all overloads need to be the same */
+    CORRADE_COMPARE(HashMapTraits<std::string>::hash("hello"),
+        HashMapTraits<std::string>::hash(std::string{"hello"}));
+    CORRADE_COMPARE(HashMapTraits<std::string>::hash(ArrayView<const char>{"hello", 5}),
+        HashMapTraits<std::string>::hash(std::string{"hello"}));
+
+    /* Only the prefix of the view is the key */
+    const char data[] = "hello world";
+    CORRADE_VERIFY(a.find(ArrayView<const char>{data, 5}));
+    CORRADE_COMPARE(*a.find(ArrayView<const char>{data, 5}), 1);
+    CORRADE_VERIFY(!a.find(ArrayView<const char>{data, 4}));
+    CORRADE_VERIFY(!a.find(ArrayView<const char>{data}));
+
+    CORRADE_VERIFY(a.find("a string that's long enough to span several chunks"));
+    CORRADE_COMPARE(*a.find("a string that's long enough to span several chunks"), 2);
+    CORRADE_VERIFY(!a.find("a string that's long enough to span several chunk"));
+
+    CORRADE_VERIFY(a.find(ArrayView<const char>{}));
+    CORRADE_COMPARE(*a.find(ArrayView<const char>{}), 3);
+    CORRADE_VERIFY(a.find(""));
+}
+
+void HashMapTest::emplaceHeterogeneous() {
+    HashMap<std::string, int> a;
+
+    /* The view isn't null-terminated at its end, only the prefix should get
+       stored */
+    const char data[] = "helloXXXX";
+    std::pair<int*, bool> inserted = a.emplace(ArrayView<const char>{data, 5}, 3);
+    CORRADE_VERIFY(inserted.second);
+    CORRADE_COMPARE(*inserted.first, 3);
+    CORRADE_COMPARE(a.begin()->key(), "hello");
+
+    std::pair<int*, bool> existing = a.emplace(ArrayView<const char>{data, 5}, 4);
+    CORRADE_VERIFY(!existing.second);
+    CORRADE_COMPARE(*existing.first, 3);
+    CORRADE_COMPARE(a.size(), 1);
+
+    CORRADE_VERIFY(a.find("hello"));
+    CORRADE_VERIFY(a.find(std::string{"hello"}));
+    CORRADE_VERIFY(!a.find("helloXXXX"));
+
+    CORRADE_VERIFY(a.emplace("world", 5).second);
+    CORRADE_VERIFY(!a.emplace(ArrayView<const char>{"world", 5}, 6).second);
+    CORRADE_VERIFY(!a.emplace(std::string{"world"}, 6).second);
+    CORRADE_COMPARE(a.size(), 2);
+    CORRADE_COMPARE(*a.find("world"), 5);
+}
+
+void HashMapTest::accessOperatorHeterogeneous() {
+    HashMap<std::string, int> a;
+
+    const char data[] = "helloXXXX";
+    a[ArrayView<const char>{data, 5}] = 3;
+    a[ArrayView<const char>{data, 5}] += 1;
+    a["hello"] += 10;
+    CORRADE_COMPARE(a.size(), 1);
+    CORRADE_COMPARE(a.begin()->key(), "hello");
+    CORRADE_COMPARE(a[std::string{"hello"}], 14);
+    CORRADE_VERIFY(!a.find("helloXXXX"));
+}
+
+void HashMapTest::erase() {
+    HashMap<int, int> a{InPlaceInit, {{1, 10}, {2, 20}, {3, 30}}};
+    const std::size_t capacity = a.capacity();
+
+    CORRADE_VERIFY(a.erase(2));
+    CORRADE_COMPARE(a.size(), 2);
+    CORRADE_COMPARE(a.capacity(), capacity);
+    CORRADE_VERIFY(!a.find(2));
+    CORRADE_VERIFY(a.find(1));
+    CORRADE_VERIFY(a.find(3));
+}
+
+void HashMapTest::eraseNotFound() {
+    HashMap<int, int> a{InPlaceInit, {{1, 10}}};
+    CORRADE_VERIFY(!a.erase(2));
+    CORRADE_COMPARE(a.size(), 1);
+
+    HashMap<int, int> b;
+    CORRADE_VERIFY(!b.erase(2));
+}
+
+void HashMapTest::eraseReinsert() {
+    /* Repeatedly erasing and inserting different keys shouldn't make the
+       map grow indefinitely */
+    HashMap<int, int> a;
+    for(int i = 0; i != 100; ++i) a.insert(i, i);
+    const std::size_t capacity = a.capacity();
+
+    for(int i = 100; i != 10000; ++i) {
+        CORRADE_VERIFY(a.erase(i - 100));
+        a.insert(i, i);
+    }
+
+    CORRADE_COMPARE(a.size(), 100);
+    CORRADE_COMPARE(a.capacity(), capacity);
+    for(int i = 9900; i != 10000; ++i) {
+        CORRADE_VERIFY(a.find(i));
+        CORRADE_COMPARE(*a.find(i), i);
+    }
+    CORRADE_VERIFY(!a.find(9899));
+}
+
+void HashMapTest::grow() {
+    HashMap<int, int> a;
+    for(int i = 0; i != 10000; ++i) a.insert(i*7, i);
+
+    CORRADE_COMPARE(a.size(), 10000);
+    /* Power of two, at most 7/8 full */
+    CORRADE_COMPARE(a.capacity(), 16384);
+    for(int i = 0; i != 10000; ++i) {
+        CORRADE_VERIFY(a.find(i*7));
+        CORRADE_COMPARE(*a.find(i*7), i);
+    }
+    CORRADE_VERIFY(!a.find(1));
+}
+
+void HashMapTest::clear() {
+    HashMap<int, int> a{InPlaceInit, {{1, 10}, {2, 20}}};
+    const std::size_t capacity = a.capacity();
+
+    a.clear();
+    CORRADE_VERIFY(a.empty());
+    CORRADE_COMPARE(a.capacity(), capacity);
+    CORRADE_VERIFY(!a.find(1));
+
+    a.insert(1, 15);
+    CORRADE_COMPARE(*a.find(1), 15);
+}
+
+void HashMapTest::iterate() {
+    HashMap<int, int> a;
+    for(int i = 0; i != 100; ++i) a.insert(i, i*10);
+    for(int i = 0; i != 100; i += 2) a.erase(i);
+
+    int keySum = 0, count = 0;
+    for(HashMap<int, int>::Entry& entry: a) {
+        CORRADE_COMPARE(entry.value(), entry.key()*10);
+        keySum += entry.key();
+        ++count;
+        entry.value() = 0;
+    }
+    CORRADE_COMPARE(count, 50);
+    CORRADE_COMPARE(keySum, 2500);
+
+    const HashMap<int, int>& ca = a;
+    for(const HashMap<int, int>::Entry& entry: ca)
+        CORRADE_COMPARE(entry.value(), 0);
+    CORRADE_VERIFY(ca.cbegin() != ca.cend());
+}
+
+void HashMapTest::iterateEmpty() {
+    HashMap<int, int> a;
+    CORRADE_VERIFY(a.begin() == a.end());
+
+    a.insert(1, 1);
+    a.erase(1);
+    CORRADE_VERIFY(a.begin() == a.end());
+}
+
+namespace {
+    struct Counted {
+        static int constructed, destructed;
+
+        explicit Counted(int value = 0): value{value} { ++constructed; }
+        Counted(const Counted& other): value{other.value} { ++constructed; }
+        Counted(Counted&& other): value{other.value} { ++constructed; }
+        ~Counted() { ++destructed; }
+        Counted& operator=(const Counted&) = default;
+
+        int value;
+    };
+
+    int Counted::constructed = 0;
+    int Counted::destructed = 0;
+
+    enum class Fruit: unsigned char { Apple, Banana, Cherry };
+
+    /* All keys collide, so everything is found only through probing */
+    struct CollidingTraits {
+        static std::uint64_t hash(int) { return 0x1234; }
+        static bool equal(int a, int b) { return a == b; }
+    };
+}
+
+void HashMapTest::nonTrivial() {
+    Counted::constructed = Counted::destructed = 0;
+
+    {
+        HashMap<int, Counted> a;
+        for(int i = 0; i != 100; ++i) a.emplace(i, i);
+        for(int i = 0; i < 100; i += 3) a.erase(i);
+        CORRADE_COMPARE(a.size(), 66);
+        a[1000].value = 5;
+        CORRADE_COMPARE(a.find(1000)->value, 5);
+        CORRADE_COMPARE(a.find(50)->value, 50);
+    }
+
+    CORRADE_VERIFY(Counted::constructed > 100);
+    CORRADE_COMPARE(Counted::destructed, Counted::constructed);
+}
+
+void HashMapTest::pointerKey() {
+    int data[3]{};
+    HashMap<const int*, int> a;
+    a.insert(data + 0, 0);
+    a.insert(data + 2, 2);
+
+    CORRADE_VERIFY(a.find(data + 2));
+    CORRADE_COMPARE(*a.find(data + 2), 2);
+    CORRADE_VERIFY(!a.find(data + 1));
+}
+
+void HashMapTest::enumKey() {
+    HashMap<Fruit, std::string> a;
+    a[Fruit::Apple] = "red";
+    a[Fruit::Banana] = "yellow";
+
+    CORRADE_VERIFY(a.find(Fruit::Banana));
+    CORRADE_COMPARE(*a.find(Fruit::Banana), "yellow");
+    CORRADE_VERIFY(!a.find(Fruit::Cherry));
+}
+
+void HashMapTest::collidingHashes() {
+    HashMap<int, int, CollidingTraits> a;
+    for(int i = 0; i != 100; ++i) a.insert(i, i);
+    for(int i = 0; i != 100; i += 2) a.erase(i);
+
+    CORRADE_COMPARE(a.size(), 50);
+    for(int i = 0; i != 100; ++i) {
+        CORRADE_COMPARE(a.contains(i), i % 2 == 1);
+    }
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Corrade::Containers::Test::HashMapTest)
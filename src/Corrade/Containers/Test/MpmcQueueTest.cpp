@@ -0,0 +1,387 @@
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <string>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "Corrade/Containers/MpmcQueue.h"
+#include "Corrade/TestSuite/Tester.h"
+
+namespace Corrade { namespace Containers { namespace Test {
+
+struct MpmcQueueTest: TestSuite::Tester {
+    explicit MpmcQueueTest();
+
+    void construct();
+    void constructCopy();
+
+    void pushPop();
+    void pushFull();
+    void popEmpty();
+    void emplace();
+    void wrapAround();
+
+    void pushPopBatch();
+    void pushBatchFull();
+    void popBatchPartial();
+
+    void destructRemaining();
+    void threaded();
+    void threadedBatch();
+    void threadedMultiple();
+    void threadedMultipleBatch();
+};
+
+MpmcQueueTest::MpmcQueueTest() {
+    addTests({&MpmcQueueTest::construct,
+              &MpmcQueueTest::constructCopy,
+
+              &MpmcQueueTest::pushPop,
+              &MpmcQueueTest::pushFull,
+              &MpmcQueueTest::popEmpty,
+              &MpmcQueueTest::emplace,
+              &MpmcQueueTest::wrapAround,
+
+              &MpmcQueueTest::pushPopBatch,
+              &MpmcQueueTest::pushBatchFull,
+              &MpmcQueueTest::popBatchPartial,
+
+              &MpmcQueueTest::destructRemaining,
+              &MpmcQueueTest::threaded,
+              &MpmcQueueTest::threadedBatch,
+              &MpmcQueueTest::threadedMultiple,
+              &MpmcQueueTest::threadedMultipleBatch});
+}
+
+void MpmcQueueTest::construct() {
+    MpmcQueue<int> a{5};
+    CORRADE_COMPARE(a.capacity(), 8);
+    CORRADE_COMPARE(a.size(), 0);
+    CORRADE_VERIFY(a.empty());
+
+    MpmcQueue<int> b{0};
+    CORRADE_COMPARE(b.capacity(), 2);
+
+    MpmcQueue<int> c{16};
+    CORRADE_COMPARE(c.capacity(), 16);
+}
+
+void MpmcQueueTest::constructCopy() {
+    CORRADE_VERIFY(!(std::is_copy_constructible<MpmcQueue<int>>::value));
+    CORRADE_VERIFY(!(std::is_copy_assignable<MpmcQueue<int>>::value));
+    CORRADE_VERIFY(!(std::is_move_constructible<MpmcQueue<int>>::value));
+    CORRADE_VERIFY(!(std::is_move_assignable<MpmcQueue<int>>::value));
+}
+
+void MpmcQueueTest::pushPop() {
+    MpmcQueue<std::string> a{4};
+    CORRADE_VERIFY(a.tryPush("hello"));
+    const std::string world = "world";
+    CORRADE_VERIFY(a.tryPush(world));
+    CORRADE_COMPARE(a.size(), 2);
+
+    std::string out;
+    CORRADE_VERIFY(a.tryPop(out));
+    CORRADE_COMPARE(out, "hello");
+    CORRADE_VERIFY(a.tryPop(out));
+    CORRADE_COMPARE(out, "world");
+    CORRADE_VERIFY(a.empty());
+}
+
+void MpmcQueueTest::pushFull() {
+    MpmcQueue<int> a{4};
+    for(int i = 0; i != 4; ++i) CORRADE_VERIFY(a.tryPush(i));
+    CORRADE_VERIFY(!a.tryPush(4));
+    CORRADE_COMPARE(a.size(), 4);
+
+    int out;
+    CORRADE_VERIFY(a.tryPop(out));
+    CORRADE_COMPARE(out, 0);
+    CORRADE_VERIFY(a.tryPush(4));
+    CORRADE_VERIFY(!a.tryPush(5));
+}
+
+void MpmcQueueTest::popEmpty() {
+    MpmcQueue<int> a{4};
+    int out = 1337;
+    CORRADE_VERIFY(!a.tryPop(out));
+    CORRADE_COMPARE(out, 1337);
+
+    a.tryPush(3);
+    CORRADE_VERIFY(a.tryPop(out));
+    CORRADE_VERIFY(!a.tryPop(out));
+    CORRADE_COMPARE(out, 3);
+}
+
+void MpmcQueueTest::emplace() {
+    MpmcQueue<std::string> a{4};
+    CORRADE_VERIFY(a.tryEmplace(3, 'a'));
+
+    std::string out;
+    CORRADE_VERIFY(a.tryPop(out));
+    CORRADE_COMPARE(out, "aaa");
+}
+
+void MpmcQueueTest::wrapAround() {
+    MpmcQueue<int> a{4};
+    int out;
+    for(int i = 0; i != 100; ++i) {
+        CORRADE_VERIFY(a.tryPush(i));
+        CORRADE_VERIFY(a.tryPush(i + 1000));
+        CORRADE_VERIFY(a.tryPop(out));
+        CORRADE_COMPARE(out, i);
+        CORRADE_VERIFY(a.tryPop(out));
+        CORRADE_COMPARE(out, i + 1000);
+    }
+    CORRADE_VERIFY(a.empty());
+}
+
+void MpmcQueueTest::pushPopBatch() {
+    MpmcQueue<int> a{8};
+    const int in[]{1, 2, 3, 4, 5};
+    CORRADE_COMPARE(a.tryPush(ArrayView<const int>{in}), 5);
+    CORRADE_COMPARE(a.size(), 5);
+
+    int out[5]{};
+    CORRADE_COMPARE(a.tryPop(ArrayView<int>{out}), 5);
+    CORRADE_COMPARE(out[0], 1);
+    CORRADE_COMPARE(out[4], 5);
+    CORRADE_VERIFY(a.empty());
+
+    /* Now the batch wraps around the end of the buffer */
+    CORRADE_COMPARE(a.tryPush(ArrayView<const int>{in}), 5);
+    CORRADE_COMPARE(a.tryPop(ArrayView<int>{out}), 5);
+    CORRADE_COMPARE(out[0], 1);
+    CORRADE_COMPARE(out[4], 5);
+
+    CORRADE_COMPARE(a.tryPush(ArrayView<const int>{}), 0);
+    CORRADE_COMPARE(a.tryPop(ArrayView<int>{}), 0);
+}
+
+void MpmcQueueTest::pushBatchFull() {
+    MpmcQueue<int> a{4};
+    a.tryPush(0);
+    const int in[]{1, 2, 3, 4, 5};
+    CORRADE_COMPARE(a.tryPush(ArrayView<const int>{in}), 3);
+    CORRADE_COMPARE(a.tryPush(ArrayView<const int>{in}), 0);
+
+    int out;
+    a.tryPop(out);
+    a.tryPop(out);
+    CORRADE_COMPARE(out, 1);
+}
+
+void MpmcQueueTest::popBatchPartial() {
+    MpmcQueue<int> a{8};
+    a.tryPush(7);
+    a.tryPush(8);
+
+    int out[5]{};
+    CORRADE_COMPARE(a.tryPop(ArrayView<int>{out}), 2);
+    CORRADE_COMPARE(out[0], 7);
+    CORRADE_COMPARE(out[1], 8);
+    CORRADE_COMPARE(out[2], 0);
+    CORRADE_COMPARE(a.tryPop(ArrayView<int>{out}), 0);
+}
+
+namespace {
+    struct Counted {
+        static int constructed, destructed;
+
+        explicit Counted(int = 0) { ++constructed; }
+        Counted(const Counted&) { ++constructed; }
+        Counted& operator=(const Counted&) = default;
+        ~Counted() { ++destructed; }
+    };
+
+    int Counted::constructed = 0;
+    int Counted::destructed = 0;
+}
+
+void MpmcQueueTest::destructRemaining() {
+    Counted::constructed = Counted::destructed = 0;
+    {
+        MpmcQueue<Counted> a{8};
+        a.tryEmplace(1);
+        a.tryEmplace(2);
+        a.tryEmplace(3);
+        Counted out;
+        a.tryPop(out);
+        CORRADE_COMPARE(Counted::constructed, 4);
+        CORRADE_COMPARE(Counted::destructed, 1);
+    }
+    CORRADE_COMPARE(Counted::destructed, 4);
+}
+
+void MpmcQueueTest::threaded() {
+    enum: std::size_t { Count = 100000 };
+    MpmcQueue<std::size_t> a{64};
+
+    std::thread producer{[&a]() {
+        for(std::size_t i = 0; i != Count; ++i)
+            while(!a.tryPush(i)) std::this_thread::yield();
+    }};
+
+    /* Items have to arrive in order */
+    std::size_t expected = 0;
+    bool inOrder = true;
+    while(expected != Count) {
+        std::size_t out;
+        if(!a.tryPop(out)) {
+            std::this_thread::yield();
+            continue;
+        }
+        if(out != expected) inOrder = false;
+        ++expected;
+    }
+
+    producer.join();
+    CORRADE_VERIFY(inOrder);
+    CORRADE_VERIFY(a.empty());
+}
+
+void MpmcQueueTest::threadedBatch() {
+    enum: std::size_t { Count = 100000, BatchSize = 13 };
+    MpmcQueue<std::size_t> a{64};
+
+    std::thread producer{[&a]() {
+        std::size_t data[BatchSize];
+        for(std::size_t i = 0; i < Count; ) {
+            const std::size_t size = Count - i < BatchSize ? Count - i : BatchSize;
+            for(std::size_t j = 0; j != size; ++j) data[j] = i + j;
+            const std::size_t pushed = a.tryPush(ArrayView<const std::size_t>{data, size});
+            if(!pushed) std::this_thread::yield();
+            i += pushed;
+        }
+    }};
+
+    std::size_t expected = 0;
+    bool inOrder = true;
+    std::size_t data[BatchSize*2];
+    while(expected != Count) {
+        const std::size_t count = a.tryPop(ArrayView<std::size_t>{data});
+        if(!count) std::this_thread::yield();
+        for(std::size_t i = 0; i != count; ++i)
+            if(data[i] != expected++) inOrder = false;
+    }
+
+    producer.join();
+    CORRADE_VERIFY(inOrder);
+}
+
+namespace {
+    enum: std::size_t {
+        ThreadCount = 4,
+        ItemsPerThread = 50000 /* has to fit into 16 bits */
+    };
+
+    /* Upper bits identify the producer, lower bits are a counter */
+    constexpr std::size_t item(std::size_t producer, std::size_t i) {
+        return producer << 16 | i;
+    }
+
+    /* Each consumer has to see items from a single producer in the order
+       they were pushed, all items have to be received exactly once */
+    template<class Pop> void consume(std::atomic<std::size_t>& received, std::atomic<std::size_t>& sum, std::atomic<bool>& inOrder, Pop pop) {
+        std::size_t last[ThreadCount];
+        for(std::size_t& i: last) i = ~std::size_t{};
+        std::size_t localSum = 0;
+
+        while(received.load() != ThreadCount*ItemsPerThread) {
+            std::size_t data[7];
+            const std::size_t count = pop(ArrayView<std::size_t>{data});
+            if(!count) std::this_thread::yield();
+            for(std::size_t i = 0; i != count; ++i) {
+                const std::size_t producer = data[i] >> 16;
+                const std::size_t counter = data[i] & 0xffff;
+                if(last[producer] != ~std::size_t{} && last[producer] >= counter)
+                    inOrder = false;
+                last[producer] = counter;
+                localSum += counter;
+            }
+            received += count;
+        }
+
+        sum += localSum;
+    }
+}
+
+void MpmcQueueTest::threadedMultiple() {
+    MpmcQueue<std::size_t> a{64};
+    std::atomic<std::size_t> received{0}, sum{0};
+    std::atomic<bool> inOrder{true};
+
+    std::vector<std::thread> threads;
+    for(std::size_t t = 0; t != ThreadCount; ++t) threads.emplace_back([&a, t]() {
+        for(std::size_t i = 0; i != ItemsPerThread; ++i)
+            while(!a.tryPush(item(t, i))) std::this_thread::yield();
+    });
+    for(std::size_t t = 0; t != ThreadCount; ++t) threads.emplace_back([&]() {
+        consume(received, sum, inOrder, [&a](ArrayView<std::size_t> out) -> std::size_t {
+            return a.tryPop(out[0]) ? 1 : 0;
+        });
+    });
+    for(std::thread& thread: threads) thread.join();
+
+    CORRADE_VERIFY(inOrder);
+    CORRADE_COMPARE(received.load(), ThreadCount*ItemsPerThread);
+    CORRADE_COMPARE(sum.load(), ThreadCount*ItemsPerThread*(ItemsPerThread - 1)/2);
+    CORRADE_VERIFY(a.empty());
+}
+
+void MpmcQueueTest::threadedMultipleBatch() {
+    MpmcQueue<std::size_t> a{64};
+    std::atomic<std::size_t> received{0}, sum{0};
+    std::atomic<bool> inOrder{true};
+
+    std::vector<std::thread> threads;
+    for(std::size_t t = 0; t != ThreadCount; ++t) threads.emplace_back([&a, t]() {
+        std::size_t data[5];
+        for(std::size_t i = 0; i < ItemsPerThread; ) {
+            const std::size_t size = ItemsPerThread - i < 5 ? ItemsPerThread - i : 5;
+            for(std::size_t j = 0; j != size; ++j) data[j] = item(t, i + j);
+            const std::size_t pushed = a.tryPush(ArrayView<const std::size_t>{data, size});
+            if(!pushed) std::this_thread::yield();
+            i += pushed;
+        }
+    });
+    for(std::size_t t = 0; t != ThreadCount; ++t) threads.emplace_back([&]() {
+        consume(received, sum, inOrder, [&a](ArrayView<std::size_t> out) {
+            return a.tryPop(out);
+        });
+    });
+    for(std::thread& thread: threads) thread.join();
+
+    CORRADE_VERIFY(inOrder);
+    CORRADE_COMPARE(received.load(), ThreadCount*ItemsPerThread);
+    CORRADE_COMPARE(sum.load(), ThreadCount*ItemsPerThread*(ItemsPerThread - 1)/2);
+    CORRADE_VERIFY(a.empty());
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Corrade::Containers::Test::MpmcQueueTest)
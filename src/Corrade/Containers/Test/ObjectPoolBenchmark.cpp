@@ -0,0 +1,215 @@
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <memory>
+#include <vector>
+
+#include "Corrade/Containers/LinkedList.h"
+#include "Corrade/Containers/ObjectPool.h"
+#include "Corrade/TestSuite/Tester.h"
+
+namespace Corrade { namespace Containers { namespace Test {
+
+struct ObjectPoolBenchmark: TestSuite::Tester {
+    explicit ObjectPoolBenchmark();
+
+    void insertEraseNew();
+    void insertErasePool();
+
+    void traverseNew();
+    void traversePool();
+    void traverseNewChurned();
+    void traversePoolChurned();
+    void traversePoolChurnedSorted();
+};
+
+enum: std::size_t { Size = 100000 };
+
+ObjectPoolBenchmark::ObjectPoolBenchmark() {
+    addBenchmarks({&ObjectPoolBenchmark::insertEraseNew,
+                   &ObjectPoolBenchmark::insertErasePool,
+
+                   &ObjectPoolBenchmark::traverseNew,
+                   &ObjectPoolBenchmark::traversePool,
+                   &ObjectPoolBenchmark::traverseNewChurned,
+                   &ObjectPoolBenchmark::traversePoolChurned,
+                   &ObjectPoolBenchmark::traversePoolChurnedSorted}, 10);
+}
+
+namespace {
+
+struct NewNode: LinkedListItem<NewNode> {
+    explicit NewNode(std::size_t value): value{value} {}
+
+    std::size_t value;
+    char payload[48];
+};
+
+struct PoolNode: LinkedListItem<PoolNode>, PooledObject<PoolNode> {
+    explicit PoolNode(std::size_t value): value{value} {}
+
+    std::size_t value;
+    char payload[48];
+};
+
+/* Unrelated allocations done in between the nodes, simulating a real
+   application where the heap is shared with other code */
+typedef std::vector<std::unique_ptr<char[]>> Noise;
+
+template<class T> void populate(LinkedList<T>& list, Noise& noise) {
+    for(std::size_t i = 0; i != Size; ++i) {
+        list.insert(new T{i});
+        noise.emplace_back(new char[16 + (i*7) % 64]);
+    }
+}
+
+/* Erases roughly half of the items in a pseudo-random pattern and appends the
+   same count of new ones at the end */
+template<class T> void churn(LinkedList<T>& list, Noise& noise, bool sortFreeList) {
+    std::size_t erased = 0;
+    std::size_t i = 0;
+    for(T* item = list.first(); item; ++i) {
+        T* const next = item->next();
+        if((i*2654435761u) & 0x100) {
+            list.erase(item);
+            noise.emplace_back(new char[16 + (i*7) % 64]);
+            ++erased;
+        }
+        item = next;
+    }
+
+    if(sortFreeList) PooledObject<PoolNode>::pool().sortFreeList();
+
+    for(std::size_t j = 0; j != erased; ++j)
+        list.insert(new T{Size + j});
+}
+
+template<class T> std::size_t traverse(const LinkedList<T>& list) {
+    std::size_t sum = 0;
+    for(const T& item: list) sum += item.value;
+    return sum;
+}
+
+}
+
+void ObjectPoolBenchmark::insertEraseNew() {
+    LinkedList<NewNode> list;
+    CORRADE_BENCHMARK(1) {
+        for(std::size_t i = 0; i != Size; ++i) list.insert(new NewNode{i});
+        list.clear();
+    }
+
+    CORRADE_VERIFY(list.isEmpty());
+}
+
+void ObjectPoolBenchmark::insertErasePool() {
+    LinkedList<PoolNode> list;
+    CORRADE_BENCHMARK(1) {
+        for(std::size_t i = 0; i != Size; ++i) list.insert(new PoolNode{i});
+        list.clear();
+    }
+
+    CORRADE_VERIFY(list.isEmpty());
+    CORRADE_COMPARE(PooledObject<PoolNode>::pool().size(), 0);
+}
+
+void ObjectPoolBenchmark::traverseNew() {
+    Noise noise;
+    LinkedList<NewNode> list;
+    populate(list, noise);
+
+    std::size_t sum = 0;
+    CORRADE_BENCHMARK(1)
+        sum += traverse(list);
+
+    CORRADE_COMPARE(sum, Size*(Size - 1)/2);
+}
+
+void ObjectPoolBenchmark::traversePool() {
+    /* Clearing lists in previous benchmarks left the free list in reverse
+       memory order */
+    PooledObject<PoolNode>::pool().sortFreeList();
+
+    Noise noise;
+    LinkedList<PoolNode> list;
+    populate(list, noise);
+
+    std::size_t sum = 0;
+    CORRADE_BENCHMARK(1)
+        sum += traverse(list);
+
+    CORRADE_COMPARE(sum, Size*(Size - 1)/2);
+}
+
+void ObjectPoolBenchmark::traverseNewChurned() {
+    Noise noise;
+    LinkedList<NewNode> list;
+    populate(list, noise);
+    churn(list, noise, false);
+
+    std::size_t sum = 0;
+    CORRADE_BENCHMARK(1)
+        sum += traverse(list);
+
+    CORRADE_VERIFY(sum);
+}
+
+void ObjectPoolBenchmark::traversePoolChurned() {
+    /* Clearing lists in previous benchmarks left the free list in reverse
+       memory order */
+    PooledObject<PoolNode>::pool().sortFreeList();
+
+    Noise noise;
+    LinkedList<PoolNode> list;
+    populate(list, noise);
+    churn(list, noise, false);
+
+    std::size_t sum = 0;
+    CORRADE_BENCHMARK(1)
+        sum += traverse(list);
+
+    CORRADE_VERIFY(sum);
+}
+
+void ObjectPoolBenchmark::traversePoolChurnedSorted() {
+    /* Clearing lists in previous benchmarks left the free list in reverse
+       memory order */
+    PooledObject<PoolNode>::pool().sortFreeList();
+
+    Noise noise;
+    LinkedList<PoolNode> list;
+    populate(list, noise);
+    churn(list, noise, true);
+
+    std::size_t sum = 0;
+    CORRADE_BENCHMARK(1)
+        sum += traverse(list);
+
+    CORRADE_VERIFY(sum);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Corrade::Containers::Test::ObjectPoolBenchmark)
@@ -0,0 +1,327 @@
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+
+#include "Corrade/Containers/LinkedList.h"
+#include "Corrade/Containers/ObjectPool.h"
+#include "Corrade/TestSuite/Tester.h"
+#include "Corrade/Utility/Debug.h"
+
+namespace Corrade { namespace Containers { namespace Test {
+
+struct ObjectPoolTest: TestSuite::Tester {
+    explicit ObjectPoolTest();
+
+    void construct();
+    void constructZeroSlabSize();
+    void constructMove();
+
+    void create();
+    void createNonTrivial();
+    void destroyNull();
+    void reuseFreed();
+    void allocateSlabs();
+    void owns();
+    void sortFreeList();
+
+    void pooledObject();
+    void pooledObjectDerived();
+    void pooledObjectLinkedList();
+};
+
+ObjectPoolTest::ObjectPoolTest() {
+    addTests({&ObjectPoolTest::construct,
+              &ObjectPoolTest::constructZeroSlabSize,
+              &ObjectPoolTest::constructMove,
+
+              &ObjectPoolTest::create,
+              &ObjectPoolTest::createNonTrivial,
+              &ObjectPoolTest::destroyNull,
+              &ObjectPoolTest::reuseFreed,
+              &ObjectPoolTest::allocateSlabs,
+              &ObjectPoolTest::owns,
+              &ObjectPoolTest::sortFreeList,
+
+              &ObjectPoolTest::pooledObject,
+              &ObjectPoolTest::pooledObjectDerived,
+              &ObjectPoolTest::pooledObjectLinkedList});
+}
+
+namespace {
+
+struct Counted {
+    static int constructed;
+    static int destructed;
+
+    explicit Counted(int value): value{value} { ++constructed; }
+    ~Counted() { ++destructed; }
+
+    int value;
+};
+
+int Counted::constructed = 0;
+int Counted::destructed = 0;
+
+struct Pooled: PooledObject<Pooled> {
+    explicit Pooled(int value): value{value} {}
+
+    int value;
+};
+
+struct PooledDerived: Pooled {
+    explicit PooledDerived(int value): Pooled{value}, other{value*2} {}
+
+    int other;
+};
+
+struct Item: LinkedListItem<Item>, PooledObject<Item> {
+    explicit Item(int value): value{value} {}
+
+    int value;
+};
+
+}
+
+void ObjectPoolTest::construct() {
+    ObjectPool<int> pool{16};
+    CORRADE_COMPARE(pool.slabSize(), 16);
+    CORRADE_COMPARE(pool.slabCount(), 0);
+    CORRADE_COMPARE(pool.size(), 0);
+    CORRADE_COMPARE(pool.capacity(), 0);
+}
+
+void ObjectPoolTest::constructZeroSlabSize() {
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    ObjectPool<int> pool{0};
+    CORRADE_COMPARE(out.str(), "Containers::ObjectPool: slab size can't be zero\n");
+}
+
+void ObjectPoolTest::constructMove() {
+    ObjectPool<int> a{4};
+    int* value = a.create(3);
+
+    ObjectPool<int> b{std::move(a)};
+    CORRADE_COMPARE(a.slabCount(), 0);
+    CORRADE_COMPARE(a.size(), 0);
+    CORRADE_COMPARE(b.slabCount(), 1);
+    CORRADE_COMPARE(b.size(), 1);
+    CORRADE_VERIFY(b.owns(value));
+    CORRADE_COMPARE(*value, 3);
+
+    ObjectPool<int> c{8};
+    c = std::move(b);
+    CORRADE_COMPARE(c.slabSize(), 4);
+    CORRADE_COMPARE(c.size(), 1);
+    CORRADE_COMPARE(b.slabSize(), 8);
+    CORRADE_COMPARE(b.size(), 0);
+
+    c.destroy(value);
+    CORRADE_COMPARE(c.size(), 0);
+}
+
+void ObjectPoolTest::create() {
+    ObjectPool<int> pool{4};
+    int* a = pool.create(1);
+    int* b = pool.create(2);
+    int* c = pool.create();
+    CORRADE_COMPARE(*a, 1);
+    CORRADE_COMPARE(*b, 2);
+    CORRADE_COMPARE(*c, 0);
+    CORRADE_COMPARE(pool.size(), 3);
+    CORRADE_COMPARE(pool.slabCount(), 1);
+    CORRADE_COMPARE(pool.capacity(), 4);
+
+    /* Fresh slots are handed out sequentially */
+    CORRADE_VERIFY(b > a);
+    CORRADE_VERIFY(c > b);
+
+    pool.destroy(a);
+    pool.destroy(b);
+    pool.destroy(c);
+    CORRADE_COMPARE(pool.size(), 0);
+    CORRADE_COMPARE(pool.capacity(), 4);
+}
+
+void ObjectPoolTest::createNonTrivial() {
+    Counted::constructed = Counted::destructed = 0;
+    {
+        ObjectPool<Counted> pool;
+        Counted* a = pool.create(5);
+        CORRADE_COMPARE(a->value, 5);
+        CORRADE_COMPARE(Counted::constructed, 1);
+        CORRADE_COMPARE(Counted::destructed, 0);
+
+        pool.destroy(a);
+        CORRADE_COMPARE(Counted::destructed, 1);
+
+        /* This one is not destroyed by the pool destructor */
+        pool.create(6);
+    }
+    CORRADE_COMPARE(Counted::constructed, 2);
+    CORRADE_COMPARE(Counted::destructed, 1);
+}
+
+void ObjectPoolTest::destroyNull() {
+    ObjectPool<int> pool;
+    pool.destroy(nullptr);
+    pool.deallocate(nullptr);
+    CORRADE_COMPARE(pool.size(), 0);
+    CORRADE_COMPARE(pool.slabCount(), 0);
+}
+
+void ObjectPoolTest::reuseFreed() {
+    ObjectPool<int> pool{4};
+    int* a = pool.create(1);
+    int* b = pool.create(2);
+    pool.destroy(a);
+    pool.destroy(b);
+
+    /* Most recently freed slot is reused first */
+    CORRADE_COMPARE(pool.create(3), b);
+    CORRADE_COMPARE(pool.create(4), a);
+    CORRADE_COMPARE(*a, 4);
+    CORRADE_COMPARE(*b, 3);
+    CORRADE_COMPARE(pool.size(), 2);
+    CORRADE_COMPARE(pool.slabCount(), 1);
+}
+
+void ObjectPoolTest::allocateSlabs() {
+    ObjectPool<int> pool{3};
+    int* values[7];
+    for(int i = 0; i != 7; ++i) values[i] = pool.create(i);
+    CORRADE_COMPARE(pool.size(), 7);
+    CORRADE_COMPARE(pool.slabCount(), 3);
+    CORRADE_COMPARE(pool.capacity(), 9);
+
+    for(int i = 0; i != 7; ++i)
+        CORRADE_COMPARE(*values[i], i);
+
+    /* Freeing slots doesn't free slabs, new objects reuse them */
+    for(int i = 0; i != 7; ++i) pool.destroy(values[i]);
+    for(int i = 0; i != 9; ++i) pool.create(i);
+    CORRADE_COMPARE(pool.size(), 9);
+    CORRADE_COMPARE(pool.slabCount(), 3);
+}
+
+void ObjectPoolTest::owns() {
+    ObjectPool<int> pool{2};
+    int* a = pool.create();
+    int* b = pool.create();
+    int* c = pool.create();
+    int d;
+    CORRADE_VERIFY(pool.owns(a));
+    CORRADE_VERIFY(pool.owns(b));
+    CORRADE_VERIFY(pool.owns(c));
+    CORRADE_VERIFY(!pool.owns(&d));
+
+    /* Freed memory is still owned */
+    pool.destroy(b);
+    CORRADE_VERIFY(pool.owns(b));
+}
+
+void ObjectPoolTest::sortFreeList() {
+    ObjectPool<int> pool{8};
+    int* values[8];
+    for(int i = 0; i != 8; ++i) values[i] = pool.create(i);
+
+    /* Free in shuffled order */
+    for(int i: {5, 1, 7, 3, 0, 6})
+        pool.destroy(values[i]);
+
+    /* Without sorting, the last freed gets reused first */
+    int* a = pool.create();
+    CORRADE_COMPARE(a, values[6]);
+    pool.destroy(a);
+
+    /* After sorting, the lowest address gets reused first */
+    pool.sortFreeList();
+    CORRADE_COMPARE(pool.size(), 2);
+    for(int i: {0, 1, 3, 5, 6, 7})
+        CORRADE_COMPARE(pool.create(), values[i]);
+    CORRADE_COMPARE(pool.size(), 8);
+    CORRADE_COMPARE(pool.slabCount(), 1);
+}
+
+void ObjectPoolTest::pooledObject() {
+    ObjectPool<Pooled>& pool = PooledObject<Pooled>::pool();
+    const std::size_t size = pool.size();
+
+    Pooled* a = new Pooled{3};
+    CORRADE_COMPARE(a->value, 3);
+    CORRADE_COMPARE(pool.size(), size + 1);
+    CORRADE_VERIFY(pool.owns(a));
+
+    delete a;
+    CORRADE_COMPARE(pool.size(), size);
+}
+
+void ObjectPoolTest::pooledObjectDerived() {
+    ObjectPool<Pooled>& pool = PooledObject<Pooled>::pool();
+    const std::size_t size = pool.size();
+
+    /* Type of a different size goes through the global allocator */
+    PooledDerived* a = new PooledDerived{3};
+    CORRADE_COMPARE(a->other, 6);
+    CORRADE_COMPARE(pool.size(), size);
+    CORRADE_VERIFY(!pool.owns(a));
+
+    delete a;
+    CORRADE_COMPARE(pool.size(), size);
+}
+
+void ObjectPoolTest::pooledObjectLinkedList() {
+    ObjectPool<Item>& pool = PooledObject<Item>::pool();
+    const std::size_t size = pool.size();
+
+    {
+        LinkedList<Item> list;
+        for(int i = 0; i != 5; ++i) list.insert(new Item{i});
+        CORRADE_COMPARE(pool.size(), size + 5);
+
+        /* Erasing returns the item to the pool */
+        Item* second = list.first()->next();
+        list.erase(second);
+        CORRADE_COMPARE(pool.size(), size + 4);
+
+        /* The freed slot gets reused */
+        Item* inserted = new Item{10};
+        CORRADE_COMPARE(inserted, second);
+        list.insert(inserted);
+
+        int sum = 0;
+        for(Item& item: list) sum += item.value;
+        CORRADE_COMPARE(sum, 0 + 2 + 3 + 4 + 10);
+    }
+
+    /* Clearing the list returns everything */
+    CORRADE_COMPARE(pool.size(), size);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Corrade::Containers::Test::ObjectPoolTest)
@@ -0,0 +1,116 @@
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Corrade/Containers/PackedIntArray.h"
+#include "Corrade/TestSuite/Tester.h"
+
+namespace Corrade { namespace Containers { namespace Test {
+
+struct PackedIntArrayBenchmark: TestSuite::Tester {
+    explicit PackedIntArrayBenchmark();
+
+    void readArray();
+    void readPackedIndexed();
+    void readPackedUnpack();
+};
+
+namespace {
+
+enum: std::size_t {
+    Size = 1 << 20,
+    ChunkSize = 1024
+};
+
+constexpr unsigned Bits[]{1, 4, 8, 12, 16, 24, 32};
+
+std::uint32_t value(std::size_t i, unsigned bits) {
+    return std::uint32_t(std::uint64_t(i)*2654435761u) & std::uint32_t((std::uint64_t{1} << bits) - 1);
+}
+
+std::uint64_t expectedSum(unsigned bits) {
+    std::uint64_t sum = 0;
+    for(std::size_t i = 0; i != Size; ++i) sum += value(i, bits);
+    return sum;
+}
+
+}
+
+PackedIntArrayBenchmark::PackedIntArrayBenchmark() {
+    addInstancedBenchmarks({&PackedIntArrayBenchmark::readArray,
+                            &PackedIntArrayBenchmark::readPackedIndexed,
+                            &PackedIntArrayBenchmark::readPackedUnpack}, 10,
+        Containers::arraySize(Bits));
+}
+
+void PackedIntArrayBenchmark::readArray() {
+    const unsigned bits = Bits[testCaseInstanceId()];
+    setTestCaseDescription(std::to_string(bits) + " bits");
+
+    Array<std::uint32_t> a{NoInit, Size};
+    for(std::size_t i = 0; i != Size; ++i) a[i] = value(i, bits);
+
+    std::uint64_t sum = 0;
+    CORRADE_BENCHMARK(1)
+        for(std::uint32_t i: a) sum += i;
+
+    CORRADE_COMPARE(sum, expectedSum(bits));
+}
+
+void PackedIntArrayBenchmark::readPackedIndexed() {
+    const unsigned bits = Bits[testCaseInstanceId()];
+    setTestCaseDescription(std::to_string(bits) + " bits");
+
+    PackedIntArray a{NoInit, Size, bits};
+    for(std::size_t i = 0; i != Size; ++i) a.set(i, value(i, bits));
+
+    std::uint64_t sum = 0;
+    CORRADE_BENCHMARK(1)
+        for(std::size_t i = 0; i != Size; ++i) sum += a[i];
+
+    CORRADE_COMPARE(sum, expectedSum(bits));
+}
+
+void PackedIntArrayBenchmark::readPackedUnpack() {
+    const unsigned bits = Bits[testCaseInstanceId()];
+    setTestCaseDescription(std::to_string(bits) + " bits");
+
+    PackedIntArray a{NoInit, Size, bits};
+    for(std::size_t i = 0; i != Size; ++i) a.set(i, value(i, bits));
+
+    std::uint64_t sum = 0;
+    std::uint32_t chunk[ChunkSize];
+    CORRADE_BENCHMARK(1) {
+        for(std::size_t offset = 0; offset != Size; offset += ChunkSize) {
+            a.unpack(offset, chunk);
+            for(std::uint32_t i: chunk) sum += i;
+        }
+    }
+
+    CORRADE_COMPARE(sum, expectedSum(bits));
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Corrade::Containers::Test::PackedIntArrayBenchmark)
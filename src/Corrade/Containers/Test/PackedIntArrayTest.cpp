@@ -0,0 +1,243 @@
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+
+#include "Corrade/Containers/PackedIntArray.h"
+#include "Corrade/TestSuite/Tester.h"
+#include "Corrade/TestSuite/Compare/Container.h"
+#include "Corrade/Utility/Debug.h"
+
+namespace Corrade { namespace Containers { namespace Test {
+
+struct PackedIntArrayTest: TestSuite::Tester {
+    explicit PackedIntArrayTest();
+
+    void constructDefault();
+    void constructValueInit();
+    void constructNoInit();
+    void constructValues();
+    void constructInvalidBits();
+    void constructMove();
+
+    void access();
+    void setDoesntAffectNeighbors();
+    void setTooLarge();
+
+    void unpack();
+    void unpackOutOfRange();
+    void packOutOfRange();
+};
+
+namespace {
+
+/* Pseudo-random values covering the whole bit range */
+std::uint32_t value(std::size_t i, unsigned bits) {
+    return std::uint32_t((std::uint64_t(i)*2654435761u) >> 7) & std::uint32_t((std::uint64_t{1} << bits) - 1);
+}
+
+}
+
+PackedIntArrayTest::PackedIntArrayTest() {
+    addTests({&PackedIntArrayTest::constructDefault,
+              &PackedIntArrayTest::constructValueInit,
+              &PackedIntArrayTest::constructNoInit,
+              &PackedIntArrayTest::constructValues,
+              &PackedIntArrayTest::constructInvalidBits,
+              &PackedIntArrayTest::constructMove,
+
+              &PackedIntArrayTest::access,
+              &PackedIntArrayTest::setDoesntAffectNeighbors,
+              &PackedIntArrayTest::setTooLarge,
+
+              &PackedIntArrayTest::unpack,
+              &PackedIntArrayTest::unpackOutOfRange,
+              &PackedIntArrayTest::packOutOfRange});
+}
+
+void PackedIntArrayTest::constructDefault() {
+    PackedIntArray a;
+    PackedIntArray b = nullptr;
+    CORRADE_VERIFY(!a.data());
+    CORRADE_VERIFY(!b.data());
+    CORRADE_COMPARE(a.size(), 0);
+    CORRADE_COMPARE(a.bits(), 0);
+    CORRADE_VERIFY(a.empty());
+}
+
+void PackedIntArrayTest::constructValueInit() {
+    PackedIntArray a{ValueInit, 100, 12};
+    PackedIntArray b{100, 12};
+    CORRADE_VERIFY(a.data());
+    CORRADE_VERIFY(!a.empty());
+    CORRADE_COMPARE(a.size(), 100);
+    CORRADE_COMPARE(b.size(), 100);
+    CORRADE_COMPARE(a.bits(), 12);
+    CORRADE_COMPARE(b.bits(), 12);
+    CORRADE_COMPARE(a.maxValue(), 4095);
+    for(std::size_t i = 0; i != 100; ++i) {
+        CORRADE_COMPARE(a[i], 0);
+        CORRADE_COMPARE(b[i], 0);
+    }
+}
+
+void PackedIntArrayTest::constructNoInit() {
+    PackedIntArray a{NoInit, 100, 12};
+    CORRADE_VERIFY(a.data());
+    CORRADE_COMPARE(a.size(), 100);
+    CORRADE_COMPARE(a.bits(), 12);
+
+    /* Writing everything makes the contents well-defined */
+    for(std::size_t i = 0; i != 100; ++i) a.set(i, value(i, 12));
+    for(std::size_t i = 0; i != 100; ++i) CORRADE_COMPARE(a[i], value(i, 12));
+}
+
+void PackedIntArrayTest::constructValues() {
+    const std::uint32_t values[]{3, 0, 7, 1, 5, 6, 2, 4, 7, 7, 0};
+    PackedIntArray a{values, 3};
+    CORRADE_COMPARE(a.size(), 11);
+    CORRADE_COMPARE(a.bits(), 3);
+    for(std::size_t i = 0; i != 11; ++i) CORRADE_COMPARE(a[i], values[i]);
+
+    /* 33 bits, rounded up to 5 bytes */
+    const std::uint8_t expected[]{0xc3, 0x53, 0x8b, 0x3f, 0x00};
+    CORRADE_COMPARE_AS(arrayCast<const std::uint8_t>(ArrayView<const char>{a.data(), 5}),
+        ArrayView<const std::uint8_t>{expected},
+        TestSuite::Compare::Container);
+}
+
+void PackedIntArrayTest::constructInvalidBits() {
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    PackedIntArray a{10, 0};
+    PackedIntArray b{10, 33};
+    CORRADE_COMPARE(out.str(),
+        "Containers::PackedIntArray: expected bit width to be in range [1, 32] but got 0\n"
+        "Containers::PackedIntArray: expected bit width to be in range [1, 32] but got 33\n");
+}
+
+void PackedIntArrayTest::constructMove() {
+    PackedIntArray a{ValueInit, 50, 5};
+    a.set(49, 31);
+    const char* data = a.data();
+
+    PackedIntArray b{std::move(a)};
+    CORRADE_VERIFY(!a.data());
+    CORRADE_COMPARE(a.size(), 0);
+    CORRADE_COMPARE(a.bits(), 0);
+    CORRADE_COMPARE(b.data(), data);
+    CORRADE_COMPARE(b.size(), 50);
+    CORRADE_COMPARE(b.bits(), 5);
+    CORRADE_COMPARE(b[49], 31);
+
+    PackedIntArray c{ValueInit, 3, 1};
+    c = std::move(b);
+    CORRADE_COMPARE(c.data(), data);
+    CORRADE_COMPARE(c.size(), 50);
+    CORRADE_COMPARE(c.bits(), 5);
+    CORRADE_COMPARE(b.size(), 3);
+    CORRADE_COMPARE(b.bits(), 1);
+}
+
+void PackedIntArrayTest::access() {
+    for(unsigned bits = 1; bits <= 32; ++bits) {
+        PackedIntArray a{ValueInit, 77, bits};
+        for(std::size_t i = 0; i != 77; ++i) a.set(i, value(i, bits));
+        for(std::size_t i = 0; i != 77; ++i) CORRADE_COMPARE(a[i], value(i, bits));
+
+        /* Maximal value in the last slot */
+        a.set(76, a.maxValue());
+        CORRADE_COMPARE(a[76], a.maxValue());
+        CORRADE_COMPARE(a[75], value(75, bits));
+    }
+}
+
+void PackedIntArrayTest::setDoesntAffectNeighbors() {
+    PackedIntArray a{ValueInit, 20, 7};
+    for(std::size_t i = 0; i != 20; ++i) a.set(i, 127);
+    a.set(9, 0);
+    CORRADE_COMPARE(a[8], 127);
+    CORRADE_COMPARE(a[9], 0);
+    CORRADE_COMPARE(a[10], 127);
+
+    a.set(9, 85);
+    CORRADE_COMPARE(a[8], 127);
+    CORRADE_COMPARE(a[9], 85);
+    CORRADE_COMPARE(a[10], 127);
+}
+
+void PackedIntArrayTest::setTooLarge() {
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    PackedIntArray a{ValueInit, 10, 4};
+    a.set(3, 16);
+    CORRADE_COMPARE(a[3], 0);
+    CORRADE_COMPARE(out.str(), "Containers::PackedIntArray::set(): value 16 doesn't fit into 4 bits\n");
+}
+
+void PackedIntArrayTest::unpack() {
+    for(unsigned bits = 1; bits <= 32; ++bits) {
+        Array<std::uint32_t> values{NoInit, 203};
+        for(std::size_t i = 0; i != values.size(); ++i) values[i] = value(i, bits);
+        const PackedIntArray a{values, bits};
+
+        /* Various offsets and sizes to test the head, block and tail parts,
+           including a range ending in the last element */
+        for(std::size_t offset: {0, 1, 7, 8, 13, 100}) {
+            for(std::size_t size: {0, 1, 7, 8, 9, 16, 31, 103}) {
+                Array<std::uint32_t> out{ValueInit, size};
+                a.unpack(offset, out);
+                CORRADE_COMPARE_AS(ArrayView<std::uint32_t>{out}, values.slice(offset, offset + size),
+                    TestSuite::Compare::Container);
+            }
+        }
+    }
+}
+
+void PackedIntArrayTest::unpackOutOfRange() {
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    const PackedIntArray a{ValueInit, 10, 4};
+    std::uint32_t data[5];
+    a.unpack(6, data);
+    CORRADE_COMPARE(out.str(), "Containers::PackedIntArray::unpack(): range [6:11] out of range for 10 elements\n");
+}
+
+void PackedIntArrayTest::packOutOfRange() {
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    PackedIntArray a{ValueInit, 10, 4};
+    const std::uint32_t data[5]{};
+    a.pack(7, data);
+    CORRADE_COMPARE(out.str(), "Containers::PackedIntArray::pack(): range [7:12] out of range for 10 elements\n");
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Corrade::Containers::Test::PackedIntArrayTest)
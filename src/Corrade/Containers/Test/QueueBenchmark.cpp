@@ -0,0 +1,274 @@
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <atomic>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "Corrade/Containers/MpmcQueue.h"
+#include "Corrade/Containers/SpscQueue.h"
+#include "Corrade/TestSuite/Tester.h"
+
+namespace Corrade { namespace Containers { namespace Test {
+
+struct QueueBenchmark: TestSuite::Tester {
+    explicit QueueBenchmark();
+
+    void throughputMutexDeque();
+    void throughputSpsc();
+    void throughputSpscBatch();
+    void throughputMpmc();
+    void throughputMpmcBatch();
+
+    void latencyMutexDeque();
+    void latencySpsc();
+    void latencyMpmc();
+};
+
+namespace {
+
+enum: std::size_t {
+    ItemCount = 1 << 18,
+    Capacity = 1024,
+    BatchSize = 32,
+    RoundTripCount = 10000
+};
+
+/* Count of producer and count of consumer threads, single-producer
+   single-consumer benchmarks use only the first instance */
+constexpr std::size_t ThreadCounts[]{1, 2, 4};
+
+/* The baseline that's being replaced */
+template<class T> class MutexDeque {
+    public:
+        bool tryPush(const T& value) {
+            std::lock_guard<std::mutex> lock{_mutex};
+            if(_deque.size() == Capacity) return false;
+            _deque.push_back(value);
+            return true;
+        }
+
+        bool tryPop(T& out) {
+            std::lock_guard<std::mutex> lock{_mutex};
+            if(_deque.empty()) return false;
+            out = _deque.front();
+            _deque.pop_front();
+            return true;
+        }
+
+    private:
+        std::mutex _mutex;
+        std::deque<T> _deque;
+};
+
+/* Runs `threadCount` producers pushing ItemCount items in total and the same
+   count of consumers popping them, returns the sum of all popped items */
+template<class Push, class Pop> std::size_t run(std::size_t threadCount, Push push, Pop pop) {
+    std::atomic<std::size_t> received{0}, sum{0};
+    std::vector<std::thread> threads;
+    for(std::size_t t = 0; t != threadCount; ++t) threads.emplace_back([&, t]() {
+        const std::size_t begin = ItemCount*t/threadCount;
+        const std::size_t end = ItemCount*(t + 1)/threadCount;
+        for(std::size_t i = begin; i < end; ) {
+            const std::size_t count = push(i, end);
+            if(!count) std::this_thread::yield();
+            i += count;
+        }
+    });
+    for(std::size_t t = 0; t != threadCount; ++t) threads.emplace_back([&]() {
+        std::size_t localSum = 0;
+        std::size_t data[BatchSize];
+        while(received.load(std::memory_order_relaxed) != ItemCount) {
+            const std::size_t count = pop(ArrayView<std::size_t>{data});
+            for(std::size_t i = 0; i != count; ++i) localSum += data[i];
+            if(count) received += count;
+            else std::this_thread::yield();
+        }
+        sum += localSum;
+    });
+    for(std::thread& thread: threads) thread.join();
+    return sum;
+}
+
+}
+
+QueueBenchmark::QueueBenchmark() {
+    addInstancedBenchmarks({&QueueBenchmark::throughputMutexDeque}, 5,
+        Containers::arraySize(ThreadCounts));
+
+    addBenchmarks({&QueueBenchmark::throughputSpsc,
+                   &QueueBenchmark::throughputSpscBatch}, 5);
+
+    addInstancedBenchmarks({&QueueBenchmark::throughputMpmc,
+                            &QueueBenchmark::throughputMpmcBatch}, 5,
+        Containers::arraySize(ThreadCounts));
+
+    addBenchmarks({&QueueBenchmark::latencyMutexDeque,
+                   &QueueBenchmark::latencySpsc,
+                   &QueueBenchmark::latencyMpmc}, 5);
+}
+
+void QueueBenchmark::throughputMutexDeque() {
+    const std::size_t threadCount = ThreadCounts[testCaseInstanceId()];
+    setTestCaseDescription(std::to_string(threadCount) + " to " + std::to_string(threadCount));
+
+    MutexDeque<std::size_t> queue;
+    std::size_t sum{};
+    CORRADE_BENCHMARK(1) sum = run(threadCount,
+        [&queue](std::size_t i, std::size_t) -> std::size_t {
+            return queue.tryPush(i) ? 1 : 0;
+        },
+        [&queue](ArrayView<std::size_t> out) -> std::size_t {
+            return queue.tryPop(out[0]) ? 1 : 0;
+        });
+
+    CORRADE_COMPARE(sum, std::size_t(ItemCount)*(ItemCount - 1)/2);
+}
+
+void QueueBenchmark::throughputSpsc() {
+    SpscQueue<std::size_t> queue{Capacity};
+    std::size_t sum{};
+    CORRADE_BENCHMARK(1) sum = run(1,
+        [&queue](std::size_t i, std::size_t) -> std::size_t {
+            return queue.tryPush(i) ? 1 : 0;
+        },
+        [&queue](ArrayView<std::size_t> out) -> std::size_t {
+            return queue.tryPop(out[0]) ? 1 : 0;
+        });
+
+    CORRADE_COMPARE(sum, std::size_t(ItemCount)*(ItemCount - 1)/2);
+}
+
+void QueueBenchmark::throughputSpscBatch() {
+    SpscQueue<std::size_t> queue{Capacity};
+    std::size_t sum{};
+    CORRADE_BENCHMARK(1) sum = run(1,
+        [&queue](std::size_t i, std::size_t end) {
+            std::size_t data[BatchSize];
+            const std::size_t count = end - i < BatchSize ? end - i : BatchSize;
+            for(std::size_t j = 0; j != count; ++j) data[j] = i + j;
+            return queue.tryPush(ArrayView<const std::size_t>{data, count});
+        },
+        [&queue](ArrayView<std::size_t> out) {
+            return queue.tryPop(out);
+        });
+
+    CORRADE_COMPARE(sum, std::size_t(ItemCount)*(ItemCount - 1)/2);
+}
+
+void QueueBenchmark::throughputMpmc() {
+    const std::size_t threadCount = ThreadCounts[testCaseInstanceId()];
+    setTestCaseDescription(std::to_string(threadCount) + " to " + std::to_string(threadCount));
+
+    MpmcQueue<std::size_t> queue{Capacity};
+    std::size_t sum{};
+    CORRADE_BENCHMARK(1) sum = run(threadCount,
+        [&queue](std::size_t i, std::size_t) -> std::size_t {
+            return queue.tryPush(i) ? 1 : 0;
+        },
+        [&queue](ArrayView<std::size_t> out) -> std::size_t {
+            return queue.tryPop(out[0]) ? 1 : 0;
+        });
+
+    CORRADE_COMPARE(sum, std::size_t(ItemCount)*(ItemCount - 1)/2);
+}
+
+void QueueBenchmark::throughputMpmcBatch() {
+    const std::size_t threadCount = ThreadCounts[testCaseInstanceId()];
+    setTestCaseDescription(std::to_string(threadCount) + " to " + std::to_string(threadCount));
+
+    MpmcQueue<std::size_t> queue{Capacity};
+    std::size_t sum{};
+    CORRADE_BENCHMARK(1) sum = run(threadCount,
+        [&queue](std::size_t i, std::size_t end) {
+            std::size_t data[BatchSize];
+            const std::size_t count = end - i < BatchSize ? end - i : BatchSize;
+            for(std::size_t j = 0; j != count; ++j) data[j] = i + j;
+            return queue.tryPush(ArrayView<const std::size_t>{data, count});
+        },
+        [&queue](ArrayView<std::size_t> out) {
+            return queue.tryPop(out);
+        });
+
+    CORRADE_COMPARE(sum, std::size_t(ItemCount)*(ItemCount - 1)/2);
+}
+
+namespace {
+
+/* Sends a value to the other thread and waits until it's sent back,
+   measuring the round-trip latency. Waiting yields so the benchmark doesn't
+   take ages when there's fewer cores than threads. */
+template<class Queue> std::size_t pingPong(Queue& ping, Queue& pong) {
+    std::thread other{[&ping, &pong]() {
+        for(std::size_t i = 0; i != RoundTripCount; ++i) {
+            std::size_t value;
+            while(!ping.tryPop(value)) std::this_thread::yield();
+            while(!pong.tryPush(value + 1)) std::this_thread::yield();
+        }
+    }};
+
+    std::size_t sum = 0;
+    for(std::size_t i = 0; i != RoundTripCount; ++i) {
+        while(!ping.tryPush(i)) std::this_thread::yield();
+        std::size_t value;
+        while(!pong.tryPop(value)) std::this_thread::yield();
+        sum += value;
+    }
+
+    other.join();
+    return sum;
+}
+
+}
+
+void QueueBenchmark::latencyMutexDeque() {
+    MutexDeque<std::size_t> ping, pong;
+    std::size_t sum{};
+    CORRADE_BENCHMARK(1) sum = pingPong(ping, pong);
+
+    CORRADE_COMPARE(sum, std::size_t(RoundTripCount)*(RoundTripCount + 1)/2);
+}
+
+void QueueBenchmark::latencySpsc() {
+    SpscQueue<std::size_t> ping{Capacity}, pong{Capacity};
+    std::size_t sum{};
+    CORRADE_BENCHMARK(1) sum = pingPong(ping, pong);
+
+    CORRADE_COMPARE(sum, std::size_t(RoundTripCount)*(RoundTripCount + 1)/2);
+}
+
+void QueueBenchmark::latencyMpmc() {
+    MpmcQueue<std::size_t> ping{Capacity}, pong{Capacity};
+    std::size_t sum{};
+    CORRADE_BENCHMARK(1) sum = pingPong(ping, pong);
+
+    CORRADE_COMPARE(sum, std::size_t(RoundTripCount)*(RoundTripCount + 1)/2);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Corrade::Containers::Test::QueueBenchmark)
@@ -0,0 +1,100 @@
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Corrade/Containers/Array.h"
+#include "Corrade/Containers/GrowableArray.h"
+#include "Corrade/Containers/SmallArray.h"
+#include "Corrade/TestSuite/Tester.h"
+
+namespace Corrade { namespace Containers { namespace Test {
+
+struct SmallArrayBenchmark: TestSuite::Tester {
+    explicit SmallArrayBenchmark();
+
+    void constructArray();
+    void constructSmallArray();
+    void appendArray();
+    void appendSmallArray();
+};
+
+enum: std::size_t {
+    Count = 1000,
+    ItemCount = 12
+};
+
+SmallArrayBenchmark::SmallArrayBenchmark() {
+    addBenchmarks({&SmallArrayBenchmark::constructArray,
+                   &SmallArrayBenchmark::constructSmallArray,
+                   &SmallArrayBenchmark::appendArray,
+                   &SmallArrayBenchmark::appendSmallArray}, 10);
+}
+
+void SmallArrayBenchmark::constructArray() {
+    int sum = 0;
+    CORRADE_BENCHMARK(Count) {
+        Array<int> a{Containers::ValueInit, ItemCount};
+        a[ItemCount - 1] = 1;
+        sum += a[ItemCount - 1];
+    }
+
+    CORRADE_COMPARE(sum, int(Count));
+}
+
+void SmallArrayBenchmark::constructSmallArray() {
+    int sum = 0;
+    CORRADE_BENCHMARK(Count) {
+        SmallArray<16, int> a{Containers::ValueInit, ItemCount};
+        a[ItemCount - 1] = 1;
+        sum += a[ItemCount - 1];
+    }
+
+    CORRADE_COMPARE(sum, int(Count));
+}
+
+void SmallArrayBenchmark::appendArray() {
+    std::size_t size = 0;
+    CORRADE_BENCHMARK(Count) {
+        Array<int> a;
+        for(std::size_t i = 0; i != ItemCount; ++i) arrayAppend(a, int(i));
+        size += a.size();
+    }
+
+    CORRADE_COMPARE(size, Count*ItemCount);
+}
+
+void SmallArrayBenchmark::appendSmallArray() {
+    std::size_t size = 0;
+    CORRADE_BENCHMARK(Count) {
+        SmallArray<16, int> a;
+        for(std::size_t i = 0; i != ItemCount; ++i) a.append(int(i));
+        size += a.size();
+    }
+
+    CORRADE_COMPARE(size, Count*ItemCount);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Corrade::Containers::Test::SmallArrayBenchmark)
@@ -0,0 +1,543 @@
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+#include <string>
+
+#include "Corrade/Containers/SmallArray.h"
+#include "Corrade/TestSuite/Tester.h"
+
+namespace Corrade { namespace Containers { namespace Test {
+
+struct SmallArrayTest: TestSuite::Tester {
+    explicit SmallArrayTest();
+
+    void constructEmpty();
+    void constructNullptr();
+    void constructDefaultInit();
+    void constructDefaultInitLarge();
+    void constructValueInit();
+    void constructNoInit();
+    void constructDirectInit();
+    void constructInPlaceInit();
+    void constructInPlaceInitLarge();
+
+    void constructMoveSmall();
+    void constructMoveLarge();
+    void moveAssignSmall();
+    void moveAssignLarge();
+
+    void convertView();
+    void convertConstView();
+    void convertVoidView();
+    void access();
+    void accessEmpty();
+    void slice();
+
+    void reserve();
+    void resize();
+    void resizeValueInit();
+    void append();
+    void appendMove();
+    void appendInPlace();
+    void appendList();
+    void appendSpill();
+    void appendAliased();
+    void appendListAliased();
+    void removeSuffix();
+    void removeSuffixOutOfRange();
+    void clear();
+
+    void nonTrivialLifetime();
+};
+
+SmallArrayTest::SmallArrayTest() {
+    addTests({&SmallArrayTest::constructEmpty,
+              &SmallArrayTest::constructNullptr,
+              &SmallArrayTest::constructDefaultInit,
+              &SmallArrayTest::constructDefaultInitLarge,
+              &SmallArrayTest::constructValueInit,
+              &SmallArrayTest::constructNoInit,
+              &SmallArrayTest::constructDirectInit,
+              &SmallArrayTest::constructInPlaceInit,
+              &SmallArrayTest::constructInPlaceInitLarge,
+
+              &SmallArrayTest::constructMoveSmall,
+              &SmallArrayTest::constructMoveLarge,
+              &SmallArrayTest::moveAssignSmall,
+              &SmallArrayTest::moveAssignLarge,
+
+              &SmallArrayTest::convertView,
+              &SmallArrayTest::convertConstView,
+              &SmallArrayTest::convertVoidView,
+              &SmallArrayTest::access,
+              &SmallArrayTest::accessEmpty,
+              &SmallArrayTest::slice,
+
+              &SmallArrayTest::reserve,
+              &SmallArrayTest::resize,
+              &SmallArrayTest::resizeValueInit,
+              &SmallArrayTest::append,
+              &SmallArrayTest::appendMove,
+              &SmallArrayTest::appendInPlace,
+              &SmallArrayTest::appendList,
+              &SmallArrayTest::appendSpill,
+              &SmallArrayTest::appendAliased,
+              &SmallArrayTest::appendListAliased,
+              &SmallArrayTest::removeSuffix,
+              &SmallArrayTest::removeSuffixOutOfRange,
+              &SmallArrayTest::clear,
+
+              &SmallArrayTest::nonTrivialLifetime});
+}
+
+typedef Containers::SmallArray<4, int> SmallArray;
+
+namespace {
+
+struct Counted {
+    static int constructed;
+    static int destructed;
+
+    /*implicit*/ Counted(int a = 0) noexcept: a{a} { ++constructed; }
+    Counted(const Counted& other) noexcept: a{other.a} { ++constructed; }
+    Counted(Counted&& other) noexcept: a{other.a} { ++constructed; }
+    ~Counted() { ++destructed; }
+    Counted& operator=(const Counted&) = default;
+    Counted& operator=(Counted&&) = default;
+
+    int a;
+};
+
+int Counted::constructed = 0;
+int Counted::destructed = 0;
+
+}
+
+void SmallArrayTest::constructEmpty() {
+    const SmallArray a;
+    CORRADE_VERIFY(a.empty());
+    CORRADE_VERIFY(a.isSmall());
+    CORRADE_COMPARE(a.size(), 0);
+    CORRADE_COMPARE(a.capacity(), 4);
+    CORRADE_COMPARE(SmallArray::InlineCapacity, 4);
+}
+
+void SmallArrayTest::constructNullptr() {
+    const SmallArray a = nullptr;
+    CORRADE_VERIFY(a.empty());
+    CORRADE_VERIFY(a.isSmall());
+}
+
+void SmallArrayTest::constructDefaultInit() {
+    const SmallArray a{3};
+    CORRADE_VERIFY(!a.empty());
+    CORRADE_VERIFY(a.isSmall());
+    CORRADE_COMPARE(a.size(), 3);
+    CORRADE_COMPARE(a.capacity(), 4);
+
+    const Containers::SmallArray<2, std::string> b{Containers::DefaultInit, 2};
+    CORRADE_COMPARE(b[0], "");
+    CORRADE_COMPARE(b[1], "");
+}
+
+void SmallArrayTest::constructDefaultInitLarge() {
+    const SmallArray a{Containers::DefaultInit, 5};
+    CORRADE_VERIFY(!a.isSmall());
+    CORRADE_COMPARE(a.size(), 5);
+    CORRADE_COMPARE(a.capacity(), 5);
+}
+
+void SmallArrayTest::constructValueInit() {
+    const SmallArray a{Containers::ValueInit, 3};
+    CORRADE_COMPARE(a[0], 0);
+    CORRADE_COMPARE(a[2], 0);
+
+    const SmallArray b{Containers::ValueInit, 7};
+    CORRADE_VERIFY(!b.isSmall());
+    CORRADE_COMPARE(b[0], 0);
+    CORRADE_COMPARE(b[6], 0);
+}
+
+void SmallArrayTest::constructNoInit() {
+    Counted::constructed = Counted::destructed = 0;
+    {
+        Containers::SmallArray<2, Counted> a{Containers::NoInit, 2};
+        CORRADE_COMPARE(Counted::constructed, 0);
+        new(&a[0]) Counted{1};
+        new(&a[1]) Counted{2};
+        CORRADE_COMPARE(a[1].a, 2);
+    }
+
+    CORRADE_COMPARE(Counted::constructed, 2);
+    CORRADE_COMPARE(Counted::destructed, 2);
+}
+
+void SmallArrayTest::constructDirectInit() {
+    const SmallArray a{Containers::DirectInit, 3, -37};
+    CORRADE_COMPARE(a[0], -37);
+    CORRADE_COMPARE(a[2], -37);
+
+    const SmallArray b{Containers::DirectInit, 6, 15};
+    CORRADE_VERIFY(!b.isSmall());
+    CORRADE_COMPARE(b[5], 15);
+}
+
+void SmallArrayTest::constructInPlaceInit() {
+    const SmallArray a{Containers::InPlaceInit, {1, 3, 127}};
+    CORRADE_VERIFY(a.isSmall());
+    CORRADE_COMPARE(a.size(), 3);
+    CORRADE_COMPARE(a[0], 1);
+    CORRADE_COMPARE(a[1], 3);
+    CORRADE_COMPARE(a[2], 127);
+}
+
+void SmallArrayTest::constructInPlaceInitLarge() {
+    const SmallArray a{Containers::InPlaceInit, {1, 3, 127, -48, 15}};
+    CORRADE_VERIFY(!a.isSmall());
+    CORRADE_COMPARE(a.size(), 5);
+    CORRADE_COMPARE(a[0], 1);
+    CORRADE_COMPARE(a[4], 15);
+}
+
+void SmallArrayTest::constructMoveSmall() {
+    SmallArray a{Containers::InPlaceInit, {1, 2, 3}};
+    const int* prev = a.data();
+
+    SmallArray b = std::move(a);
+    CORRADE_VERIFY(a.isSmall());
+    CORRADE_VERIFY(a.empty());
+    CORRADE_VERIFY(b.isSmall());
+    CORRADE_VERIFY(b.data() != prev);
+    CORRADE_COMPARE(b.size(), 3);
+    CORRADE_COMPARE(b[2], 3);
+
+    CORRADE_VERIFY(std::is_nothrow_move_constructible<SmallArray>::value);
+    CORRADE_VERIFY(!std::is_copy_constructible<SmallArray>::value);
+}
+
+void SmallArrayTest::constructMoveLarge() {
+    SmallArray a{Containers::InPlaceInit, {1, 2, 3, 4, 5}};
+    const int* prev = a.data();
+
+    SmallArray b = std::move(a);
+    CORRADE_VERIFY(a.isSmall());
+    CORRADE_VERIFY(a.empty());
+    CORRADE_COMPARE(a.capacity(), 4);
+    CORRADE_VERIFY(!b.isSmall());
+    CORRADE_COMPARE(b.data(), prev);
+    CORRADE_COMPARE(b.size(), 5);
+    CORRADE_COMPARE(b.capacity(), 5);
+}
+
+void SmallArrayTest::moveAssignSmall() {
+    SmallArray a{Containers::InPlaceInit, {1, 2}};
+    SmallArray b{Containers::InPlaceInit, {3, 4, 5, 6, 7}};
+
+    b = std::move(a);
+    CORRADE_VERIFY(a.empty());
+    CORRADE_VERIFY(b.isSmall());
+    CORRADE_COMPARE(b.size(), 2);
+    CORRADE_COMPARE(b[1], 2);
+
+    CORRADE_VERIFY(std::is_nothrow_move_assignable<SmallArray>::value);
+    CORRADE_VERIFY(!std::is_copy_assignable<SmallArray>::value);
+}
+
+void SmallArrayTest::moveAssignLarge() {
+    SmallArray a{Containers::InPlaceInit, {1, 2, 3, 4, 5}};
+    SmallArray b{Containers::InPlaceInit, {6}};
+    const int* prev = a.data();
+
+    b = std::move(a);
+    CORRADE_VERIFY(a.empty());
+    CORRADE_VERIFY(a.isSmall());
+    CORRADE_VERIFY(!b.isSmall());
+    CORRADE_COMPARE(b.data(), prev);
+    CORRADE_COMPARE(b.size(), 5);
+}
+
+void SmallArrayTest::convertView() {
+    SmallArray a{Containers::InPlaceInit, {1, 2, 3}};
+
+    ArrayView<int> b = a;
+    CORRADE_COMPARE(b.data(), a.data());
+    CORRADE_COMPARE(b.size(), 3);
+
+    auto c = arrayView(a);
+    CORRADE_VERIFY((std::is_same<decltype(c), ArrayView<int>>::value));
+    CORRADE_COMPARE(c.data(), a.data());
+}
+
+void SmallArrayTest::convertConstView() {
+    const SmallArray a{Containers::InPlaceInit, {1, 2, 3, 4, 5}};
+
+    ArrayView<const int> b = a;
+    CORRADE_COMPARE(b.data(), a.data());
+    CORRADE_COMPARE(b.size(), 5);
+
+    auto c = arrayView(a);
+    CORRADE_VERIFY((std::is_same<decltype(c), ArrayView<const int>>::value));
+    CORRADE_COMPARE(c.size(), 5);
+}
+
+void SmallArrayTest::convertVoidView() {
+    const SmallArray a{Containers::InPlaceInit, {1, 2, 3}};
+
+    ArrayView<const void> b = a;
+    CORRADE_COMPARE(b.data(), static_cast<const void*>(a.data()));
+    CORRADE_COMPARE(b.size(), 3*sizeof(int));
+}
+
+void SmallArrayTest::access() {
+    SmallArray a{Containers::InPlaceInit, {1, 2, 3}};
+    CORRADE_COMPARE(a.front(), 1);
+    CORRADE_COMPARE(a.back(), 3);
+    CORRADE_COMPARE(*a.begin(), 1);
+    CORRADE_COMPARE(*(a.end() - 1), 3);
+
+    a[1] = 7;
+    int sum = 0;
+    for(int i: a) sum += i;
+    CORRADE_COMPARE(sum, 11);
+
+    const SmallArray& ca = a;
+    CORRADE_COMPARE(ca.front(), 1);
+    CORRADE_COMPARE(ca.back(), 3);
+    CORRADE_COMPARE(*ca.cbegin(), 1);
+    CORRADE_COMPARE(ca.cend() - ca.cbegin(), 3);
+}
+
+void SmallArrayTest::accessEmpty() {
+    SmallArray a;
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    a.front();
+    a.back();
+    CORRADE_COMPARE(out.str(),
+        "Containers::SmallArray::front(): array is empty\n"
+        "Containers::SmallArray::back(): array is empty\n");
+}
+
+void SmallArrayTest::slice() {
+    SmallArray a{Containers::InPlaceInit, {1, 2, 3, 4, 5}};
+
+    ArrayView<int> b = a.slice(1, 4);
+    CORRADE_COMPARE(b.size(), 3);
+    CORRADE_COMPARE(b[0], 2);
+
+    ArrayView<int> c = a.prefix(2);
+    CORRADE_COMPARE(c.size(), 2);
+    CORRADE_COMPARE(c[1], 2);
+
+    ArrayView<const int> d = static_cast<const SmallArray&>(a).suffix(3);
+    CORRADE_COMPARE(d.size(), 2);
+    CORRADE_COMPARE(d[0], 4);
+}
+
+void SmallArrayTest::reserve() {
+    SmallArray a{Containers::InPlaceInit, {1, 2}};
+
+    /* Smaller than inline capacity, nothing happens */
+    CORRADE_COMPARE(a.reserve(3), 4);
+    CORRADE_VERIFY(a.isSmall());
+
+    CORRADE_COMPARE(a.reserve(10), 10);
+    CORRADE_VERIFY(!a.isSmall());
+    CORRADE_COMPARE(a.size(), 2);
+    CORRADE_COMPARE(a[1], 2);
+
+    /* Smaller than current, nothing happens */
+    const int* prev = a.data();
+    CORRADE_COMPARE(a.reserve(5), 10);
+    CORRADE_COMPARE(a.data(), prev);
+}
+
+void SmallArrayTest::resize() {
+    SmallArray a{Containers::InPlaceInit, {1, 2}};
+
+    a.resize(4);
+    CORRADE_VERIFY(a.isSmall());
+    CORRADE_COMPARE(a.size(), 4);
+    CORRADE_COMPARE(a[1], 2);
+
+    a.resize(6);
+    CORRADE_VERIFY(!a.isSmall());
+    CORRADE_COMPARE(a.size(), 6);
+    CORRADE_COMPARE(a[1], 2);
+
+    /* Shrinking doesn't change capacity nor go back to inline storage */
+    const std::size_t capacity = a.capacity();
+    a.resize(1);
+    CORRADE_VERIFY(!a.isSmall());
+    CORRADE_COMPARE(a.size(), 1);
+    CORRADE_COMPARE(a.capacity(), capacity);
+}
+
+void SmallArrayTest::resizeValueInit() {
+    SmallArray a{Containers::InPlaceInit, {1}};
+    a.resize(Containers::ValueInit, 7);
+    CORRADE_COMPARE(a.size(), 7);
+    CORRADE_COMPARE(a[0], 1);
+    CORRADE_COMPARE(a[1], 0);
+    CORRADE_COMPARE(a[6], 0);
+}
+
+void SmallArrayTest::append() {
+    SmallArray a;
+    const int value = 3;
+    int& appended = a.append(value);
+    CORRADE_COMPARE(&appended, a.data());
+    CORRADE_COMPARE(a.size(), 1);
+    CORRADE_COMPARE(a[0], 3);
+    CORRADE_VERIFY(a.isSmall());
+}
+
+void SmallArrayTest::appendMove() {
+    Containers::SmallArray<2, std::string> a;
+    std::string value = "a string that's long enough to not fit into SSO";
+    a.append(std::move(value));
+    CORRADE_COMPARE(a.size(), 1);
+    CORRADE_COMPARE(a[0], "a string that's long enough to not fit into SSO");
+}
+
+void SmallArrayTest::appendInPlace() {
+    Containers::SmallArray<2, std::string> a;
+    a.append(Containers::InPlaceInit, 3, 'a');
+    CORRADE_COMPARE(a.size(), 1);
+    CORRADE_COMPARE(a[0], "aaa");
+}
+
+void SmallArrayTest::appendList() {
+    SmallArray a{Containers::InPlaceInit, {1}};
+    ArrayView<int> appended = a.append({2, 3, 4});
+    CORRADE_VERIFY(a.isSmall());
+    CORRADE_COMPARE(appended.data(), a.data() + 1);
+    CORRADE_COMPARE(appended.size(), 3);
+    CORRADE_COMPARE(a.size(), 4);
+    CORRADE_COMPARE(a[3], 4);
+
+    a.append({5, 6});
+    CORRADE_VERIFY(!a.isSmall());
+    CORRADE_COMPARE(a.size(), 6);
+    CORRADE_COMPARE(a[0], 1);
+    CORRADE_COMPARE(a[5], 6);
+}
+
+void SmallArrayTest::appendSpill() {
+    SmallArray a;
+    for(int i = 0; i != 4; ++i) a.append(i);
+    CORRADE_VERIFY(a.isSmall());
+    CORRADE_COMPARE(a.capacity(), 4);
+
+    /* First spill doubles the inline capacity, so the next appends don't
+       need to reallocate */
+    a.append(4);
+    CORRADE_VERIFY(!a.isSmall());
+    CORRADE_COMPARE(a.capacity(), 8);
+    const int* const data = a.data();
+    a.append(5);
+    CORRADE_COMPARE(a.capacity(), 8);
+    CORRADE_COMPARE(a.data(), data);
+
+    for(int i = 0; i != 6; ++i) CORRADE_COMPARE(a[i], i);
+}
+
+void SmallArrayTest::appendAliased() {
+    Containers::SmallArray<2, std::string> a{Containers::InPlaceInit, {
+        "a string that's long enough to not fit into SSO", "b"}};
+
+    /* Appending an item of the array itself while reallocating */
+    a.append(a[0]);
+    CORRADE_VERIFY(!a.isSmall());
+    CORRADE_COMPARE(a.size(), 3);
+    CORRADE_COMPARE(a[0], "a string that's long enough to not fit into SSO");
+    CORRADE_COMPARE(a[2], "a string that's long enough to not fit into SSO");
+}
+
+void SmallArrayTest::appendListAliased() {
+    Containers::SmallArray<2, std::string> a{Containers::InPlaceInit, {
+        "a string that's long enough to not fit into SSO", "b"}};
+
+    a.append(a);
+    CORRADE_VERIFY(!a.isSmall());
+    CORRADE_COMPARE(a.size(), 4);
+    CORRADE_COMPARE(a[2], "a string that's long enough to not fit into SSO");
+    CORRADE_COMPARE(a[3], "b");
+}
+
+void SmallArrayTest::removeSuffix() {
+    SmallArray a{Containers::InPlaceInit, {1, 2, 3}};
+    a.removeSuffix();
+    CORRADE_COMPARE(a.size(), 2);
+    a.removeSuffix(2);
+    CORRADE_VERIFY(a.empty());
+    CORRADE_COMPARE(a.capacity(), 4);
+}
+
+void SmallArrayTest::removeSuffixOutOfRange() {
+    SmallArray a{Containers::InPlaceInit, {1, 2, 3}};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    a.removeSuffix(4);
+    CORRADE_COMPARE(a.size(), 3);
+    CORRADE_COMPARE(out.str(), "Containers::SmallArray::removeSuffix(): can't remove 4 elements from an array of size 3\n");
+}
+
+void SmallArrayTest::clear() {
+    SmallArray a{Containers::InPlaceInit, {1, 2, 3, 4, 5}};
+    const std::size_t capacity = a.capacity();
+    a.clear();
+    CORRADE_VERIFY(a.empty());
+    CORRADE_VERIFY(!a.isSmall());
+    CORRADE_COMPARE(a.capacity(), capacity);
+}
+
+void SmallArrayTest::nonTrivialLifetime() {
+    Counted::constructed = Counted::destructed = 0;
+    {
+        Containers::SmallArray<2, Counted> a;
+        a.append(1);
+        a.append(2);
+        a.append(3);
+        a.append(Containers::InPlaceInit, 4);
+        a.removeSuffix();
+
+        Containers::SmallArray<2, Counted> b{Containers::InPlaceInit, {5}};
+        Containers::SmallArray<2, Counted> c = std::move(b);
+        b = std::move(a);
+        CORRADE_COMPARE(b.size(), 3);
+        CORRADE_COMPARE(c.size(), 1);
+    }
+
+    CORRADE_VERIFY(Counted::constructed);
+    CORRADE_COMPARE(Counted::constructed, Counted::destructed);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Corrade::Containers::Test::SmallArrayTest)
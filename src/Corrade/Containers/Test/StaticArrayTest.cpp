@@ -23,6 +23,9 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <cstdint>
+#include <string>
+
 #include "Corrade/Containers/StaticArray.h"
 #include "Corrade/TestSuite/Tester.h"
 
@@ -35,8 +38,11 @@ struct StaticArrayTest: TestSuite::Tester {
     void constructInPlace();
     void constructInPlaceOneArgument();
     void constructValueInit();
+    void constructConstexpr();
     void constructNoInit();
     void constructDirectInit();
+    void constructGenerator();
+    void constructGeneratorConstexpr();
     void constructNonCopyable();
     void constructNoImplicitConstructor();
     void constructDirectReferences();
@@ -48,8 +54,10 @@ struct StaticArrayTest: TestSuite::Tester {
     void convertStaticView();
     void convertStaticViewDerived();
     void convertVoid();
+    void convertConstexpr();
 
     void access();
+    void accessConstexpr();
     void rvalueArrayAccess();
     void rangeBasedFor();
 
@@ -72,8 +80,11 @@ StaticArrayTest::StaticArrayTest() {
               &StaticArrayTest::constructInPlace,
               &StaticArrayTest::constructInPlaceOneArgument,
               &StaticArrayTest::constructValueInit,
+              &StaticArrayTest::constructConstexpr,
               &StaticArrayTest::constructNoInit,
               &StaticArrayTest::constructDirectInit,
+              &StaticArrayTest::constructGenerator,
+              &StaticArrayTest::constructGeneratorConstexpr,
               &StaticArrayTest::constructNonCopyable,
               &StaticArrayTest::constructNoImplicitConstructor,
               &StaticArrayTest::constructDirectReferences,
@@ -85,8 +96,10 @@ StaticArrayTest::StaticArrayTest() {
               &StaticArrayTest::convertStaticView,
               &StaticArrayTest::convertStaticViewDerived,
               &StaticArrayTest::convertVoid,
+              &StaticArrayTest::convertConstexpr,
 
               &StaticArrayTest::access,
+              &StaticArrayTest::accessConstexpr,
               &StaticArrayTest::rvalueArrayAccess,
               &StaticArrayTest::rangeBasedFor,
 
@@ -141,6 +154,21 @@ void StaticArrayTest::constructValueInit() {
     CORRADE_COMPARE(a[4], 0);
 }
 
+namespace {
+    constexpr StaticArray ConstexprValueInit{ValueInit};
+    constexpr StaticArray ConstexprInPlaceInit{InPlaceInit, 1, 2, 3, 4, 5};
+    constexpr StaticArray ConstexprInPlaceInitImplicit{1, 2, 3, 4, 5};
+}
+
+void StaticArrayTest::constructConstexpr() {
+    constexpr int a = ConstexprValueInit[3];
+    constexpr int b = ConstexprInPlaceInit[3];
+    constexpr int c = ConstexprInPlaceInitImplicit[4];
+    CORRADE_COMPARE(a, 0);
+    CORRADE_COMPARE(b, 4);
+    CORRADE_COMPARE(c, 5);
+}
+
 namespace {
     struct Foo {
         static int constructorCallCount;
@@ -174,6 +202,63 @@ void StaticArrayTest::constructDirectInit() {
     CORRADE_COMPARE(a[4], -37);
 }
 
+namespace {
+    constexpr int square(std::size_t i) { return int(i*i); }
+
+    struct Multiplier {
+        constexpr int operator()(std::size_t i) const { return int(i)*factor; }
+        int factor;
+    };
+
+    /* The classic reflected CRC-32 table, 0xedb88320 polynomial */
+    constexpr std::uint32_t crc32(std::uint32_t c, int i = 0) {
+        return i == 8 ? c : crc32(c & 1 ? 0xedb88320u ^ (c >> 1) : c >> 1, i + 1);
+    }
+    constexpr std::uint32_t crc32Entry(std::size_t i) {
+        return crc32(std::uint32_t(i));
+    }
+
+    constexpr char hexDigit(std::size_t i) {
+        return "0123456789abcdef"[i];
+    }
+
+    constexpr Containers::StaticArray<256, std::uint32_t> Crc32Table{GeneratorInit, crc32Entry};
+    constexpr Containers::StaticArray<16, char> HexDigits{GeneratorInit, hexDigit};
+    constexpr StaticArray Multiplied{GeneratorInit, Multiplier{3}};
+}
+
+void StaticArrayTest::constructGenerator() {
+    const StaticArray a{GeneratorInit, square};
+    CORRADE_COMPARE(a[0], 0);
+    CORRADE_COMPARE(a[1], 1);
+    CORRADE_COMPARE(a[2], 4);
+    CORRADE_COMPARE(a[3], 9);
+    CORRADE_COMPARE(a[4], 16);
+
+    /* Non-trivial types and functors with state work as well */
+    struct Prefixed {
+        std::string operator()(std::size_t i) const {
+            return prefix + std::to_string(i);
+        }
+        std::string prefix;
+    };
+    const Containers::StaticArray<3, std::string> b{GeneratorInit, Prefixed{"item"}};
+    CORRADE_COMPARE(b[0], "item0");
+    CORRADE_COMPARE(b[1], "item1");
+    CORRADE_COMPARE(b[2], "item2");
+}
+
+void StaticArrayTest::constructGeneratorConstexpr() {
+    constexpr std::uint32_t crc1 = Crc32Table[1];
+    constexpr std::uint32_t crc255 = Crc32Table[255];
+    constexpr char hexA = HexDigits[10];
+    constexpr int multiplied = Multiplied[4];
+    CORRADE_COMPARE(crc1, 0x77073096u);
+    CORRADE_COMPARE(crc255, 0x2d02ef8du);
+    CORRADE_COMPARE(hexA, 'a');
+    CORRADE_COMPARE(multiplied, 12);
+}
+
 void StaticArrayTest::constructNonCopyable() {
     struct NonCopyable {
         NonCopyable(const NonCopyable&) = delete;
@@ -394,6 +479,19 @@ void StaticArrayTest::convertVoid() {
     CORRADE_COMPARE(cb.size(), 5*sizeof(int));
 }
 
+void StaticArrayTest::convertConstexpr() {
+    constexpr ConstArrayView a = ConstexprInPlaceInit;
+    constexpr ConstStaticArrayView b = ConstexprInPlaceInit;
+    constexpr VoidArrayView c = ConstexprInPlaceInit;
+    constexpr int third = b[2];
+    constexpr std::size_t size = a.size();
+    constexpr std::size_t voidSize = c.size();
+    CORRADE_COMPARE(third, 3);
+    CORRADE_COMPARE(size, 5);
+    CORRADE_COMPARE(voidSize, 5*sizeof(int));
+    CORRADE_COMPARE(a.data(), ConstexprInPlaceInit.data());
+}
+
 void StaticArrayTest::access() {
     StaticArray a;
     for(std::size_t i = 0; i != 5; ++i)
@@ -407,6 +505,19 @@ void StaticArrayTest::access() {
     CORRADE_COMPARE(a.cend(), a.end());
 }
 
+void StaticArrayTest::accessConstexpr() {
+    constexpr const int* data = ConstexprInPlaceInit.data();
+    constexpr int second = *(ConstexprInPlaceInit.begin() + 1);
+    constexpr int last = *(ConstexprInPlaceInit.cend() - 1);
+    constexpr std::size_t size = ConstexprInPlaceInit.end() - ConstexprInPlaceInit.cbegin();
+    constexpr bool empty = ConstexprInPlaceInit.empty();
+    CORRADE_COMPARE(data, static_cast<const int*>(ConstexprInPlaceInit));
+    CORRADE_COMPARE(second, 2);
+    CORRADE_COMPARE(last, 5);
+    CORRADE_COMPARE(size, 5);
+    CORRADE_VERIFY(!empty);
+}
+
 void StaticArrayTest::rvalueArrayAccess() {
     CORRADE_COMPARE((StaticArray{DirectInit, 3})[2], 3);
 }
@@ -0,0 +1,621 @@
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <sstream>
+
+#include "Corrade/Containers/Array.h"
+#include "Corrade/Containers/StridedArrayView.h"
+#include "Corrade/TestSuite/Tester.h"
+
+namespace Corrade { namespace Containers { namespace Test {
+
+struct StridedArrayViewTest: TestSuite::Tester {
+    explicit StridedArrayViewTest();
+
+    void dimensionsConstruct();
+    void dimensionsConstructDefault();
+    void dimensionsConvertScalar();
+    void dimensionsCompare();
+
+    void constructEmpty();
+    void constructNullptr();
+    void construct();
+    void constructNegativeStride();
+    void constructZeroStride();
+    void constructInvalid();
+    void constructInvalidEmpty();
+    void constructArrayView();
+    void constructStaticArrayView();
+    void constructFixedSize();
+    void constructConst();
+    void construct2D();
+    void construct3D();
+    void constructContiguous();
+    void constructContiguous3D();
+    void constructContiguousInvalid();
+
+    void isContiguous();
+    void isContiguousSizeOne();
+    void asContiguous();
+    void asContiguousNonContiguous();
+
+    void access();
+    void access2D();
+    void accessOutOfRange();
+    void iterate();
+    void iterate2D();
+    void frontBack();
+    void frontBackEmpty();
+
+    void slice();
+    void slice2D();
+    void sliceOutOfRange();
+
+    void transposed();
+    void transposedFlipped();
+    void flipped();
+    void flippedEmpty();
+    void flipped2D();
+};
+
+StridedArrayViewTest::StridedArrayViewTest() {
+    addTests({&StridedArrayViewTest::dimensionsConstruct,
+              &StridedArrayViewTest::dimensionsConstructDefault,
+              &StridedArrayViewTest::dimensionsConvertScalar,
+              &StridedArrayViewTest::dimensionsCompare,
+
+              &StridedArrayViewTest::constructEmpty,
+              &StridedArrayViewTest::constructNullptr,
+              &StridedArrayViewTest::construct,
+              &StridedArrayViewTest::constructNegativeStride,
+              &StridedArrayViewTest::constructZeroStride,
+              &StridedArrayViewTest::constructInvalid,
+              &StridedArrayViewTest::constructInvalidEmpty,
+              &StridedArrayViewTest::constructArrayView,
+              &StridedArrayViewTest::constructStaticArrayView,
+              &StridedArrayViewTest::constructFixedSize,
+              &StridedArrayViewTest::constructConst,
+              &StridedArrayViewTest::construct2D,
+              &StridedArrayViewTest::construct3D,
+              &StridedArrayViewTest::constructContiguous,
+              &StridedArrayViewTest::constructContiguous3D,
+              &StridedArrayViewTest::constructContiguousInvalid,
+
+              &StridedArrayViewTest::isContiguous,
+              &StridedArrayViewTest::isContiguousSizeOne,
+              &StridedArrayViewTest::asContiguous,
+              &StridedArrayViewTest::asContiguousNonContiguous,
+
+              &StridedArrayViewTest::access,
+              &StridedArrayViewTest::access2D,
+              &StridedArrayViewTest::accessOutOfRange,
+              &StridedArrayViewTest::iterate,
+              &StridedArrayViewTest::iterate2D,
+              &StridedArrayViewTest::frontBack,
+              &StridedArrayViewTest::frontBackEmpty,
+
+              &StridedArrayViewTest::slice,
+              &StridedArrayViewTest::slice2D,
+              &StridedArrayViewTest::sliceOutOfRange,
+
+              &StridedArrayViewTest::transposed,
+              &StridedArrayViewTest::transposedFlipped,
+              &StridedArrayViewTest::flipped,
+              &StridedArrayViewTest::flippedEmpty,
+              &StridedArrayViewTest::flipped2D});
+}
+
+typedef StridedDimensions<3, std::size_t> Size3D;
+
+struct Vertex {
+    float position[2];
+    int id;
+};
+
+/* Four rows of three columns */
+constexpr int Data2D[]{
+    0, 1, 2,
+    3, 4, 5,
+    6, 7, 8,
+    9, 10, 11
+};
+
+void StridedArrayViewTest::dimensionsConstruct() {
+    constexpr Size3D a{1, 37, 4564};
+    CORRADE_COMPARE(a[0], 1);
+    CORRADE_COMPARE(a[1], 37);
+    CORRADE_COMPARE(a[2], 4564);
+    CORRADE_COMPARE(*a.begin(), 1);
+    CORRADE_COMPARE(a.end() - a.begin(), 3);
+}
+
+void StridedArrayViewTest::dimensionsConstructDefault() {
+    constexpr Size3D a;
+    CORRADE_COMPARE(a, (Size3D{0, 0, 0}));
+}
+
+void StridedArrayViewTest::dimensionsConvertScalar() {
+    constexpr StridedDimensions<1, std::size_t> a = 1337;
+    constexpr std::size_t b = a;
+    CORRADE_COMPARE(a[0], 1337);
+    CORRADE_COMPARE(b, 1337);
+}
+
+void StridedArrayViewTest::dimensionsCompare() {
+    CORRADE_VERIFY((Size3D{1, 2, 3} == Size3D{1, 2, 3}));
+    CORRADE_VERIFY((Size3D{1, 2, 3} != Size3D{1, 2, 4}));
+    CORRADE_VERIFY(!(Size3D{1, 2, 3} != Size3D{1, 2, 3}));
+}
+
+void StridedArrayViewTest::constructEmpty() {
+    StridedArrayView1D<int> a;
+    CORRADE_VERIFY(!a.data());
+    CORRADE_VERIFY(a.empty());
+    CORRADE_COMPARE(a.size(), 0);
+    CORRADE_COMPARE(a.stride(), 0);
+}
+
+void StridedArrayViewTest::constructNullptr() {
+    StridedArrayView2D<int> a = nullptr;
+    CORRADE_VERIFY(!a.data());
+    CORRADE_VERIFY(a.empty());
+    CORRADE_COMPARE(a.size(), (StridedDimensions<2, std::size_t>{0, 0}));
+    CORRADE_COMPARE(a.stride(), (StridedDimensions<2, std::ptrdiff_t>{0, 0}));
+}
+
+void StridedArrayViewTest::construct() {
+    Vertex vertices[]{
+        {{1.0f, 2.0f}, 3},
+        {{4.0f, 5.0f}, 6},
+        {{7.0f, 8.0f}, 9}
+    };
+
+    StridedArrayView1D<int> a{vertices, &vertices[0].id, 3, sizeof(Vertex)};
+    CORRADE_COMPARE(a.data(), &vertices[0].id);
+    CORRADE_VERIFY(!a.empty());
+    CORRADE_COMPARE(a.size(), 3);
+    CORRADE_COMPARE(a.stride(), sizeof(Vertex));
+    CORRADE_COMPARE(a[0], 3);
+    CORRADE_COMPARE(a[1], 6);
+    CORRADE_COMPARE(a[2], 9);
+
+    /* Writing through the view */
+    a[1] = 42;
+    CORRADE_COMPARE(vertices[1].id, 42);
+}
+
+void StridedArrayViewTest::constructNegativeStride() {
+    int data[]{1, 2, 3, 4};
+
+    StridedArrayView1D<int> a{data, data + 3, 4, -std::ptrdiff_t(sizeof(int))};
+    CORRADE_COMPARE(a[0], 4);
+    CORRADE_COMPARE(a[3], 1);
+}
+
+void StridedArrayViewTest::constructZeroStride() {
+    int data[]{1337};
+
+    StridedArrayView1D<int> a{data, data, 5, 0};
+    CORRADE_COMPARE(a.size(), 5);
+    CORRADE_COMPARE(a[0], 1337);
+    CORRADE_COMPARE(a[4], 1337);
+}
+
+void StridedArrayViewTest::constructInvalid() {
+    int data[6]{};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    StridedArrayView1D<int>{data, data, 4, 8};
+    StridedArrayView1D<int>{data, data + 1, 2, -8};
+    StridedArrayView2D<int>{data, {2, 4}, {12, 4}};
+    CORRADE_COMPARE(out.str(),
+        "Containers::StridedArrayView: data size 24 is not enough for the view, expected bytes [0:28]\n"
+        "Containers::StridedArrayView: data size 24 is not enough for the view, expected bytes [-4:8]\n"
+        "Containers::StridedArrayView: data size 24 is not enough for the view, expected bytes [0:28]\n");
+}
+
+void StridedArrayViewTest::constructInvalidEmpty() {
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    /* Zero size in any dimension means no data is accessed */
+    int data[1]{};
+    StridedArrayView2D<int> a{data, {0, 100}, {4, 4}};
+    CORRADE_VERIFY(a.empty());
+    CORRADE_COMPARE(out.str(), "");
+}
+
+void StridedArrayViewTest::constructArrayView() {
+    int data[]{1, 2, 3};
+    ArrayView<int> view = data;
+
+    StridedArrayView1D<int> a = view;
+    CORRADE_COMPARE(a.data(), static_cast<void*>(data));
+    CORRADE_COMPARE(a.size(), 3);
+    CORRADE_COMPARE(a.stride(), sizeof(int));
+    CORRADE_COMPARE(a[2], 3);
+
+    /* Directly from an Array, going through ArrayView */
+    Array<int> array{InPlaceInit, {4, 5}};
+    StridedArrayView1D<const int> b = ArrayView<const int>{array};
+    CORRADE_COMPARE(b.size(), 2);
+    CORRADE_COMPARE(b[1], 5);
+}
+
+void StridedArrayViewTest::constructStaticArrayView() {
+    int data[]{1, 2, 3};
+    StaticArrayView<3, int> view = data;
+
+    StridedArrayView1D<int> a = view;
+    CORRADE_COMPARE(a.data(), static_cast<void*>(data));
+    CORRADE_COMPARE(a.size(), 3);
+    CORRADE_COMPARE(a.stride(), sizeof(int));
+    CORRADE_COMPARE(a[1], 2);
+}
+
+void StridedArrayViewTest::constructFixedSize() {
+    int data[]{1, 2, 3};
+
+    StridedArrayView1D<int> a = data;
+    CORRADE_COMPARE(a.data(), static_cast<void*>(data));
+    CORRADE_COMPARE(a.size(), 3);
+    CORRADE_COMPARE(a.stride(), sizeof(int));
+
+    /* Not convertible from types of a different size or unrelated types */
+    CORRADE_VERIFY((std::is_convertible<int(&)[3], StridedArrayView1D<const int>>::value));
+    CORRADE_VERIFY(!(std::is_convertible<char(&)[3], StridedArrayView1D<int>>::value));
+    CORRADE_VERIFY(!(std::is_convertible<const int(&)[3], StridedArrayView1D<int>>::value));
+}
+
+void StridedArrayViewTest::constructConst() {
+    int data[]{1, 2, 3};
+    StridedArrayView1D<int> a = data;
+
+    StridedArrayView1D<const int> b = a;
+    CORRADE_COMPARE(b.data(), static_cast<void*>(data));
+    CORRADE_COMPARE(b.size(), 3);
+    CORRADE_COMPARE(b.stride(), sizeof(int));
+
+    CORRADE_VERIFY(!(std::is_convertible<StridedArrayView1D<const int>, StridedArrayView1D<int>>::value));
+}
+
+void StridedArrayViewTest::construct2D() {
+    StridedArrayView2D<const int> a{Data2D, {4, 3}, {12, 4}};
+    CORRADE_COMPARE(a.size(), (StridedDimensions<2, std::size_t>{4, 3}));
+    CORRADE_COMPARE(a.stride(), (StridedDimensions<2, std::ptrdiff_t>{12, 4}));
+    CORRADE_COMPARE(a[0][0], 0);
+    CORRADE_COMPARE(a[1][2], 5);
+    CORRADE_COMPARE(a[3][1], 10);
+}
+
+void StridedArrayViewTest::construct3D() {
+    /* Two 2x3 images */
+    StridedArrayView3D<const int> a{Data2D, {2, 2, 3}, {24, 12, 4}};
+    CORRADE_COMPARE(a.size(), (Size3D{2, 2, 3}));
+    CORRADE_COMPARE(a[0][1][2], 5);
+    CORRADE_COMPARE(a[1][0][0], 6);
+    CORRADE_COMPARE(a[1][1][2], 11);
+
+    StridedArrayView2D<const int> b = a[1];
+    CORRADE_COMPARE(b.size(), (StridedDimensions<2, std::size_t>{2, 3}));
+    CORRADE_COMPARE(b[1][1], 10);
+}
+
+void StridedArrayViewTest::constructContiguous() {
+    StridedArrayView2D<const int> a{Data2D, {4, 3}};
+    CORRADE_COMPARE(a.size(), (StridedDimensions<2, std::size_t>{4, 3}));
+    CORRADE_COMPARE(a.stride(), (StridedDimensions<2, std::ptrdiff_t>{12, 4}));
+    CORRADE_COMPARE(a[1][2], 5);
+    CORRADE_COMPARE(a[3][1], 10);
+
+    StridedArrayView1D<const int> b{Data2D, 5};
+    CORRADE_COMPARE(b.size(), 5);
+    CORRADE_COMPARE(b.stride(), 4);
+    CORRADE_COMPARE(b[4], 4);
+}
+
+void StridedArrayViewTest::constructContiguous3D() {
+    StridedArrayView3D<const int> a{Data2D, {2, 2, 3}};
+    CORRADE_COMPARE(a.size(), (Size3D{2, 2, 3}));
+    CORRADE_COMPARE(a.stride(), (StridedDimensions<3, std::ptrdiff_t>{24, 12, 4}));
+    CORRADE_COMPARE(a[0][1][2], 5);
+    CORRADE_COMPARE(a[1][1][2], 11);
+}
+
+void StridedArrayViewTest::constructContiguousInvalid() {
+    std::ostringstream out;
+    Error redirectError{&out};
+    StridedArrayView2D<const int>{Data2D, {4, 4}};
+    CORRADE_COMPARE(out.str(),
+        "Containers::StridedArrayView: data size 48 is not enough for the view, expected bytes [0:64]\n");
+}
+
+void StridedArrayViewTest::isContiguous() {
+    StridedArrayView3D<const int> a{Data2D, {2, 2, 3}};
+    CORRADE_VERIFY(a.isContiguous());
+    CORRADE_VERIFY(a.isContiguous<1>());
+    CORRADE_VERIFY(a.isContiguous<2>());
+
+    /* A sub-rectangle has contiguous rows but isn't contiguous as a whole */
+    StridedArrayView3D<const int> b = a.slice({0, 0, 1}, {2, 2, 3});
+    CORRADE_VERIFY(!b.isContiguous());
+    CORRADE_VERIFY(!b.isContiguous<1>());
+    CORRADE_VERIFY(b.isContiguous<2>());
+
+    /* Cutting off rows keeps the inner dimensions contiguous */
+    StridedArrayView3D<const int> c = a.slice({0, 0, 0}, {2, 1, 3});
+    CORRADE_VERIFY(!c.isContiguous());
+    CORRADE_VERIFY(c.isContiguous<1>());
+
+    /* Flipped and transposed views aren't contiguous */
+    CORRADE_VERIFY(!a.flipped<2>().isContiguous<2>());
+    CORRADE_VERIFY(!(a.transposed<1, 2>().isContiguous<1>()));
+
+    /* Zero stride isn't contiguous */
+    StridedArrayView1D<const int> d{Data2D, Data2D, 4, 0};
+    CORRADE_VERIFY(!d.isContiguous());
+}
+
+void StridedArrayViewTest::isContiguousSizeOne() {
+    /* Stride of dimensions of size one doesn't matter */
+    StridedArrayView2D<const int> a{Data2D, {1, 3}, {1000, 4}};
+    CORRADE_VERIFY(a.isContiguous());
+
+    StridedArrayView2D<const int> b{Data2D, {4, 1}, {4, -3}};
+    CORRADE_VERIFY(b.isContiguous());
+}
+
+void StridedArrayViewTest::asContiguous() {
+    StridedArrayView2D<const int> a{Data2D, {4, 3}};
+    ArrayView<const int> b = a.asContiguous();
+    CORRADE_COMPARE(b.data(), Data2D);
+    CORRADE_COMPARE(b.size(), 12);
+
+    /* Last row only */
+    ArrayView<const int> c = a.suffix({3, 0}).asContiguous();
+    CORRADE_COMPARE(c.data(), Data2D + 9);
+    CORRADE_COMPARE(c.size(), 3);
+}
+
+void StridedArrayViewTest::asContiguousNonContiguous() {
+    StridedArrayView2D<const int> a{Data2D, {4, 3}};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    a.prefix({4, 2}).asContiguous();
+    CORRADE_COMPARE(out.str(), "Containers::StridedArrayView::asContiguous(): the view is not contiguous\n");
+}
+
+void StridedArrayViewTest::access() {
+    Vertex vertices[]{
+        {{1.0f, 2.0f}, 3},
+        {{4.0f, 5.0f}, 6}
+    };
+
+    StridedArrayView1D<float> a{vertices, &vertices[0].position[1], 2, sizeof(Vertex)};
+    CORRADE_COMPARE(a[0], 2.0f);
+    CORRADE_COMPARE(a[1], 5.0f);
+
+    for(float& i: a) i *= 10.0f;
+    CORRADE_COMPARE(vertices[0].position[1], 20.0f);
+    CORRADE_COMPARE(vertices[1].position[1], 50.0f);
+    CORRADE_COMPARE(vertices[1].position[0], 4.0f);
+}
+
+void StridedArrayViewTest::access2D() {
+    StridedArrayView2D<const int> a{Data2D, {4, 3}, {12, 4}};
+
+    StridedArrayView1D<const int> row = a[2];
+    CORRADE_COMPARE(row.size(), 3);
+    CORRADE_COMPARE(row.stride(), 4);
+    CORRADE_COMPARE(row[0], 6);
+    CORRADE_COMPARE(row[2], 8);
+}
+
+void StridedArrayViewTest::accessOutOfRange() {
+    int data[]{1, 2, 3};
+    StridedArrayView1D<int> a = data;
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    a[3];
+    CORRADE_COMPARE(out.str(), "Containers::StridedArrayView::operator[](): index 3 out of range for 3 elements\n");
+}
+
+void StridedArrayViewTest::iterate() {
+    int data[]{1, 2, 3, 4, 5, 6};
+    StridedArrayView1D<const int> a{data, {3}, {8}};
+
+    int sum = 0;
+    for(int i: a) sum += i;
+    CORRADE_COMPARE(sum, 1 + 3 + 5);
+
+    CORRADE_COMPARE(a.end() - a.begin(), 3);
+    CORRADE_VERIFY(a.begin() < a.end());
+    CORRADE_COMPARE(*(a.begin() + 2), 5);
+    CORRADE_COMPARE(*(a.end() - 1), 5);
+    CORRADE_COMPARE(*++a.begin(), 3);
+    CORRADE_COMPARE(*--a.end(), 5);
+}
+
+void StridedArrayViewTest::iterate2D() {
+    StridedArrayView2D<const int> a{Data2D, {4, 3}, {12, 4}};
+
+    int sum = 0;
+    std::size_t rows = 0;
+    for(StridedArrayView1D<const int> row: a) {
+        CORRADE_COMPARE(row.size(), 3);
+        for(int i: row) sum += i;
+        ++rows;
+    }
+    CORRADE_COMPARE(rows, 4);
+    CORRADE_COMPARE(sum, 66);
+}
+
+void StridedArrayViewTest::frontBack() {
+    StridedArrayView2D<const int> a{Data2D, {4, 3}, {12, 4}};
+    CORRADE_COMPARE(a.front()[0], 0);
+    CORRADE_COMPARE(a.back()[0], 9);
+    CORRADE_COMPARE(a.back().back(), 11);
+}
+
+void StridedArrayViewTest::frontBackEmpty() {
+    StridedArrayView1D<int> a;
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    a.front();
+    a.back();
+    CORRADE_COMPARE(out.str(),
+        "Containers::StridedArrayView::front(): view is empty\n"
+        "Containers::StridedArrayView::back(): view is empty\n");
+}
+
+void StridedArrayViewTest::slice() {
+    int data[]{1, 2, 3, 4, 5};
+    StridedArrayView1D<int> a = data;
+
+    StridedArrayView1D<int> b = a.slice(1, 4);
+    CORRADE_COMPARE(b.size(), 3);
+    CORRADE_COMPARE(b.stride(), sizeof(int));
+    CORRADE_COMPARE(b[0], 2);
+    CORRADE_COMPARE(b[2], 4);
+
+    StridedArrayView1D<int> c = a.prefix(3);
+    CORRADE_COMPARE(c.size(), 3);
+    CORRADE_COMPARE(c[0], 1);
+    CORRADE_COMPARE(c[2], 3);
+
+    StridedArrayView1D<int> d = a.suffix(2);
+    CORRADE_COMPARE(d.size(), 3);
+    CORRADE_COMPARE(d[0], 3);
+    CORRADE_COMPARE(d[2], 5);
+}
+
+void StridedArrayViewTest::slice2D() {
+    StridedArrayView2D<const int> a{Data2D, {4, 3}, {12, 4}};
+
+    /* The middle 2x2 block */
+    StridedArrayView2D<const int> b = a.slice({1, 1}, {3, 3});
+    CORRADE_COMPARE(b.size(), (StridedDimensions<2, std::size_t>{2, 2}));
+    CORRADE_COMPARE(b.stride(), (StridedDimensions<2, std::ptrdiff_t>{12, 4}));
+    CORRADE_COMPARE(b[0][0], 4);
+    CORRADE_COMPARE(b[0][1], 5);
+    CORRADE_COMPARE(b[1][0], 7);
+    CORRADE_COMPARE(b[1][1], 8);
+
+    StridedArrayView2D<const int> c = a.suffix({3, 2});
+    CORRADE_COMPARE(c.size(), (StridedDimensions<2, std::size_t>{1, 1}));
+    CORRADE_COMPARE(c[0][0], 11);
+}
+
+void StridedArrayViewTest::sliceOutOfRange() {
+    StridedArrayView2D<const int> a{Data2D, {4, 3}, {12, 4}};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    a.slice({1, 1}, {3, 4});
+    a.slice({2, 0}, {1, 3});
+    CORRADE_COMPARE(out.str(),
+        "Containers::StridedArrayView::slice(): slice [{1, 1}:{3, 4}] out of range for {4, 3} elements in dimension 1\n"
+        "Containers::StridedArrayView::slice(): slice [{2, 0}:{1, 3}] out of range for {4, 3} elements in dimension 0\n");
+}
+
+void StridedArrayViewTest::transposed() {
+    StridedArrayView2D<const int> a{Data2D, {4, 3}, {12, 4}};
+
+    StridedArrayView2D<const int> b = a.transposed<0, 1>();
+    CORRADE_COMPARE(b.data(), a.data());
+    CORRADE_COMPARE(b.size(), (StridedDimensions<2, std::size_t>{3, 4}));
+    CORRADE_COMPARE(b.stride(), (StridedDimensions<2, std::ptrdiff_t>{4, 12}));
+
+    /* Second column */
+    StridedArrayView1D<const int> column = b[1];
+    CORRADE_COMPARE(column.size(), 4);
+    CORRADE_COMPARE(column[0], 1);
+    CORRADE_COMPARE(column[1], 4);
+    CORRADE_COMPARE(column[3], 10);
+
+    /* Transposing back gives the original */
+    StridedArrayView2D<const int> c = b.transposed<1, 0>();
+    CORRADE_COMPARE(c.size(), a.size());
+    CORRADE_COMPARE(c.stride(), a.stride());
+}
+
+void StridedArrayViewTest::transposedFlipped() {
+    StridedArrayView2D<const int> a{Data2D, {4, 3}, {12, 4}};
+
+    /* Rotation by 90° clockwise -- first row is the original first column
+       bottom to top */
+    StridedArrayView2D<const int> b = a.transposed<0, 1>().flipped<1>();
+    CORRADE_COMPARE(b.size(), (StridedDimensions<2, std::size_t>{3, 4}));
+    CORRADE_COMPARE(b[0][0], 9);
+    CORRADE_COMPARE(b[0][3], 0);
+    CORRADE_COMPARE(b[2][0], 11);
+    CORRADE_COMPARE(b[2][3], 2);
+}
+
+void StridedArrayViewTest::flipped() {
+    int data[]{1, 2, 3, 4, 5};
+    StridedArrayView1D<int> a = data;
+
+    StridedArrayView1D<int> b = a.flipped<0>();
+    CORRADE_COMPARE(b.data(), data + 4);
+    CORRADE_COMPARE(b.size(), 5);
+    CORRADE_COMPARE(b.stride(), -std::ptrdiff_t(sizeof(int)));
+    CORRADE_COMPARE(b[0], 5);
+    CORRADE_COMPARE(b[4], 1);
+
+    /* Flipping twice gives back the original */
+    StridedArrayView1D<int> c = b.flipped<0>();
+    CORRADE_COMPARE(c.data(), static_cast<void*>(data));
+    CORRADE_COMPARE(c.stride(), sizeof(int));
+}
+
+void StridedArrayViewTest::flippedEmpty() {
+    int data[]{1, 2, 3};
+    StridedArrayView1D<int> a = StridedArrayView1D<int>{data}.prefix(0);
+
+    StridedArrayView1D<int> b = a.flipped<0>();
+    CORRADE_COMPARE(b.data(), static_cast<void*>(data));
+    CORRADE_VERIFY(b.empty());
+}
+
+void StridedArrayViewTest::flipped2D() {
+    StridedArrayView2D<const int> a{Data2D, {4, 3}, {12, 4}};
+
+    StridedArrayView2D<const int> b = a.flipped<0>();
+    CORRADE_COMPARE(b[0][0], 9);
+    CORRADE_COMPARE(b[3][2], 2);
+
+    StridedArrayView2D<const int> c = a.flipped<1>();
+    CORRADE_COMPARE(c[0][0], 2);
+    CORRADE_COMPARE(c[3][2], 9);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Corrade::Containers::Test::StridedArrayViewTest)
@@ -43,6 +43,8 @@ void TagsTest::noDefaultConstructor() {
     CORRADE_VERIFY(!std::is_default_constructible<ValueInitT>::value);
     CORRADE_VERIFY(!std::is_default_constructible<NoInitT>::value);
     CORRADE_VERIFY(!std::is_default_constructible<DirectInitT>::value);
+    CORRADE_VERIFY(!std::is_default_constructible<InPlaceInitT>::value);
+    CORRADE_VERIFY(!std::is_default_constructible<GeneratorInitT>::value);
 }
 
 }}}
@@ -184,6 +184,17 @@ doesn't know about yet.
 #define CORRADE_TARGET_ARM
 #undef CORRADE_TARGET_ARM
 
+/**
+@brief SSE2 target
+
+Defined if the library is built for @ref CORRADE_TARGET_X86 "x86" with SSE2
+instructions enabled. That's always the case on 64-bit x86, on 32-bit it
+depends on compiler flags. Similarly to @ref CORRADE_TARGET_X86, this
+variable is not exposed in CMake.
+*/
+#define CORRADE_TARGET_SSE2
+#undef CORRADE_TARGET_SSE2
+
 /**
 @brief Use ANSI escape sequences for colored Debug output on Windows
 
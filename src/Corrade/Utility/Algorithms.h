@@ -0,0 +1,475 @@
+#ifndef Corrade_Utility_Algorithms_h
+#define Corrade_Utility_Algorithms_h
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Corrade::Utility::copy(), @ref Corrade::Utility::fill(), @ref Corrade::Utility::find(), @ref Corrade::Utility::count(), @ref Corrade::Utility::equal(), @ref Corrade::Utility::min(), @ref Corrade::Utility::max(), @ref Corrade::Utility::minmax()
+ */
+
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+
+#include "Corrade/configure.h"
+#include "Corrade/Containers/ArrayView.h"
+#include "Corrade/Containers/StridedArrayView.h"
+#include "Corrade/Utility/Assert.h"
+#include "Corrade/Utility/TypeTraits.h"
+
+#ifdef CORRADE_TARGET_SSE2
+#include <emmintrin.h>
+#endif
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+
+namespace Corrade { namespace Utility {
+
+namespace Implementation {
+    template<class T> void copyContiguous(const T* const src, T* const dst, const std::size_t size, std::true_type) {
+        std::memcpy(dst, src, size*sizeof(T));
+    }
+    template<class T> void copyContiguous(const T* const src, T* const dst, const std::size_t size, std::false_type) {
+        for(std::size_t i = 0; i != size; ++i) dst[i] = src[i];
+    }
+
+    template<class T> std::size_t stridedSize(const Containers::StridedArrayView<1, T>& view) {
+        return view.size();
+    }
+    template<unsigned dimensions, class T> std::size_t stridedSize(const Containers::StridedArrayView<dimensions, T>& view) {
+        std::size_t size = 1;
+        for(std::size_t i = 0; i != dimensions; ++i) size *= view.size()[i];
+        return size;
+    }
+
+    template<unsigned dimensions, class T> struct StridedCopy {
+        static void copy(const Containers::StridedArrayView<dimensions, const T>& src, const Containers::StridedArrayView<dimensions, T>& dst) {
+            /* If both views are contiguous from here on, copy everything at
+               once, otherwise go one level deeper */
+            if(src.isContiguous() && dst.isContiguous()) {
+                copyContiguous(static_cast<const T*>(src.data()), static_cast<T*>(dst.data()), stridedSize(src), IsTriviallyCopyable<T>{});
+                return;
+            }
+            for(std::size_t i = 0, size = src.size()[0]; i != size; ++i)
+                StridedCopy<dimensions - 1, T>::copy(src[i], dst[i]);
+        }
+    };
+    template<class T> struct StridedCopy<1, T> {
+        static void copy(const Containers::StridedArrayView<1, const T>& src, const Containers::StridedArrayView<1, T>& dst) {
+            if(src.isContiguous() && dst.isContiguous()) {
+                copyContiguous(static_cast<const T*>(src.data()), static_cast<T*>(dst.data()), src.size(), IsTriviallyCopyable<T>{});
+                return;
+            }
+            for(std::size_t i = 0, size = src.size(); i != size; ++i)
+                dst[i] = src[i];
+        }
+    };
+
+    template<class T> void fillContiguous(T* const data, const std::size_t size, const T& value, std::true_type) {
+        char byte;
+        std::memcpy(&byte, &value, 1);
+        std::memset(data, byte, size);
+    }
+    template<class T> void fillContiguous(T* const data, const std::size_t size, const T& value, std::false_type) {
+        for(std::size_t i = 0; i != size; ++i) data[i] = value;
+    }
+    template<class T> void fillContiguous(T* const data, const std::size_t size, const T& value) {
+        fillContiguous(data, size, value, std::integral_constant<bool, sizeof(T) == 1 && IsTriviallyCopyable<T>::value>{});
+    }
+
+    template<unsigned dimensions, class T> struct StridedFill {
+        static void fill(const Containers::StridedArrayView<dimensions, T>& view, const T& value) {
+            if(view.isContiguous()) {
+                fillContiguous(static_cast<T*>(view.data()), stridedSize(view), value);
+                return;
+            }
+            for(std::size_t i = 0, size = view.size()[0]; i != size; ++i)
+                StridedFill<dimensions - 1, T>::fill(view[i], value);
+        }
+    };
+    template<class T> struct StridedFill<1, T> {
+        static void fill(const Containers::StridedArrayView<1, T>& view, const T& value) {
+            if(view.isContiguous()) {
+                fillContiguous(static_cast<T*>(view.data()), view.size(), value);
+                return;
+            }
+            for(std::size_t i = 0, size = view.size(); i != size; ++i)
+                view[i] = value;
+        }
+    };
+
+    /* Types for which operator== is equivalent to comparing the bytes */
+    template<class T> using IsBitwiseComparable = std::integral_constant<bool, std::is_integral<T>::value || std::is_enum<T>::value || std::is_pointer<T>::value>;
+
+    template<class T> std::size_t findScalar(const T* const data, const std::size_t begin, const std::size_t size, const T& value) {
+        for(std::size_t i = begin; i != size; ++i)
+            if(data[i] == value) return i;
+        return size;
+    }
+
+    template<class T> std::size_t countScalar(const T* const data, const std::size_t begin, const std::size_t size, const T& value) {
+        std::size_t count = 0;
+        for(std::size_t i = begin; i != size; ++i)
+            if(data[i] == value) ++count;
+        return count;
+    }
+
+    struct MinOperation {
+        template<class T> static T scalar(const T& a, const T& b) { return b < a ? b : a; }
+        template<class V> static typename V::Type vector(typename V::Type a, typename V::Type b) { return V::min(a, b); }
+    };
+    struct MaxOperation {
+        template<class T> static T scalar(const T& a, const T& b) { return a < b ? b : a; }
+        template<class V> static typename V::Type vector(typename V::Type a, typename V::Type b) { return V::max(a, b); }
+    };
+
+    template<class Operation, class T> T reduceScalar(const T* const data, const std::size_t begin, const std::size_t size, T result) {
+        for(std::size_t i = begin; i != size; ++i)
+            result = Operation::scalar(result, data[i]);
+        return result;
+    }
+
+    #ifdef CORRADE_TARGET_SSE2
+    /* Equality comparison of 16 bytes at once, for bitwise comparable types
+       of given size */
+    template<std::size_t size> struct Sse2Compare {
+        enum: bool { Supported = false };
+    };
+    template<> struct Sse2Compare<1> {
+        enum: bool { Supported = true };
+        static __m128i splat(std::int8_t value) { return _mm_set1_epi8(value); }
+        static __m128i equal(__m128i a, __m128i b) { return _mm_cmpeq_epi8(a, b); }
+    };
+    template<> struct Sse2Compare<2> {
+        enum: bool { Supported = true };
+        static __m128i splat(std::int16_t value) { return _mm_set1_epi16(value); }
+        static __m128i equal(__m128i a, __m128i b) { return _mm_cmpeq_epi16(a, b); }
+    };
+    template<> struct Sse2Compare<4> {
+        enum: bool { Supported = true };
+        static __m128i splat(std::int32_t value) { return _mm_set1_epi32(value); }
+        static __m128i equal(__m128i a, __m128i b) { return _mm_cmpeq_epi32(a, b); }
+    };
+
+    template<class T> using HasSse2Compare = std::integral_constant<bool, IsBitwiseComparable<T>::value && Sse2Compare<sizeof(T)>::Supported>;
+
+    template<class T> __m128i sse2Splat(const T& value) {
+        typedef typename std::conditional<sizeof(T) == 1, std::int8_t,
+            typename std::conditional<sizeof(T) == 2, std::int16_t, std::int32_t>::type>::type Integer;
+        Integer integer;
+        std::memcpy(&integer, &value, sizeof(T));
+        return Sse2Compare<sizeof(T)>::splat(integer);
+    }
+
+    /* The compare mask has one bit per byte, so a match of an N-byte item
+       sets N consecutive bits */
+    inline std::size_t sse2CountTrailingZeros(unsigned int mask) {
+        #if defined(__GNUC__) || defined(__clang__)
+        return __builtin_ctz(mask);
+        #else
+        unsigned long index;
+        _BitScanForward(&index, mask);
+        return index;
+        #endif
+    }
+
+    template<class T> std::size_t find(const T* const data, const std::size_t size, const T& value, std::true_type) {
+        constexpr std::size_t lanes = 16/sizeof(T);
+        const __m128i splat = sse2Splat(value);
+        std::size_t i = 0;
+        for(; i + lanes <= size; i += lanes) {
+            const __m128i items = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+            const unsigned int mask = unsigned(_mm_movemask_epi8(Sse2Compare<sizeof(T)>::equal(items, splat)));
+            if(mask) return i + sse2CountTrailingZeros(mask)/sizeof(T);
+        }
+        return findScalar(data, i, size, value);
+    }
+
+    /* Every byte of a matching item is 0xff in the compare result, so
+       subtracting it increments per-byte counters. These are summed using
+       _mm_sad_epu8() before they could overflow and the total divided by
+       the item size at the end. */
+    template<class T> std::size_t count(const T* const data, const std::size_t size, const T& value, std::true_type) {
+        constexpr std::size_t lanes = 16/sizeof(T);
+        const __m128i splat = sse2Splat(value);
+        const __m128i zero = _mm_setzero_si128();
+        __m128i total = zero;
+        std::size_t i = 0;
+        while(i + lanes <= size) {
+            __m128i counts = zero;
+            for(std::size_t j = 0; j != 255 && i + lanes <= size; ++j, i += lanes) {
+                const __m128i items = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+                counts = _mm_sub_epi8(counts, Sse2Compare<sizeof(T)>::equal(items, splat));
+            }
+            total = _mm_add_epi64(total, _mm_sad_epu8(counts, zero));
+        }
+
+        std::uint64_t totals[2];
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(totals), total);
+        return std::size_t(totals[0] + totals[1])/sizeof(T) + countScalar(data, i, size, value);
+    }
+
+    /* Min and max of 16 bytes at once. SSE2 has those only for floats,
+       unsigned bytes and signed 16-bit integers, 32-bit integers are emulated
+       with a comparison and a select. */
+    template<class T> struct Sse2MinMax {
+        enum: bool { Supported = false };
+    };
+    template<> struct Sse2MinMax<float> {
+        enum: bool { Supported = true };
+        typedef __m128 Type;
+        static Type load(const float* data) { return _mm_loadu_ps(data); }
+        static void store(float* data, Type a) { _mm_storeu_ps(data, a); }
+        static Type min(Type a, Type b) { return _mm_min_ps(a, b); }
+        static Type max(Type a, Type b) { return _mm_max_ps(a, b); }
+    };
+    template<> struct Sse2MinMax<std::uint8_t> {
+        enum: bool { Supported = true };
+        typedef __m128i Type;
+        static Type load(const std::uint8_t* data) { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(data)); }
+        static void store(std::uint8_t* data, Type a) { _mm_storeu_si128(reinterpret_cast<__m128i*>(data), a); }
+        static Type min(Type a, Type b) { return _mm_min_epu8(a, b); }
+        static Type max(Type a, Type b) { return _mm_max_epu8(a, b); }
+    };
+    template<> struct Sse2MinMax<std::int16_t> {
+        enum: bool { Supported = true };
+        typedef __m128i Type;
+        static Type load(const std::int16_t* data) { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(data)); }
+        static void store(std::int16_t* data, Type a) { _mm_storeu_si128(reinterpret_cast<__m128i*>(data), a); }
+        static Type min(Type a, Type b) { return _mm_min_epi16(a, b); }
+        static Type max(Type a, Type b) { return _mm_max_epi16(a, b); }
+    };
+    template<> struct Sse2MinMax<std::int32_t> {
+        enum: bool { Supported = true };
+        typedef __m128i Type;
+        static Type load(const std::int32_t* data) { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(data)); }
+        static void store(std::int32_t* data, Type a) { _mm_storeu_si128(reinterpret_cast<__m128i*>(data), a); }
+        static Type min(Type a, Type b) {
+            const __m128i greater = _mm_cmpgt_epi32(a, b);
+            return _mm_or_si128(_mm_and_si128(greater, b), _mm_andnot_si128(greater, a));
+        }
+        static Type max(Type a, Type b) {
+            const __m128i greater = _mm_cmpgt_epi32(a, b);
+            return _mm_or_si128(_mm_and_si128(greater, a), _mm_andnot_si128(greater, b));
+        }
+    };
+
+    template<class T> using HasSse2MinMax = std::integral_constant<bool, Sse2MinMax<T>::Supported>;
+
+    template<class Operation, class T> T reduce(const T* const data, const std::size_t size, std::true_type) {
+        typedef Sse2MinMax<T> Vector;
+        constexpr std::size_t lanes = 16/sizeof(T);
+        if(size < lanes) return reduceScalar<Operation>(data, 1, size, data[0]);
+
+        typename Vector::Type result = Vector::load(data);
+        std::size_t i = lanes;
+        for(; i + lanes <= size; i += lanes)
+            result = Operation::template vector<Vector>(result, Vector::load(data + i));
+
+        T lanesResult[lanes];
+        Vector::store(lanesResult, result);
+        return reduceScalar<Operation>(data, i, size, reduceScalar<Operation>(lanesResult, 1, lanes, lanesResult[0]));
+    }
+    #else
+    template<class T> using HasSse2Compare = std::false_type;
+    template<class T> using HasSse2MinMax = std::false_type;
+    #endif
+
+    template<class T> std::size_t find(const T* const data, const std::size_t size, const T& value, std::false_type) {
+        return findScalar(data, 0, size, value);
+    }
+
+    template<class T> std::size_t count(const T* const data, const std::size_t size, const T& value, std::false_type) {
+        return countScalar(data, 0, size, value);
+    }
+
+    template<class T> bool equal(const T* const a, const T* const b, const std::size_t size, std::true_type) {
+        return std::memcmp(a, b, size*sizeof(T)) == 0;
+    }
+    template<class T> bool equal(const T* const a, const T* const b, const std::size_t size, std::false_type) {
+        for(std::size_t i = 0; i != size; ++i)
+            if(!(a[i] == b[i])) return false;
+        return true;
+    }
+
+    template<class Operation, class T> T reduce(const T* const data, const std::size_t size, std::false_type) {
+        return reduceScalar<Operation>(data, 1, size, data[0]);
+    }
+}
+
+/**
+@brief Copy a view to another
+
+Expects that both views have the same size. For trivially copyable types the
+copy is done using @ref std::memcpy(), other types are copied using the copy
+assignment operator. The views are expected to not overlap.
+@see @ref IsTriviallyCopyable
+*/
+template<class T> void copy(const Containers::ArrayView<const T>& src, const Containers::ArrayView<T>& dst) {
+    CORRADE_ASSERT(src.size() == dst.size(),
+        "Utility::copy(): sizes" << src.size() << "and" << dst.size() << "don't match", );
+    if(!src.size()) return;
+    Implementation::copyContiguous(src.data(), dst.data(), src.size(), IsTriviallyCopyable<T>{});
+}
+
+/** @overload */
+template<class T> void copy(const Containers::ArrayView<T>& src, const Containers::ArrayView<T>& dst) {
+    copy(Containers::ArrayView<const T>{src}, dst);
+}
+
+/**
+@brief Copy a strided view to another
+
+Expects that both views have the same size. For trivially copyable types the
+copy is done using a single @ref std::memcpy() if both views are contiguous,
+or a @ref std::memcpy() for each contiguous block otherwise --- for example
+for each row when copying a sub-rectangle of a contiguous image. Other types
+are copied element by element using the copy assignment operator. The views
+are expected to not overlap.
+@see @ref Containers::StridedArrayView::isContiguous(),
+    @ref IsTriviallyCopyable
+*/
+template<unsigned dimensions, class T> void copy(const Containers::StridedArrayView<dimensions, const T>& src, const Containers::StridedArrayView<dimensions, T>& dst) {
+    CORRADE_ASSERT(src.size() == dst.size(),
+        "Utility::copy(): sizes" << src.size() << "and" << dst.size() << "don't match", );
+    if(src.empty()) return;
+    Implementation::StridedCopy<dimensions, T>::copy(src, dst);
+}
+
+/** @overload */
+template<unsigned dimensions, class T> void copy(const Containers::StridedArrayView<dimensions, T>& src, const Containers::StridedArrayView<dimensions, T>& dst) {
+    copy(Containers::StridedArrayView<dimensions, const T>{src}, dst);
+}
+
+/**
+@brief Fill a view with a value
+
+For one-byte trivially copyable types the fill is done using
+@ref std::memset(), other types are assigned in a plain loop which the
+compiler is free to vectorize.
+*/
+template<class T> void fill(const Containers::ArrayView<T>& view, const typename std::common_type<T>::type& value) {
+    if(!view.size()) return;
+    Implementation::fillContiguous(view.data(), view.size(), value);
+}
+
+/**
+@brief Fill a strided view with a value
+
+Contiguous blocks of the view are filled at once, equivalently to
+@ref fill(const Containers::ArrayView<T>&, const typename std::common_type<T>::type&),
+the rest element by element.
+@see @ref Containers::StridedArrayView::isContiguous()
+*/
+template<unsigned dimensions, class T> void fill(const Containers::StridedArrayView<dimensions, T>& view, const typename std::common_type<T>::type& value) {
+    if(view.empty()) return;
+    Implementation::StridedFill<dimensions, T>::fill(view, value);
+}
+
+/**
+@brief Find a value in a view
+
+Returns index of the first item equal to @p value or @cpp view.size() @ce if
+there's no such item. If @ref CORRADE_TARGET_SSE2 is defined, integral and
+enum types of one, two or four bytes are compared 16 bytes at a time, other
+types are compared one by one using @cpp operator== @ce.
+*/
+template<class T> std::size_t find(const Containers::ArrayView<T>& view, const typename std::remove_const<T>::type& value) {
+    typedef typename std::remove_const<T>::type Type;
+    return Implementation::find<Type>(view.data(), view.size(), value, Implementation::HasSse2Compare<Type>{});
+}
+
+/**
+@brief Count occurrences of a value in a view
+
+Uses the same fast path as @ref find().
+*/
+template<class T> std::size_t count(const Containers::ArrayView<T>& view, const typename std::remove_const<T>::type& value) {
+    typedef typename std::remove_const<T>::type Type;
+    return Implementation::count<Type>(view.data(), view.size(), value, Implementation::HasSse2Compare<Type>{});
+}
+
+/**
+@brief Whether two views have equal contents
+
+Returns @cpp false @ce if the views have different size. Integral, enum and
+pointer types are compared using @ref std::memcmp(), other types one by one
+using @cpp operator== @ce.
+*/
+template<class T, class U> bool equal(const Containers::ArrayView<T>& a, const Containers::ArrayView<U>& b) {
+    typedef typename std::remove_const<T>::type Type;
+    static_assert(std::is_same<Type, typename std::remove_const<U>::type>::value,
+        "the views are expected to have the same type");
+    if(a.size() != b.size()) return false;
+    if(!a.size()) return true;
+    return Implementation::equal<Type>(a.data(), b.data(), a.size(), Implementation::IsBitwiseComparable<Type>{});
+}
+
+/**
+@brief Minimal value in a view
+
+Expects that the view is not empty. If @ref CORRADE_TARGET_SSE2 is defined,
+@cpp float @ce, @ref std::uint8_t, @ref std::int16_t and @ref std::int32_t
+are processed 16 bytes at a time, other types are compared one by one using
+@cpp operator< @ce. Result for floating-point data containing NaNs is
+unspecified.
+@see @ref max(), @ref minmax()
+*/
+template<class T> typename std::remove_const<T>::type min(const Containers::ArrayView<T>& view) {
+    typedef typename std::remove_const<T>::type Type;
+    CORRADE_ASSERT(view.size(), "Utility::min(): view is empty", {});
+    return Implementation::reduce<Implementation::MinOperation, Type>(view.data(), view.size(), Implementation::HasSse2MinMax<Type>{});
+}
+
+/**
+@brief Maximal value in a view
+
+Expects that the view is not empty. Uses the same fast path as @ref min().
+@see @ref minmax()
+*/
+template<class T> typename std::remove_const<T>::type max(const Containers::ArrayView<T>& view) {
+    typedef typename std::remove_const<T>::type Type;
+    CORRADE_ASSERT(view.size(), "Utility::max(): view is empty", {});
+    return Implementation::reduce<Implementation::MaxOperation, Type>(view.data(), view.size(), Implementation::HasSse2MinMax<Type>{});
+}
+
+/**
+@brief Minimal and maximal value in a view
+
+Expects that the view is not empty. Equivalent to calling both @ref min() and
+@ref max().
+*/
+template<class T> std::pair<typename std::remove_const<T>::type, typename std::remove_const<T>::type> minmax(const Containers::ArrayView<T>& view) {
+    typedef typename std::remove_const<T>::type Type;
+    CORRADE_ASSERT(view.size(), "Utility::minmax(): view is empty", {});
+    return {Implementation::reduce<Implementation::MinOperation, Type>(view.data(), view.size(), Implementation::HasSse2MinMax<Type>{}),
+            Implementation::reduce<Implementation::MaxOperation, Type>(view.data(), view.size(), Implementation::HasSse2MinMax<Type>{})};
+}
+
+}}
+
+#endif
@@ -0,0 +1,522 @@
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "AsyncFileQueue.h"
+
+#include <deque>
+
+#include "Corrade/configure.h"
+#include "Corrade/Utility/Assert.h"
+#include "Corrade/Utility/Debug.h"
+#include "Corrade/Utility/Directory.h"
+
+#ifndef CORRADE_TARGET_EMSCRIPTEN
+#include <algorithm>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+#endif
+
+#ifdef CORRADE_UTILITY_USE_IO_URING
+#include <cerrno>
+#include <cstdint>
+#include <fcntl.h>
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#include "Corrade/Containers/GrowableArray.h"
+#endif
+
+namespace Corrade { namespace Utility {
+
+namespace {
+
+struct Operation {
+    std::size_t id;
+    std::string filename;
+    /* Data to write, empty for reads */
+    Containers::Array<char> data;
+    bool write;
+};
+
+AsyncFileQueue::Completion execute(Operation& operation) {
+    if(operation.write) {
+        const bool success = Directory::write(operation.filename, operation.data);
+        return {operation.id, success, std::move(operation.data)};
+    }
+
+    /* Directory::read() returns nullptr also for empty files, distinguish
+       that from a failure */
+    Containers::Array<char> data = Directory::read(operation.filename);
+    const bool success = data || Directory::fileExists(operation.filename);
+    return {operation.id, success, std::move(data)};
+}
+
+#ifdef CORRADE_UTILITY_USE_IO_URING
+/* There's no wrapper for these in glibc, liburing is deliberately not used to
+   avoid an external dependency */
+int ioUringSetup(unsigned entries, io_uring_params& params) {
+    return int(syscall(__NR_io_uring_setup, entries, &params));
+}
+
+int ioUringEnter(int fd, unsigned toSubmit, unsigned minComplete, unsigned flags) {
+    return int(syscall(__NR_io_uring_enter, fd, toSubmit, minComplete, flags, nullptr, 0));
+}
+
+/* Linux transfers at most 0x7ffff000 bytes in a single readv() / writev(),
+   larger files are transferred in multiple parts. The test library makes this
+   smaller to exercise partial transfers without multi-gigabyte files. */
+#ifndef CORRADE_UTILITY_IO_URING_MAX_TRANSFER_SIZE
+#define CORRADE_UTILITY_IO_URING_MAX_TRANSFER_SIZE 0x7ffff000
+#endif
+
+/* An operation submitted to the ring. Its address is the SQE user data, the
+   iovec has to stay alive until the operation completes. */
+struct IoUringOperation {
+    std::size_t id;
+    std::string filename;
+    Containers::Array<char> data;
+    std::size_t offset;
+    iovec vector;
+    int fd;
+    bool write;
+};
+
+class IoUring {
+    public:
+        /* Enough to saturate the device, while the CQ ring (which is twice
+           as large) can never overflow */
+        enum: unsigned { Entries = 64 };
+
+        explicit IoUring() = default;
+
+        /* Returns false if io_uring is not supported by the kernel or
+           disallowed by a seccomp filter */
+        bool setup();
+
+        ~IoUring();
+
+        explicit operator bool() const { return _fd != -1; }
+
+        void read(std::size_t id, const std::string& filename, std::deque<AsyncFileQueue::Completion>& completed);
+        void write(std::size_t id, const std::string& filename, Containers::Array<char>&& data, std::deque<AsyncFileQueue::Completion>& completed);
+
+        /* Moves all operations finished by the kernel to the completed
+           queue, if wait is set, blocks until at least one gets there.
+           Completion entries for partial transfers that got resubmitted
+           don't count. */
+        void reap(std::deque<AsyncFileQueue::Completion>& completed, bool wait);
+
+    private:
+        void submit(IoUringOperation* operation, std::deque<AsyncFileQueue::Completion>& completed);
+
+        int _fd{-1};
+        void* _sqRing{};
+        void* _cqRing{};
+        io_uring_sqe* _sqes{};
+        std::size_t _sqRingSize, _cqRingSize, _sqesSize;
+        unsigned *_sqTail, *_sqArray, _sqMask;
+        unsigned *_cqHead, *_cqTail, _cqMask;
+        io_uring_cqe* _cqes;
+        unsigned _inFlight{};
+};
+
+bool IoUring::setup() {
+    io_uring_params params{};
+    const int fd = ioUringSetup(Entries, params);
+    if(fd < 0) return false;
+
+    _sqRingSize = params.sq_off.array + params.sq_entries*sizeof(unsigned);
+    _cqRingSize = params.cq_off.cqes + params.cq_entries*sizeof(io_uring_cqe);
+    _sqesSize = params.sq_entries*sizeof(io_uring_sqe);
+    bool singleMmap = false;
+    #ifdef IORING_FEAT_SINGLE_MMAP
+    if(params.features & IORING_FEAT_SINGLE_MMAP) {
+        _sqRingSize = _cqRingSize = std::max(_sqRingSize, _cqRingSize);
+        singleMmap = true;
+    }
+    #endif
+
+    void* const sqRing = mmap(nullptr, _sqRingSize, PROT_READ|PROT_WRITE, MAP_SHARED|MAP_POPULATE, fd, IORING_OFF_SQ_RING);
+    void* const cqRing = singleMmap ? sqRing : mmap(nullptr, _cqRingSize, PROT_READ|PROT_WRITE, MAP_SHARED|MAP_POPULATE, fd, IORING_OFF_CQ_RING);
+    void* const sqes = mmap(nullptr, _sqesSize, PROT_READ|PROT_WRITE, MAP_SHARED|MAP_POPULATE, fd, IORING_OFF_SQES);
+    if(sqRing == MAP_FAILED || cqRing == MAP_FAILED || sqes == MAP_FAILED) {
+        if(sqRing != MAP_FAILED) munmap(sqRing, _sqRingSize);
+        if(cqRing != MAP_FAILED && !singleMmap) munmap(cqRing, _cqRingSize);
+        if(sqes != MAP_FAILED) munmap(sqes, _sqesSize);
+        close(fd);
+        return false;
+    }
+
+    _fd = fd;
+    _sqRing = sqRing;
+    _cqRing = cqRing;
+    _sqes = static_cast<io_uring_sqe*>(sqes);
+    char* const sq = static_cast<char*>(sqRing);
+    _sqTail = reinterpret_cast<unsigned*>(sq + params.sq_off.tail);
+    _sqArray = reinterpret_cast<unsigned*>(sq + params.sq_off.array);
+    _sqMask = *reinterpret_cast<unsigned*>(sq + params.sq_off.ring_mask);
+    char* const cq = static_cast<char*>(cqRing);
+    _cqHead = reinterpret_cast<unsigned*>(cq + params.cq_off.head);
+    _cqTail = reinterpret_cast<unsigned*>(cq + params.cq_off.tail);
+    _cqMask = *reinterpret_cast<unsigned*>(cq + params.cq_off.ring_mask);
+    _cqes = reinterpret_cast<io_uring_cqe*>(cq + params.cq_off.cqes);
+    return true;
+}
+
+IoUring::~IoUring() {
+    if(_fd == -1) return;
+
+    /* The kernel might still be writing into the buffers, wait for all
+       operations to finish and discard them */
+    std::deque<AsyncFileQueue::Completion> discarded;
+    while(_inFlight) reap(discarded, true);
+
+    munmap(_sqes, _sqesSize);
+    if(_cqRing != _sqRing) munmap(_cqRing, _cqRingSize);
+    munmap(_sqRing, _sqRingSize);
+    close(_fd);
+}
+
+void IoUring::read(const std::size_t id, const std::string& filename, std::deque<AsyncFileQueue::Completion>& completed) {
+    const int fd = open(filename.data(), O_RDONLY|O_CLOEXEC);
+    if(fd == -1) {
+        Error{} << "Utility::AsyncFileQueue::read(): can't open" << filename;
+        completed.push_back({id, false, nullptr});
+        return;
+    }
+
+    /* Non-regular files can't be read with a single known-size operation,
+       empty files don't need to be read at all. Let Directory::read() handle
+       both synchronously. */
+    struct stat st;
+    if(fstat(fd, &st) != 0 || !S_ISREG(st.st_mode) || st.st_size == 0) {
+        close(fd);
+        Operation operation{id, filename, nullptr, false};
+        completed.push_back(execute(operation));
+        return;
+    }
+
+    Containers::Array<char> data{Containers::NoInit, std::size_t(st.st_size)};
+    submit(new IoUringOperation{id, filename, std::move(data), 0, {}, fd, false}, completed);
+}
+
+void IoUring::write(const std::size_t id, const std::string& filename, Containers::Array<char>&& data, std::deque<AsyncFileQueue::Completion>& completed) {
+    const int fd = open(filename.data(), O_WRONLY|O_CREAT|O_TRUNC|O_CLOEXEC, 0666);
+    if(fd == -1) {
+        Error{} << "Utility::AsyncFileQueue::write(): can't open" << filename;
+        completed.push_back({id, false, std::move(data)});
+        return;
+    }
+
+    if(data.empty()) {
+        close(fd);
+        completed.push_back({id, true, std::move(data)});
+        return;
+    }
+
+    submit(new IoUringOperation{id, filename, std::move(data), 0, {}, fd, true}, completed);
+}
+
+void IoUring::submit(IoUringOperation* const operation, std::deque<AsyncFileQueue::Completion>& completed) {
+    /* Wait for a free slot. Resubmitted partial operations are already
+       counted. */
+    if(!operation->offset) {
+        while(_inFlight == Entries) reap(completed, true);
+        ++_inFlight;
+    }
+
+    operation->vector.iov_base = operation->data + operation->offset;
+    operation->vector.iov_len = std::min(operation->data.size() - operation->offset, std::size_t(CORRADE_UTILITY_IO_URING_MAX_TRANSFER_SIZE));
+
+    /* Only this thread writes the tail, the kernel reads it */
+    const unsigned tail = *_sqTail;
+    const unsigned index = tail & _sqMask;
+    io_uring_sqe& sqe = _sqes[index];
+    sqe = io_uring_sqe{};
+    sqe.opcode = operation->write ? IORING_OP_WRITEV : IORING_OP_READV;
+    sqe.fd = operation->fd;
+    sqe.off = operation->offset;
+    sqe.addr = reinterpret_cast<std::uintptr_t>(&operation->vector);
+    sqe.len = 1;
+    sqe.user_data = reinterpret_cast<std::uintptr_t>(operation);
+    _sqArray[index] = index;
+    __atomic_store_n(_sqTail, tail + 1, __ATOMIC_RELEASE);
+
+    for(;;) {
+        const int result = ioUringEnter(_fd, 1, 0, 0);
+        if(result >= 0) break;
+        /* The kernel is out of resources for new submissions, make some
+           room by waiting for the ones in flight */
+        if((errno == EAGAIN || errno == EBUSY) && _inFlight > 1)
+            reap(completed, true);
+        else CORRADE_INTERNAL_ASSERT(errno == EINTR || errno == EAGAIN || errno == EBUSY);
+    }
+}
+
+void IoUring::reap(std::deque<AsyncFileQueue::Completion>& completed, bool wait) {
+    /* Partial transfers get resubmitted only after the loop below is done
+       with the completion queue, as submit() may call reap() again, which
+       would consume the entries this loop didn't get to yet */
+    Containers::Array<IoUringOperation*> partial;
+    const std::size_t completedCount = completed.size();
+
+    for(;;) {
+        /* Only this thread writes the head, the kernel writes the tail */
+        unsigned head = *_cqHead;
+        const unsigned tail = __atomic_load_n(_cqTail, __ATOMIC_ACQUIRE);
+
+        for(; head != tail; ++head) {
+            const io_uring_cqe& cqe = _cqes[head & _cqMask];
+            IoUringOperation* const operation = reinterpret_cast<IoUringOperation*>(cqe.user_data);
+            const int result = cqe.res;
+            __atomic_store_n(_cqHead, head + 1, __ATOMIC_RELEASE);
+
+            if(result < 0) {
+                if(operation->write)
+                    Error{} << "Utility::AsyncFileQueue::write(): can't write to" << operation->filename;
+                else
+                    Error{} << "Utility::AsyncFileQueue::read(): can't read from" << operation->filename;
+            } else {
+                operation->offset += std::size_t(result);
+
+                /* Partial transfer, resubmit the rest once done here */
+                if(result && operation->offset != operation->data.size()) {
+                    Containers::arrayAppend(partial, operation);
+                    continue;
+                }
+
+                /* The file got truncated while reading */
+                if(!operation->write && operation->offset != operation->data.size())
+                    Containers::arrayResize(operation->data, Containers::NoInit, operation->offset);
+            }
+
+            close(operation->fd);
+            /* Failed reads have no data, failed writes give the data back */
+            const bool success = result >= 0 && (!operation->write || operation->offset == operation->data.size());
+            if(!success && !operation->write) operation->data = nullptr;
+            completed.push_back({operation->id, success, std::move(operation->data)});
+            delete operation;
+            --_inFlight;
+        }
+
+        for(IoUringOperation* const operation: partial)
+            submit(operation, completed);
+        Containers::arrayRemoveSuffix(partial, partial.size());
+
+        /* If all entries were partial transfers, there's still nothing to
+           return, wait more */
+        if(!wait || completed.size() != completedCount) return;
+
+        const int result = ioUringEnter(_fd, 0, 1, IORING_ENTER_GETEVENTS);
+        CORRADE_INTERNAL_ASSERT(result >= 0 || errno == EINTR);
+    }
+}
+#endif
+
+}
+
+struct AsyncFileQueue::State {
+    Backend backend;
+    std::size_t nextId{};
+    std::size_t pending{};
+
+    /* Accessed under the mutex with the thread backend */
+    std::deque<Completion> completed;
+
+    #ifndef CORRADE_TARGET_EMSCRIPTEN
+    void work();
+
+    std::mutex mutex;
+    std::condition_variable submittedCondition, completedCondition;
+    std::deque<Operation> submitted;
+    std::vector<std::thread> threads;
+    bool quit{};
+    #endif
+
+    #ifdef CORRADE_UTILITY_USE_IO_URING
+    IoUring ring;
+    #endif
+};
+
+#ifndef CORRADE_TARGET_EMSCRIPTEN
+void AsyncFileQueue::State::work() {
+    for(;;) {
+        Operation operation;
+        {
+            std::unique_lock<std::mutex> lock{mutex};
+            submittedCondition.wait(lock, [this]{ return quit || !submitted.empty(); });
+            if(quit) return;
+            operation = std::move(submitted.front());
+            submitted.pop_front();
+        }
+
+        Completion completion = execute(operation);
+
+        {
+            std::lock_guard<std::mutex> lock{mutex};
+            completed.push_back(std::move(completion));
+        }
+        completedCondition.notify_one();
+    }
+}
+#endif
+
+AsyncFileQueue::AsyncFileQueue(const Backend backend, const std::size_t threadCount): _state{new State} {
+    #ifdef CORRADE_UTILITY_USE_IO_URING
+    if(backend != Backend::Threads && _state->ring.setup()) {
+        _state->backend = Backend::IoUring;
+        return;
+    }
+    #else
+    static_cast<void>(backend);
+    #endif
+
+    _state->backend = Backend::Threads;
+
+    #ifndef CORRADE_TARGET_EMSCRIPTEN
+    const std::size_t count = threadCount ? threadCount :
+        std::max(std::size_t(std::thread::hardware_concurrency()), std::size_t(4));
+    _state->threads.reserve(count);
+    for(std::size_t i = 0; i != count; ++i)
+        _state->threads.emplace_back(&State::work, _state.get());
+    #else
+    static_cast<void>(threadCount);
+    #endif
+}
+
+AsyncFileQueue::~AsyncFileQueue() {
+    #ifndef CORRADE_TARGET_EMSCRIPTEN
+    if(_state->threads.empty()) return;
+
+    {
+        std::lock_guard<std::mutex> lock{_state->mutex};
+        _state->quit = true;
+        _state->submitted.clear();
+    }
+    _state->submittedCondition.notify_all();
+    for(std::thread& thread: _state->threads) thread.join();
+    #endif
+}
+
+AsyncFileQueue::Backend AsyncFileQueue::backend() const { return _state->backend; }
+
+std::size_t AsyncFileQueue::read(const std::string& filename) {
+    const std::size_t id = _state->nextId++;
+    ++_state->pending;
+
+    #ifdef CORRADE_UTILITY_USE_IO_URING
+    if(_state->ring) {
+        _state->ring.read(id, filename, _state->completed);
+        return id;
+    }
+    #endif
+
+    #ifndef CORRADE_TARGET_EMSCRIPTEN
+    {
+        std::lock_guard<std::mutex> lock{_state->mutex};
+        _state->submitted.push_back({id, filename, nullptr, false});
+    }
+    _state->submittedCondition.notify_one();
+    #else
+    Operation operation{id, filename, nullptr, false};
+    _state->completed.push_back(execute(operation));
+    #endif
+    return id;
+}
+
+std::size_t AsyncFileQueue::write(const std::string& filename, Containers::Array<char>&& data) {
+    const std::size_t id = _state->nextId++;
+    ++_state->pending;
+
+    #ifdef CORRADE_UTILITY_USE_IO_URING
+    if(_state->ring) {
+        _state->ring.write(id, filename, std::move(data), _state->completed);
+        return id;
+    }
+    #endif
+
+    #ifndef CORRADE_TARGET_EMSCRIPTEN
+    {
+        std::lock_guard<std::mutex> lock{_state->mutex};
+        _state->submitted.push_back({id, filename, std::move(data), true});
+    }
+    _state->submittedCondition.notify_one();
+    #else
+    Operation operation{id, filename, std::move(data), true};
+    _state->completed.push_back(execute(operation));
+    #endif
+    return id;
+}
+
+std::size_t AsyncFileQueue::pending() const { return _state->pending; }
+
+bool AsyncFileQueue::poll(Completion& completion) {
+    #ifdef CORRADE_UTILITY_USE_IO_URING
+    if(_state->ring) _state->ring.reap(_state->completed, false);
+    #endif
+
+    #ifndef CORRADE_TARGET_EMSCRIPTEN
+    std::unique_lock<std::mutex> lock{_state->mutex, std::defer_lock};
+    if(!_state->threads.empty()) lock.lock();
+    #endif
+
+    if(_state->completed.empty()) return false;
+
+    completion = std::move(_state->completed.front());
+    _state->completed.pop_front();
+    --_state->pending;
+    return true;
+}
+
+AsyncFileQueue::Completion AsyncFileQueue::wait() {
+    CORRADE_ASSERT(_state->pending,
+        "Utility::AsyncFileQueue::wait(): no pending operations", (Completion{0, false, nullptr}));
+
+    #ifdef CORRADE_UTILITY_USE_IO_URING
+    if(_state->ring && _state->completed.empty())
+        _state->ring.reap(_state->completed, true);
+    #endif
+
+    #ifndef CORRADE_TARGET_EMSCRIPTEN
+    std::unique_lock<std::mutex> lock{_state->mutex, std::defer_lock};
+    if(!_state->threads.empty()) {
+        lock.lock();
+        _state->completedCondition.wait(lock, [this]{ return !_state->completed.empty(); });
+    }
+    #endif
+
+    Completion completion = std::move(_state->completed.front());
+    _state->completed.pop_front();
+    --_state->pending;
+    return completion;
+}
+
+}}
@@ -0,0 +1,220 @@
+#ifndef Corrade_Utility_AsyncFileQueue_h
+#define Corrade_Utility_AsyncFileQueue_h
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Corrade::Utility::AsyncFileQueue
+ */
+
+#include <cstddef>
+#include <memory>
+#include <string>
+
+#include "Corrade/Containers/Array.h"
+#include "Corrade/Utility/visibility.h"
+
+namespace Corrade { namespace Utility {
+
+/**
+@brief Asynchronous file queue
+
+Submits file reads and writes without blocking the calling thread and
+delivers the results through a completion queue. Useful for example for
+loading a large amount of small files at once, where looping over
+@ref Directory::read() would serialize all the I/O:
+
+@code{.cpp}
+Utility::AsyncFileQueue queue;
+for(const std::string& file: files) queue.read(file);
+
+while(queue.pending()) {
+    Utility::AsyncFileQueue::Completion completion = queue.wait();
+    if(!completion.success) continue;
+
+    // process completion.data of a file with ID completion.id ...
+}
+@endcode
+
+Each submission returns a numeric ID, which is then present in the
+corresponding @ref Completion. IDs are assigned sequentially starting from
+@cpp 0 @ce. The completions are delivered in the order in which the
+operations finished, which is not necessarily the order of submission.
+
+@section Utility-AsyncFileQueue-backends Backends
+
+On Linux the queue uses [io_uring](https://kernel.dk/io_uring.pdf) if the
+running kernel supports it, submitting all requests to the kernel directly
+without any intermediate threads. Otherwise, and on all other platforms, the
+operations are executed on a pool of worker threads. The used backend can be
+queried with @ref backend() and the thread backend can be explicitly requested
+by passing @ref Backend::Threads to the constructor. In
+@ref CORRADE_TARGET_EMSCRIPTEN "Emscripten", where threads are not available,
+the operations are executed directly in @ref read() and @ref write().
+
+The queue itself is not thread-safe, it's expected to be used from a single
+thread. With the thread backend, error messages for failed operations are
+printed from the worker threads.
+*/
+class CORRADE_UTILITY_EXPORT AsyncFileQueue {
+    public:
+        /**
+         * @brief Backend
+         *
+         * @see @ref AsyncFileQueue(), @ref backend()
+         */
+        enum class Backend: unsigned char {
+            /**
+             * Use @ref Backend::IoUring if available, @ref Backend::Threads
+             * otherwise.
+             */
+            Automatic,
+
+            /**
+             * Linux io_uring. Falls back to @ref Backend::Threads if not
+             * supported by the platform or the running kernel.
+             */
+            IoUring,
+
+            /** Pool of worker threads */
+            Threads
+        };
+
+        /**
+         * @brief Completed operation
+         *
+         * @see @ref poll(), @ref wait()
+         */
+        struct Completion {
+            /** @brief ID returned from @ref read() or @ref write() */
+            std::size_t id;
+
+            /**
+             * @brief Whether the operation succeeded
+             *
+             * If @cpp false @ce, a message was printed to @ref Error.
+             */
+            bool success;
+
+            /**
+             * @brief Data
+             *
+             * Contents of the file for a successful read, @cpp nullptr @ce
+             * for a failed one. For writes the data passed to @ref write()
+             * are returned back, so the memory can be reused.
+             */
+            Containers::Array<char> data;
+        };
+
+        /**
+         * @brief Constructor
+         * @param backend       Backend to use
+         * @param threadCount   Worker thread count for @ref Backend::Threads.
+         *      If @cpp 0 @ce, @ref std::thread::hardware_concurrency() is
+         *      used, but at least four threads are always created as the
+         *      workers spend most of the time waiting for I/O.
+         */
+        explicit AsyncFileQueue(Backend backend = Backend::Automatic, std::size_t threadCount = 0);
+
+        /** @brief Copying is not allowed */
+        AsyncFileQueue(const AsyncFileQueue&) = delete;
+
+        /** @brief Moving is not allowed */
+        AsyncFileQueue(AsyncFileQueue&&) = delete;
+
+        /**
+         * @brief Destructor
+         *
+         * Waits for all operations that are already in progress to finish,
+         * operations that weren't started yet are discarded.
+         */
+        ~AsyncFileQueue();
+
+        /** @brief Copying is not allowed */
+        AsyncFileQueue& operator=(const AsyncFileQueue&) = delete;
+
+        /** @brief Moving is not allowed */
+        AsyncFileQueue& operator=(AsyncFileQueue&&) = delete;
+
+        /**
+         * @brief Used backend
+         *
+         * Never @ref Backend::Automatic.
+         */
+        Backend backend() const;
+
+        /**
+         * @brief Submit a file read
+         *
+         * Reads the whole file as binary (i.e. without newline conversion).
+         * Returns ID of the operation. Expects that the filename is in UTF-8.
+         * @see @ref Directory::read()
+         */
+        std::size_t read(const std::string& filename);
+
+        /**
+         * @brief Submit a file write
+         *
+         * Writes @p data into the file as binary (i.e. without newline
+         * conversion), replacing any previous contents. Returns ID of the
+         * operation. Expects that the filename is in UTF-8.
+         * @see @ref Directory::write()
+         */
+        std::size_t write(const std::string& filename, Containers::Array<char>&& data);
+
+        /**
+         * @brief Count of pending operations
+         *
+         * Count of operations that were submitted but whose completion
+         * wasn't retrieved yet using @ref poll() or @ref wait().
+         */
+        std::size_t pending() const;
+
+        /**
+         * @brief Poll for a completed operation
+         *
+         * If there's a completed operation, moves it to @p completion and
+         * returns @cpp true @ce. Otherwise returns @cpp false @ce without
+         * blocking.
+         */
+        bool poll(Completion& completion);
+
+        /**
+         * @brief Wait for a completed operation
+         *
+         * Blocks until any of the pending operations is completed and
+         * returns it. Expects that @ref pending() is not zero.
+         */
+        Completion wait();
+
+    private:
+        struct State;
+
+        std::unique_ptr<State> _state;
+};
+
+}}
+
+#endif
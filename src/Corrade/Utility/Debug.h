@@ -36,6 +36,7 @@
 
 #include "Corrade/Utility/Macros.h"
 #include "Corrade/Containers/EnumSet.h"
+#include "Corrade/Containers/sequenceHelpers.h"
 #include "Corrade/Utility/TypeTraits.h"
 #include "Corrade/Utility/Utility.h"
 #include "Corrade/Utility/visibility.h"
@@ -610,26 +611,13 @@ template<class Iterable> Debug& operator<<(typename std::enable_if<IsIterable<It
 }
 
 namespace Implementation {
-    /** @todo C++14: use std::make_index_sequence and std::integer_sequence */
-    template<std::size_t ...> struct Sequence {};
-
-    #ifndef DOXYGEN_GENERATING_OUTPUT
-    /* E.g. GenerateSequence<3>::Type is Sequence<0, 1, 2> */
-    template<std::size_t N, std::size_t ...sequence> struct GenerateSequence:
-        GenerateSequence<N-1, N-1, sequence...> {};
-
-    template<std::size_t ...sequence> struct GenerateSequence<0, sequence...> {
-        typedef Sequence<sequence...> Type;
-    };
-    #endif
-
     /* Used by operator<<(Debug&, std::tuple<>...) */
-    template<class T> inline void tupleDebugOutput(Debug&, const T&, Sequence<>) {}
-    template<class T, std::size_t i, std::size_t ...sequence> void tupleDebugOutput(Debug& debug, const T& tuple, Sequence<i, sequence...>) {
+    template<class T> inline void tupleDebugOutput(Debug&, const T&, Containers::Implementation::Sequence<>) {}
+    template<class T, std::size_t i, std::size_t ...sequence> void tupleDebugOutput(Debug& debug, const T& tuple, Containers::Implementation::Sequence<i, sequence...>) {
         debug << std::get<i>(tuple);
         if(i + 1 != std::tuple_size<T>::value)
             debug << Debug::nospace << ",";
-        tupleDebugOutput(debug, tuple, Sequence<sequence...>{});
+        tupleDebugOutput(debug, tuple, Containers::Implementation::Sequence<sequence...>{});
     }
 }
 
@@ -640,7 +628,7 @@ Prints the value as @cb{.shell-session} (first, second, third...) @ce.
 */
 template<class ...Args> Debug& operator<<(Debug& debug, const std::tuple<Args...>& value) {
     debug << "(" << Debug::nospace;
-    Implementation::tupleDebugOutput(debug, value, typename Implementation::GenerateSequence<sizeof...(Args)>::Type{});
+    Implementation::tupleDebugOutput(debug, value, typename Containers::Implementation::GenerateSequence<sizeof...(Args)>::Type{});
     debug << Debug::nospace << ")";
     return debug;
 }
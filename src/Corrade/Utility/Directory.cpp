@@ -33,14 +33,26 @@
 
 #include <cstdio>
 #include <cstdlib>
-#include <array>
+#include <cstring>
 #include <algorithm>
+#include <deque>
 #include <fstream>
 
-/* Unix memory mapping */
+/* Unix memory mapping, vectored writes */
 #ifdef CORRADE_TARGET_UNIX
+#include <cerrno>
+#include <climits>
 #include <fcntl.h>
 #include <sys/mman.h>
+#include <sys/uio.h>
+#endif
+
+/* Linux in-kernel file copy */
+#ifdef __linux__
+#include <linux/fs.h>
+#include <sys/ioctl.h>
+#include <sys/sendfile.h>
+#include <sys/syscall.h>
 #endif
 
 /* Unix, Emscripten directory access */
@@ -67,9 +79,17 @@
 #endif
 
 #include "Corrade/configure.h"
-#include "Corrade/Containers/Array.h"
+#include "Corrade/Containers/GrowableArray.h"
+#include "Corrade/Containers/Optional.h"
+#include "Corrade/Utility/Assert.h"
 #include "Corrade/Utility/String.h"
 
+#ifndef CORRADE_TARGET_EMSCRIPTEN
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#endif
+
 /* Unicode helpers for Windows */
 #ifdef CORRADE_TARGET_WINDOWS
 #include "Corrade/Utility/Unicode.h"
@@ -206,6 +226,167 @@ bool move(const std::string& oldPath, const std::string& newPath) {
         == 0;
 }
 
+#ifdef CORRADE_TARGET_UNIX
+namespace {
+
+/* Plain read() / write() loop for systems and filesystems where none of the
+   in-kernel copy methods is available. Offsets of both descriptors are
+   expected to be at the same position. */
+bool copyStreaming(const int in, const int out) {
+    char buffer[64*1024];
+    for(;;) {
+        const ssize_t read = ::read(in, buffer, sizeof(buffer));
+        if(read == 0) return true;
+        if(read < 0) {
+            if(errno == EINTR) continue;
+            return false;
+        }
+
+        for(ssize_t written = 0; written != read; ) {
+            const ssize_t result = ::write(out, buffer + written, read - written);
+            if(result < 0) {
+                if(errno == EINTR) continue;
+                return false;
+            }
+            written += result;
+        }
+    }
+}
+
+bool copyFile(const int in, const struct stat& st, const int out) {
+    /* Non-regular files (pipes, /proc) report no or bogus size */
+    if(!S_ISREG(st.st_mode)) return copyStreaming(in, out);
+
+    #ifdef __linux__
+    /* Reflink on copy-on-write filesystems (Btrfs, XFS), which shares the
+       extents instead of copying the data */
+    #ifdef FICLONE
+    if(ioctl(out, FICLONE, in) == 0) return true;
+    #endif
+
+    /* In-kernel copy, which can also be offloaded to the storage or done
+       server-side on network filesystems. Calling the syscall directly as the
+       glibc wrapper is only since 2.27. Fails with EXDEV across filesystems
+       before Linux 5.3 and with ENOSYS before 4.5, falling back to
+       sendfile() in that case. */
+    std::size_t remaining = std::size_t(st.st_size);
+    #ifdef __NR_copy_file_range
+    while(remaining) {
+        const ssize_t result = syscall(__NR_copy_file_range, in, nullptr, out, nullptr, remaining, 0);
+        if(result < 0) {
+            if(errno == EINTR) continue;
+            if(remaining != std::size_t(st.st_size)) return false;
+            break;
+        }
+        /* The file got truncated while copying */
+        if(result == 0) return true;
+        remaining -= std::size_t(result);
+    }
+    if(!remaining) return true;
+    #endif
+
+    /* sendfile() to a regular file is supported since Linux 2.6.33 */
+    while(remaining) {
+        const ssize_t result = sendfile(out, in, nullptr, remaining);
+        if(result < 0) {
+            if(errno == EINTR) continue;
+            if(remaining != std::size_t(st.st_size)) return false;
+            break;
+        }
+        if(result == 0) return true;
+        remaining -= std::size_t(result);
+    }
+    if(!remaining) return true;
+    #endif
+
+    return copyStreaming(in, out);
+}
+
+}
+#endif
+
+bool copy(const std::string& from, const std::string& to) {
+    /* Unix */
+    #ifdef CORRADE_TARGET_UNIX
+    const int in = open(from.data(), O_RDONLY|O_CLOEXEC);
+    if(in == -1) {
+        Error{} << "Utility::Directory::copy(): can't open" << from;
+        return false;
+    }
+
+    /* Not truncating right away, as the destination might be the same file */
+    const int out = open(to.data(), O_WRONLY|O_CREAT|O_CLOEXEC, 0666);
+    if(out == -1) {
+        Error{} << "Utility::Directory::copy(): can't open" << to;
+        close(in);
+        return false;
+    }
+
+    struct stat inStat, outStat;
+    bool success = fstat(in, &inStat) == 0 && fstat(out, &outStat) == 0;
+    if(success && inStat.st_dev == outStat.st_dev && inStat.st_ino == outStat.st_ino) {
+        Error{} << "Utility::Directory::copy():" << from << "and" << to << "are the same file";
+        close(in);
+        close(out);
+        return false;
+    }
+
+    success = success && ftruncate(out, 0) == 0 && copyFile(in, inStat, out);
+    close(in);
+    close(out);
+    if(!success) {
+        Error{} << "Utility::Directory::copy(): can't copy" << from << "to" << to;
+        return false;
+    }
+
+    return true;
+
+    /* Windows (not Store/Phone) */
+    #elif defined(CORRADE_TARGET_WINDOWS) && !defined(CORRADE_TARGET_WINDOWS_RT)
+    if(!CopyFileW(widen(from).data(), widen(to).data(), false)) {
+        Error{} << "Utility::Directory::copy(): can't copy" << from << "to" << to;
+        return false;
+    }
+
+    return true;
+
+    /* Emscripten, Windows Store/Phone */
+    #else
+    #ifndef CORRADE_TARGET_WINDOWS
+    std::ifstream in{from, std::ifstream::binary};
+    #else
+    std::ifstream in{widen(from), std::ifstream::binary};
+    #endif
+    if(!in) {
+        Error{} << "Utility::Directory::copy(): can't open" << from;
+        return false;
+    }
+
+    #ifndef CORRADE_TARGET_WINDOWS
+    std::ofstream out{to, std::ofstream::binary};
+    #else
+    std::ofstream out{widen(to), std::ofstream::binary};
+    #endif
+    if(!out) {
+        Error{} << "Utility::Directory::copy(): can't open" << to;
+        return false;
+    }
+
+    char buffer[64*1024];
+    do {
+        in.read(buffer, sizeof(buffer));
+        out.write(buffer, in.gcount());
+    } while(in && out);
+
+    if(in.bad() || !out) {
+        Error{} << "Utility::Directory::copy(): can't copy" << from << "to" << to;
+        return false;
+    }
+
+    return true;
+    #endif
+}
+
 bool fileExists(const std::string& filename) {
     /* Sane platforms */
     #ifndef CORRADE_TARGET_WINDOWS
@@ -436,6 +617,293 @@ std::vector<std::string> list(const std::string& path, Flags flags) {
     return list;
 }
 
+namespace {
+
+/* Contents of a single directory. Path offsets of the entries are relative to
+   the local paths, children contain for each entry an index of the listing
+   with its contents or ~0 if it's not a directory. */
+struct WalkListing {
+    std::vector<TreeEntry> entries;
+    std::string paths;
+    std::vector<std::size_t> children;
+};
+
+#if defined(CORRADE_TARGET_UNIX) || defined(CORRADE_TARGET_EMSCRIPTEN)
+std::int64_t modificationTime(const struct stat& st) {
+    #ifdef CORRADE_TARGET_APPLE
+    const timespec& time = st.st_mtimespec;
+    #else
+    const timespec& time = st.st_mtim;
+    #endif
+    return std::int64_t(time.tv_sec)*1000000000ll + time.tv_nsec;
+}
+#endif
+
+bool walkDirectory(const std::string& root, const std::string& prefix, const WalkFlags flags, WalkListing& out) {
+    const std::string directoryPath = prefix.empty() ? root : join(root, prefix);
+
+    /* POSIX-compliant Unix, Emscripten */
+    #if defined(CORRADE_TARGET_UNIX) || defined(CORRADE_TARGET_EMSCRIPTEN)
+    DIR* directory = opendir(directoryPath.data());
+    if(!directory) return false;
+    const int fd = dirfd(directory);
+
+    dirent* entry;
+    while((entry = readdir(directory)) != nullptr) {
+        const char* const name = entry->d_name;
+        if(name[0] == '.' && (name[1] == '\0' || (name[1] == '.' && name[2] == '\0')))
+            continue;
+
+        TreeEntry item{};
+        bool needsStat = !(flags & WalkFlag::SkipMetadata);
+        bool hasType = true;
+        /* Emscripten reports only DT_DIR reliably */
+        #ifndef CORRADE_TARGET_EMSCRIPTEN
+        switch(entry->d_type) {
+            case DT_REG: item.type = EntryType::File; break;
+            case DT_DIR: item.type = EntryType::Directory; break;
+            case DT_LNK: item.type = EntryType::Symlink; break;
+            case DT_UNKNOWN: needsStat = true; hasType = false; break;
+            default: item.type = EntryType::Special;
+        }
+        #else
+        needsStat = true;
+        hasType = false;
+        #endif
+
+        if(needsStat) {
+            struct stat st;
+            /* If the entry can't be queried (for example because it got
+               deleted in the meantime), keep it with zero metadata instead
+               of dropping it. If the listing didn't provide its type
+               either, report it as special. */
+            if(fstatat(fd, name, &st, AT_SYMLINK_NOFOLLOW) != 0) {
+                if(!hasType) item.type = EntryType::Special;
+            } else {
+                if(S_ISREG(st.st_mode)) item.type = EntryType::File;
+                else if(S_ISDIR(st.st_mode)) item.type = EntryType::Directory;
+                else if(S_ISLNK(st.st_mode)) item.type = EntryType::Symlink;
+                else item.type = EntryType::Special;
+
+                if(!(flags & WalkFlag::SkipMetadata)) {
+                    item.size = std::uint64_t(st.st_size);
+                    item.modificationTime = modificationTime(st);
+                }
+            }
+        }
+
+        item.pathOffset = out.paths.size();
+        if(!prefix.empty()) {
+            out.paths += prefix;
+            out.paths += '/';
+        }
+        out.paths += name;
+        item.pathSize = out.paths.size() - item.pathOffset;
+        out.paths += '\0';
+        out.entries.push_back(item);
+    }
+
+    closedir(directory);
+
+    /* Windows (not Store/Phone) */
+    #elif defined(CORRADE_TARGET_WINDOWS) && !defined(CORRADE_TARGET_WINDOWS_RT)
+    WIN32_FIND_DATAW data;
+    HANDLE hFile = FindFirstFileExW(widen(join(directoryPath, "*")).data(), FindExInfoBasic, &data, FindExSearchNameMatch, nullptr, 0);
+    if(hFile == INVALID_HANDLE_VALUE) return false;
+
+    do {
+        const wchar_t* const name = data.cFileName;
+        if(name[0] == L'.' && (name[1] == L'\0' || (name[1] == L'.' && name[2] == L'\0')))
+            continue;
+
+        TreeEntry item{};
+        if(data.dwFileAttributes & FILE_ATTRIBUTE_REPARSE_POINT)
+            item.type = EntryType::Symlink;
+        else if(data.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY)
+            item.type = EntryType::Directory;
+        else item.type = EntryType::File;
+
+        if(!(flags & WalkFlag::SkipMetadata)) {
+            item.size = std::uint64_t(data.nFileSizeHigh) << 32 | data.nFileSizeLow;
+            /* FILETIME is in 100 ns units since 1601 */
+            const std::int64_t time = std::int64_t(std::uint64_t(data.ftLastWriteTime.dwHighDateTime) << 32 | data.ftLastWriteTime.dwLowDateTime);
+            item.modificationTime = (time - 116444736000000000ll)*100;
+        }
+
+        item.pathOffset = out.paths.size();
+        if(!prefix.empty()) {
+            out.paths += prefix;
+            out.paths += '/';
+        }
+        out.paths += narrow(name);
+        item.pathSize = out.paths.size() - item.pathOffset;
+        out.paths += '\0';
+        out.entries.push_back(item);
+    } while(FindNextFileW(hFile, &data) != 0);
+
+    FindClose(hFile);
+
+    /* Other not implemented */
+    #else
+    static_cast<void>(directoryPath);
+    static_cast<void>(flags);
+    static_cast<void>(out);
+    return false;
+    #endif
+
+    if(flags & WalkFlag::SortAscending) {
+        const char* const paths = out.paths.data();
+        std::sort(out.entries.begin(), out.entries.end(), [paths](const TreeEntry& a, const TreeEntry& b) {
+            return std::strcmp(paths + a.pathOffset, paths + b.pathOffset) < 0;
+        });
+    }
+
+    out.children.assign(out.entries.size(), ~std::size_t{});
+    return true;
+}
+
+struct Walk {
+    /* Listings are only ever appended, std::deque keeps references to them
+       valid */
+    std::deque<WalkListing> listings;
+    /* Listing index and path of directories to list */
+    std::deque<std::pair<std::size_t, std::string>> queue;
+
+    #ifndef CORRADE_TARGET_EMSCRIPTEN
+    std::size_t active{};
+    std::mutex mutex;
+    std::condition_variable condition;
+    #endif
+
+    /* Reserves a listing for each subdirectory and queues it */
+    void enqueueSubdirectories(WalkListing& listing);
+
+    void work(const std::string& root, WalkFlags flags);
+    #ifndef CORRADE_TARGET_EMSCRIPTEN
+    void workParallel(const std::string& root, WalkFlags flags);
+    #endif
+};
+
+void Walk::enqueueSubdirectories(WalkListing& listing) {
+    for(std::size_t i = 0; i != listing.entries.size(); ++i) {
+        if(listing.entries[i].type != EntryType::Directory) continue;
+        listing.children[i] = listings.size();
+        listings.emplace_back();
+        queue.emplace_back(listing.children[i], std::string{listing.paths.data() + listing.entries[i].pathOffset, listing.entries[i].pathSize});
+    }
+}
+
+void Walk::work(const std::string& root, const WalkFlags flags) {
+    while(!queue.empty()) {
+        const std::pair<std::size_t, std::string> job = std::move(queue.front());
+        queue.pop_front();
+
+        WalkListing listing;
+        if(!walkDirectory(root, job.second, flags, listing))
+            Warning{} << "Utility::Directory::walk(): can't list" << join(root, job.second) << Debug::nospace << ", skipping its contents";
+        enqueueSubdirectories(listing);
+        listings[job.first] = std::move(listing);
+    }
+}
+
+#ifndef CORRADE_TARGET_EMSCRIPTEN
+void Walk::workParallel(const std::string& root, const WalkFlags flags) {
+    for(;;) {
+        std::pair<std::size_t, std::string> job;
+        {
+            std::unique_lock<std::mutex> lock{mutex};
+            condition.wait(lock, [this]{ return !queue.empty() || !active; });
+            /* Nothing queued and nobody who could queue more, done */
+            if(queue.empty()) return;
+            job = std::move(queue.front());
+            queue.pop_front();
+            ++active;
+        }
+
+        WalkListing listing;
+        const bool listed = walkDirectory(root, job.second, flags, listing);
+
+        {
+            std::lock_guard<std::mutex> lock{mutex};
+            /* Printed under the lock so messages from different threads
+               don't interleave */
+            if(!listed)
+                Warning{} << "Utility::Directory::walk(): can't list" << join(root, job.second) << Debug::nospace << ", skipping its contents";
+            enqueueSubdirectories(listing);
+            listings[job.first] = std::move(listing);
+            --active;
+        }
+        condition.notify_all();
+    }
+}
+#endif
+
+/* Appends a listing and, recursively, listings of its subdirectories right
+   after their entry */
+void walkFlatten(const std::deque<WalkListing>& listings, const std::size_t index, Containers::ArrayView<TreeEntry> entries, std::size_t& entryOffset, Containers::ArrayView<char> paths, std::size_t& pathOffset) {
+    const WalkListing& listing = listings[index];
+    const std::size_t listingPathOffset = pathOffset;
+    std::copy(listing.paths.begin(), listing.paths.end(), paths.begin() + pathOffset);
+    pathOffset += listing.paths.size();
+
+    for(std::size_t i = 0; i != listing.entries.size(); ++i) {
+        TreeEntry& entry = entries[entryOffset++];
+        entry = listing.entries[i];
+        entry.pathOffset += listingPathOffset;
+        if(listing.children[i] != ~std::size_t{})
+            walkFlatten(listings, listing.children[i], entries, entryOffset, paths, pathOffset);
+    }
+}
+
+Tree walkFlatten(const std::deque<WalkListing>& listings) {
+    std::size_t entryCount = 0, pathSize = 0;
+    for(const WalkListing& listing: listings) {
+        entryCount += listing.entries.size();
+        pathSize += listing.paths.size();
+    }
+
+    Containers::Array<TreeEntry> entries{Containers::NoInit, entryCount};
+    Containers::Array<char> paths{Containers::NoInit, pathSize};
+    std::size_t entryOffset = 0, pathOffset = 0;
+    walkFlatten(listings, 0, entries, entryOffset, paths, pathOffset);
+    return Tree{std::move(entries), std::move(paths)};
+}
+
+}
+
+Containers::Optional<Tree> walk(const std::string& path, const WalkFlags flags, std::size_t threadCount) {
+    WalkListing root;
+    if(!walkDirectory(path, {}, flags, root)) {
+        Error{} << "Utility::Directory::walk(): can't open" << path;
+        return Containers::NullOpt;
+    }
+
+    Walk walk;
+    walk.listings.emplace_back();
+    walk.enqueueSubdirectories(root);
+    walk.listings.front() = std::move(root);
+
+    #ifndef CORRADE_TARGET_EMSCRIPTEN
+    if(!threadCount) threadCount = std::max(std::thread::hardware_concurrency(), 1u);
+    if(threadCount > 1) {
+        /* The calling thread is one of the workers */
+        std::vector<std::thread> threads;
+        threads.reserve(threadCount - 1);
+        for(std::size_t i = 0; i != threadCount - 1; ++i)
+            threads.emplace_back(&Walk::workParallel, &walk, std::cref(path), flags);
+        walk.workParallel(path, flags);
+        for(std::thread& thread: threads) thread.join();
+    } else
+    #else
+    static_cast<void>(threadCount);
+    #endif
+    {
+        walk.work(path, flags);
+    }
+
+    return walkFlatten(walk.listings);
+}
+
 Containers::Array<char> read(const std::string& filename) {
     /* Sane platforms */
     #ifndef CORRADE_TARGET_WINDOWS
@@ -480,19 +948,19 @@ Containers::Array<char> read(const std::string& filename) {
         return data;
     }
 
-    /* Probably non-seekable (or empty) file, clear badbit and read by chunks.
-       Hopefully this juggling won't cause any needless memory allocations for
-       empty files. */
+    /* Probably non-seekable (or empty) file, clear badbit and read by chunks
+       directly into a growable array, which avoids an extra copy at the end.
+       Nothing gets allocated for empty files. */
     file.clear();
-    std::string data;
-    std::array<char, 4096> buffer;
+    Containers::Array<char> out;
     do {
-        file.read(&buffer[0], buffer.size());
-        data.append(&buffer[0], std::size_t(file.gcount()));
+        Containers::ArrayView<char> chunk = arrayAppend(out, Containers::NoInit, 4096);
+        file.read(chunk, chunk.size());
+        arrayRemoveSuffix(out, chunk.size() - std::size_t(file.gcount()));
     } while(file);
 
-    Containers::Array<char> out(data.size());
-    std::copy(data.begin(), data.end(), out.begin());
+    /* Don't return a zero-sized allocation for empty files */
+    if(out.empty()) return nullptr;
 
     return out;
 }
@@ -503,53 +971,383 @@ std::string readString(const std::string& filename) {
     return {data, data.size()};
 }
 
-bool write(const std::string& filename, const Containers::ArrayView<const void> data) {
+namespace {
+
+/* Reads until the chunk is full or the file ends, returns the number of bytes
+   read or -1 on error */
+std::ptrdiff_t readChunk(std::istream& file, const Containers::ArrayView<char> chunk) {
+    file.read(chunk, chunk.size());
+    if(file.bad()) return -1;
+    return file.gcount();
+}
+
+#ifndef CORRADE_TARGET_EMSCRIPTEN
+/* Double-buffered reading, chunk i is read into buffer i % 2 by a background
+   thread while the calling thread processes chunk i - 1 */
+struct ReadAhead {
+    explicit ReadAhead(std::size_t chunkSize): buffers{Containers::Array<char>{Containers::NoInit, chunkSize}, Containers::Array<char>{Containers::NoInit, chunkSize}} {}
+
+    void run(std::istream& file) {
+        const std::size_t chunkSize = buffers[0].size();
+        for(std::size_t i = 0; ; ++i) {
+            {
+                std::unique_lock<std::mutex> lock{mutex};
+                condition.wait(lock, [&]() { return consumed + 2 > i || stopped; });
+                if(stopped) break;
+            }
+
+            const std::ptrdiff_t size = readChunk(file, buffers[i % 2]);
+
+            std::lock_guard<std::mutex> lock{mutex};
+            if(size > 0) {
+                sizes[i % 2] = std::size_t(size);
+                produced = i + 1;
+            }
+            if(size < std::ptrdiff_t(chunkSize)) {
+                failed = size < 0;
+                finished = true;
+            }
+            condition.notify_all();
+            if(finished) break;
+        }
+    }
+
+    std::mutex mutex;
+    std::condition_variable condition;
+    Containers::Array<char> buffers[2];
+    std::size_t sizes[2]{};
+    std::size_t produced{}, consumed{};
+    bool finished{}, failed{}, stopped{};
+};
+#endif
+
+}
+
+bool readChunks(const std::string& filename, const std::size_t chunkSize, bool(*const callback)(Containers::ArrayView<const char>, void*), void* const state, const ReadChunksFlags flags) {
+    CORRADE_ASSERT(chunkSize,
+        "Utility::Directory::readChunks(): chunk size can't be zero", false);
+
     /* Sane platforms */
     #ifndef CORRADE_TARGET_WINDOWS
-    std::ofstream file{filename, std::ofstream::binary};
+    std::ifstream file{filename, std::ifstream::binary};
 
     /* MSVC */
     #elif !defined(__MINGW32__)
-    std::ofstream file{widen(filename), std::ifstream::binary};
+    std::ifstream file{widen(filename), std::ifstream::binary};
 
-    /* MinGW */
+    /* MinGW, see read() for details */
     #else
-    /* http://stackoverflow.com/q/6524821, http://stackoverflow.com/a/30263811,
-       but I'm not sure if filebuf should be stack- or heap-allocated */
-    /* https://gcc.gnu.org/onlinedocs/gcc-4.6.2/libstdc++/api/a00069.html#a1dcd5a3e751c566a4b9b3e851ce92b30
-       says that the file descriptor returned by _wopen will be closed
-       automatically on destruction */
-    const int fd = _wopen(widen(filename).data(), _O_CREAT|_O_TRUNC|_O_WRONLY|_O_BINARY, 0666);
+    const int fd = _wopen(widen(filename).data(), _O_RDONLY|_O_BINARY, 0666);
+    if(fd == -1) {
+        Error{} << "Utility::Directory::readChunks(): can't open" << filename;
+        return false;
+    }
+    __gnu_cxx::stdio_filebuf<char> filebuf{fd, std::ifstream::in|std::ifstream::binary};
+    std::istream file{&filebuf};
+    #endif
+
+    if(!file) {
+        Error{} << "Utility::Directory::readChunks(): can't open" << filename;
+        return false;
+    }
+
+    #ifndef CORRADE_TARGET_EMSCRIPTEN
+    if(flags & ReadChunksFlag::ReadAhead) {
+        ReadAhead readAhead{chunkSize};
+        std::thread thread{&ReadAhead::run, &readAhead, std::ref(file)};
+
+        bool failed = false;
+        for(std::size_t i = 0; ; ++i) {
+            std::unique_lock<std::mutex> lock{readAhead.mutex};
+            readAhead.condition.wait(lock, [&]() { return readAhead.produced > i || readAhead.finished; });
+            if(readAhead.produced <= i) {
+                failed = readAhead.failed;
+                break;
+            }
+            lock.unlock();
+
+            const bool next = callback(readAhead.buffers[i % 2].prefix(readAhead.sizes[i % 2]), state);
+
+            lock.lock();
+            readAhead.consumed = i + 1;
+            if(!next) readAhead.stopped = true;
+            readAhead.condition.notify_all();
+            if(!next) break;
+        }
+
+        thread.join();
+        if(failed) {
+            Error{} << "Utility::Directory::readChunks(): can't read" << filename;
+            return false;
+        }
+        return true;
+    }
+    #else
+    static_cast<void>(flags);
+    #endif
+
+    Containers::Array<char> buffer{Containers::NoInit, chunkSize};
+    for(;;) {
+        const std::ptrdiff_t size = readChunk(file, buffer);
+        if(size < 0) {
+            Error{} << "Utility::Directory::readChunks(): can't read" << filename;
+            return false;
+        }
+        if(size && !callback(buffer.prefix(std::size_t(size)), state)) break;
+        if(std::size_t(size) < chunkSize) break;
+    }
+
+    return true;
+}
+
+namespace {
+
+bool writeInternal(const char* const prefix, const std::string& filename, const Containers::ArrayView<const Containers::ArrayView<const void>> data, const WriteFlags flags, const bool append) {
+    /* Unix */
+    #ifdef CORRADE_TARGET_UNIX
+    const int fd = open(filename.data(), O_WRONLY|O_CREAT|O_CLOEXEC|(append ? O_APPEND : O_TRUNC), 0666);
     if(fd == -1) {
-        Error{} << "Utility::Directory::write(): can't open" << filename;
+        Error{} << prefix << "can't open" << filename;
         return false;
     }
-    __gnu_cxx::stdio_filebuf<char> filebuf{fd, std::ofstream::out|std::ofstream::binary};
-    std::ostream file{&filebuf};
+
+    /* Submit the views in batches of at most IOV_MAX */
+    #ifdef IOV_MAX
+    constexpr std::size_t MaxVectors = IOV_MAX < 1024 ? IOV_MAX : 1024;
+    #else
+    constexpr std::size_t MaxVectors = 16;
     #endif
+    iovec vectors[MaxVectors];
+    bool success = true;
+    for(std::size_t i = 0; success && i != data.size(); ) {
+        std::size_t count = 0;
+        for(; count != MaxVectors && i + count != data.size(); ++count) {
+            vectors[count].iov_base = const_cast<void*>(data[i + count].data());
+            vectors[count].iov_len = data[i + count].size();
+        }
+        i += count;
+
+        iovec* current = vectors;
+        while(count) {
+            const ssize_t written = writev(fd, current, int(count));
+            if(written < 0) {
+                if(errno == EINTR) continue;
+                success = false;
+                break;
+            }
+
+            /* Skip what was written and continue from where it stopped */
+            std::size_t remaining = std::size_t(written);
+            while(count && remaining >= current->iov_len) {
+                remaining -= current->iov_len;
+                ++current;
+                --count;
+            }
+            if(count) {
+                current->iov_base = static_cast<char*>(current->iov_base) + remaining;
+                current->iov_len -= remaining;
+            }
+        }
+    }
 
+    if(success && (flags & WriteFlag::Sync)) {
+        /* Not available on Apple platforms */
+        #ifndef CORRADE_TARGET_APPLE
+        success = fdatasync(fd) == 0;
+        #else
+        success = fsync(fd) == 0;
+        #endif
+    }
+
+    /* Errors from delayed writes on network filesystems are reported only on
+       close */
+    if(close(fd) != 0) success = false;
+
+    /* Windows (not Store/Phone) */
+    #elif defined(CORRADE_TARGET_WINDOWS) && !defined(CORRADE_TARGET_WINDOWS_RT)
+    HANDLE file = CreateFileW(widen(filename).data(),
+        append ? FILE_APPEND_DATA : GENERIC_WRITE, FILE_SHARE_READ, nullptr,
+        append ? OPEN_ALWAYS : CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if(file == INVALID_HANDLE_VALUE) {
+        Error{} << prefix << "can't open" << filename;
+        return false;
+    }
+
+    bool success = true;
+    for(std::size_t i = 0; success && i != data.size(); ++i) {
+        const char* current = static_cast<const char*>(data[i].data());
+        std::size_t remaining = data[i].size();
+        while(remaining) {
+            /* WriteFile() takes only 32-bit sizes */
+            DWORD written;
+            if(!WriteFile(file, current, DWORD(std::min(remaining, std::size_t{1} << 30)), &written, nullptr)) {
+                success = false;
+                break;
+            }
+            current += written;
+            remaining -= written;
+        }
+    }
+
+    if(success && (flags & WriteFlag::Sync))
+        success = FlushFileBuffers(file);
+
+    CloseHandle(file);
+
+    /* Emscripten, Windows Store/Phone */
+    #else
+    static_cast<void>(flags);
+
+    const std::ofstream::openmode mode = std::ofstream::binary|(append ? std::ofstream::app : std::ofstream::trunc);
+    #ifndef CORRADE_TARGET_WINDOWS
+    std::ofstream file{filename, mode};
+    #else
+    std::ofstream file{widen(filename), mode};
+    #endif
     if(!file) {
-        Error{} << "Utility::Directory::write(): can't open" << filename;
+        Error{} << prefix << "can't open" << filename;
+        return false;
+    }
+
+    for(const Containers::ArrayView<const void> view: data)
+        file.write(static_cast<const char*>(view.data()), view.size());
+    file.flush();
+    const bool success = bool(file);
+    #endif
+
+    if(!success) {
+        Error{} << prefix << "can't write to" << filename;
         return false;
     }
 
-    file.write(reinterpret_cast<const char*>(data.data()), data.size());
     return true;
 }
 
+}
+
+bool write(const std::string& filename, const Containers::ArrayView<const void> data, const WriteFlags flags) {
+    return writeInternal("Utility::Directory::write():", filename, {&data, 1}, flags, false);
+}
+
+bool write(const std::string& filename, const Containers::ArrayView<const Containers::ArrayView<const void>> data, const WriteFlags flags) {
+    return writeInternal("Utility::Directory::write():", filename, data, flags, false);
+}
+
+bool write(const std::string& filename, const std::initializer_list<Containers::ArrayView<const void>> data, const WriteFlags flags) {
+    return writeInternal("Utility::Directory::write():", filename, {data.begin(), data.size()}, flags, false);
+}
+
 bool writeString(const std::string& filename, const std::string& data) {
     static_assert(sizeof(std::string::value_type) == 1, "std::string doesn't have 8-bit characters");
-    return write(filename, {data.data(), data.size()});
+    return write(filename, Containers::ArrayView<const void>{data.data(), data.size()});
+}
+
+bool append(const std::string& filename, const Containers::ArrayView<const void> data, const WriteFlags flags) {
+    return writeInternal("Utility::Directory::append():", filename, {&data, 1}, flags, true);
+}
+
+bool append(const std::string& filename, const Containers::ArrayView<const Containers::ArrayView<const void>> data, const WriteFlags flags) {
+    return writeInternal("Utility::Directory::append():", filename, data, flags, true);
+}
+
+bool append(const std::string& filename, const std::initializer_list<Containers::ArrayView<const void>> data, const WriteFlags flags) {
+    return writeInternal("Utility::Directory::append():", filename, {data.begin(), data.size()}, flags, true);
+}
+
+bool appendString(const std::string& filename, const std::string& data) {
+    static_assert(sizeof(std::string::value_type) == 1, "std::string doesn't have 8-bit characters");
+    return append(filename, Containers::ArrayView<const void>{data.data(), data.size()});
 }
 
 #ifdef CORRADE_TARGET_UNIX
+namespace {
+
+int mmapFlags(const MapFlags flags) {
+    int out = MAP_SHARED;
+    #ifdef MAP_POPULATE
+    if(flags & MapFlag::Populate) out |= MAP_POPULATE;
+    #else
+    static_cast<void>(flags);
+    #endif
+    return out;
+}
+
+/* All of these are just hints, so failures are silently ignored */
+void adviseMapping(void* const data, const std::size_t size, const MapFlags flags) {
+    if(flags & MapFlag::Random)
+        madvise(data, size, MADV_RANDOM);
+    else if(flags & MapFlag::Sequential)
+        madvise(data, size, MADV_SEQUENTIAL);
+
+    /* Without MAP_POPULATE, prefaulting is at least hinted */
+    #ifdef MAP_POPULATE
+    if(flags & MapFlag::WillNeed)
+    #else
+    if(flags & (MapFlag::WillNeed|MapFlag::Populate))
+    #endif
+        madvise(data, size, MADV_WILLNEED);
+
+    #ifdef MADV_HUGEPAGE
+    if(flags & MapFlag::HugePages)
+        madvise(data, size, MADV_HUGEPAGE);
+    #endif
+}
+
+/* Size of ~std::size_t{} maps everything from offset to the end of the
+   file */
+Containers::Array<const char, MapDeleter> mapReadInternal(const std::string& filename, const std::size_t offset, std::size_t size, const MapFlags flags) {
+    /* Open the file for reading */
+    const int fd = open(filename.data(), O_RDONLY);
+    if(fd == -1) {
+        Error() << "Utility::Directory::mapRead(): can't open" << filename;
+        return nullptr;
+    }
+
+    /* Get file size */
+    const off_t currentPos = lseek(fd, 0, SEEK_CUR);
+    const std::size_t fileSize = lseek(fd, 0, SEEK_END);
+    lseek(fd, currentPos, SEEK_SET);
+
+    /* Written so it can't overflow for huge sizes */
+    if(offset > fileSize || (size != ~std::size_t{} && size > fileSize - offset)) {
+        close(fd);
+        Error e;
+        e << "Utility::Directory::mapRead(): range [" << Debug::nospace
+            << offset << Debug::nospace << ":" << Debug::nospace;
+        if(size == ~std::size_t{}) e << "end";
+        else if(size > ~offset) e << offset << Debug::nospace << "+" << Debug::nospace << size;
+        else e << offset + size;
+        e << Debug::nospace << "] out of range for a file of" << fileSize << "bytes";
+        return nullptr;
+    }
+    if(size == ~std::size_t{}) size = fileSize - offset;
+
+    /* The mapping has to start at a page boundary */
+    const std::size_t pageSize = sysconf(_SC_PAGESIZE);
+    const std::size_t delta = offset % pageSize;
+
+    /* Map the file */
+    char* data = reinterpret_cast<char*>(mmap(nullptr, size + delta, PROT_READ, mmapFlags(flags), fd, offset - delta));
+    if(data == MAP_FAILED) {
+        close(fd);
+        Error() << "Utility::Directory::mapRead(): can't map the file";
+        return nullptr;
+    }
+
+    adviseMapping(data, size + delta, flags);
+
+    return Containers::Array<const char, MapDeleter>{data + delta, size, MapDeleter{fd, delta}};
+}
+
+}
+
 void MapDeleter::operator()(const char* const data, const std::size_t size) {
-    if(data && munmap(const_cast<char*>(data), size) == -1)
+    if(data && munmap(const_cast<char*>(data - _offset), size + _offset) == -1)
         Error() << "Utility::Directory: can't unmap memory-mapped file";
     if(_fd) close(_fd);
 }
 
-Containers::Array<char, MapDeleter> map(const std::string& filename, std::size_t size) {
+Containers::Array<char, MapDeleter> map(const std::string& filename, std::size_t size, const MapFlags flags) {
     /* Open the file for writing. Create if it doesn't exist, truncate it if it
        does. */
     const int fd = open(filename.data(), O_RDWR|O_CREAT|O_TRUNC, mode_t(0600));
@@ -573,47 +1371,93 @@ Containers::Array<char, MapDeleter> map(const std::string& filename, std::size_t
     }
 
     /* Map the file */
-    char* data = reinterpret_cast<char*>(mmap(nullptr, size, PROT_READ|PROT_WRITE, MAP_SHARED, fd, 0));
+    char* data = reinterpret_cast<char*>(mmap(nullptr, size, PROT_READ|PROT_WRITE, mmapFlags(flags), fd, 0));
     if(data == MAP_FAILED) {
         close(fd);
         Error() << "Utility::Directory::map(): can't map the file";
         return nullptr;
     }
 
+    adviseMapping(data, size, flags);
+
     return Containers::Array<char, MapDeleter>{data, size, MapDeleter{fd}};
 }
 
-Containers::Array<const char, MapDeleter> mapRead(const std::string& filename) {
+Containers::Array<const char, MapDeleter> mapRead(const std::string& filename, const MapFlags flags) {
+    return mapReadInternal(filename, 0, ~std::size_t{}, flags);
+}
+
+Containers::Array<const char, MapDeleter> mapRead(const std::string& filename, const std::size_t offset, const std::size_t size, const MapFlags flags) {
+    return mapReadInternal(filename, offset, size, flags);
+}
+#elif defined(CORRADE_TARGET_WINDOWS) && !defined(CORRADE_TARGET_WINDOWS_RT)
+namespace {
+
+/* Size of ~std::size_t{} maps everything from offset to the end of the
+   file. Flags are not implemented on Windows. */
+Containers::Array<const char, MapDeleter> mapReadInternal(const std::string& filename, const std::size_t offset, std::size_t size) {
     /* Open the file for reading */
-    const int fd = open(filename.data(), O_RDONLY);
-    if(fd == -1) {
+    HANDLE hFile = CreateFileW(widen(filename).data(),
+        GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, 0, nullptr);
+    if (hFile == INVALID_HANDLE_VALUE) {
         Error() << "Utility::Directory::mapRead(): can't open" << filename;
         return nullptr;
     }
 
     /* Get file size */
-    const off_t currentPos = lseek(fd, 0, SEEK_CUR);
-    const std::size_t size = lseek(fd, 0, SEEK_END);
-    lseek(fd, currentPos, SEEK_SET);
+    LARGE_INTEGER fileSizeLarge;
+    GetFileSizeEx(hFile, &fileSizeLarge);
+    const std::size_t fileSize = std::size_t(fileSizeLarge.QuadPart);
+
+    /* Written so it can't overflow for huge sizes */
+    if(offset > fileSize || (size != ~std::size_t{} && size > fileSize - offset)) {
+        CloseHandle(hFile);
+        Error e;
+        e << "Utility::Directory::mapRead(): range [" << Debug::nospace
+            << offset << Debug::nospace << ":" << Debug::nospace;
+        if(size == ~std::size_t{}) e << "end";
+        else if(size > ~offset) e << offset << Debug::nospace << "+" << Debug::nospace << size;
+        else e << offset + size;
+        e << Debug::nospace << "] out of range for a file of" << fileSize << "bytes";
+        return nullptr;
+    }
+    if(size == ~std::size_t{}) size = fileSize - offset;
+
+    /* Create the file mapping */
+    HANDLE hMap = CreateFileMappingW(hFile, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (!hMap) {
+        Error() << "Utility::Directory::mapRead(): can't create the file mapping:" << GetLastError();
+        CloseHandle(hFile);
+        return nullptr;
+    }
+
+    /* The view has to start at a multiple of allocation granularity */
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    const std::size_t delta = offset % info.dwAllocationGranularity;
+    const unsigned long long viewOffset = offset - delta;
 
     /* Map the file */
-    const char* data = reinterpret_cast<const char*>(mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0));
-    if(data == MAP_FAILED) {
-        close(fd);
-        Error() << "Utility::Directory::mapRead(): can't map the file";
+    char* data = reinterpret_cast<char*>(::MapViewOfFile(hMap, FILE_MAP_READ, DWORD(viewOffset >> 32), DWORD(viewOffset & 0xffffffffull), size + delta));
+    if(!data) {
+        Error() << "Utility::Directory::mapRead(): can't map the file:" << GetLastError();
+        CloseHandle(hMap);
+        CloseHandle(hFile);
         return nullptr;
     }
 
-    return Containers::Array<const char, MapDeleter>{data, size, MapDeleter{fd}};
+    return Containers::Array<const char, MapDeleter>{data + delta, size, MapDeleter{hFile, hMap, delta}};
 }
-#elif defined(CORRADE_TARGET_WINDOWS) && !defined(CORRADE_TARGET_WINDOWS_RT)
+
+}
+
 void MapDeleter::operator()(const char* const data, const std::size_t) {
-    if(data) UnmapViewOfFile(data);
+    if(data) UnmapViewOfFile(data - _offset);
     if(_hMap) CloseHandle(_hMap);
     if(_hFile) CloseHandle(_hFile);
 }
 
-Containers::Array<char, MapDeleter> map(const std::string& filename, std::size_t size) {
+Containers::Array<char, MapDeleter> map(const std::string& filename, std::size_t size, MapFlags) {
     /* Open the file for writing. Create if it doesn't exist, truncate it if it
        does. */
     HANDLE hFile = CreateFileW(widen(filename).data(),
@@ -643,36 +1487,12 @@ Containers::Array<char, MapDeleter> map(const std::string& filename, std::size_t
     return Containers::Array<char, MapDeleter>{data, size, MapDeleter{hFile, hMap}};
 }
 
-Containers::Array<const char, MapDeleter> mapRead(const std::string& filename) {
-    /* Open the file for reading */
-    HANDLE hFile = CreateFileW(widen(filename).data(),
-        GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, 0, nullptr);
-    if (hFile == INVALID_HANDLE_VALUE) {
-        Error() << "Utility::Directory::mapRead(): can't open" << filename;
-        return nullptr;
-    }
-
-    /* Create the file mapping */
-    HANDLE hMap = CreateFileMappingW(hFile, nullptr, PAGE_READONLY, 0, 0, nullptr);
-    if (!hMap) {
-        Error() << "Utility::Directory::mapRead(): can't create the file mapping:" << GetLastError();
-        CloseHandle(hFile);
-        return nullptr;
-    }
-
-    /* Get file size */
-    const size_t size = GetFileSize(hFile, nullptr);
-
-    /* Map the file */
-    char* data = reinterpret_cast<char*>(::MapViewOfFile(hMap, FILE_MAP_READ, 0, 0, 0));
-    if(!data) {
-        Error() << "Utility::Directory::mapRead(): can't map the file:" << GetLastError();
-        CloseHandle(hMap);
-        CloseHandle(hFile);
-        return nullptr;
-    }
+Containers::Array<const char, MapDeleter> mapRead(const std::string& filename, MapFlags) {
+    return mapReadInternal(filename, 0, ~std::size_t{});
+}
 
-    return Containers::Array<const char, MapDeleter>{data, size, MapDeleter{hFile, hMap}};
+Containers::Array<const char, MapDeleter> mapRead(const std::string& filename, const std::size_t offset, const std::size_t size, MapFlags) {
+    return mapReadInternal(filename, offset, size);
 }
 #endif
 
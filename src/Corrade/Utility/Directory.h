@@ -29,10 +29,13 @@
  * @brief Namespace @ref Corrade::Utility::Directory
  */
 
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
 #include <string>
 #include <vector>
 
-#include "Corrade/Containers/Containers.h"
+#include "Corrade/Containers/Array.h"
 #include "Corrade/Containers/EnumSet.h"
 #include "Corrade/Utility/visibility.h"
 
@@ -153,6 +156,175 @@ On failure returns empty vector.
 */
 CORRADE_UTILITY_EXPORT std::vector<std::string> list(const std::string& path, Flags flags = Flags());
 
+/**
+@brief Directory tree entry type
+
+@see @ref TreeEntry, @ref walk()
+*/
+enum class EntryType: unsigned char {
+    File,           /**< Regular file */
+    Directory,      /**< Directory */
+    Symlink,        /**< Symbolic link. Not followed by @ref walk(). */
+    Special         /**< Anything else, such as a pipe or a device */
+};
+
+/**
+@brief Directory tree entry
+
+@see @ref Tree, @ref walk()
+*/
+struct TreeEntry {
+    /**
+     * @brief Size in bytes
+     *
+     * Meaningful only for @ref EntryType::File. @cpp 0 @ce if
+     * @ref WalkFlag::SkipMetadata was passed to @ref walk().
+     */
+    std::uint64_t size;
+
+    /**
+     * @brief Modification time
+     *
+     * In nanoseconds since the Unix epoch, with the precision the platform
+     * and filesystem provide. @cpp 0 @ce if @ref WalkFlag::SkipMetadata was
+     * passed to @ref walk().
+     */
+    std::int64_t modificationTime;
+
+    /** @brief Offset of the path in @ref Tree::paths() */
+    std::size_t pathOffset;
+
+    /** @brief Path size, excluding the null terminator */
+    std::size_t pathSize;
+
+    /** @brief Type */
+    EntryType type;
+};
+
+/**
+@brief Directory tree
+
+Result of @ref walk(). Paths of all entries are stored in a single contiguous
+allocation instead of each in its own @ref std::string.
+*/
+class CORRADE_UTILITY_EXPORT Tree {
+    public:
+        /** @brief Default constructor, creates an empty tree */
+        explicit Tree() = default;
+
+        /**
+         * @brief Construct from entries and paths
+         *
+         * Each entry is expected to reference a null-terminated path in
+         * @p paths.
+         */
+        explicit Tree(Containers::Array<TreeEntry>&& entries, Containers::Array<char>&& paths) noexcept: _entries{std::move(entries)}, _paths{std::move(paths)} {}
+
+        /** @brief Entries */
+        Containers::ArrayView<const TreeEntry> entries() const { return _entries; }
+
+        /**
+         * @brief Path data
+         *
+         * Null-terminated paths of all entries, in unspecified order.
+         */
+        Containers::ArrayView<const char> paths() const { return _paths; }
+
+        /** @brief Entry count */
+        std::size_t size() const { return _entries.size(); }
+
+        /** @brief Whether the tree is empty */
+        bool empty() const { return _entries.empty(); }
+
+        /** @brief Entry at given position */
+        const TreeEntry& operator[](std::size_t i) const { return _entries[i]; }
+
+        /**
+         * @brief Path of an entry at given position
+         *
+         * Relative to the path passed to @ref walk(), with forward slashes
+         * as directory separators. The null terminator is not included in
+         * the view but is present after it, so @cpp path(i).data() @ce can be
+         * used as a C string.
+         */
+        Containers::ArrayView<const char> path(std::size_t i) const {
+            return _paths.slice(_entries[i].pathOffset, _entries[i].pathOffset + _entries[i].pathSize);
+        }
+
+    private:
+        Containers::Array<TreeEntry> _entries;
+        Containers::Array<char> _paths;
+};
+
+/**
+@brief Directory tree walking flag
+
+@see @ref WalkFlags, @ref walk()
+*/
+enum class WalkFlag: unsigned char {
+    /**
+     * Don't query size and modification time. Where the platform reports
+     * entry type directly while listing the directory, this saves one
+     * @cpp stat() @ce call per entry.
+     */
+    SkipMetadata = 1 << 0,
+
+    /** Sort entries of each directory by name in ascending order */
+    SortAscending = 1 << 1
+};
+
+/**
+@brief Directory tree walking flags
+
+@see @ref walk()
+*/
+typedef Containers::EnumSet<WalkFlag> WalkFlags;
+
+CORRADE_ENUMSET_OPERATORS(WalkFlags)
+
+/**
+@brief Walk a directory tree
+@param path         Directory to walk
+@param flags        Flags
+@param threadCount  Count of threads to list the subdirectories in. If
+    @cpp 0 @ce, @ref std::thread::hardware_concurrency() is used.
+
+Recursively lists all entries in @p path together with their type, size and
+modification time. On Unix the type is taken from the directory listing and
+the metadata are queried relative to the directory file descriptor with
+@cpp fstatat() @ce, on Windows everything comes directly from the listing.
+Symbolic links are reported as such and not followed, `.` and `..` are not
+included. If the metadata of an entry can't be queried, the entry is still
+reported, with zero size and modification time and, if the directory listing
+didn't provide its type either, as @ref EntryType::Special. Subdirectories
+that can't be opened are reported as well, but a message is printed to
+@ref Warning and their contents are skipped --- the returned tree is
+incomplete in that case.
+
+The entries are ordered so that each directory is directly followed by its
+contents, recursively. The order inside a single directory is the order in
+which the system lists it, unless @ref WalkFlag::SortAscending is passed.
+The result is the same regardless of @p threadCount.
+
+If @p path can't be opened, prints a message to @ref Error and returns
+@ref Containers::NullOpt. Expects that the path is in UTF-8.
+
+@code{.cpp}
+Containers::Optional<Utility::Directory::Tree> tree =
+    Utility::Directory::walk("data", {}, 0);
+for(std::size_t i = 0; tree && i != tree->size(); ++i) {
+    if((*tree)[i].type != Utility::Directory::EntryType::File) continue;
+    Utility::Debug{} << tree->path(i).data() << (*tree)[i].size;
+}
+@endcode
+
+@partialsupport In @ref CORRADE_TARGET_EMSCRIPTEN "Emscripten" the
+    subdirectories are always listed on the calling thread and the metadata
+    are always queried. Not implemented on Windows RT.
+@see @ref list()
+*/
+CORRADE_UTILITY_EXPORT Containers::Optional<Tree> walk(const std::string& path, WalkFlags flags = {}, std::size_t threadCount = 1);
+
 /**
 @brief Create path
 
@@ -178,6 +350,22 @@ paths are in UTF-8.
 */
 CORRADE_UTILITY_EXPORT bool move(const std::string& oldPath, const std::string& newPath);
 
+/**
+@brief Copy a file
+
+Copies contents of @p from to @p to, replacing any previous contents of
+@p to. Unlike a @ref read() followed by a @ref write() the file is never
+materialized in memory. On Linux the copy is done in the kernel, either by
+sharing the data on filesystems that support reflinks or with
+@cpp copy_file_range() @ce or @cpp sendfile() @ce. On Windows
+@cpp CopyFileW() @ce is used, on other Unix systems and if none of the above
+is supported the data are streamed through a fixed-size buffer. Returns
+@cpp false @ce and prints message to @ref Error if the file can't be copied,
+@cpp true @ce otherwise. Expects that the paths are in UTF-8.
+@see @ref move()
+*/
+CORRADE_UTILITY_EXPORT bool copy(const std::string& from, const std::string& to);
+
 /**
 @brief Whether the application runs in a sandboxed environment
 
@@ -262,7 +450,10 @@ CORRADE_UTILITY_EXPORT bool fileExists(const std::string& filename);
 
 Reads whole file as binary (i.e. without newline conversion). Returns
 @cpp nullptr @ce and prints message to @ref Error if the file can't be read.
-Expects that the filename is in UTF-8.
+Expects that the filename is in UTF-8. Non-seekable files are read in chunks
+into a @ref Containers-Array-growable "growable array", which is then returned
+as-is, meaning its deleter is not the default one in that case. For streaming
+large files without materializing them in memory see @ref readChunks().
 @see @ref readString(), @ref fileExists(), @ref write(), @ref mapRead()
 */
 CORRADE_UTILITY_EXPORT Containers::Array<char> read(const std::string& filename);
@@ -275,15 +466,134 @@ Convenience overload for @ref read().
 */
 CORRADE_UTILITY_EXPORT std::string readString(const std::string& filename);
 
+/**
+@brief Chunked read flag
+
+@see @ref ReadChunksFlags, @ref readChunks()
+*/
+enum class ReadChunksFlag: unsigned char {
+    /**
+     * Read the next chunk in a background thread while the callback is
+     * processing the current one. Uses two buffers instead of one.
+     * @partialsupport Ignored in @ref CORRADE_TARGET_EMSCRIPTEN "Emscripten",
+     *      where threads are not available.
+     */
+    ReadAhead = 1 << 0
+};
+
+/**
+@brief Chunked read flags
+
+@see @ref readChunks()
+*/
+typedef Containers::EnumSet<ReadChunksFlag> ReadChunksFlags;
+
+CORRADE_ENUMSET_OPERATORS(ReadChunksFlags)
+
+/**
+@brief Read file in chunks
+@param filename     File to read
+@param chunkSize    Chunk size in bytes, expected to be non-zero
+@param callback     Function called for each chunk
+@param state        State pointer passed to @p callback
+@param flags        Flags
+
+Streaming alternative to @ref read() for files that are too large to be
+materialized in memory at once. Reads the file as binary (i.e. without
+newline conversion) into a single buffer of @p chunkSize bytes, which is
+reused for all chunks, and calls @p callback with each filled part of it.
+All chunks except the last one are exactly @p chunkSize bytes, the callback
+is never called with an empty chunk. The view passed to the callback is
+valid only until it returns. Returning @cpp false @ce from the callback
+stops the reading.
+
+With @ref ReadChunksFlag::ReadAhead the next chunk is read from a background
+thread while @p callback processes the current one, which overlaps I/O with
+the processing. The callback is still always called from the calling
+thread, in order.
+
+Returns @cpp false @ce and prints message to @ref Error if the file can't be
+opened or read, @cpp true @ce otherwise, including the case when the reading
+was stopped by the callback. Expects that the filename is in UTF-8.
+
+@code{.cpp}
+std::size_t lines = 0;
+Utility::Directory::readChunks("huge.log", 1 << 20,
+    [](Containers::ArrayView<const char> chunk, void* state) {
+        for(char c: chunk) if(c == '\n') ++*static_cast<std::size_t*>(state);
+        return true;
+    }, &lines, Utility::Directory::ReadChunksFlag::ReadAhead);
+@endcode
+
+@see @ref mapRead()
+*/
+CORRADE_UTILITY_EXPORT bool readChunks(const std::string& filename, std::size_t chunkSize, bool(*callback)(Containers::ArrayView<const char>, void*), void* state = nullptr, ReadChunksFlags flags = {});
+
+/**
+@brief Write flag
+
+@see @ref WriteFlags, @ref write(), @ref append()
+*/
+enum class WriteFlag: unsigned char {
+    /**
+     * Flush the data to the storage device before returning, using
+     * @cpp fdatasync() @ce on Unix and @cpp FlushFileBuffers() @ce on
+     * Windows.
+     * @partialsupport Ignored in @ref CORRADE_TARGET_EMSCRIPTEN "Emscripten"
+     *      and on @ref CORRADE_TARGET_WINDOWS_RT "Windows RT".
+     */
+    Sync = 1 << 0
+};
+
+/**
+@brief Write flags
+
+@see @ref write(), @ref append()
+*/
+typedef Containers::EnumSet<WriteFlag> WriteFlags;
+
+CORRADE_ENUMSET_OPERATORS(WriteFlags)
+
 /**
 @brief Write array into file
 
 Writes the file as binary (i.e. without newline conversion). Returns
 @cpp false @ce and prints message to @ref Error if the file can't be written,
 @cpp true @ce otherwise. Expects that the filename is in UTF-8.
-@see @ref writeString(), @ref read(), @ref map()
+@see @ref writeString(), @ref append(), @ref read(), @ref map()
 */
-CORRADE_UTILITY_EXPORT bool write(const std::string& filename, Containers::ArrayView<const void> data);
+CORRADE_UTILITY_EXPORT bool write(const std::string& filename, Containers::ArrayView<const void> data, WriteFlags flags = {});
+
+/**
+@brief Write multiple arrays into file
+
+Writes all @p data one after another without concatenating them first, which
+avoids an extra copy for example when writing a header, a body and a footer.
+On Unix the data are submitted with @cpp writev() @ce, in batches of at most
+@cpp IOV_MAX @ce views. Apart from that behaves the same as
+@ref write(const std::string&, Containers::ArrayView<const void>, WriteFlags).
+*/
+CORRADE_UTILITY_EXPORT bool write(const std::string& filename, Containers::ArrayView<const Containers::ArrayView<const void>> data, WriteFlags flags = {});
+
+/** @overload */
+CORRADE_UTILITY_EXPORT bool write(const std::string& filename, std::initializer_list<Containers::ArrayView<const void>> data, WriteFlags flags = {});
+
+/** @overload
+ *
+ * Needed to resolve an ambiguity with the single-view overload.
+ */
+template<std::size_t size> inline bool write(const std::string& filename, const Containers::ArrayView<const void>(&data)[size], WriteFlags flags = {}) {
+    return write(filename, Containers::ArrayView<const Containers::ArrayView<const void>>{data}, flags);
+}
+
+/** @overload
+ *
+ * Creates an empty file. Needed to resolve an ambiguity between the
+ * single-view and multi-view overloads.
+ */
+inline bool write(const std::string& filename, std::nullptr_t, WriteFlags flags = {}) {
+    return write(filename, Containers::ArrayView<const void>{}, flags);
+}
 
 /**
 @brief Write string into file
@@ -293,7 +603,112 @@ Convenience overload for @ref write().
 */
 CORRADE_UTILITY_EXPORT bool writeString(const std::string& filename, const std::string& data);
 
+/**
+@brief Append array to a file
+
+Similar to @ref write(const std::string&, Containers::ArrayView<const void>, WriteFlags),
+but appends to the file instead of replacing its contents. The file is
+created if it doesn't exist.
+@see @ref appendString()
+*/
+CORRADE_UTILITY_EXPORT bool append(const std::string& filename, Containers::ArrayView<const void> data, WriteFlags flags = {});
+
+/**
+@brief Append multiple arrays to a file
+
+Similar to @ref write(const std::string&, Containers::ArrayView<const Containers::ArrayView<const void>>, WriteFlags),
+but appends to the file instead of replacing its contents. The file is
+created if it doesn't exist.
+*/
+CORRADE_UTILITY_EXPORT bool append(const std::string& filename, Containers::ArrayView<const Containers::ArrayView<const void>> data, WriteFlags flags = {});
+
+/** @overload */
+CORRADE_UTILITY_EXPORT bool append(const std::string& filename, std::initializer_list<Containers::ArrayView<const void>> data, WriteFlags flags = {});
+
+/** @overload
+ *
+ * Needed to resolve an ambiguity with the single-view overload.
+ */
+template<std::size_t size> inline bool append(const std::string& filename, const Containers::ArrayView<const void>(&data)[size], WriteFlags flags = {}) {
+    return append(filename, Containers::ArrayView<const Containers::ArrayView<const void>>{data}, flags);
+}
+
+/** @overload
+ *
+ * Creates the file if it doesn't exist. Needed to resolve an ambiguity
+ * between the single-view and multi-view overloads.
+ */
+inline bool append(const std::string& filename, std::nullptr_t, WriteFlags flags = {}) {
+    return append(filename, Containers::ArrayView<const void>{}, flags);
+}
+
+/**
+@brief Append string to a file
+
+Convenience overload for @ref append().
+@see @ref append(), @ref writeString()
+*/
+CORRADE_UTILITY_EXPORT bool appendString(const std::string& filename, const std::string& data);
+
 #if defined(DOXYGEN_GENERATING_OUTPUT) || defined(CORRADE_TARGET_UNIX) || (defined(CORRADE_TARGET_WINDOWS) && !defined(CORRADE_TARGET_WINDOWS_RT))
+/**
+@brief Memory mapping flag
+
+Hints about how the mapped memory is going to be accessed. All flags are
+only advisory, the mapped contents are the same regardless of them.
+@see @ref MapFlags, @ref map(), @ref mapRead()
+@partialsupport Available only on @ref CORRADE_TARGET_UNIX "Unix" and non-RT
+    @ref CORRADE_TARGET_WINDOWS "Windows" platforms. All flags are ignored on
+    Windows.
+*/
+enum class MapFlag: unsigned char {
+    /**
+     * The memory will be accessed sequentially, so the system can read ahead
+     * aggressively and free pages soon after they were accessed. Corresponds
+     * to @cpp MADV_SEQUENTIAL @ce. Mutually exclusive with
+     * @ref MapFlag::Random, if both are specified, @ref MapFlag::Random is
+     * used.
+     */
+    Sequential = 1 << 0,
+
+    /**
+     * The memory will be accessed in random order, so reading ahead would
+     * be wasted. Corresponds to @cpp MADV_RANDOM @ce.
+     */
+    Random = 1 << 1,
+
+    /**
+     * The whole mapping will be needed soon, start reading it in the
+     * background. Corresponds to @cpp MADV_WILLNEED @ce.
+     */
+    WillNeed = 1 << 2,
+
+    /**
+     * Prefault the whole mapping before returning, so accessing it doesn't
+     * cause any page faults later. Corresponds to @cpp MAP_POPULATE @ce on
+     * Linux, on other Unix systems it's the same as @ref MapFlag::WillNeed.
+     */
+    Populate = 1 << 3,
+
+    /**
+     * Back the mapping with transparent huge pages, if the system and the
+     * filesystem support it. Corresponds to @cpp MADV_HUGEPAGE @ce on Linux,
+     * ignored elsewhere.
+     */
+    HugePages = 1 << 4
+};
+
+/**
+@brief Memory mapping flags
+
+@see @ref map(), @ref mapRead()
+@partialsupport Available only on @ref CORRADE_TARGET_UNIX "Unix" and non-RT
+    @ref CORRADE_TARGET_WINDOWS "Windows" platforms.
+*/
+typedef Containers::EnumSet<MapFlag> MapFlags;
+
+CORRADE_ENUMSET_OPERATORS(MapFlags)
+
 /**
 @brief Map file for reading and writing
 
@@ -301,12 +716,13 @@ Maps the file as read-write memory and enlarges it to @p size. If the file does
 not exist yet, it is created, if it exists, it's truncated. The array deleter
 takes care of unmapping, however the file is not deleted after unmapping. If an
 error occurs, @cpp nullptr @ce is returned and a message is printed to
-@ref Error. Expects that the filename is in UTF-8.
+@ref Error. Expects that the filename is in UTF-8. See @ref MapFlag for
+description of the access pattern hints.
 @see @ref mapRead(), @ref read(), @ref write()
 @partialsupport Available only on @ref CORRADE_TARGET_UNIX "Unix" and non-RT
     @ref CORRADE_TARGET_WINDOWS "Windows" platforms.
     */
-CORRADE_UTILITY_EXPORT Containers::Array<char, MapDeleter> map(const std::string& filename, std::size_t size);
+CORRADE_UTILITY_EXPORT Containers::Array<char, MapDeleter> map(const std::string& filename, std::size_t size, MapFlags flags = {});
 
 /**
 @brief Map file for reading
@@ -314,33 +730,53 @@ CORRADE_UTILITY_EXPORT Containers::Array<char, MapDeleter> map(const std::string
 Maps the file as read-only memory. The array deleter takes care of unmapping.
 If the file doesn't exist or an error occurs while mapping, @cpp nullptr @ce is
 returned and a message is printed to @ref Error. Expects that the filename is
-in UTF-8.
+in UTF-8. See @ref MapFlag for description of the access pattern hints.
 @see @ref map(), @ref read()
 @partialsupport Available only on @ref CORRADE_TARGET_UNIX "Unix" and non-RT
     @ref CORRADE_TARGET_WINDOWS "Windows" platforms.
 */
-CORRADE_UTILITY_EXPORT Containers::Array<const char, MapDeleter> mapRead(const std::string& filename);
+CORRADE_UTILITY_EXPORT Containers::Array<const char, MapDeleter> mapRead(const std::string& filename, MapFlags flags = {});
+
+/**
+@brief Map a byte range of a file for reading
+
+Maps @p size bytes starting at @p offset as read-only memory. The offset
+doesn't need to be aligned to a page boundary, the returned array points
+directly to the first requested byte. If @p size is @cpp ~std::size_t{} @ce,
+everything from @p offset to the end of the file is mapped. If the range
+doesn't fit into the file, @cpp nullptr @ce is returned and a message is
+printed to @ref Error.
+@see @ref mapRead(const std::string&, MapFlags)
+@partialsupport Available only on @ref CORRADE_TARGET_UNIX "Unix" and non-RT
+    @ref CORRADE_TARGET_WINDOWS "Windows" platforms.
+*/
+CORRADE_UTILITY_EXPORT Containers::Array<const char, MapDeleter> mapRead(const std::string& filename, std::size_t offset, std::size_t size, MapFlags flags = {});
 #endif
 
 #ifndef DOXYGEN_GENERATING_OUTPUT
 #ifdef CORRADE_TARGET_UNIX
 class CORRADE_UTILITY_EXPORT MapDeleter {
     public:
-        constexpr explicit MapDeleter(): _fd{} {}
-        constexpr explicit MapDeleter(int fd) noexcept: _fd{fd} {}
+        constexpr explicit MapDeleter(): _fd{}, _offset{} {}
+        constexpr explicit MapDeleter(int fd, std::size_t offset = 0) noexcept: _fd{fd}, _offset{offset} {}
         void operator()(const char* data, std::size_t size);
     private:
         int _fd;
+        /* Distance of the data pointer from the page-aligned mapping start */
+        std::size_t _offset;
 };
 #elif defined(CORRADE_TARGET_WINDOWS) && !defined(CORRADE_TARGET_WINDOWS_RT)
 class CORRADE_UTILITY_EXPORT MapDeleter {
     public:
-        constexpr explicit MapDeleter(): _hFile{}, _hMap{} {}
-        constexpr explicit MapDeleter(void* hFile, void* hMap) noexcept: _hFile{hFile}, _hMap{hMap} {}
+        constexpr explicit MapDeleter(): _hFile{}, _hMap{}, _offset{} {}
+        constexpr explicit MapDeleter(void* hFile, void* hMap, std::size_t offset = 0) noexcept: _hFile{hFile}, _hMap{hMap}, _offset{offset} {}
         void operator()(const char* data, std::size_t size);
     private:
         void* _hFile;
         void* _hMap;
+        /* Distance of the data pointer from the mapping start aligned to
+           allocation granularity */
+        std::size_t _offset;
 };
 #endif
 #endif
@@ -0,0 +1,157 @@
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Memory.h"
+
+#include <cerrno>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+
+#include "Corrade/configure.h"
+#include "Corrade/Utility/Debug.h"
+
+#ifdef CORRADE_TARGET_UNIX
+#include <sys/mman.h>
+#include <unistd.h>
+#elif defined(CORRADE_TARGET_WINDOWS)
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#endif
+
+namespace Corrade { namespace Utility { namespace Implementation {
+
+namespace {
+    /* Size of a transparent huge page on all common x86 and ARM Linux
+       configurations */
+    constexpr std::size_t HugePageSize = 2*1024*1024;
+
+    std::size_t pageSize(const bool hugePages) {
+        if(hugePages) return HugePageSize;
+        #ifdef CORRADE_TARGET_UNIX
+        return sysconf(_SC_PAGESIZE);
+        #elif defined(CORRADE_TARGET_WINDOWS)
+        SYSTEM_INFO info;
+        GetSystemInfo(&info);
+        return info.dwPageSize;
+        #else
+        return 4096;
+        #endif
+    }
+
+    std::size_t roundUp(const std::size_t size, const std::size_t alignment) {
+        return (size + alignment - 1)/alignment*alignment;
+    }
+}
+
+void* allocateAligned(const std::size_t size, std::size_t alignment) {
+    #ifndef CORRADE_TARGET_WINDOWS
+    /* posix_memalign() requires the alignment to be a multiple of
+       sizeof(void*) */
+    if(alignment < sizeof(void*)) alignment = sizeof(void*);
+    void* data;
+    if(const int error = posix_memalign(&data, alignment, size)) {
+        Error() << "Utility::allocateAligned(): can't allocate" << size << "bytes aligned to" << alignment << Debug::nospace << ":" << std::strerror(error);
+        return nullptr;
+    }
+    #else
+    void* const data = _aligned_malloc(size, alignment);
+    if(!data) {
+        Error() << "Utility::allocateAligned(): can't allocate" << size << "bytes aligned to" << alignment;
+        return nullptr;
+    }
+    #endif
+    return data;
+}
+
+void deallocateAligned(void* const data) {
+    #ifndef CORRADE_TARGET_WINDOWS
+    std::free(data);
+    #else
+    _aligned_free(data);
+    #endif
+}
+
+void* allocatePages(const std::size_t size, const bool hugePages) {
+    const std::size_t alignment = pageSize(hugePages);
+    const std::size_t roundedSize = roundUp(size, alignment);
+
+    #ifdef CORRADE_TARGET_UNIX
+    /* mmap() gives back only regular page alignment, so for huge pages
+       overallocate and then unmap the unaligned head and the tail */
+    const std::size_t mappedSize = hugePages ? roundedSize + alignment : roundedSize;
+    void* const mapped = mmap(nullptr, mappedSize, PROT_READ|PROT_WRITE, MAP_PRIVATE|MAP_ANONYMOUS, -1, 0);
+    if(mapped == MAP_FAILED) {
+        Error() << "Utility::allocatePages(): can't map" << mappedSize << "bytes:" << std::strerror(errno);
+        return nullptr;
+    }
+
+    if(!hugePages) return mapped;
+
+    char* const begin = static_cast<char*>(mapped);
+    char* const data = begin + (alignment - reinterpret_cast<std::uintptr_t>(mapped) % alignment) % alignment;
+    if(data != begin) munmap(begin, data - begin);
+    if(const std::size_t tail = begin + mappedSize - (data + roundedSize))
+        munmap(data + roundedSize, tail);
+
+    #ifdef MADV_HUGEPAGE
+    /* Failure isn't fatal, the memory will be backed by regular pages */
+    madvise(data, roundedSize, MADV_HUGEPAGE);
+    #endif
+
+    return data;
+    #elif defined(CORRADE_TARGET_WINDOWS)
+    /* Large pages on Windows require the SeLockMemoryPrivilege, which is
+       almost never available, so using regular pages in both cases */
+    void* const data = VirtualAlloc(nullptr, roundedSize, MEM_RESERVE|MEM_COMMIT, PAGE_READWRITE);
+    if(!data) {
+        Error() << "Utility::allocatePages(): can't allocate" << roundedSize << "bytes, error" << GetLastError();
+        return nullptr;
+    }
+    return data;
+    #else
+    void* const data = allocateAligned(roundedSize, alignment);
+    if(data) std::memset(data, 0, roundedSize);
+    return data;
+    #endif
+}
+
+void deallocatePages(void* const data, const std::size_t size, const bool hugePages) {
+    #ifdef CORRADE_TARGET_UNIX
+    munmap(data, roundUp(size, pageSize(hugePages)));
+    #elif defined(CORRADE_TARGET_WINDOWS)
+    static_cast<void>(size);
+    static_cast<void>(hugePages);
+    VirtualFree(data, 0, MEM_RELEASE);
+    #else
+    static_cast<void>(size);
+    static_cast<void>(hugePages);
+    deallocateAligned(data);
+    #endif
+}
+
+}}}
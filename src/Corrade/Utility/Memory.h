@@ -0,0 +1,236 @@
+#ifndef Corrade_Utility_Memory_h
+#define Corrade_Utility_Memory_h
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Corrade::Utility::allocateAligned(), @ref Corrade::Utility::allocatePages(), @ref Corrade::Utility::allocateHugePages()
+ */
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+
+#include "Corrade/Containers/Array.h"
+#include "Corrade/Utility/visibility.h"
+
+namespace Corrade { namespace Utility {
+
+namespace Implementation {
+    /* These return nullptr and print a message on failure */
+    CORRADE_UTILITY_EXPORT void* allocateAligned(std::size_t size, std::size_t alignment);
+    CORRADE_UTILITY_EXPORT void deallocateAligned(void* data);
+    CORRADE_UTILITY_EXPORT void* allocatePages(std::size_t size, bool hugePages);
+    CORRADE_UTILITY_EXPORT void deallocatePages(void* data, std::size_t size, bool hugePages);
+
+    template<class T> void alignedDeleter(T* data, std::size_t size) {
+        for(std::size_t i = 0; i != size; ++i) data[i].~T();
+        deallocateAligned(data);
+    }
+
+    template<class T, bool hugePages> void pageDeleter(T* data, std::size_t size) {
+        for(std::size_t i = 0; i != size; ++i) data[i].~T();
+        deallocatePages(data, size*sizeof(T), hugePages);
+    }
+
+    template<class T> void construct(T* data, std::size_t size, Containers::DefaultInitT) {
+        for(std::size_t i = 0; i != size; ++i) new(data + i) T;
+    }
+    template<class T> void construct(T* data, std::size_t size, Containers::ValueInitT) {
+        for(std::size_t i = 0; i != size; ++i) new(data + i) T();
+    }
+    template<class T> void construct(T*, std::size_t, Containers::NoInitT) {}
+
+    /* Freshly mapped pages are always zero-filled, so value-initializing
+       trivial types is a no-op */
+    template<class T, class InitTag> void constructPages(T* data, std::size_t size, InitTag tag) {
+        construct(data, size, tag);
+    }
+    template<class T> void constructPages(T* data, std::size_t size, Containers::ValueInitT) {
+        if(!std::is_trivial<T>::value) construct(data, size, Containers::ValueInit);
+    }
+
+    template<class T, std::size_t alignment, class InitTag> Containers::Array<T> allocateAligned(InitTag tag, std::size_t size) {
+        static_assert(alignment && !(alignment & (alignment - 1)),
+            "alignment expected to be a power of two");
+        static_assert(alignment >= alignof(T),
+            "alignment expected to be not smaller than alignment of the type");
+
+        if(!size) return {};
+        T* const data = static_cast<T*>(Implementation::allocateAligned(size*sizeof(T), alignment));
+        if(!data) return {};
+        construct(data, size, tag);
+        return Containers::Array<T>{data, size, alignedDeleter<T>};
+    }
+
+    template<class T, bool hugePages, class InitTag> Containers::Array<T> allocatePages(InitTag tag, std::size_t size) {
+        if(!size) return {};
+        T* const data = static_cast<T*>(Implementation::allocatePages(size*sizeof(T), hugePages));
+        if(!data) return {};
+        constructPages(data, size, tag);
+        return Containers::Array<T>{data, size, pageDeleter<T, hugePages>};
+    }
+}
+
+/**
+@brief Allocate an aligned array
+@tparam T           Array type
+@tparam alignment   Alignment in bytes. Expected to be a power of two and not
+    smaller than alignment of @p T.
+
+Unlike @ref Containers::Array::Array(DefaultInitT, std::size_t), which
+allocates through @cpp new[] @ce and thus gives only the default platform
+alignment (usually 8 or 16 bytes), the returned memory is guaranteed to be
+aligned to @p alignment bytes, making it suitable for aligned SIMD loads or
+avoiding false sharing of cache lines. The array has a custom deleter that
+calls destructors of all items and frees the memory, apart from that it
+behaves exactly like any other @ref Containers::Array. Example usage:
+
+@code{.cpp}
+// 32-byte aligned array of floats for AVX loads
+Containers::Array<float> data = Utility::allocateAligned<float, 32>(1024);
+@endcode
+
+Trivial types are left uninitialized, other types are default-constructed,
+equivalently to @ref Containers::Array::Array(DefaultInitT, std::size_t). If
+@p size is zero or the allocation fails, returns an empty array, in the
+latter case also printing a message to error output.
+@see @ref allocateAligned(Containers::ValueInitT, std::size_t),
+    @ref allocateAligned(Containers::NoInitT, std::size_t),
+    @ref allocatePages(), @ref allocateHugePages()
+*/
+template<class T, std::size_t alignment = alignof(T)> Containers::Array<T> allocateAligned(Containers::DefaultInitT, std::size_t size) {
+    return Implementation::allocateAligned<T, alignment>(Containers::DefaultInit, size);
+}
+
+/**
+@brief Allocate a value-initialized aligned array
+
+Like @ref allocateAligned(Containers::DefaultInitT, std::size_t), but
+value-initializes the items (zero-initializes trivial types), equivalently to
+@ref Containers::Array::Array(ValueInitT, std::size_t).
+*/
+template<class T, std::size_t alignment = alignof(T)> Containers::Array<T> allocateAligned(Containers::ValueInitT, std::size_t size) {
+    return Implementation::allocateAligned<T, alignment>(Containers::ValueInit, size);
+}
+
+/**
+@brief Allocate an uninitialized aligned array
+
+Like @ref allocateAligned(Containers::DefaultInitT, std::size_t), but leaves
+the items uninitialized, equivalently to
+@ref Containers::Array::Array(NoInitT, std::size_t). Destructors of all items
+are called on destruction, so the items are expected to be constructed using
+placement-new before that.
+*/
+template<class T, std::size_t alignment = alignof(T)> Containers::Array<T> allocateAligned(Containers::NoInitT, std::size_t size) {
+    return Implementation::allocateAligned<T, alignment>(Containers::NoInit, size);
+}
+
+/**
+@brief Allocate an aligned array
+
+Alias to @ref allocateAligned(Containers::DefaultInitT, std::size_t).
+*/
+template<class T, std::size_t alignment = alignof(T)> Containers::Array<T> allocateAligned(std::size_t size) {
+    return Implementation::allocateAligned<T, alignment>(Containers::DefaultInit, size);
+}
+
+/**
+@brief Allocate a page-aligned array directly from the operating system
+
+Bypasses the heap and maps the memory directly using @cpp mmap() @ce on Unix
+and @cpp VirtualAlloc() @ce on Windows, the memory is thus aligned to (and its
+size rounded up to) the system page size. Suitable for large buffers that
+would otherwise fragment the heap. On other platforms falls back to an
+allocation aligned to 4096 bytes. Initialization behavior is the same as with
+@ref allocateAligned() --- but because fresh mappings are always zero-filled,
+@ref Containers::ValueInit is free for trivial types.
+
+The array has a custom deleter that calls destructors of all items and
+unmaps the memory. If @p size is zero or the allocation fails, returns an
+empty array, in the latter case also printing a message to error output.
+@see @ref allocateHugePages()
+*/
+template<class T> Containers::Array<T> allocatePages(Containers::DefaultInitT, std::size_t size) {
+    return Implementation::allocatePages<T, false>(Containers::DefaultInit, size);
+}
+
+/** @overload */
+template<class T> Containers::Array<T> allocatePages(Containers::ValueInitT, std::size_t size) {
+    return Implementation::allocatePages<T, false>(Containers::ValueInit, size);
+}
+
+/** @overload */
+template<class T> Containers::Array<T> allocatePages(Containers::NoInitT, std::size_t size) {
+    return Implementation::allocatePages<T, false>(Containers::NoInit, size);
+}
+
+/**
+@brief Allocate a page-aligned array
+
+Alias to @ref allocatePages(Containers::DefaultInitT, std::size_t).
+*/
+template<class T> Containers::Array<T> allocatePages(std::size_t size) {
+    return Implementation::allocatePages<T, false>(Containers::DefaultInit, size);
+}
+
+/**
+@brief Allocate an array backed by huge pages
+
+Like @ref allocatePages(), but the mapping is aligned to (and its size rounded
+up to) 2 MB and on Linux marked with @cpp MADV_HUGEPAGE @ce, allowing the
+kernel to back it with transparent huge pages. For multi-gigabyte buffers
+this significantly reduces TLB misses. Whether huge pages are actually used
+depends on system configuration, on other platforms the memory is backed by
+regular pages. Because of the rounding, it's not advised to use this function
+for small allocations.
+*/
+template<class T> Containers::Array<T> allocateHugePages(Containers::DefaultInitT, std::size_t size) {
+    return Implementation::allocatePages<T, true>(Containers::DefaultInit, size);
+}
+
+/** @overload */
+template<class T> Containers::Array<T> allocateHugePages(Containers::ValueInitT, std::size_t size) {
+    return Implementation::allocatePages<T, true>(Containers::ValueInit, size);
+}
+
+/** @overload */
+template<class T> Containers::Array<T> allocateHugePages(Containers::NoInitT, std::size_t size) {
+    return Implementation::allocatePages<T, true>(Containers::NoInit, size);
+}
+
+/**
+@brief Allocate an array backed by huge pages
+
+Alias to @ref allocateHugePages(Containers::DefaultInitT, std::size_t).
+*/
+template<class T> Containers::Array<T> allocateHugePages(std::size_t size) {
+    return Implementation::allocatePages<T, true>(Containers::DefaultInit, size);
+}
+
+}}
+
+#endif
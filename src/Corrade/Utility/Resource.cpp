@@ -25,10 +25,11 @@
 
 #include "Resource.h"
 
-#ifdef _MSC_VER
-#include <algorithm> /* std::max() */
-#endif
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
 #include <iomanip>
+#include <mutex>
 #include <sstream>
 #include <tuple>
 #include <vector>
@@ -49,7 +50,23 @@ struct Resource::OverrideData {
     explicit OverrideData(const std::string& filename): conf(filename) {}
 };
 
+struct Resource::Cache {
+    std::mutex mutex;
+
+    /* Decompressed data for every file, allocated on first access */
+    Containers::Array<Containers::Array<char>> data;
+};
+
+struct Resource::Pack {
+    #if defined(CORRADE_TARGET_UNIX) || (defined(CORRADE_TARGET_WINDOWS) && !defined(CORRADE_TARGET_WINDOWS_RT))
+    Containers::Array<const char, Directory::MapDeleter> data;
+    #else
+    Containers::Array<char> data;
+    #endif
+};
+
 Resource::GroupData::GroupData() = default;
+Resource::GroupData::GroupData(GroupData&&) noexcept = default;
 Resource::GroupData::~GroupData() = default;
 
 auto Resource::resources() -> std::map<std::string, GroupData>& {
@@ -57,49 +74,300 @@ auto Resource::resources() -> std::map<std::string, GroupData>& {
     return resources;
 }
 
-void Resource::registerData(const char* group, unsigned int count, const unsigned char* positions, const unsigned char* filenames, const unsigned char* data) {
+namespace {
+
+/* Filename and data positions are stored as pairs of end offsets, the begin
+   offset is the end of the previous file */
+Containers::ArrayView<const char> filenameAt(const unsigned int* positions, const char* filenames, unsigned int i) {
+    const unsigned int begin = i ? positions[2*(i - 1)] : 0;
+    return {filenames + begin, positions[2*i] - begin};
+}
+
+/* If alignments are present, the file data begin at the end of the previous
+   file rounded up to the alignment */
+unsigned int alignUp(unsigned int offset, unsigned int alignment) {
+    return (offset + alignment - 1) & ~(alignment - 1);
+}
+
+Containers::ArrayView<const char> dataAt(const unsigned int* positions, const unsigned int* alignments, const char* data, unsigned int i) {
+    unsigned int begin = i ? positions[2*(i - 1) + 1] : 0;
+    if(alignments) begin = alignUp(begin, alignments[i]);
+    return {data + begin, positions[2*i + 1] - begin};
+}
+
+char* alignedPointer(char* data, std::size_t alignment) {
+    return reinterpret_cast<char*>((reinterpret_cast<std::uintptr_t>(data) + alignment - 1) & ~std::uintptr_t(alignment - 1));
+}
+
+/* Compression is the LZ4 block format -- sequences of a token byte with
+   literal and match length, the literals, 16-bit match offset and optional
+   match length continuation. The last sequence has only literals. */
+enum: std::size_t {
+    CompressionMinMatch = 4,
+    CompressionLastLiterals = 5,
+    CompressionMatchLimit = 12,
+    CompressionMaxOffset = 65535,
+    CompressionHashBits = 16
+};
+
+std::uint32_t read32(const char* data) {
+    std::uint32_t value;
+    std::memcpy(&value, data, 4);
+    return value;
+}
+
+void compressLength(std::string& out, std::size_t length) {
+    for(length -= 15; length >= 255; length -= 255) out += char(255);
+    out += char(length);
+}
+
+void compressLiterals(std::string& out, const char* data, std::size_t size, std::size_t matchLength) {
+    out += char((std::min<std::size_t>(size, 15) << 4)|std::min<std::size_t>(matchLength, 15));
+    if(size >= 15) compressLength(out, size);
+    out.append(data, size);
+}
+
+std::string compress(const std::string& in) {
+    std::string out;
+    out.reserve(in.size());
+
+    /* Greedy matching with a hash table of last positions of four-byte
+       sequences */
+    std::vector<std::uint32_t> table(1 << CompressionHashBits);
+    const char* const data = in.data();
+    std::size_t anchor = 0;
+    for(std::size_t i = 0; i + CompressionMatchLimit < in.size(); ) {
+        const std::uint32_t sequence = read32(data + i);
+        std::uint32_t& entry = table[(sequence*2654435761u) >> (32 - CompressionHashBits)];
+        const std::size_t candidate = entry;
+        entry = std::uint32_t(i);
+
+        if(candidate >= i || i - candidate > CompressionMaxOffset || read32(data + candidate) != sequence) {
+            ++i;
+            continue;
+        }
+
+        std::size_t length = CompressionMinMatch;
+        while(i + length < in.size() - CompressionLastLiterals && data[candidate + length] == data[i + length])
+            ++length;
+
+        const std::size_t offset = i - candidate;
+        compressLiterals(out, data + anchor, i - anchor, length - CompressionMinMatch);
+        out += char(offset & 0xff);
+        out += char(offset >> 8);
+        if(length - CompressionMinMatch >= 15)
+            compressLength(out, length - CompressionMinMatch);
+
+        i += length;
+        anchor = i;
+    }
+
+    compressLiterals(out, data + anchor, in.size() - anchor, 0);
+    return out;
+}
+
+bool decompress(Containers::ArrayView<const char> in, Containers::ArrayView<char> out) {
+    std::size_t i = 0, o = 0;
+    for(;;) {
+        if(i == in.size()) return false;
+        const unsigned char token = in[i++];
+
+        /* Literals */
+        std::size_t size = token >> 4;
+        if(size == 15) for(unsigned char c = 255; c == 255; size += c) {
+            if(i == in.size()) return false;
+            c = in[i++];
+        }
+        if(size > in.size() - i || size > out.size() - o) return false;
+        std::memcpy(out + o, in + i, size);
+        i += size;
+        o += size;
+
+        /* The last sequence has only literals */
+        if(i == in.size()) return o == out.size();
+
+        /* Match */
+        if(in.size() - i < 2) return false;
+        const std::size_t offset = static_cast<unsigned char>(in[i])|static_cast<unsigned char>(in[i + 1]) << 8;
+        i += 2;
+        if(!offset || offset > o) return false;
+        std::size_t length = token & 0x0f;
+        if(length == 15) for(unsigned char c = 255; c == 255; length += c) {
+            if(i == in.size()) return false;
+            c = in[i++];
+        }
+        length += CompressionMinMatch;
+        if(length > out.size() - o) return false;
+
+        /* Overlapping matches repeat the data, copy byte by byte there */
+        if(offset >= length) std::memcpy(out + o, out + o - offset, length);
+        else for(std::size_t j = 0; j != length; ++j) out[o + j] = out[o + j - offset];
+        o += length;
+    }
+}
+
+/* Pack file layout, all numbers are unsigned 32-bit in native byte order:
+
+    - 8-byte magic
+    - version, file count, group name size, flags, filename data size and
+      data offset
+    - group name, padded to four bytes
+    - filename and data end position for every file
+    - uncompressed size for every file, if PackFlagCompressed is set
+    - alignment of every file, if PackFlagAligned is set
+    - filename data
+    - file data, starting at the data offset, aligned to PackDataAlignment
+      or the largest file alignment, whichever is larger */
+constexpr const char PackMagic[] = "CRDPACK";
+enum: std::size_t {
+    PackVersion = 1,
+    PackHeaderSize = 8 + 6*4,
+    PackFlagCompressed = 1 << 0,
+    PackFlagAligned = 1 << 1,
+    PackDataAlignment = 16
+};
+
+/* Same ordering as std::string::compare(), which is what compile() sorts
+   the files with */
+int compare(Containers::ArrayView<const char> a, Containers::ArrayView<const char> b) {
+    const std::size_t size = std::min(a.size(), b.size());
+    if(const int result = size ? std::memcmp(a.data(), b.data(), size) : 0)
+        return result;
+    return a.size() < b.size() ? -1 : (a.size() > b.size() ? 1 : 0);
+}
+
+}
+
+void Resource::registerData(const char* group, unsigned int count, const unsigned char* positions, const unsigned char* filenames, const unsigned char* data, const unsigned char* uncompressedSizes, const unsigned char* alignments) {
     /* Already registered */
     /** @todo Fix and assert that this doesn't happen */
     if(resources().find(group) != resources().end()) return;
 
     CORRADE_INTERNAL_ASSERT(reinterpret_cast<std::uintptr_t>(positions) % 4 == 0);
+    CORRADE_INTERNAL_ASSERT(reinterpret_cast<std::uintptr_t>(uncompressedSizes) % 4 == 0);
+    CORRADE_INTERNAL_ASSERT(reinterpret_cast<std::uintptr_t>(alignments) % 4 == 0);
+
+    /* Only remember where the compiled-in tables are, the filenames are
+       already sorted by compile() so nothing else needs to be done */
+    GroupData groupData;
+    groupData.count = count;
+    groupData.positions = reinterpret_cast<const unsigned int*>(positions);
+    groupData.filenames = reinterpret_cast<const char*>(filenames);
+    groupData.data = reinterpret_cast<const char*>(data);
+    groupData.uncompressedSizes = reinterpret_cast<const unsigned int*>(uncompressedSizes);
+    groupData.alignments = reinterpret_cast<const unsigned int*>(alignments);
+    if(uncompressedSizes) groupData.cache.reset(new Cache);
+
+    #ifndef CORRADE_NO_ASSERT
+    for(unsigned int i = 1; i < count; ++i) {
+        CORRADE_ASSERT(compare(filenameAt(groupData.positions, groupData.filenames, i - 1), filenameAt(groupData.positions, groupData.filenames, i)) <= 0,
+            "Utility::Resource: filenames in group" << group << "are not sorted, the resource file needs to be recompiled", );
+    }
+    #endif
 
     #ifndef CORRADE_GCC47_COMPATIBILITY
-    const auto groupData = resources().emplace(group, GroupData()).first;
+    resources().emplace(group, std::move(groupData));
     #else
-    const auto groupData = resources().insert(std::make_pair(group, GroupData())).first;
+    resources().insert(std::make_pair(group, std::move(groupData)));
     #endif
+}
 
-    /* Cast to type which can be eaten by std::string constructor */
-    const char* _positions = reinterpret_cast<const char*>(positions);
-    const char* _filenames = reinterpret_cast<const char*>(filenames);
+void Resource::unregisterData(const char* group) {
+    /** @todo test this */
+    auto it = resources().find(group);
+    CORRADE_ASSERT(it != resources().end(),
+        "Utility::Resource: resource group" << group << "is not registered", );
 
-    const unsigned int size = sizeof(unsigned int);
-    unsigned int oldFilenamePosition = 0, oldDataPosition = 0;
+    resources().erase(it);
+}
 
-    /* Every 2*sizeof(unsigned int) is one data */
-    for(unsigned int i = 0; i != count*2*size; i += 2*size) {
-        unsigned int filenamePosition = *reinterpret_cast<const unsigned int*>(_positions+i);
-        unsigned int dataPosition = *reinterpret_cast<const unsigned int*>(_positions+i+size);
+bool Resource::mountPack(const std::string& filename) {
+    #if defined(CORRADE_TARGET_UNIX) || (defined(CORRADE_TARGET_WINDOWS) && !defined(CORRADE_TARGET_WINDOWS_RT))
+    std::unique_ptr<Pack> pack{new Pack{Directory::mapRead(filename, Directory::MapFlag::Random)}};
+    #else
+    std::unique_ptr<Pack> pack{new Pack{Directory::read(filename)}};
+    #endif
+    if(!pack->data) {
+        Error() << "Utility::Resource::mountPack(): can't read" << filename;
+        return false;
+    }
 
-        Containers::ArrayView<const char> res(reinterpret_cast<const char*>(data)+oldDataPosition, dataPosition-oldDataPosition);
+    /* Check the header. All sizes are 32-bit, so summing them in 64 bits
+       can't overflow. */
+    const char* const data = pack->data;
+    const std::uint64_t size = pack->data.size();
+    unsigned int header[6];
+    if(size < PackHeaderSize || std::memcmp(data, PackMagic, 8) != 0) {
+        Error() << "Utility::Resource::mountPack():" << filename << "is not a resource pack";
+        return false;
+    }
+    std::memcpy(header, data + 8, sizeof(header));
+    const unsigned int version = header[0],
+        count = header[1],
+        groupSize = header[2],
+        flags = header[3],
+        filenamesSize = header[4],
+        dataOffset = header[5];
+    if(version != PackVersion) {
+        Error() << "Utility::Resource::mountPack(): unsupported version" << version << "of" << filename;
+        return false;
+    }
 
-        #ifndef CORRADE_GCC47_COMPATIBILITY
-        groupData->second.resources.emplace(std::string(_filenames+oldFilenamePosition, filenamePosition-oldFilenamePosition), res);
-        #else
-        groupData->second.resources.insert(std::make_pair(std::string(_filenames+oldFilenamePosition, filenamePosition-oldFilenamePosition), res));
-        #endif
+    const std::uint64_t positionsOffset = (PackHeaderSize + std::uint64_t{groupSize} + 3) & ~std::uint64_t{3};
+    const std::uint64_t sizesOffset = positionsOffset + std::uint64_t{count}*8;
+    const std::uint64_t alignmentsOffset = sizesOffset + (flags & PackFlagCompressed ? std::uint64_t{count}*4 : 0);
+    const std::uint64_t filenamesOffset = alignmentsOffset + (flags & PackFlagAligned ? std::uint64_t{count}*4 : 0);
+    if((flags & ~(PackFlagCompressed|PackFlagAligned)) || filenamesOffset + filenamesSize > dataOffset || dataOffset > size || dataOffset % PackDataAlignment) {
+        Error() << "Utility::Resource::mountPack():" << filename << "is corrupted";
+        return false;
+    }
 
-        oldFilenamePosition = filenamePosition;
-        oldDataPosition = dataPosition;
+    GroupData groupData;
+    groupData.count = count;
+    groupData.positions = reinterpret_cast<const unsigned int*>(data + positionsOffset);
+    groupData.filenames = data + filenamesOffset;
+    groupData.data = data + dataOffset;
+    groupData.uncompressedSizes = flags & PackFlagCompressed ? reinterpret_cast<const unsigned int*>(data + sizesOffset) : nullptr;
+    groupData.alignments = flags & PackFlagAligned ? reinterpret_cast<const unsigned int*>(data + alignmentsOffset) : nullptr;
+
+    /* Verify that all positions are in bounds, alignments are powers of two
+       and the filenames are sorted so the lookup doesn't need to check
+       anything */
+    for(unsigned int i = 0; i != count; ++i) {
+        const unsigned int filenameEnd = groupData.positions[2*i],
+            dataEnd = groupData.positions[2*i + 1];
+        const unsigned int alignment = groupData.alignments ? groupData.alignments[i] : 1;
+        const std::uint64_t dataBegin = ((i ? groupData.positions[2*(i - 1) + 1] : 0) + std::uint64_t{alignment} - 1) & ~std::uint64_t(alignment - 1);
+        if(filenameEnd > filenamesSize || dataEnd > size - dataOffset ||
+           !alignment || (alignment & (alignment - 1)) || dataOffset % alignment || dataBegin > dataEnd ||
+          (i && (filenameEnd < groupData.positions[2*(i - 1)] ||
+                 compare(filenameAt(groupData.positions, groupData.filenames, i - 1), filenameAt(groupData.positions, groupData.filenames, i)) > 0))) {
+            Error() << "Utility::Resource::mountPack():" << filename << "is corrupted";
+            return false;
+        }
+    }
+
+    const std::string group{data + PackHeaderSize, groupSize};
+    if(resources().find(group) != resources().end()) {
+        Error() << "Utility::Resource::mountPack(): group" << '\'' + group + '\'' << "is already registered";
+        return false;
     }
+
+    groupData.pack = std::move(pack);
+    if(groupData.uncompressedSizes) groupData.cache.reset(new Cache);
+
+    #ifndef CORRADE_GCC47_COMPATIBILITY
+    resources().emplace(group, std::move(groupData));
+    #else
+    resources().insert(std::make_pair(group, std::move(groupData)));
+    #endif
+    return true;
 }
 
-void Resource::unregisterData(const char* group) {
-    /** @todo test this */
+void Resource::unmountPack(const std::string& group) {
     auto it = resources().find(group);
-    CORRADE_ASSERT(it != resources().end(),
-        "Utility::Resource: resource group" << group << "is not registered", );
+    CORRADE_ASSERT(it != resources().end() && it->second.pack,
+        "Utility::Resource::unmountPack(): group" << '\'' + group + '\'' << "is not a mounted pack", );
 
     resources().erase(it);
 }
@@ -140,13 +408,32 @@ template<class T> std::string numberToString(const T& number) {
 }
 #endif
 
+/* The path ends up in a string in the .incbin directive which is itself in a
+   C string literal, so the escaping needs to be done twice */
+std::string incbinPath(const std::string& path) {
+    std::string out;
+    out.reserve(path.size());
+    for(const char c: path) {
+        if(c == '\\') out += "\\\\\\\\";
+        else if(c == '"') out += "\\\\\\\"";
+        else out += c;
+    }
+    return out;
 }
 
-std::string Resource::compileFrom(const std::string& name, const std::string& configurationFile) {
+/* Per-file options from the configuration file */
+struct FileOptions {
+    unsigned int uncompressedSize; /* or zero if not compressed */
+    unsigned int alignment;
+};
+
+enum: unsigned int { MaxAlignment = 4096 };
+
+bool filesFrom(const std::string& configurationFile, std::string& group, std::vector<std::pair<std::string, std::string>>& fileData, std::vector<FileOptions>& options) {
     /* Resource file existence */
     if(!Directory::fileExists(configurationFile)) {
         Error() << "    Error: file" << configurationFile << "does not exist";
-        return {};
+        return false;
     }
 
     const std::string path = Directory::path(configurationFile);
@@ -155,20 +442,26 @@ std::string Resource::compileFrom(const std::string& name, const std::string& co
     /* Group name */
     if(!conf.hasValue("group")) {
         Error() << "    Error: group name is not specified";
-        return {};
+        return false;
     }
-    const std::string group = conf.value("group");
+    group = conf.value("group");
 
     /* Load all files */
     std::vector<const ConfigurationGroup*> files = conf.groups("file");
-    std::vector<std::pair<std::string, std::string>> fileData;
     fileData.reserve(files.size());
+    options.reserve(files.size());
     for(const auto file: files) {
         const std::string filename = file->value("filename");
         const std::string alias = file->hasValue("alias") ? file->value("alias") : filename;
         if(filename.empty() || alias.empty()) {
             Error() << "    Error: filename or alias of file" << fileData.size()+1 << "in group" << group << "is empty";
-            return {};
+            return false;
+        }
+
+        const unsigned int alignment = file->hasValue("align") ? file->value<unsigned int>("align") : 1;
+        if(!alignment || alignment > MaxAlignment || (alignment & (alignment - 1))) {
+            Error() << "    Error: alignment of file" << fileData.size()+1 << "in group" << group << "is not a power of two between 1 and" << MaxAlignment;
+            return false;
         }
 
         bool success;
@@ -176,15 +469,90 @@ std::string Resource::compileFrom(const std::string& name, const std::string& co
         std::tie(success, contents) = fileContents(Directory::join(path, filename));
         if(!success) {
             Error() << "    Error: cannot open file" << filename << "of file" << fileData.size()+1 << "in group" << group;
-            return {};
+            return false;
         }
         fileData.emplace_back(alias, std::string{contents, contents.size()});
+
+        /* Compress the file if requested, but keep it uncompressed if that
+           wouldn't make it smaller */
+        std::string& data = fileData.back().second;
+        if(file->value<bool>("compress") && !data.empty()) {
+            std::string compressed = compress(data);
+            if(compressed.size() < data.size()) {
+                options.push_back({unsigned(data.size()), alignment});
+                data = std::move(compressed);
+                continue;
+            }
+        }
+        options.push_back({0, alignment});
     }
 
-    return compile(name, group, fileData);
+    return true;
 }
 
-std::string Resource::compile(const std::string& name, const std::string& group, const std::vector<std::pair<std::string, std::string>>& files) {
+/* Sort the files by filename so getRaw() can do a binary search directly on
+   the compiled-in data. The sort is stable so in case of duplicates it's
+   still the first one that's found. */
+std::vector<std::size_t> sortedFiles(const std::vector<std::pair<std::string, std::string>>& files) {
+    std::vector<std::size_t> sorted;
+    sorted.reserve(files.size());
+    for(std::size_t i = 0; i != files.size(); ++i) sorted.push_back(i);
+    std::stable_sort(sorted.begin(), sorted.end(), [&files](std::size_t a, std::size_t b) {
+        return files[a].first < files[b].first;
+    });
+    return sorted;
+}
+
+/* Layout of the data. Files are placed one after another, with padding
+   inserted before files that need to be aligned. */
+struct DataLayout {
+    std::vector<std::size_t> sorted;
+    std::vector<unsigned int> padding;
+    unsigned int maxAlignment;
+    bool compressed, aligned;
+};
+
+DataLayout dataLayout(const std::vector<std::pair<std::string, std::string>>& files, const std::vector<FileOptions>& options) {
+    DataLayout layout{sortedFiles(files), {}, 1, false, false};
+    layout.padding.reserve(files.size());
+    std::size_t offset = 0;
+    for(const std::size_t file: layout.sorted) {
+        const FileOptions fileOptions = options.empty() ? FileOptions{0, 1} : options[file];
+        const std::size_t padding = (fileOptions.alignment - offset % fileOptions.alignment) % fileOptions.alignment;
+        layout.padding.push_back(padding);
+        layout.maxAlignment = std::max(layout.maxAlignment, fileOptions.alignment);
+        layout.compressed = layout.compressed || fileOptions.uncompressedSize;
+        layout.aligned = layout.aligned || fileOptions.alignment != 1;
+        offset += padding + files[file].second.size();
+    }
+    return layout;
+}
+
+/* Zeros used for padding the data, never more than the max alignment */
+constexpr const char Zeros[MaxAlignment]{};
+
+/* If dataFilename is not null, the data are written there and referenced
+   using .incbin instead of being converted to hexacodes. If options are not
+   empty, they contain uncompressed size and alignment for every file. */
+std::string compileInternal(const std::string& name, const std::string& group, const std::vector<std::pair<std::string, std::string>>& files, const std::vector<FileOptions>& options, const std::string* const dataFilename) {
+    const DataLayout layout = dataLayout(files, options);
+    const std::vector<std::size_t>& sorted = layout.sorted;
+
+    /* Write the data file. Done also for an empty file list so the build
+       system always gets the output it expects. */
+    if(dataFilename) {
+        std::vector<Containers::ArrayView<const void>> views;
+        views.reserve(sorted.size()*2);
+        for(std::size_t i = 0; i != sorted.size(); ++i) {
+            if(layout.padding[i]) views.emplace_back(Zeros, layout.padding[i]);
+            views.emplace_back(files[sorted[i]].second.data(), files[sorted[i]].second.size());
+        }
+        if(!Directory::write(*dataFilename, Containers::ArrayView<const Containers::ArrayView<const void>>{views.data(), views.size()})) {
+            Error() << "    Error: cannot write data file" << *dataFilename;
+            return {};
+        }
+    }
+
     /* Special case for empty file list */
     if(files.empty()) {
         return "/* Compiled resource file. DO NOT EDIT! */\n\n"
@@ -203,17 +571,21 @@ std::string Resource::compile(const std::string& name, const std::string& group,
             "} CORRADE_AUTOMATIC_FINALIZER(resourceFinalizer_" + name + ")\n";
     }
 
-    std::string positions, filenames, data;
+    std::string positions, filenames, data, sizes, alignments;
     unsigned int filenamesLen = 0, dataLen = 0;
+    const bool compressed = layout.compressed;
+    const bool aligned = layout.aligned;
 
     /* Convert data to hexacodes */
-    for(auto it = files.cbegin(); it != files.cend(); ++it) {
+    for(auto file = sorted.cbegin(); file != sorted.cend(); ++file) {
+        const auto it = &files[*file];
+        const unsigned int padding = layout.padding[file - sorted.cbegin()];
         filenamesLen += it->first.size();
-        dataLen += it->second.size();
+        dataLen += padding + it->second.size();
 
-        if(it != files.begin()) {
+        if(file != sorted.begin()) {
             filenames += '\n';
-            data += '\n';
+            if(!dataFilename) data += '\n';
         }
 
         positions += hexcode(numberToString(filenamesLen));
@@ -222,27 +594,85 @@ std::string Resource::compile(const std::string& name, const std::string& group,
         filenames += comment(it->first);
         filenames += hexcode(it->first);
 
-        data += comment(it->first);
-        data += hexcode(it->second);
+        if(compressed)
+            sizes += hexcode(numberToString(options[*file].uncompressedSize));
+        if(aligned)
+            alignments += hexcode(numberToString(options[*file].alignment));
+
+        if(!dataFilename) {
+            if(padding) {
+                data += comment("padding");
+                data += hexcode(std::string(padding, '\0'));
+                data += '\n';
+            }
+            data += comment(it->first);
+            data += hexcode(it->second);
+        }
     }
 
     /* Remove last comma from positions and filenames array */
     positions.resize(positions.size()-1);
     filenames.resize(filenames.size()-1);
-
-    /* Remove last comma from data array only if the last file is not empty */
-    if(!files.back().second.empty())
-        data.resize(data.size()-1);
+    if(compressed) sizes.resize(sizes.size()-1);
+    if(aligned) alignments.resize(alignments.size()-1);
+
+    /* Alignment of the whole data array */
+    std::string dataAlignment;
+    if(layout.maxAlignment != 1) {
+        std::ostringstream out;
+        out << layout.maxAlignment;
+        dataAlignment = out.str();
+    }
 
     #if defined(CORRADE_TARGET_ANDROID)
     std::ostringstream converter;
     converter << files.size();
     #endif
 
+    /* The data either go to a hexcode array or are pulled in by the
+       assembler. If we don't have any data, we don't create the resourceData
+       array, as zero-length arrays are not allowed. */
+    std::string dataDefinition, dataName;
+    if(dataFilename) {
+        dataName = "corradeResourceData_" + name;
+        if(dataLen) dataDefinition =
+            "#if defined(CORRADE_TARGET_APPLE)\n"
+            "__asm__(\".pushsection __TEXT,__const\\n\"\n" +
+            (dataAlignment.empty() ? "" : "        \".balign " + dataAlignment + "\\n\"\n") +
+            "        \".globl _" + dataName + "\\n\"\n"
+            "        \".private_extern _" + dataName + "\\n\"\n"
+            "        \"_" + dataName + ":\\n\"\n"
+            "        \".incbin \\\"" + incbinPath(*dataFilename) + "\\\"\\n\"\n"
+            "        \".popsection\\n\");\n"
+            "#elif defined(__ELF__)\n"
+            "__asm__(\".pushsection .rodata\\n\"\n" +
+            (dataAlignment.empty() ? "" : "        \".balign " + dataAlignment + "\\n\"\n") +
+            "        \".globl " + dataName + "\\n\"\n"
+            "        \".hidden " + dataName + "\\n\"\n"
+            "        \"" + dataName + ":\\n\"\n"
+            "        \".incbin \\\"" + incbinPath(*dataFilename) + "\\\"\\n\"\n"
+            "        \".popsection\\n\");\n"
+            "#else\n"
+            "#error resources embedded with .incbin are supported only with GCC and Clang on ELF and Apple platforms\n"
+            "#endif\n"
+            "extern \"C\" const unsigned char " + dataName + "[];\n\n";
+    } else {
+        dataName = "resourceData";
+
+        /* Remove last comma from data array only if the last file is not
+           empty */
+        if(!files[sorted.back()].second.empty())
+            data.resize(data.size()-1);
+
+        dataDefinition = (dataLen ? "" : "// ") +
+            (dataAlignment.empty() ? "" : "CORRADE_ALIGNAS(" + dataAlignment + ") ") +
+            "static const unsigned char resourceData[] = {" +
+            data + '\n' + (dataLen ? "" : "// ") + "};\n\n";
+    }
+
     /* Return C++ file. The functions have forward declarations to avoid warning
        about functions which don't have corresponding declarations (enabled by
-       -Wmissing-declarations in GCC). If we don't have any data, we don't
-       create the resourceData array, as zero-length arrays are not allowed. */
+       -Wmissing-declarations in GCC). */
     return "/* Compiled resource file. DO NOT EDIT! */\n\n"
         "#include \"Corrade/Corrade.h\"\n"
         "#include \"Corrade/Utility/Macros.h\"\n"
@@ -251,8 +681,9 @@ std::string Resource::compile(const std::string& name, const std::string& group,
         positions + "\n};\n\n"
         "static const unsigned char resourceFilenames[] = {" +
         filenames + "\n};\n\n" +
-        (dataLen ? "" : "// ") + "static const unsigned char resourceData[] = {" +
-        data + '\n' + (dataLen ? "" : "// ") + "};\n\n" +
+        dataDefinition +
+        (compressed ? "CORRADE_ALIGNAS(4) static const unsigned char resourceUncompressedSizes[] = {" + sizes + "\n};\n\n" : "") +
+        (aligned ? "CORRADE_ALIGNAS(4) static const unsigned char resourceAlignments[] = {" + alignments + "\n};\n\n" : "") +
         "int resourceInitializer_" + name + "();\n"
         "int resourceInitializer_" + name + "() {\n"
         "    Corrade::Utility::Resource::registerData(\"" + group + "\", " +
@@ -261,7 +692,7 @@ std::string Resource::compile(const std::string& name, const std::string& group,
             #else
             converter.str() +
             #endif
-        ", resourcePositions, resourceFilenames, " + (dataLen ? "resourceData" : "nullptr") + ");\n"
+        ", resourcePositions, resourceFilenames, " + (dataLen ? dataName : "nullptr") + (compressed ? ", resourceUncompressedSizes" : aligned ? ", nullptr" : "") + (aligned ? ", resourceAlignments" : "") + ");\n"
         "    return 1;\n"
         "} CORRADE_AUTOMATIC_INITIALIZER(resourceInitializer_" + name + ")\n\n"
         "int resourceFinalizer_" + name + "();\n"
@@ -271,6 +702,96 @@ std::string Resource::compile(const std::string& name, const std::string& group,
         "} CORRADE_AUTOMATIC_FINALIZER(resourceFinalizer_" + name + ")\n";
 }
 
+std::string compilePackInternal(const std::string& group, const std::vector<std::pair<std::string, std::string>>& files, const std::vector<FileOptions>& options) {
+    const DataLayout layout = dataLayout(files, options);
+    const std::vector<std::size_t>& sorted = layout.sorted;
+    const bool compressed = layout.compressed;
+    const bool aligned = layout.aligned;
+
+    std::string positions, sizes, alignments, filenames;
+    std::size_t dataSize = 0;
+    for(std::size_t i = 0; i != sorted.size(); ++i) {
+        const std::size_t file = sorted[i];
+        filenames += files[file].first;
+        dataSize += layout.padding[i] + files[file].second.size();
+        positions += numberToString<unsigned int>(filenames.size());
+        positions += numberToString<unsigned int>(dataSize);
+        if(compressed)
+            sizes += numberToString(options[file].uncompressedSize);
+        if(aligned)
+            alignments += numberToString(options[file].alignment);
+    }
+
+    const std::size_t groupEnd = PackHeaderSize + group.size();
+    const std::size_t filenamesEnd = ((groupEnd + 3) & ~std::size_t{3}) + positions.size() + sizes.size() + alignments.size() + filenames.size();
+    const std::size_t dataAlignment = std::max<std::size_t>(PackDataAlignment, layout.maxAlignment);
+    const std::size_t dataOffset = (filenamesEnd + dataAlignment - 1) & ~(dataAlignment - 1);
+
+    std::string out;
+    out.reserve(dataOffset + dataSize);
+    out.append(PackMagic, 8);
+    out += numberToString<unsigned int>(PackVersion);
+    out += numberToString<unsigned int>(sorted.size());
+    out += numberToString<unsigned int>(group.size());
+    out += numberToString<unsigned int>((compressed ? unsigned(PackFlagCompressed) : 0u)|(aligned ? unsigned(PackFlagAligned) : 0u));
+    out += numberToString<unsigned int>(filenames.size());
+    out += numberToString<unsigned int>(dataOffset);
+    out += group;
+    out.resize((groupEnd + 3) & ~std::size_t{3});
+    out += positions;
+    out += sizes;
+    out += alignments;
+    out += filenames;
+    out.resize(dataOffset);
+    for(std::size_t i = 0; i != sorted.size(); ++i) {
+        out.append(layout.padding[i], '\0');
+        out += files[sorted[i]].second;
+    }
+
+    return out;
+}
+
+}
+
+std::string Resource::compileFrom(const std::string& name, const std::string& configurationFile) {
+    std::string group;
+    std::vector<std::pair<std::string, std::string>> files;
+    std::vector<FileOptions> options;
+    if(!filesFrom(configurationFile, group, files, options)) return {};
+
+    return compileInternal(name, group, files, options, nullptr);
+}
+
+std::string Resource::compileIncbinFrom(const std::string& name, const std::string& configurationFile, const std::string& dataFilename) {
+    std::string group;
+    std::vector<std::pair<std::string, std::string>> files;
+    std::vector<FileOptions> options;
+    if(!filesFrom(configurationFile, group, files, options)) return {};
+
+    return compileInternal(name, group, files, options, &dataFilename);
+}
+
+std::string Resource::compile(const std::string& name, const std::string& group, const std::vector<std::pair<std::string, std::string>>& files) {
+    return compileInternal(name, group, files, {}, nullptr);
+}
+
+std::string Resource::compilePack(const std::string& group, const std::vector<std::pair<std::string, std::string>>& files) {
+    return compilePackInternal(group, files, {});
+}
+
+std::string Resource::compilePackFrom(const std::string& configurationFile) {
+    std::string group;
+    std::vector<std::pair<std::string, std::string>> files;
+    std::vector<FileOptions> options;
+    if(!filesFrom(configurationFile, group, files, options)) return {};
+
+    return compilePackInternal(group, files, options);
+}
+
+std::string Resource::compileIncbin(const std::string& name, const std::string& group, const std::vector<std::pair<std::string, std::string>>& files, const std::string& dataFilename) {
+    return compileInternal(name, group, files, {}, &dataFilename);
+}
+
 void Resource::overrideGroup(const std::string& group, const std::string& configurationFile) {
     auto it = resources().find(group);
     CORRADE_ASSERT(it != resources().end(),
@@ -306,10 +827,18 @@ Resource::~Resource() {
 std::vector<std::string> Resource::list() const {
     CORRADE_INTERNAL_ASSERT(_group != resources().end());
 
+    const GroupData& group = _group->second;
     std::vector<std::string> result;
-    result.reserve(_group->second.resources.size());
-    for(const auto& filename: _group->second.resources)
-        result.push_back(filename.first);
+    result.reserve(group.count);
+    for(unsigned int i = 0; i != group.count; ++i) {
+        const Containers::ArrayView<const char> filename = filenameAt(group.positions, group.filenames, i);
+
+        /* Duplicates are next to each other, list each name just once */
+        if(i && compare(filenameAt(group.positions, group.filenames, i - 1), filename) == 0)
+            continue;
+
+        result.emplace_back(filename.data(), filename.size());
+    }
 
     return result;
 }
@@ -354,11 +883,66 @@ Containers::ArrayView<const char> Resource::getRaw(const std::string& filename)
                   << "was not found in overriden group, fallback to compiled-in resources";
     }
 
-    const auto it = _group->second.resources.find(filename);
-    CORRADE_ASSERT(it != _group->second.resources.end(),
+    /* Lower bound on the sorted filenames, so the first one is found in case
+       there are duplicates */
+    const GroupData& group = _group->second;
+    const Containers::ArrayView<const char> name{filename.data(), filename.size()};
+    unsigned int first = 0, count = group.count;
+    while(count) {
+        const unsigned int half = count/2;
+        if(compare(filenameAt(group.positions, group.filenames, first + half), name) < 0) {
+            first += half + 1;
+            count -= half + 1;
+        } else count = half;
+    }
+
+    CORRADE_ASSERT(first != group.count && compare(filenameAt(group.positions, group.filenames, first), name) == 0,
         "Utility::Resource::get(): file" << '\'' + filename + '\'' << "was not found in group" << '\'' + _group->first + '\'', nullptr);
 
-    return it->second;
+    const Containers::ArrayView<const char> data = dataAt(group.positions, group.alignments, group.data, first);
+    if(!group.uncompressedSizes || !group.uncompressedSizes[first]) return data;
+
+    /* Decompress the file on first access. If the file needs to be aligned,
+       allocate more and decompress to an aligned offset inside. */
+    const std::size_t size = group.uncompressedSizes[first];
+    const std::size_t alignment = group.alignments ? group.alignments[first] : 1;
+    std::lock_guard<std::mutex> lock{group.cache->mutex};
+    if(group.cache->data.empty())
+        group.cache->data = Containers::Array<Containers::Array<char>>{Containers::ValueInit, group.count};
+    Containers::Array<char>& decompressed = group.cache->data[first];
+    if(decompressed.empty()) {
+        Containers::Array<char> out{Containers::NoInit, size + alignment - 1};
+        if(!decompress(data, {alignedPointer(out, alignment), size})) {
+            Error() << "Utility::Resource::get(): file" << '\'' + filename + '\'' << "in group" << '\'' + _group->first + '\'' << "is corrupted";
+            return nullptr;
+        }
+        decompressed = std::move(out);
+    }
+
+    return {alignedPointer(decompressed, alignment), size};
+}
+
+std::size_t Resource::cacheSize() const {
+    CORRADE_INTERNAL_ASSERT(_group != resources().end());
+
+    const GroupData& group = _group->second;
+    if(!group.cache) return 0;
+
+    std::lock_guard<std::mutex> lock{group.cache->mutex};
+    std::size_t size = 0;
+    for(const Containers::Array<char>& data: group.cache->data)
+        size += data.size();
+    return size;
+}
+
+void Resource::evictCache() {
+    CORRADE_INTERNAL_ASSERT(_group != resources().end());
+
+    const GroupData& group = _group->second;
+    if(!group.cache) return;
+
+    std::lock_guard<std::mutex> lock{group.cache->mutex};
+    group.cache->data = nullptr;
 }
 
 std::string Resource::get(const std::string& filename) const {
@@ -30,6 +30,7 @@
  */
 
 #include <map>
+#include <memory>
 #include <string>
 #include <utility>
 #include <vector>
@@ -72,8 +73,37 @@ filename=license.txt
 [file]
 filename=levels-insane.conf
 alias=levels-easy.conf
+
+[file]
+filename=../resources/dictionary.txt
+compress=true
+
+[file]
+filename=../resources/vertices.bin
+align=64
 @endcode
 
+Files with @cb{.ini} compress=true @ce are stored compressed with a fast
+LZ77-based codec (compatible with the LZ4 block format). Nothing is
+decompressed during startup, the file is decompressed on first access
+through @ref getRaw() or @ref get() into a cache owned by the group and
+subsequent accesses return the cached data. The cache is shared by all
+@ref Resource instances for the same group, it's safe to access from
+multiple threads and can be emptied with @ref evictCache(). If compression
+doesn't make the file smaller, it's stored uncompressed. The option is
+ignored when overriding the group with live data using @ref overrideGroup().
+
+Files with @cb{.ini} align=N @ce, where @cb{.ini} N @ce is a power of two
+not larger than 4096, are placed at an address that's a multiple of
+@cb{.ini} N @ce, so the data can be directly used for example as a vertex
+buffer or through SIMD loads. The alignment is honored for compiled-in data,
+for data embedded via @cpp .incbin @ce, for memory-mapped packs and for
+compressed files decompressed into the cache. If the pack can't be
+memory-mapped and is read into memory instead, only 16-byte alignment is
+guaranteed. Groups with no explicit alignment don't need any padding or
+extra alignment tables. Like compression, the option is ignored when
+overriding the group with live data using @ref overrideGroup().
+
 @todo Ad-hoc resources
 @todo Test data unregistering
  */
@@ -85,7 +115,11 @@ class CORRADE_UTILITY_EXPORT Resource {
          * @param group         Group name
          * @param files         Files (pairs of filename, file data)
          *
-         * Produces C++ file with hexadecimal data representation.
+         * Produces C++ file with hexadecimal data representation. The files
+         * are sorted by filename in the output so they can be looked up
+         * directly in the compiled-in data without building any additional
+         * index at runtime. If there is more than one file with the same
+         * name, only the first one is accessible.
          */
         static std::string compile(const std::string& name, const std::string& group, const std::vector<std::pair<std::string, std::string>>& files);
 
@@ -100,6 +134,88 @@ class CORRADE_UTILITY_EXPORT Resource {
          */
         static std::string compileFrom(const std::string& name, const std::string& configurationFile);
 
+        /**
+         * @brief Compile data resource file with data embedded by the assembler
+         * @param name          Resource name (see @ref CORRADE_RESOURCE_INITIALIZE())
+         * @param group         Group name
+         * @param files         Files (pairs of filename, file data)
+         * @param dataFilename  File to write the data to
+         *
+         * Compared to @ref compile(), the file data are not converted to a
+         * hexadecimal representation but written as-is to @p dataFilename
+         * and the produced C++ file pulls them in using the `.incbin`
+         * assembler directive. That makes both the generation and the
+         * compilation significantly faster for large files. The
+         * @p dataFilename is embedded into the output verbatim, so it should
+         * be absolute. The output can be compiled only with GCC and Clang
+         * on ELF and Apple platforms. Returns empty string if the data file
+         * can't be written.
+         */
+        static std::string compileIncbin(const std::string& name, const std::string& group, const std::vector<std::pair<std::string, std::string>>& files, const std::string& dataFilename);
+
+        /**
+         * @brief Compile data resource file with data embedded by the assembler using configuration file
+         * @param name          Resource name (see @ref CORRADE_RESOURCE_INITIALIZE())
+         * @param configurationFile Filename of configuration file
+         * @param dataFilename  File to write the data to
+         *
+         * Same as @ref compileFrom(), but with the data written to a
+         * separate file, see @ref compileIncbin() for details.
+         */
+        static std::string compileIncbinFrom(const std::string& name, const std::string& configurationFile, const std::string& dataFilename);
+
+        /**
+         * @brief Compile resource pack
+         * @param group         Group name
+         * @param files         Files (pairs of filename, file data)
+         *
+         * Produces a binary pack that can be loaded at runtime using
+         * @ref mountPack(). The pack contains the group name, an index
+         * sorted by filename and the file data, which start at a 16-byte
+         * aligned offset. Numbers in the index are stored in the byte order
+         * of the platform the pack was created on.
+         */
+        static std::string compilePack(const std::string& group, const std::vector<std::pair<std::string, std::string>>& files);
+
+        /**
+         * @brief Compile resource pack using configuration file
+         * @param configurationFile Filename of configuration file
+         *
+         * Same as @ref compilePack(), but with the group name and files
+         * taken from a configuration file, see @ref compileFrom() for
+         * details. Files marked for compression are compressed in the pack
+         * as well. Returns empty string on error.
+         */
+        static std::string compilePackFrom(const std::string& configurationFile);
+
+        /**
+         * @brief Mount resource pack
+         * @param filename      Filename of a pack produced by
+         *      @ref compilePack() or @ref compilePackFrom()
+         *
+         * Maps the pack into memory using @ref Directory::mapRead() and
+         * registers its group, so it can be accessed the same way as
+         * compiled-in resources. @ref getRaw() returns views directly into
+         * the mapped file except for compressed files. The index is
+         * validated on mount, so lookups don't need any additional checks.
+         * If the file can't be read, is not a valid pack or the group is
+         * already registered, prints a message to @ref Error and returns
+         * @cpp false @ce. On platforms without memory mapping support the
+         * whole file is read into memory instead.
+         * @see @ref unmountPack()
+         */
+        static bool mountPack(const std::string& filename);
+
+        /**
+         * @brief Unmount resource pack
+         * @param group         Group name
+         *
+         * Expects that the group was registered using @ref mountPack(). All
+         * data returned from the group become invalid and no @ref Resource
+         * instance for the group should exist at that point.
+         */
+        static void unmountPack(const std::string& group);
+
         /**
          * @brief Override group
          * @param group         Group name
@@ -131,8 +247,9 @@ class CORRADE_UTILITY_EXPORT Resource {
         /**
          * @brief List of all resources in the group
          *
-         * Note that the list contains only list of compiled-in files, no
-         * additional filenames from overriden group are incluuded.
+         * The list is sorted. Note that the list contains only list of
+         * compiled-in files, no additional filenames from overriden group are
+         * incluuded.
          */
         std::vector<std::string> list() const;
 
@@ -141,7 +258,11 @@ class CORRADE_UTILITY_EXPORT Resource {
          * @param filename      Filename in UTF-8
          *
          * Returns reference to data of given file in the group. The file must
-         * exist. If the file is empty, returns @cpp nullptr @ce.
+         * exist. If the file is empty, returns @cpp nullptr @ce. The lookup
+         * is a binary search directly on the compiled-in data and doesn't
+         * allocate. If the file is compressed, it's decompressed on the
+         * first call and the returned view points into the group cache, see
+         * @ref Utility-Resource-conf for more information.
          */
         Containers::ArrayView<const char> getRaw(const std::string& filename) const;
 
@@ -153,20 +274,61 @@ class CORRADE_UTILITY_EXPORT Resource {
          */
         std::string get(const std::string& filename) const;
 
+        /**
+         * @brief Size of decompressed data cached for the group
+         *
+         * Sum of sizes of all compressed files in the group that were
+         * accessed since the group was registered or since the last call to
+         * @ref evictCache(). For files with an explicit alignment this
+         * includes also the padding needed to align the decompressed data.
+         */
+        std::size_t cacheSize() const;
+
+        /**
+         * @brief Evict decompressed data cached for the group
+         *
+         * Frees data of all compressed files in the group that were
+         * decompressed by @ref getRaw() or @ref get(). The group cache is
+         * shared among all @ref Resource instances, so views returned by
+         * @ref getRaw() for compressed files from any instance become
+         * invalid. Views to uncompressed files are not affected.
+         */
+        void evictCache();
+
     #ifdef DOXYGEN_GENERATING_OUTPUT
     private:
     #endif
         /* Internal use only. */
-        static void registerData(const char* group, unsigned int count, const unsigned char* positions, const unsigned char* filenames, const unsigned char* data);
+        static void registerData(const char* group, unsigned int count, const unsigned char* positions, const unsigned char* filenames, const unsigned char* data, const unsigned char* uncompressedSizes = nullptr, const unsigned char* alignments = nullptr);
         static void unregisterData(const char* group);
 
     private:
+        struct Cache;
+        struct Pack;
         struct CORRADE_UTILITY_LOCAL GroupData {
             explicit GroupData();
+            GroupData(GroupData&&) noexcept;
             ~GroupData();
 
             std::string overrideGroup;
-            std::map<std::string, Containers::ArrayView<const char>> resources;
+
+            /* Pointers to the compiled-in tables, filenames are sorted so
+               the lookup can be done with a binary search directly on them */
+            unsigned int count;
+            const unsigned int* positions;
+            const char* filenames;
+            const char* data;
+
+            /* Uncompressed size for every file or zero if the file is not
+               compressed. Null and no cache if nothing is compressed. */
+            const unsigned int* uncompressedSizes;
+            std::unique_ptr<Cache> cache;
+
+            /* Alignment for every file, null if no file needs it */
+            const unsigned int* alignments;
+
+            /* Mapped file if the group comes from mountPack() */
+            std::unique_ptr<Pack> pack;
         };
 
         struct OverrideData;
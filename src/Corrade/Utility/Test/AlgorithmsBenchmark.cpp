@@ -0,0 +1,335 @@
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <algorithm>
+#include <cstdint>
+
+#include "Corrade/Containers/Array.h"
+#include "Corrade/TestSuite/Tester.h"
+#include "Corrade/Utility/Algorithms.h"
+
+namespace Corrade { namespace Utility { namespace Test {
+
+struct AlgorithmsBenchmark: TestSuite::Tester {
+    explicit AlgorithmsBenchmark();
+
+    template<class T> void copyNaive();
+    template<class T> void copy();
+    template<class T> void copyStridedNaive();
+    template<class T> void copyStrided();
+
+    template<class T> void fillNaive();
+    template<class T> void fill();
+
+    template<class T> void findNaive();
+    template<class T> void find();
+
+    template<class T> void countNaive();
+    template<class T> void count();
+
+    template<class T> void equalNaive();
+    template<class T> void equal();
+
+    template<class T> void minNaive();
+    template<class T> void min();
+    template<class T> void minmaxNaive();
+    template<class T> void minmax();
+};
+
+/* All benchmarks operate on the same amount of bytes regardless of the type */
+enum: std::size_t { Size = 1 << 20 };
+
+AlgorithmsBenchmark::AlgorithmsBenchmark() {
+    addBenchmarks<AlgorithmsBenchmark>({&AlgorithmsBenchmark::copyNaive<std::uint8_t>,
+                                        &AlgorithmsBenchmark::copy<std::uint8_t>,
+                                        &AlgorithmsBenchmark::copyNaive<std::int32_t>,
+                                        &AlgorithmsBenchmark::copy<std::int32_t>,
+                                        &AlgorithmsBenchmark::copyStridedNaive<std::uint8_t>,
+                                        &AlgorithmsBenchmark::copyStrided<std::uint8_t>,
+                                        &AlgorithmsBenchmark::copyStridedNaive<std::int32_t>,
+                                        &AlgorithmsBenchmark::copyStrided<std::int32_t>,
+
+                                        &AlgorithmsBenchmark::fillNaive<std::uint8_t>,
+                                        &AlgorithmsBenchmark::fill<std::uint8_t>,
+                                        &AlgorithmsBenchmark::fillNaive<std::int32_t>,
+                                        &AlgorithmsBenchmark::fill<std::int32_t>,
+
+                                        &AlgorithmsBenchmark::findNaive<std::uint8_t>,
+                                        &AlgorithmsBenchmark::find<std::uint8_t>,
+                                        &AlgorithmsBenchmark::findNaive<std::int16_t>,
+                                        &AlgorithmsBenchmark::find<std::int16_t>,
+                                        &AlgorithmsBenchmark::findNaive<std::int32_t>,
+                                        &AlgorithmsBenchmark::find<std::int32_t>,
+                                        &AlgorithmsBenchmark::findNaive<std::int64_t>,
+                                        &AlgorithmsBenchmark::find<std::int64_t>,
+
+                                        &AlgorithmsBenchmark::countNaive<std::uint8_t>,
+                                        &AlgorithmsBenchmark::count<std::uint8_t>,
+                                        &AlgorithmsBenchmark::countNaive<std::int16_t>,
+                                        &AlgorithmsBenchmark::count<std::int16_t>,
+                                        &AlgorithmsBenchmark::countNaive<std::int32_t>,
+                                        &AlgorithmsBenchmark::count<std::int32_t>,
+                                        &AlgorithmsBenchmark::countNaive<std::int64_t>,
+                                        &AlgorithmsBenchmark::count<std::int64_t>,
+
+                                        &AlgorithmsBenchmark::equalNaive<std::uint8_t>,
+                                        &AlgorithmsBenchmark::equal<std::uint8_t>,
+                                        &AlgorithmsBenchmark::equalNaive<std::int32_t>,
+                                        &AlgorithmsBenchmark::equal<std::int32_t>,
+
+                                        &AlgorithmsBenchmark::minNaive<std::uint8_t>,
+                                        &AlgorithmsBenchmark::min<std::uint8_t>,
+                                        &AlgorithmsBenchmark::minNaive<std::int16_t>,
+                                        &AlgorithmsBenchmark::min<std::int16_t>,
+                                        &AlgorithmsBenchmark::minNaive<std::int32_t>,
+                                        &AlgorithmsBenchmark::min<std::int32_t>,
+                                        &AlgorithmsBenchmark::minNaive<std::int64_t>,
+                                        &AlgorithmsBenchmark::min<std::int64_t>,
+                                        &AlgorithmsBenchmark::minNaive<float>,
+                                        &AlgorithmsBenchmark::min<float>,
+                                        &AlgorithmsBenchmark::minmaxNaive<std::int32_t>,
+                                        &AlgorithmsBenchmark::minmax<std::int32_t>,
+                                        &AlgorithmsBenchmark::minmaxNaive<float>,
+                                        &AlgorithmsBenchmark::minmax<float>}, 10);
+}
+
+namespace {
+
+template<class> struct TypeName;
+template<> struct TypeName<std::uint8_t> { static const char* name() { return "std::uint8_t"; } };
+template<> struct TypeName<std::int16_t> { static const char* name() { return "std::int16_t"; } };
+template<> struct TypeName<std::int32_t> { static const char* name() { return "std::int32_t"; } };
+template<> struct TypeName<std::int64_t> { static const char* name() { return "std::int64_t"; } };
+template<> struct TypeName<float> { static const char* name() { return "float"; } };
+
+/* Values spread over the whole type range, never equal to 127 */
+template<class T> Containers::Array<T> data() {
+    Containers::Array<T> out{Size/sizeof(T)};
+    for(std::size_t i = 0; i != out.size(); ++i)
+        out[i] = T((i*2654435761u) % 97);
+    return out;
+}
+
+}
+
+template<class T> void AlgorithmsBenchmark::copyNaive() {
+    setTestCaseDescription(TypeName<T>::name());
+
+    Containers::Array<T> src = data<T>();
+    Containers::Array<T> dst{Containers::ValueInit, src.size()};
+    CORRADE_BENCHMARK(1) {
+        /* Volatile to prevent the compiler from turning it into memcpy() */
+        volatile T* out = dst.data();
+        for(std::size_t i = 0; i != src.size(); ++i) out[i] = src[i];
+    }
+
+    CORRADE_COMPARE(dst[dst.size() - 1], src[src.size() - 1]);
+}
+
+template<class T> void AlgorithmsBenchmark::copy() {
+    setTestCaseDescription(TypeName<T>::name());
+
+    Containers::Array<T> src = data<T>();
+    Containers::Array<T> dst{Containers::ValueInit, src.size()};
+    CORRADE_BENCHMARK(1)
+        Utility::copy(Containers::ArrayView<const T>{src}, Containers::ArrayView<T>{dst});
+
+    CORRADE_COMPARE(dst[dst.size() - 1], src[src.size() - 1]);
+}
+
+template<class T> void AlgorithmsBenchmark::copyStridedNaive() {
+    setTestCaseDescription(TypeName<T>::name());
+
+    /* Copying a 512x512 sub-rectangle from the middle of a 1024x1024 image
+       into a contiguous one */
+    Containers::Array<T> src{Containers::ValueInit, 1024*1024};
+    Containers::Array<T> dst{Containers::ValueInit, 512*512};
+    src[512*1024 + 512] = T(3);
+    const Containers::StridedArrayView2D<const T> srcView = Containers::StridedArrayView2D<const T>{src, {1024, 1024}}.slice({256, 256}, {768, 768});
+    const Containers::StridedArrayView2D<T> dstView{dst, {512, 512}};
+    CORRADE_BENCHMARK(1) {
+        for(std::size_t i = 0; i != 512; ++i) {
+            const Containers::StridedArrayView1D<const T> srcRow = srcView[i];
+            const Containers::StridedArrayView1D<T> dstRow = dstView[i];
+            for(std::size_t j = 0; j != 512; ++j) dstRow[j] = srcRow[j];
+        }
+    }
+
+    CORRADE_COMPARE(dst[256*512 + 256], T(3));
+}
+
+template<class T> void AlgorithmsBenchmark::copyStrided() {
+    setTestCaseDescription(TypeName<T>::name());
+
+    Containers::Array<T> src{Containers::ValueInit, 1024*1024};
+    Containers::Array<T> dst{Containers::ValueInit, 512*512};
+    src[512*1024 + 512] = T(3);
+    const Containers::StridedArrayView2D<const T> srcView = Containers::StridedArrayView2D<const T>{src, {1024, 1024}}.slice({256, 256}, {768, 768});
+    const Containers::StridedArrayView2D<T> dstView{dst, {512, 512}};
+    CORRADE_BENCHMARK(1)
+        Utility::copy(srcView, dstView);
+
+    CORRADE_COMPARE(dst[256*512 + 256], T(3));
+}
+
+template<class T> void AlgorithmsBenchmark::fillNaive() {
+    setTestCaseDescription(TypeName<T>::name());
+
+    Containers::Array<T> a{Containers::ValueInit, Size/sizeof(T)};
+    CORRADE_BENCHMARK(1) {
+        volatile T* out = a.data();
+        for(std::size_t i = 0; i != a.size(); ++i) out[i] = T(3);
+    }
+
+    CORRADE_COMPARE(a[a.size() - 1], T(3));
+}
+
+template<class T> void AlgorithmsBenchmark::fill() {
+    setTestCaseDescription(TypeName<T>::name());
+
+    Containers::Array<T> a{Containers::ValueInit, Size/sizeof(T)};
+    CORRADE_BENCHMARK(1)
+        Utility::fill(Containers::ArrayView<T>{a}, T(3));
+
+    CORRADE_COMPARE(a[a.size() - 1], T(3));
+}
+
+template<class T> void AlgorithmsBenchmark::findNaive() {
+    setTestCaseDescription(TypeName<T>::name());
+
+    Containers::Array<T> a = data<T>();
+    a[a.size() - 1] = T(127);
+    std::size_t found = 0;
+    CORRADE_BENCHMARK(1)
+        found += std::find(a.begin(), a.end(), T(127)) - a.begin();
+
+    CORRADE_COMPARE(found, a.size() - 1);
+}
+
+template<class T> void AlgorithmsBenchmark::find() {
+    setTestCaseDescription(TypeName<T>::name());
+
+    Containers::Array<T> a = data<T>();
+    a[a.size() - 1] = T(127);
+    std::size_t found = 0;
+    CORRADE_BENCHMARK(1)
+        found += Utility::find(Containers::ArrayView<const T>{a}, T(127));
+
+    CORRADE_COMPARE(found, a.size() - 1);
+}
+
+template<class T> void AlgorithmsBenchmark::countNaive() {
+    setTestCaseDescription(TypeName<T>::name());
+
+    Containers::Array<T> a = data<T>();
+    std::size_t count = 0;
+    CORRADE_BENCHMARK(1)
+        count += std::count(a.begin(), a.end(), T(5));
+
+    CORRADE_VERIFY(count);
+}
+
+template<class T> void AlgorithmsBenchmark::count() {
+    setTestCaseDescription(TypeName<T>::name());
+
+    Containers::Array<T> a = data<T>();
+    std::size_t count = 0;
+    CORRADE_BENCHMARK(1)
+        count += Utility::count(Containers::ArrayView<const T>{a}, T(5));
+
+    CORRADE_COMPARE(count, std::size_t(std::count(a.begin(), a.end(), T(5))));
+}
+
+template<class T> void AlgorithmsBenchmark::equalNaive() {
+    setTestCaseDescription(TypeName<T>::name());
+
+    Containers::Array<T> a = data<T>();
+    Containers::Array<T> b = data<T>();
+    std::size_t equal = 0;
+    CORRADE_BENCHMARK(1)
+        equal += std::equal(a.begin(), a.end(), b.begin());
+
+    CORRADE_COMPARE(equal, 1);
+}
+
+template<class T> void AlgorithmsBenchmark::equal() {
+    setTestCaseDescription(TypeName<T>::name());
+
+    Containers::Array<T> a = data<T>();
+    Containers::Array<T> b = data<T>();
+    std::size_t equal = 0;
+    CORRADE_BENCHMARK(1)
+        equal += Utility::equal(Containers::ArrayView<const T>{a}, Containers::ArrayView<const T>{b});
+
+    CORRADE_COMPARE(equal, 1);
+}
+
+template<class T> void AlgorithmsBenchmark::minNaive() {
+    setTestCaseDescription(TypeName<T>::name());
+
+    Containers::Array<T> a = data<T>();
+    T min{};
+    CORRADE_BENCHMARK(1)
+        min += *std::min_element(a.begin(), a.end());
+
+    CORRADE_COMPARE(min, T(0));
+}
+
+template<class T> void AlgorithmsBenchmark::min() {
+    setTestCaseDescription(TypeName<T>::name());
+
+    Containers::Array<T> a = data<T>();
+    T min{};
+    CORRADE_BENCHMARK(1)
+        min += Utility::min(Containers::ArrayView<const T>{a});
+
+    CORRADE_COMPARE(min, T(0));
+}
+
+template<class T> void AlgorithmsBenchmark::minmaxNaive() {
+    setTestCaseDescription(TypeName<T>::name());
+
+    Containers::Array<T> a = data<T>();
+    T max{};
+    CORRADE_BENCHMARK(1)
+        max += *std::minmax_element(a.begin(), a.end()).second;
+
+    CORRADE_COMPARE(max, T(96));
+}
+
+template<class T> void AlgorithmsBenchmark::minmax() {
+    setTestCaseDescription(TypeName<T>::name());
+
+    Containers::Array<T> a = data<T>();
+    T max{};
+    CORRADE_BENCHMARK(1)
+        max += Utility::minmax(Containers::ArrayView<const T>{a}).second;
+
+    CORRADE_COMPARE(max, T(96));
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Corrade::Utility::Test::AlgorithmsBenchmark)
@@ -0,0 +1,477 @@
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+            2017, 2018 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <algorithm>
+#include <cstdint>
+#include <sstream>
+#include <string>
+
+#include "Corrade/Containers/Array.h"
+#include "Corrade/TestSuite/Tester.h"
+#include "Corrade/TestSuite/Compare/Container.h"
+#include "Corrade/Utility/Algorithms.h"
+
+namespace Corrade { namespace Utility { namespace Test {
+
+struct AlgorithmsTest: TestSuite::Tester {
+    explicit AlgorithmsTest();
+
+    void copy();
+    void copyNonTrivial();
+    void copyEmpty();
+    void copySizeMismatch();
+
+    void copyStrided();
+    void copyStrided2D();
+    void copyStrided2DSubRectangle();
+    void copyStrided3D();
+    void copyStridedFlipped();
+    void copyStridedNonTrivial();
+    void copyStridedEmpty();
+    void copyStridedSizeMismatch();
+
+    void fill();
+    void fillOneByte();
+    void fillNonTrivial();
+    void fillStrided();
+
+    template<class T> void find();
+    void findNonTrivial();
+    void findConst();
+    template<class T> void count();
+
+    void equal();
+    void equalFloat();
+    void equalNonTrivial();
+
+    template<class T> void minMax();
+    void minMaxNonTrivial();
+    void minMaxEmpty();
+};
+
+AlgorithmsTest::AlgorithmsTest() {
+    addTests({&AlgorithmsTest::copy,
+              &AlgorithmsTest::copyNonTrivial,
+              &AlgorithmsTest::copyEmpty,
+              &AlgorithmsTest::copySizeMismatch,
+
+              &AlgorithmsTest::copyStrided,
+              &AlgorithmsTest::copyStrided2D,
+              &AlgorithmsTest::copyStrided2DSubRectangle,
+              &AlgorithmsTest::copyStrided3D,
+              &AlgorithmsTest::copyStridedFlipped,
+              &AlgorithmsTest::copyStridedNonTrivial,
+              &AlgorithmsTest::copyStridedEmpty,
+              &AlgorithmsTest::copyStridedSizeMismatch,
+
+              &AlgorithmsTest::fill,
+              &AlgorithmsTest::fillOneByte,
+              &AlgorithmsTest::fillNonTrivial,
+              &AlgorithmsTest::fillStrided,
+
+              &AlgorithmsTest::find<std::uint8_t>,
+              &AlgorithmsTest::find<std::int16_t>,
+              &AlgorithmsTest::find<std::int32_t>,
+              &AlgorithmsTest::find<std::int64_t>,
+              &AlgorithmsTest::find<float>,
+              &AlgorithmsTest::findNonTrivial,
+              &AlgorithmsTest::findConst,
+              &AlgorithmsTest::count<std::uint8_t>,
+              &AlgorithmsTest::count<std::int16_t>,
+              &AlgorithmsTest::count<std::int32_t>,
+              &AlgorithmsTest::count<std::int64_t>,
+              &AlgorithmsTest::count<float>,
+
+              &AlgorithmsTest::equal,
+              &AlgorithmsTest::equalFloat,
+              &AlgorithmsTest::equalNonTrivial,
+
+              &AlgorithmsTest::minMax<std::uint8_t>,
+              &AlgorithmsTest::minMax<std::int8_t>,
+              &AlgorithmsTest::minMax<std::int16_t>,
+              &AlgorithmsTest::minMax<std::int32_t>,
+              &AlgorithmsTest::minMax<std::uint32_t>,
+              &AlgorithmsTest::minMax<std::int64_t>,
+              &AlgorithmsTest::minMax<float>,
+              &AlgorithmsTest::minMax<double>,
+              &AlgorithmsTest::minMaxNonTrivial,
+              &AlgorithmsTest::minMaxEmpty});
+}
+
+namespace {
+
+template<class> struct TypeName;
+template<> struct TypeName<std::uint8_t> { static const char* name() { return "std::uint8_t"; } };
+template<> struct TypeName<std::int8_t> { static const char* name() { return "std::int8_t"; } };
+template<> struct TypeName<std::int16_t> { static const char* name() { return "std::int16_t"; } };
+template<> struct TypeName<std::int32_t> { static const char* name() { return "std::int32_t"; } };
+template<> struct TypeName<std::uint32_t> { static const char* name() { return "std::uint32_t"; } };
+template<> struct TypeName<std::int64_t> { static const char* name() { return "std::int64_t"; } };
+template<> struct TypeName<float> { static const char* name() { return "float"; } };
+template<> struct TypeName<double> { static const char* name() { return "double"; } };
+
+}
+
+/* Four rows of three columns */
+constexpr int Data2D[]{
+    0, 1, 2,
+    3, 4, 5,
+    6, 7, 8,
+    9, 10, 11
+};
+
+void AlgorithmsTest::copy() {
+    int src[]{1, 2, 3, 4};
+    int dst[4]{};
+    Utility::copy(Containers::ArrayView<const int>{src}, Containers::ArrayView<int>{dst});
+    CORRADE_COMPARE_AS(Containers::ArrayView<const int>{dst},
+        (Containers::ArrayView<const int>{src}),
+        TestSuite::Compare::Container);
+
+    /* Non-const source */
+    int dst2[4]{};
+    Utility::copy(Containers::ArrayView<int>{src}, Containers::ArrayView<int>{dst2});
+    CORRADE_COMPARE_AS(Containers::ArrayView<const int>{dst2},
+        (Containers::ArrayView<const int>{src}),
+        TestSuite::Compare::Container);
+}
+
+void AlgorithmsTest::copyNonTrivial() {
+    std::string src[]{"hello", "a string that's long enough to not fit into SSO"};
+    std::string dst[2];
+    Utility::copy(Containers::ArrayView<const std::string>{src}, Containers::ArrayView<std::string>{dst});
+    CORRADE_COMPARE(dst[0], "hello");
+    CORRADE_COMPARE(dst[1], "a string that's long enough to not fit into SSO");
+    CORRADE_COMPARE(src[0], "hello");
+}
+
+void AlgorithmsTest::copyEmpty() {
+    /* Shouldn't call memcpy() on a null pointer */
+    Utility::copy(Containers::ArrayView<const int>{}, Containers::ArrayView<int>{});
+    CORRADE_VERIFY(true);
+}
+
+void AlgorithmsTest::copySizeMismatch() {
+    int src[3]{};
+    int dst[4]{};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    Utility::copy(Containers::ArrayView<const int>{src}, Containers::ArrayView<int>{dst});
+    CORRADE_COMPARE(out.str(), "Utility::copy(): sizes 3 and 4 don't match\n");
+}
+
+void AlgorithmsTest::copyStrided() {
+    /* Every other item */
+    int dst[6]{};
+    Utility::copy(Containers::StridedArrayView1D<const int>{Data2D, Data2D, 6, 8},
+        Containers::StridedArrayView1D<int>{dst});
+    const int expected[]{0, 2, 4, 6, 8, 10};
+    CORRADE_COMPARE_AS(Containers::ArrayView<const int>{dst},
+        Containers::ArrayView<const int>{expected},
+        TestSuite::Compare::Container);
+}
+
+void AlgorithmsTest::copyStrided2D() {
+    int dst[12]{};
+    Containers::StridedArrayView2D<const int> src{Data2D, {4, 3}};
+    Utility::copy(src, Containers::StridedArrayView2D<int>{dst, {4, 3}});
+    CORRADE_COMPARE_AS(Containers::ArrayView<const int>{dst},
+        (Containers::ArrayView<const int>{Data2D}),
+        TestSuite::Compare::Container);
+}
+
+void AlgorithmsTest::copyStrided2DSubRectangle() {
+    /* The bottom right 2x2 block into the top left corner of a 3x3 image */
+    int dst[9]{};
+    Containers::StridedArrayView2D<const int> src{Data2D, {4, 3}};
+    Containers::StridedArrayView2D<int> dstView{dst, {3, 3}};
+    Utility::copy(src.suffix({2, 1}), dstView.prefix({2, 2}));
+    const int expected[]{
+        7, 8, 0,
+        10, 11, 0,
+        0, 0, 0};
+    CORRADE_COMPARE_AS(Containers::ArrayView<const int>{dst},
+        Containers::ArrayView<const int>{expected},
+        TestSuite::Compare::Container);
+}
+
+void AlgorithmsTest::copyStrided3D() {
+    int dst[12]{};
+    Containers::StridedArrayView3D<const int> src{Data2D, {2, 2, 3}};
+    Containers::StridedArrayView3D<int> dstView{dst, {2, 2, 3}};
+
+    /* Second row of both images only */
+    Utility::copy(src.suffix({0, 1, 0}), dstView.suffix({0, 1, 0}));
+    const int expected[]{
+        0, 0, 0,
+        3, 4, 5,
+        0, 0, 0,
+        9, 10, 11};
+    CORRADE_COMPARE_AS(Containers::ArrayView<const int>{dst},
+        Containers::ArrayView<const int>{expected},
+        TestSuite::Compare::Container);
+}
+
+void AlgorithmsTest::copyStridedFlipped() {
+    /* Neither dimension is contiguous in the source, the copy has to go
+       element by element */
+    int dst[12]{};
+    Containers::StridedArrayView2D<const int> src{Data2D, {4, 3}};
+    Utility::copy(src.flipped<0>().flipped<1>(), Containers::StridedArrayView2D<int>{dst, {4, 3}});
+    const int expected[]{
+        11, 10, 9,
+        8, 7, 6,
+        5, 4, 3,
+        2, 1, 0};
+    CORRADE_COMPARE_AS(Containers::ArrayView<const int>{dst},
+        Containers::ArrayView<const int>{expected},
+        TestSuite::Compare::Container);
+
+    /* Transposed */
+    int dst2[12]{};
+    Utility::copy(src.transposed<0, 1>(), Containers::StridedArrayView2D<int>{dst2, {3, 4}});
+    const int expected2[]{
+        0, 3, 6, 9,
+        1, 4, 7, 10,
+        2, 5, 8, 11};
+    CORRADE_COMPARE_AS(Containers::ArrayView<const int>{dst2},
+        Containers::ArrayView<const int>{expected2},
+        TestSuite::Compare::Container);
+}
+
+void AlgorithmsTest::copyStridedNonTrivial() {
+    std::string src[]{"a", "b", "c", "d"};
+    std::string dst[2];
+    Utility::copy(Containers::StridedArrayView1D<std::string>{src, src + 1, 2, 2*sizeof(std::string)},
+        Containers::StridedArrayView1D<std::string>{dst});
+    CORRADE_COMPARE(dst[0], "b");
+    CORRADE_COMPARE(dst[1], "d");
+}
+
+void AlgorithmsTest::copyStridedEmpty() {
+    int dst[3]{};
+    Containers::StridedArrayView2D<const int> src{Data2D, {0, 3}};
+    Utility::copy(src, Containers::StridedArrayView2D<int>{dst, {0, 3}});
+    CORRADE_COMPARE(dst[0], 0);
+}
+
+void AlgorithmsTest::copyStridedSizeMismatch() {
+    int dst[12]{};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    Utility::copy(Containers::StridedArrayView2D<const int>{Data2D, {4, 3}},
+        Containers::StridedArrayView2D<int>{dst, {3, 4}});
+    CORRADE_COMPARE(out.str(), "Utility::copy(): sizes {4, 3} and {3, 4} don't match\n");
+}
+
+void AlgorithmsTest::fill() {
+    int data[7];
+    Utility::fill(Containers::ArrayView<int>{data}, 1337);
+    for(int i: data) CORRADE_COMPARE(i, 1337);
+}
+
+void AlgorithmsTest::fillOneByte() {
+    /* Goes through memset() */
+    char data[5]{};
+    Utility::fill(Containers::ArrayView<char>{data}, 'x');
+    CORRADE_COMPARE(std::string(data, 5), "xxxxx");
+
+    std::int8_t signedData[3]{};
+    Utility::fill(Containers::ArrayView<std::int8_t>{signedData}, std::int8_t(-3));
+    for(std::int8_t i: signedData) CORRADE_COMPARE(i, -3);
+
+    /* Shouldn't call memset() on a null pointer */
+    Utility::fill(Containers::ArrayView<char>{}, 'x');
+}
+
+void AlgorithmsTest::fillNonTrivial() {
+    std::string data[3];
+    Utility::fill(Containers::ArrayView<std::string>{data}, "a string that's long enough to not fit into SSO");
+    for(const std::string& i: data)
+        CORRADE_COMPARE(i, "a string that's long enough to not fit into SSO");
+}
+
+void AlgorithmsTest::fillStrided() {
+    int data[12]{};
+    Containers::StridedArrayView2D<int> view{data, {4, 3}};
+
+    /* The middle 2x2 block, filled row by row */
+    Utility::fill(view.slice({1, 1}, {3, 3}), 5);
+
+    /* The first column, filled element by element */
+    Utility::fill(view.transposed<0, 1>()[0], 7);
+
+    const int expected[]{
+        7, 0, 0,
+        7, 5, 5,
+        7, 5, 5,
+        7, 0, 0};
+    CORRADE_COMPARE_AS(Containers::ArrayView<const int>{data},
+        Containers::ArrayView<const int>{expected},
+        TestSuite::Compare::Container);
+
+    /* Contiguous, filled at once */
+    Utility::fill(view, 3);
+    for(int i: data) CORRADE_COMPARE(i, 3);
+}
+
+template<class T> void AlgorithmsTest::find() {
+    setTestCaseDescription(TypeName<T>::name());
+
+    /* Long enough to have a few full SIMD blocks and a tail */
+    T data[67];
+    for(std::size_t i = 0; i != 67; ++i) data[i] = T(i % 50);
+    const Containers::ArrayView<const T> view{data};
+
+    CORRADE_COMPARE(Utility::find(view, T(0)), 0);
+    CORRADE_COMPARE(Utility::find(view, T(3)), 3);
+    CORRADE_COMPARE(Utility::find(view, T(17)), 17);
+    CORRADE_COMPARE(Utility::find(view, T(49)), 49);
+    CORRADE_COMPARE(Utility::find(view, T(51)), 67);
+
+    /* In the tail only */
+    data[66] = T(99);
+    CORRADE_COMPARE(Utility::find(view, T(99)), 66);
+
+    /* Short view with no full SIMD block */
+    CORRADE_COMPARE(Utility::find(view.prefix(3), T(2)), 2);
+    CORRADE_COMPARE(Utility::find(view.prefix(3), T(3)), 3);
+    CORRADE_COMPARE(Utility::find(view.prefix(std::size_t{0}), T(0)), 0);
+}
+
+void AlgorithmsTest::findNonTrivial() {
+    const std::string data[]{"hello", "world", "hello"};
+    CORRADE_COMPARE(Utility::find(Containers::ArrayView<const std::string>{data}, "world"), 1);
+    CORRADE_COMPARE(Utility::find(Containers::ArrayView<const std::string>{data}, "nope"), 3);
+    CORRADE_COMPARE(Utility::count(Containers::ArrayView<const std::string>{data}, "hello"), 2);
+}
+
+void AlgorithmsTest::findConst() {
+    /* Both mutable and const views should work */
+    int data[]{3, 7, 1};
+    CORRADE_COMPARE(Utility::find(Containers::ArrayView<int>{data}, 7), 1);
+    CORRADE_COMPARE(Utility::count(Containers::ArrayView<int>{data}, 7), 1);
+    CORRADE_COMPARE(Utility::min(Containers::ArrayView<int>{data}), 1);
+    CORRADE_COMPARE(Utility::max(Containers::ArrayView<int>{data}), 7);
+    CORRADE_VERIFY(Utility::equal(Containers::ArrayView<int>{data}, Containers::ArrayView<const int>{data}));
+}
+
+template<class T> void AlgorithmsTest::count() {
+    setTestCaseDescription(TypeName<T>::name());
+
+    T data[67];
+    for(std::size_t i = 0; i != 67; ++i) data[i] = T(i % 5);
+    const Containers::ArrayView<const T> view{data};
+
+    CORRADE_COMPARE(Utility::count(view, T(0)), 14);
+    CORRADE_COMPARE(Utility::count(view, T(1)), 14);
+    CORRADE_COMPARE(Utility::count(view, T(2)), 13);
+    CORRADE_COMPARE(Utility::count(view, T(4)), 13);
+    CORRADE_COMPARE(Utility::count(view, T(5)), 0);
+    CORRADE_COMPARE(Utility::count(view.prefix(3), T(1)), 1);
+
+    /* Large enough to overflow 8-bit counters in the SIMD implementation */
+    Containers::Array<T> large{Containers::ValueInit, 100003};
+    for(std::size_t i = 0; i < large.size(); i += 3) large[i] = T(1);
+    CORRADE_COMPARE(Utility::count(Containers::ArrayView<const T>{large}, T(1)), 33335);
+    CORRADE_COMPARE(Utility::count(Containers::ArrayView<const T>{large}, T(0)), 66668);
+}
+
+void AlgorithmsTest::equal() {
+    const int a[]{1, 2, 3, 4};
+    const int b[]{1, 2, 3, 4};
+    const int c[]{1, 2, 5, 4};
+    CORRADE_VERIFY(Utility::equal(Containers::ArrayView<const int>{a}, Containers::ArrayView<const int>{b}));
+    CORRADE_VERIFY(!Utility::equal(Containers::ArrayView<const int>{a}, Containers::ArrayView<const int>{c}));
+    CORRADE_VERIFY(!Utility::equal(Containers::ArrayView<const int>{a}, Containers::ArrayView<const int>{b}.prefix(3)));
+    CORRADE_VERIFY(Utility::equal(Containers::ArrayView<const int>{}, Containers::ArrayView<const int>{}));
+}
+
+void AlgorithmsTest::equalFloat() {
+    /* Floats can't be compared bitwise, -0.0f and 0.0f are equal */
+    const float a[]{1.0f, -0.0f};
+    const float b[]{1.0f, 0.0f};
+    CORRADE_VERIFY(Utility::equal(Containers::ArrayView<const float>{a}, Containers::ArrayView<const float>{b}));
+}
+
+void AlgorithmsTest::equalNonTrivial() {
+    const std::string a[]{"hello", "world"};
+    const std::string b[]{"hello", "world"};
+    const std::string c[]{"hello", "there"};
+    CORRADE_VERIFY(Utility::equal(Containers::ArrayView<const std::string>{a}, Containers::ArrayView<const std::string>{b}));
+    CORRADE_VERIFY(!Utility::equal(Containers::ArrayView<const std::string>{a}, Containers::ArrayView<const std::string>{c}));
+}
+
+template<class T> void AlgorithmsTest::minMax() {
+    setTestCaseDescription(TypeName<T>::name());
+
+    /* Long enough to have a few full SIMD blocks and a tail. Signed types
+       get negative values as well. */
+    const T offset = std::is_signed<T>::value ? T(-30) : T(1);
+    T data[67];
+    for(std::size_t i = 0; i != 67; ++i)
+        data[i] = T((i*37) % 61) + offset;
+    const Containers::ArrayView<const T> view{data};
+
+    CORRADE_COMPARE(Utility::min(view), offset);
+    CORRADE_COMPARE(Utility::max(view), T(offset + T(60)));
+    CORRADE_COMPARE(Utility::minmax(view), std::make_pair(offset, T(offset + T(60))));
+
+    /* Extremes in the tail only */
+    const T tailMin = std::is_signed<T>::value ? T(-100) : T(0);
+    data[66] = tailMin;
+    data[65] = T(100);
+    CORRADE_COMPARE(Utility::min(view), tailMin);
+    CORRADE_COMPARE(Utility::max(view), T(100));
+
+    /* Short view with no full SIMD block */
+    CORRADE_COMPARE(Utility::min(view.prefix(2)), std::min(data[0], data[1]));
+    CORRADE_COMPARE(Utility::max(view.prefix(2)), std::max(data[0], data[1]));
+    CORRADE_COMPARE(Utility::min(view.prefix(1)), data[0]);
+}
+
+void AlgorithmsTest::minMaxNonTrivial() {
+    const std::string data[]{"hello", "world", "abc", "hellp"};
+    CORRADE_COMPARE(Utility::min(Containers::ArrayView<const std::string>{data}), "abc");
+    CORRADE_COMPARE(Utility::max(Containers::ArrayView<const std::string>{data}), "world");
+}
+
+void AlgorithmsTest::minMaxEmpty() {
+    std::ostringstream out;
+    Error redirectError{&out};
+    Utility::min(Containers::ArrayView<const int>{});
+    Utility::max(Containers::ArrayView<const int>{});
+    Utility::minmax(Containers::ArrayView<const int>{});
+    CORRADE_COMPARE(out.str(),
+        "Utility::min(): view is empty\n"
+        "Utility::max(): view is empty\n"
+        "Utility::minmax(): view is empty\n");
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Corrade::Utility::Test::AlgorithmsTest)
@@ -0,0 +1,151 @@
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <string>
+#include <vector>
+
+#include "Corrade/Containers/Array.h"
+#include "Corrade/TestSuite/Tester.h"
+#include "Corrade/Utility/AsyncFileQueue.h"
+#include "Corrade/Utility/Directory.h"
+
+#include "configure.h"
+
+#ifdef CORRADE_TARGET_UNIX
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace Corrade { namespace Utility { namespace Test {
+
+struct AsyncFileQueueBenchmark: TestSuite::Tester {
+    explicit AsyncFileQueueBenchmark();
+
+    void directoryRead();
+    void asyncRead();
+
+    private:
+        void evict();
+
+        std::vector<std::string> _filenames;
+};
+
+namespace {
+
+enum: std::size_t {
+    FileCount = 500,
+    FileSize = 16*1024
+};
+
+constexpr struct {
+    const char* name;
+    bool cold;
+} DirectoryReadData[]{
+    {"", false},
+    {"cold cache", true}
+};
+
+constexpr struct {
+    const char* name;
+    AsyncFileQueue::Backend backend;
+    bool cold;
+} AsyncReadData[]{
+    {"io_uring", AsyncFileQueue::Backend::IoUring, false},
+    {"io_uring, cold cache", AsyncFileQueue::Backend::IoUring, true},
+    {"threads", AsyncFileQueue::Backend::Threads, false},
+    {"threads, cold cache", AsyncFileQueue::Backend::Threads, true}
+};
+
+}
+
+AsyncFileQueueBenchmark::AsyncFileQueueBenchmark() {
+    addInstancedBenchmarks({&AsyncFileQueueBenchmark::directoryRead}, 5,
+        Containers::arraySize(DirectoryReadData));
+
+    addInstancedBenchmarks({&AsyncFileQueueBenchmark::asyncRead}, 5,
+        Containers::arraySize(AsyncReadData));
+
+    const std::string dir = Directory::join(DIRECTORY_WRITE_TEST_DIR, "AsyncFileQueueBenchmark");
+    Directory::mkpath(dir);
+    Containers::Array<char> data{Containers::NoInit, FileSize};
+    for(std::size_t i = 0; i != FileCount; ++i) {
+        for(std::size_t j = 0; j != FileSize; ++j) data[j] = char(i + j);
+        _filenames.push_back(Directory::join(dir, std::to_string(i)));
+        Directory::write(_filenames.back(), data);
+    }
+}
+
+/* Evict the files from the page cache so the benchmark includes the actual
+   I/O. Works only for clean pages and only where posix_fadvise() exists, on
+   other systems the cache stays warm. */
+void AsyncFileQueueBenchmark::evict() {
+    #if defined(CORRADE_TARGET_UNIX) && defined(POSIX_FADV_DONTNEED)
+    for(const std::string& filename: _filenames) {
+        const int fd = open(filename.data(), O_RDONLY);
+        if(fd == -1) continue;
+        posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED);
+        close(fd);
+    }
+    #endif
+}
+
+void AsyncFileQueueBenchmark::directoryRead() {
+    const auto& data = DirectoryReadData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    if(data.cold) evict();
+
+    std::size_t size = 0;
+    CORRADE_BENCHMARK(1)
+        for(const std::string& filename: _filenames)
+            size += Directory::read(filename).size();
+
+    CORRADE_COMPARE(size, FileCount*FileSize);
+}
+
+void AsyncFileQueueBenchmark::asyncRead() {
+    const auto& data = AsyncReadData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    AsyncFileQueue queue{data.backend};
+    if(queue.backend() != data.backend)
+        CORRADE_SKIP("io_uring is not available.");
+
+    if(data.cold) evict();
+
+    std::size_t size = 0;
+    CORRADE_BENCHMARK(1) {
+        for(const std::string& filename: _filenames)
+            queue.read(filename);
+        while(queue.pending())
+            size += queue.wait().data.size();
+    }
+
+    CORRADE_COMPARE(size, FileCount*FileSize);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Corrade::Utility::Test::AsyncFileQueueBenchmark)
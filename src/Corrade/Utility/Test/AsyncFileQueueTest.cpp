@@ -0,0 +1,314 @@
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <algorithm>
+#include <sstream>
+#include <vector>
+
+#include "Corrade/Containers/Array.h"
+#include "Corrade/TestSuite/Tester.h"
+#include "Corrade/TestSuite/Compare/Container.h"
+#include "Corrade/Utility/AsyncFileQueue.h"
+#include "Corrade/Utility/Directory.h"
+
+#include "configure.h"
+
+namespace Corrade { namespace Utility { namespace Test {
+
+struct AsyncFileQueueTest: TestSuite::Tester {
+    explicit AsyncFileQueueTest();
+
+    void backend();
+
+    void read();
+    void readEmpty();
+    void readNonexistent();
+    void write();
+    void writeEmpty();
+    void readWriteLarge();
+    void many();
+    void poll();
+    void waitNothingPending();
+    void destructPending();
+
+    private:
+        std::string _testDir;
+};
+
+namespace {
+
+constexpr struct {
+    const char* name;
+    AsyncFileQueue::Backend backend;
+} BackendData[]{
+    {"automatic", AsyncFileQueue::Backend::Automatic},
+    {"threads", AsyncFileQueue::Backend::Threads}
+};
+
+}
+
+AsyncFileQueueTest::AsyncFileQueueTest(): _testDir{Directory::join(DIRECTORY_WRITE_TEST_DIR, "AsyncFileQueue")} {
+    addInstancedTests({&AsyncFileQueueTest::backend,
+
+                       &AsyncFileQueueTest::read,
+                       &AsyncFileQueueTest::readEmpty,
+                       &AsyncFileQueueTest::readNonexistent,
+                       &AsyncFileQueueTest::write,
+                       &AsyncFileQueueTest::writeEmpty,
+                       &AsyncFileQueueTest::readWriteLarge,
+                       &AsyncFileQueueTest::many,
+                       &AsyncFileQueueTest::poll,
+                       &AsyncFileQueueTest::waitNothingPending,
+                       &AsyncFileQueueTest::destructPending},
+        Containers::arraySize(BackendData));
+
+    Directory::mkpath(_testDir);
+}
+
+void AsyncFileQueueTest::backend() {
+    auto&& data = BackendData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    AsyncFileQueue queue{data.backend};
+    if(data.backend == AsyncFileQueue::Backend::Threads)
+        CORRADE_VERIFY(queue.backend() == AsyncFileQueue::Backend::Threads);
+    else CORRADE_VERIFY(queue.backend() != AsyncFileQueue::Backend::Automatic);
+
+    Debug{} << "Using" << (queue.backend() == AsyncFileQueue::Backend::IoUring ? "io_uring" : "threads");
+}
+
+void AsyncFileQueueTest::read() {
+    auto&& data = BackendData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    AsyncFileQueue queue{data.backend};
+    CORRADE_COMPARE(queue.pending(), 0);
+
+    CORRADE_COMPARE(queue.read(Directory::join(DIRECTORY_TEST_DIR, "file")), 0);
+    CORRADE_COMPARE(queue.pending(), 1);
+
+    AsyncFileQueue::Completion completion = queue.wait();
+    CORRADE_COMPARE(queue.pending(), 0);
+    CORRADE_COMPARE(completion.id, 0);
+    CORRADE_VERIFY(completion.success);
+    CORRADE_COMPARE_AS(completion.data,
+        (Containers::Array<char>{Containers::InPlaceInit,
+            {'\xCA', '\xFE', '\xBA', '\xBE', '\x0D', '\x0A', '\x00', '\xDE', '\xAD', '\xBE', '\xEF'}}),
+        TestSuite::Compare::Container);
+}
+
+void AsyncFileQueueTest::readEmpty() {
+    auto&& data = BackendData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    const std::string filename = Directory::join(_testDir, "empty");
+    CORRADE_VERIFY(Directory::write(filename, nullptr));
+
+    AsyncFileQueue queue{data.backend};
+    queue.read(filename);
+
+    AsyncFileQueue::Completion completion = queue.wait();
+    CORRADE_VERIFY(completion.success);
+    CORRADE_VERIFY(!completion.data);
+}
+
+void AsyncFileQueueTest::readNonexistent() {
+    auto&& data = BackendData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    AsyncFileQueue queue{data.backend};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    queue.read("nonexistent");
+
+    AsyncFileQueue::Completion completion = queue.wait();
+    CORRADE_COMPARE(completion.id, 0);
+    CORRADE_VERIFY(!completion.success);
+    CORRADE_VERIFY(!completion.data);
+    CORRADE_VERIFY(out.str().find("can't open nonexistent\n") != std::string::npos);
+}
+
+void AsyncFileQueueTest::write() {
+    auto&& data = BackendData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    const std::string filename = Directory::join(_testDir, "write");
+    if(Directory::fileExists(filename))
+        CORRADE_VERIFY(Directory::rm(filename));
+
+    AsyncFileQueue queue{data.backend};
+    Containers::Array<char> contents{Containers::InPlaceInit, {'\xCA', '\xFE', '\xBA', '\xBE'}};
+    const char* const pointer = contents;
+    CORRADE_COMPARE(queue.write(filename, std::move(contents)), 0);
+
+    AsyncFileQueue::Completion completion = queue.wait();
+    CORRADE_COMPARE(completion.id, 0);
+    CORRADE_VERIFY(completion.success);
+    /* The data are given back */
+    CORRADE_COMPARE(static_cast<const void*>(completion.data.data()), static_cast<const void*>(pointer));
+    CORRADE_COMPARE_AS(Directory::read(filename),
+        (Containers::Array<char>{Containers::InPlaceInit, {'\xCA', '\xFE', '\xBA', '\xBE'}}),
+        TestSuite::Compare::Container);
+}
+
+void AsyncFileQueueTest::writeEmpty() {
+    auto&& data = BackendData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    const std::string filename = Directory::join(_testDir, "writeEmpty");
+    CORRADE_VERIFY(Directory::writeString(filename, "previous contents"));
+
+    AsyncFileQueue queue{data.backend};
+    queue.write(filename, nullptr);
+
+    AsyncFileQueue::Completion completion = queue.wait();
+    CORRADE_VERIFY(completion.success);
+    CORRADE_COMPARE(Directory::readString(filename), "");
+}
+
+void AsyncFileQueueTest::readWriteLarge() {
+    auto&& data = BackendData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    /* The test library makes the io_uring backend transfer at most 4 kB at
+       once, so this is done in many partial transfers, none of which
+       should get reported as a completion on its own */
+    const std::string filename = Directory::join(_testDir, "large");
+    Containers::Array<char> contents{Containers::NoInit, 100*1024 + 7};
+    for(std::size_t i = 0; i != contents.size(); ++i)
+        contents[i] = char(i*7 + i/256);
+    Containers::Array<char> expected{Containers::NoInit, contents.size()};
+    std::copy(contents.begin(), contents.end(), expected.begin());
+
+    AsyncFileQueue queue{data.backend};
+    CORRADE_COMPARE(queue.write(filename, std::move(contents)), 0);
+
+    AsyncFileQueue::Completion completion = queue.wait();
+    CORRADE_COMPARE(queue.pending(), 0);
+    CORRADE_COMPARE(completion.id, 0);
+    CORRADE_VERIFY(completion.success);
+
+    CORRADE_COMPARE(queue.read(filename), 1);
+    completion = queue.wait();
+    CORRADE_COMPARE(queue.pending(), 0);
+    CORRADE_COMPARE(completion.id, 1);
+    CORRADE_VERIFY(completion.success);
+    CORRADE_COMPARE_AS(completion.data, expected,
+        TestSuite::Compare::Container);
+}
+
+void AsyncFileQueueTest::many() {
+    auto&& data = BackendData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    /* More than the io_uring backend can have in flight at once */
+    enum: std::size_t { Count = 200 };
+
+    AsyncFileQueue queue{data.backend};
+    for(std::size_t i = 0; i != Count; ++i) {
+        Containers::Array<char> contents{Containers::NoInit, 1000 + i};
+        for(std::size_t j = 0; j != contents.size(); ++j)
+            contents[j] = char(i + j);
+        CORRADE_COMPARE(queue.write(Directory::join(_testDir, "many" + std::to_string(i)), std::move(contents)), i);
+    }
+
+    std::vector<bool> done(Count);
+    while(queue.pending()) {
+        AsyncFileQueue::Completion completion = queue.wait();
+        CORRADE_VERIFY(completion.success);
+        CORRADE_VERIFY(completion.id < Count);
+        CORRADE_VERIFY(!done[completion.id]);
+        done[completion.id] = true;
+    }
+
+    for(std::size_t i = 0; i != Count; ++i)
+        CORRADE_COMPARE(queue.read(Directory::join(_testDir, "many" + std::to_string(i))), Count + i);
+
+    done.assign(Count, false);
+    while(queue.pending()) {
+        AsyncFileQueue::Completion completion = queue.wait();
+        CORRADE_VERIFY(completion.success);
+        const std::size_t i = completion.id - Count;
+        CORRADE_VERIFY(i < Count);
+        CORRADE_VERIFY(!done[i]);
+        done[i] = true;
+
+        Containers::Array<char> expected{Containers::NoInit, 1000 + i};
+        for(std::size_t j = 0; j != expected.size(); ++j)
+            expected[j] = char(i + j);
+        CORRADE_COMPARE_AS(completion.data, expected,
+            TestSuite::Compare::Container);
+    }
+}
+
+void AsyncFileQueueTest::poll() {
+    auto&& data = BackendData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    AsyncFileQueue queue{data.backend};
+
+    AsyncFileQueue::Completion completion;
+    CORRADE_VERIFY(!queue.poll(completion));
+
+    queue.read(Directory::join(DIRECTORY_TEST_DIR, "file"));
+    while(!queue.poll(completion)) {}
+
+    CORRADE_COMPARE(queue.pending(), 0);
+    CORRADE_COMPARE(completion.id, 0);
+    CORRADE_VERIFY(completion.success);
+    CORRADE_COMPARE(completion.data.size(), 11);
+    CORRADE_VERIFY(!queue.poll(completion));
+}
+
+void AsyncFileQueueTest::waitNothingPending() {
+    auto&& data = BackendData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    AsyncFileQueue queue{data.backend};
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    queue.wait();
+    CORRADE_COMPARE(out.str(), "Utility::AsyncFileQueue::wait(): no pending operations\n");
+}
+
+void AsyncFileQueueTest::destructPending() {
+    auto&& data = BackendData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    {
+        AsyncFileQueue queue{data.backend};
+        for(std::size_t i = 0; i != 100; ++i)
+            queue.read(Directory::join(DIRECTORY_TEST_DIR, "file"));
+    }
+
+    /* Shouldn't crash, hang or leak */
+    CORRADE_VERIFY(true);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Corrade::Utility::Test::AsyncFileQueueTest)
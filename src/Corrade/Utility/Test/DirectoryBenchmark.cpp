@@ -0,0 +1,412 @@
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <cstdlib>
+#include <fstream>
+
+#include "Corrade/Containers/Array.h"
+#include "Corrade/Containers/ArrayView.h"
+#include "Corrade/Containers/Optional.h"
+#include "Corrade/TestSuite/Tester.h"
+#include "Corrade/Utility/Directory.h"
+
+#include "configure.h"
+
+#ifdef CORRADE_TARGET_UNIX
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace Corrade { namespace Utility { namespace Test {
+
+struct DirectoryBenchmark: TestSuite::Tester {
+    explicit DirectoryBenchmark();
+    ~DirectoryBenchmark();
+
+    void read();
+    #if defined(CORRADE_TARGET_UNIX) || (defined(CORRADE_TARGET_WINDOWS) && !defined(CORRADE_TARGET_WINDOWS_RT))
+    void mapRead();
+    #endif
+    void readChunks();
+    void readChunksReadAhead();
+
+    void readWrite();
+    void copy();
+
+    void writeConcatenated();
+    void writeMultiple();
+
+    void listRecursive();
+    void walk();
+    void walkSkipMetadata();
+    void walkParallel();
+
+    #ifdef CORRADE_TARGET_UNIX
+    void mapReadCold();
+    #endif
+
+    private:
+        void writeCopyInput(std::size_t size);
+        void writeWalkTree();
+        void removeWalkTree();
+
+        std::string _filename, _copyInput, _copyOutput;
+        std::size_t _copyInputSize{};
+        std::string _walkRoot;
+        bool _walkTreeWritten{};
+        std::size_t _expected;
+};
+
+namespace {
+
+enum: std::size_t {
+    Size = 64*1024*1024,
+    ChunkSize = 1024*1024,
+    WalkDirectoryCount = 20,
+    WalkSubdirectoryCount = 10,
+    WalkFileCount = 100
+};
+
+/* Some nontrivial per-byte processing so there's something to overlap the
+   I/O with */
+std::size_t process(Containers::ArrayView<const char> data) {
+    std::size_t hash = 0;
+    for(char c: data) hash = hash*31 + std::size_t(c);
+    return hash;
+}
+
+/* The last case is run only if CORRADE_BENCHMARK_LARGE_FILES is set in the
+   environment, as it needs a gigabyte of memory and two gigabytes of disk
+   space */
+constexpr struct {
+    const char* name;
+    std::size_t size;
+    std::size_t iterations;
+} CopyData[]{
+    {"1 kB", 1024, 1000},
+    {"1 MB", 1024*1024, 10},
+    {"64 MB", 64*1024*1024, 1},
+    {"1 GB", 1024*1024*1024, 1}
+};
+
+#ifdef CORRADE_TARGET_UNIX
+constexpr struct {
+    const char* name;
+    Directory::MapFlags flags;
+} MapReadColdData[]{
+    {"", {}},
+    {"Sequential", Directory::MapFlag::Sequential},
+    {"Random", Directory::MapFlag::Random},
+    {"WillNeed", Directory::MapFlag::WillNeed},
+    {"Populate", Directory::MapFlag::Populate},
+    {"Sequential|Populate", Directory::MapFlag::Sequential|Directory::MapFlag::Populate},
+    {"HugePages", Directory::MapFlag::HugePages}
+};
+#endif
+
+bool processChunk(Containers::ArrayView<const char> chunk, void* state) {
+    std::size_t& hash = *static_cast<std::size_t*>(state);
+    for(char c: chunk) hash = hash*31 + std::size_t(c);
+    return true;
+}
+
+}
+
+DirectoryBenchmark::DirectoryBenchmark() {
+    addBenchmarks({&DirectoryBenchmark::read,
+                   #if defined(CORRADE_TARGET_UNIX) || (defined(CORRADE_TARGET_WINDOWS) && !defined(CORRADE_TARGET_WINDOWS_RT))
+                   &DirectoryBenchmark::mapRead,
+                   #endif
+                   &DirectoryBenchmark::readChunks,
+                   &DirectoryBenchmark::readChunksReadAhead}, 5);
+
+    addInstancedBenchmarks({&DirectoryBenchmark::readWrite,
+                            &DirectoryBenchmark::copy}, 3,
+        Containers::arraySize(CopyData) - (std::getenv("CORRADE_BENCHMARK_LARGE_FILES") ? 0 : 1));
+
+    addBenchmarks({&DirectoryBenchmark::writeConcatenated,
+                   &DirectoryBenchmark::writeMultiple}, 5);
+
+    addBenchmarks({&DirectoryBenchmark::listRecursive,
+                   &DirectoryBenchmark::walk,
+                   &DirectoryBenchmark::walkSkipMetadata,
+                   &DirectoryBenchmark::walkParallel}, 5);
+
+    #ifdef CORRADE_TARGET_UNIX
+    addInstancedBenchmarks({&DirectoryBenchmark::mapReadCold}, 5,
+        Containers::arraySize(MapReadColdData));
+    #endif
+
+    Containers::Array<char> data{Containers::NoInit, Size};
+    for(std::size_t i = 0; i != Size; ++i) data[i] = char(i*2654435761u >> 24);
+    _expected = process(data);
+
+    Directory::mkpath(DIRECTORY_WRITE_TEST_DIR);
+    _filename = Directory::join(DIRECTORY_WRITE_TEST_DIR, "benchmark");
+    Directory::write(_filename, data);
+
+    _copyInput = Directory::join(DIRECTORY_WRITE_TEST_DIR, "benchmarkCopyInput");
+    _copyOutput = Directory::join(DIRECTORY_WRITE_TEST_DIR, "benchmarkCopyOutput");
+    _walkRoot = Directory::join(DIRECTORY_WRITE_TEST_DIR, "benchmarkWalk");
+}
+
+DirectoryBenchmark::~DirectoryBenchmark() {
+    /* Don't leave the large files lying around */
+    Directory::rm(_filename);
+    Directory::rm(_copyInput);
+    removeWalkTree();
+}
+
+void DirectoryBenchmark::read() {
+    std::size_t hash = 0;
+    CORRADE_BENCHMARK(1)
+        hash = process(Directory::read(_filename));
+
+    CORRADE_COMPARE(hash, _expected);
+}
+
+#if defined(CORRADE_TARGET_UNIX) || (defined(CORRADE_TARGET_WINDOWS) && !defined(CORRADE_TARGET_WINDOWS_RT))
+void DirectoryBenchmark::mapRead() {
+    std::size_t hash = 0;
+    CORRADE_BENCHMARK(1)
+        hash = process(Directory::mapRead(_filename));
+
+    CORRADE_COMPARE(hash, _expected);
+}
+#endif
+
+void DirectoryBenchmark::readChunks() {
+    std::size_t hash = 0;
+    CORRADE_BENCHMARK(1) {
+        hash = 0;
+        Directory::readChunks(_filename, ChunkSize, processChunk, &hash);
+    }
+
+    CORRADE_COMPARE(hash, _expected);
+}
+
+void DirectoryBenchmark::readChunksReadAhead() {
+    std::size_t hash = 0;
+    CORRADE_BENCHMARK(1) {
+        hash = 0;
+        Directory::readChunks(_filename, ChunkSize, processChunk, &hash, Directory::ReadChunksFlag::ReadAhead);
+    }
+
+    CORRADE_COMPARE(hash, _expected);
+}
+
+void DirectoryBenchmark::writeCopyInput(const std::size_t size) {
+    /* Both benchmarks use the same inputs, the large ones take a while to
+       write */
+    if(_copyInputSize == size) return;
+
+    Containers::Array<char> data{Containers::NoInit, size};
+    for(std::size_t i = 0; i != size; ++i) data[i] = char(i*2654435761u >> 24);
+    Directory::write(_copyInput, data);
+    _copyInputSize = size;
+}
+
+void DirectoryBenchmark::readWrite() {
+    const auto& data = CopyData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    writeCopyInput(data.size);
+
+    CORRADE_BENCHMARK(data.iterations)
+        Directory::write(_copyOutput, Directory::read(_copyInput));
+
+    CORRADE_COMPARE(Directory::read(_copyOutput).size(), data.size);
+    Directory::rm(_copyOutput);
+}
+
+void DirectoryBenchmark::copy() {
+    const auto& data = CopyData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    writeCopyInput(data.size);
+
+    CORRADE_BENCHMARK(data.iterations)
+        Directory::copy(_copyInput, _copyOutput);
+
+    CORRADE_COMPARE(Directory::read(_copyOutput).size(), data.size);
+    Directory::rm(_copyOutput);
+}
+
+namespace {
+
+/* A typical serialized file -- a small header and footer around a large
+   body */
+struct {
+    char header[64];
+    char footer[16];
+} WriteData{};
+
+}
+
+void DirectoryBenchmark::writeConcatenated() {
+    const Containers::Array<char> body{Containers::ValueInit, Size/4};
+    const std::string filename = Directory::join(DIRECTORY_WRITE_TEST_DIR, "benchmarkWrite");
+
+    CORRADE_BENCHMARK(1) {
+        Containers::Array<char> data{Containers::NoInit, sizeof(WriteData.header) + body.size() + sizeof(WriteData.footer)};
+        std::copy(std::begin(WriteData.header), std::end(WriteData.header), data.begin());
+        std::copy(body.begin(), body.end(), data.begin() + sizeof(WriteData.header));
+        std::copy(std::begin(WriteData.footer), std::end(WriteData.footer), data.end() - sizeof(WriteData.footer));
+        Directory::write(filename, data);
+    }
+
+    CORRADE_COMPARE(Directory::read(filename).size(), Size/4 + 80);
+    Directory::rm(filename);
+}
+
+void DirectoryBenchmark::writeMultiple() {
+    const Containers::Array<char> body{Containers::ValueInit, Size/4};
+    const std::string filename = Directory::join(DIRECTORY_WRITE_TEST_DIR, "benchmarkWrite");
+
+    CORRADE_BENCHMARK(1)
+        Directory::write(filename, {WriteData.header, body, WriteData.footer});
+
+    CORRADE_COMPARE(Directory::read(filename).size(), Size/4 + 80);
+    Directory::rm(filename);
+}
+
+void DirectoryBenchmark::writeWalkTree() {
+    /* Created just once for all benchmarks, writing the files takes a while.
+       A tree left over from an interrupted run is removed first. */
+    if(_walkTreeWritten) return;
+    removeWalkTree();
+
+    for(std::size_t i = 0; i != WalkDirectoryCount; ++i) {
+        for(std::size_t j = 0; j != WalkSubdirectoryCount; ++j) {
+            const std::string path = Directory::join(_walkRoot, std::to_string(i) + "/" + std::to_string(j));
+            Directory::mkpath(path);
+            for(std::size_t k = 0; k != WalkFileCount; ++k)
+                Directory::writeString(Directory::join(path, std::to_string(k) + ".bin"), "data");
+        }
+    }
+
+    _walkTreeWritten = true;
+}
+
+void DirectoryBenchmark::removeWalkTree() {
+    if(!Directory::fileExists(_walkRoot)) return;
+
+    /* Each directory is followed by its contents, so going backwards removes
+       the contents first */
+    Containers::Optional<Directory::Tree> tree = Directory::walk(_walkRoot, Directory::WalkFlag::SkipMetadata);
+    for(std::size_t i = tree ? tree->size() : 0; i != 0; --i)
+        Directory::rm(Directory::join(_walkRoot, tree->path(i - 1).data()));
+    Directory::rm(_walkRoot);
+    _walkTreeWritten = false;
+}
+
+namespace {
+
+/* What one would do without walk() -- list the files and directories
+   separately, recurse and query size of every file */
+std::size_t listRecursive(const std::string& path, std::size_t& size) {
+    std::size_t count = 0;
+    for(const std::string& file: Directory::list(path, Directory::Flag::SkipDirectories|Directory::Flag::SkipSpecial)) {
+        std::ifstream in{Directory::join(path, file), std::ifstream::binary|std::ifstream::ate};
+        size += std::size_t(in.tellg());
+        ++count;
+    }
+    for(const std::string& directory: Directory::list(path, Directory::Flag::SkipFiles|Directory::Flag::SkipSpecial|Directory::Flag::SkipDotAndDotDot))
+        count += 1 + listRecursive(Directory::join(path, directory), size);
+    return count;
+}
+
+/* The directories, subdirectories and files */
+constexpr std::size_t WalkEntryCount = WalkDirectoryCount*(1 + WalkSubdirectoryCount*(1 + WalkFileCount));
+
+}
+
+void DirectoryBenchmark::listRecursive() {
+    writeWalkTree();
+
+    std::size_t count = 0, size = 0;
+    CORRADE_BENCHMARK(1)
+        count = Test::listRecursive(_walkRoot, size);
+
+    CORRADE_COMPARE(count, WalkEntryCount);
+    CORRADE_VERIFY(size);
+}
+
+void DirectoryBenchmark::walk() {
+    writeWalkTree();
+
+    std::size_t count = 0;
+    CORRADE_BENCHMARK(1)
+        count = Directory::walk(_walkRoot)->size();
+
+    CORRADE_COMPARE(count, WalkEntryCount);
+}
+
+void DirectoryBenchmark::walkSkipMetadata() {
+    writeWalkTree();
+
+    std::size_t count = 0;
+    CORRADE_BENCHMARK(1)
+        count = Directory::walk(_walkRoot, Directory::WalkFlag::SkipMetadata)->size();
+
+    CORRADE_COMPARE(count, WalkEntryCount);
+}
+
+void DirectoryBenchmark::walkParallel() {
+    writeWalkTree();
+
+    std::size_t count = 0;
+    CORRADE_BENCHMARK(1)
+        count = Directory::walk(_walkRoot, {}, 4)->size();
+
+    CORRADE_COMPARE(count, WalkEntryCount);
+}
+
+#ifdef CORRADE_TARGET_UNIX
+void DirectoryBenchmark::mapReadCold() {
+    const auto& data = MapReadColdData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    /* Evict the file from the page cache so the scan includes the actual I/O.
+       Works only for clean pages and only where posix_fadvise() exists, on
+       other systems the cache stays warm. */
+    #ifdef POSIX_FADV_DONTNEED
+    const int fd = open(_filename.data(), O_RDONLY);
+    CORRADE_VERIFY(fd != -1);
+    posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED);
+    close(fd);
+    #endif
+
+    std::size_t hash = 0;
+    CORRADE_BENCHMARK(1)
+        hash = process(Directory::mapRead(_filename, data.flags));
+
+    CORRADE_COMPARE(hash, _expected);
+}
+#endif
+
+}}}
+
+CORRADE_TEST_MAIN(Corrade::Utility::Test::DirectoryBenchmark)
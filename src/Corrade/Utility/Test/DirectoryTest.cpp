@@ -26,6 +26,8 @@
 #include <sstream>
 
 #include "Corrade/Containers/Array.h"
+#include "Corrade/Containers/GrowableArray.h"
+#include "Corrade/Containers/Optional.h"
 #include "Corrade/TestSuite/Tester.h"
 #include "Corrade/TestSuite/Compare/Container.h"
 #include "Corrade/TestSuite/Compare/File.h"
@@ -34,6 +36,10 @@
 
 #include "configure.h"
 
+#ifdef CORRADE_TARGET_UNIX
+#include <unistd.h>
+#endif
+
 namespace Corrade { namespace Utility { namespace Test {
 
 struct DirectoryTest: TestSuite::Tester {
@@ -59,6 +65,14 @@ struct DirectoryTest: TestSuite::Tester {
     void moveDirectory();
     void moveUtf8();
 
+    void copy();
+    void copyLarge();
+    void copyOverwrite();
+    void copyEmpty();
+    void copyNonexistent();
+    void copySameFile();
+    void copyUtf8();
+
     void mkpath();
     void mkpathNoPermission();
     void mkpathUtf8();
@@ -86,21 +100,45 @@ struct DirectoryTest: TestSuite::Tester {
     void listSortPrecedence();
     void listUtf8();
 
+    void walk();
+    void walkSkipMetadata();
+    void walkParallel();
+    void walkSymlink();
+    void walkNonexistent();
+    void walkUtf8();
+
     void read();
     void readEmpty();
     void readNonSeekable();
     void readNonexistent();
     void readUtf8();
 
+    void readChunks();
+    void readChunksLarge();
+    void readChunksStop();
+    void readChunksEmpty();
+    void readChunksNonexistent();
+
     void write();
     void writeNoPermission();
     void writeUtf8();
+    void writeMultiple();
+    void writeMultipleMany();
+    void writeSync();
+
+    void append();
+    void appendMultiple();
+    void appendNonexistent();
 
     void map();
+    void mapFlags();
     void mapNoPermission();
     void mapUtf8();
 
     void mapRead();
+    void mapReadFlags();
+    void mapReadRange();
+    void mapReadRangeOutOfRange();
     void mapReadNonexistent();
     void mapReadUtf8();
 
@@ -130,6 +168,14 @@ DirectoryTest::DirectoryTest() {
               &DirectoryTest::moveDirectory,
               &DirectoryTest::moveUtf8,
 
+              &DirectoryTest::copy,
+              &DirectoryTest::copyLarge,
+              &DirectoryTest::copyOverwrite,
+              &DirectoryTest::copyEmpty,
+              &DirectoryTest::copyNonexistent,
+              &DirectoryTest::copySameFile,
+              &DirectoryTest::copyUtf8,
+
               &DirectoryTest::mkpath,
               &DirectoryTest::mkpathNoPermission,
               &DirectoryTest::mkpathUtf8,
@@ -157,21 +203,45 @@ DirectoryTest::DirectoryTest() {
               &DirectoryTest::listSortPrecedence,
               &DirectoryTest::listUtf8,
 
+              &DirectoryTest::walk,
+              &DirectoryTest::walkSkipMetadata,
+              &DirectoryTest::walkParallel,
+              &DirectoryTest::walkSymlink,
+              &DirectoryTest::walkNonexistent,
+              &DirectoryTest::walkUtf8,
+
               &DirectoryTest::read,
               &DirectoryTest::readEmpty,
               &DirectoryTest::readNonSeekable,
               &DirectoryTest::readNonexistent,
               &DirectoryTest::readUtf8,
 
+              &DirectoryTest::readChunks,
+              &DirectoryTest::readChunksLarge,
+              &DirectoryTest::readChunksStop,
+              &DirectoryTest::readChunksEmpty,
+              &DirectoryTest::readChunksNonexistent,
+
               &DirectoryTest::write,
               &DirectoryTest::writeNoPermission,
               &DirectoryTest::writeUtf8,
+              &DirectoryTest::writeMultiple,
+              &DirectoryTest::writeMultipleMany,
+              &DirectoryTest::writeSync,
+
+              &DirectoryTest::append,
+              &DirectoryTest::appendMultiple,
+              &DirectoryTest::appendNonexistent,
 
               &DirectoryTest::map,
+              &DirectoryTest::mapFlags,
               &DirectoryTest::mapNoPermission,
               &DirectoryTest::mapUtf8,
 
               &DirectoryTest::mapRead,
+              &DirectoryTest::mapReadFlags,
+              &DirectoryTest::mapReadRange,
+              &DirectoryTest::mapReadRangeOutOfRange,
               &DirectoryTest::mapReadNonexistent,
               &DirectoryTest::mapReadUtf8});
 
@@ -352,6 +422,85 @@ void DirectoryTest::moveUtf8() {
     CORRADE_VERIFY(Directory::fileExists(newFile));
 }
 
+void DirectoryTest::copy() {
+    std::string output = Directory::join(_writeTestDir, "copy");
+    if(Directory::fileExists(output))
+        CORRADE_VERIFY(Directory::rm(output));
+
+    CORRADE_VERIFY(Directory::copy(Directory::join(_testDir, "file"), output));
+    CORRADE_COMPARE_AS(output, Directory::join(_testDir, "file"),
+        TestSuite::Compare::File);
+}
+
+void DirectoryTest::copyLarge() {
+    /* Larger than the buffer used by the streaming fallback and not a
+       multiple of it */
+    Containers::Array<char> data{Containers::NoInit, 1024*1024 + 7};
+    for(std::size_t i = 0; i != data.size(); ++i) data[i] = char(i*7);
+
+    std::string input = Directory::join(_writeTestDir, "copyLargeInput");
+    std::string output = Directory::join(_writeTestDir, "copyLarge");
+    CORRADE_VERIFY(Directory::write(input, data));
+    if(Directory::fileExists(output))
+        CORRADE_VERIFY(Directory::rm(output));
+
+    CORRADE_VERIFY(Directory::copy(input, output));
+    CORRADE_COMPARE_AS(Directory::read(output), data,
+        TestSuite::Compare::Container);
+}
+
+void DirectoryTest::copyOverwrite() {
+    /* The previous contents are longer, check they get truncated */
+    std::string output = Directory::join(_writeTestDir, "copyOverwrite");
+    CORRADE_VERIFY(Directory::writeString(output, "some long previous contents"));
+
+    CORRADE_VERIFY(Directory::copy(Directory::join(_testDir, "file"), output));
+    CORRADE_COMPARE_AS(output, Directory::join(_testDir, "file"),
+        TestSuite::Compare::File);
+}
+
+void DirectoryTest::copyEmpty() {
+    std::string input = Directory::join(_writeTestDir, "copyEmptyInput");
+    std::string output = Directory::join(_writeTestDir, "copyEmpty");
+    CORRADE_VERIFY(Directory::write(input, nullptr));
+    CORRADE_VERIFY(Directory::writeString(output, "previous contents"));
+
+    CORRADE_VERIFY(Directory::copy(input, output));
+    CORRADE_COMPARE_AS(output, "", TestSuite::Compare::FileToString);
+}
+
+void DirectoryTest::copyNonexistent() {
+    std::ostringstream out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!Directory::copy("nonexistent", Directory::join(_writeTestDir, "copyNonexistent")));
+    CORRADE_COMPARE(out.str(), "Utility::Directory::copy(): can't open nonexistent\n");
+}
+
+void DirectoryTest::copySameFile() {
+    #if !defined(CORRADE_TARGET_UNIX) && !defined(CORRADE_TARGET_WINDOWS)
+    CORRADE_SKIP("Not detected on this platform.");
+    #else
+    std::string file = Directory::join(_writeTestDir, "copySameFile");
+    CORRADE_VERIFY(Directory::writeString(file, "contents"));
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!Directory::copy(file, file));
+    /* The file is not truncated */
+    CORRADE_COMPARE_AS(file, "contents", TestSuite::Compare::FileToString);
+    #endif
+}
+
+void DirectoryTest::copyUtf8() {
+    std::string output = Directory::join(_writeTestDir, "kopie hýždě");
+    if(Directory::fileExists(output))
+        CORRADE_VERIFY(Directory::rm(output));
+
+    CORRADE_VERIFY(Directory::copy(Directory::join(_testDirUtf8, "hýždě"), output));
+    CORRADE_COMPARE_AS(output, Directory::join(_testDirUtf8, "hýždě"),
+        TestSuite::Compare::File);
+}
+
 void DirectoryTest::mkpath() {
     /* Existing */
     CORRADE_VERIFY(Directory::fileExists(_writeTestDir));
@@ -689,6 +838,127 @@ void DirectoryTest::listUtf8() {
         TestSuite::Compare::SortedContainer);
 }
 
+namespace {
+
+std::vector<std::string> walkPaths(const Directory::Tree& tree) {
+    std::vector<std::string> out;
+    for(std::size_t i = 0; i != tree.size(); ++i)
+        out.emplace_back(tree.path(i).data(), tree.path(i).size());
+    return out;
+}
+
+}
+
+void DirectoryTest::walk() {
+    #if defined(CORRADE_TARGET_IOS) && defined(CORRADE_TESTSUITE_TARGET_XCTEST)
+    CORRADE_EXPECT_FAIL_IF(!std::getenv("SIMULATOR_UDID"),
+        "CTest is not able to run XCTest executables properly in the simulator.");
+    #endif
+
+    Containers::Optional<Directory::Tree> tree = Directory::walk(_testDir, Directory::WalkFlag::SortAscending);
+    CORRADE_VERIFY(tree);
+    CORRADE_COMPARE_AS(walkPaths(*tree),
+        (std::vector<std::string>{"dir", "dir/dummy", "file"}),
+        TestSuite::Compare::Container);
+
+    CORRADE_VERIFY((*tree)[0].type == Directory::EntryType::Directory);
+    CORRADE_VERIFY((*tree)[1].type == Directory::EntryType::File);
+    CORRADE_COMPARE((*tree)[1].size, 0);
+    CORRADE_VERIFY((*tree)[2].type == Directory::EntryType::File);
+    CORRADE_COMPARE((*tree)[2].size, 11);
+    CORRADE_VERIFY((*tree)[2].modificationTime > 0);
+
+    /* The paths are null-terminated */
+    CORRADE_COMPARE(tree->path(2).data()[tree->path(2).size()], '\0');
+    CORRADE_COMPARE(tree->paths().size(), 19);
+}
+
+void DirectoryTest::walkSkipMetadata() {
+    #if defined(CORRADE_TARGET_IOS) && defined(CORRADE_TESTSUITE_TARGET_XCTEST)
+    CORRADE_EXPECT_FAIL_IF(!std::getenv("SIMULATOR_UDID"),
+        "CTest is not able to run XCTest executables properly in the simulator.");
+    #endif
+
+    Containers::Optional<Directory::Tree> tree = Directory::walk(_testDir, Directory::WalkFlag::SortAscending|Directory::WalkFlag::SkipMetadata);
+    CORRADE_VERIFY(tree);
+    CORRADE_COMPARE(tree->size(), 3);
+    CORRADE_VERIFY((*tree)[0].type == Directory::EntryType::Directory);
+    CORRADE_VERIFY((*tree)[2].type == Directory::EntryType::File);
+    CORRADE_COMPARE((*tree)[2].size, 0);
+    CORRADE_COMPARE((*tree)[2].modificationTime, 0);
+}
+
+void DirectoryTest::walkParallel() {
+    /* Nested directories with files on every level */
+    const std::string root = Directory::join(_writeTestDir, "walk");
+    std::vector<std::string> expected;
+    for(const char* a: {"a", "b", "c"}) {
+        for(const char* b: {"d", "e"}) {
+            const std::string path = Directory::join(Directory::join(a, b), "f");
+            CORRADE_VERIFY(Directory::mkpath(Directory::join(root, path)));
+            for(const char* c: {"0", "1", "2"})
+                CORRADE_VERIFY(Directory::writeString(Directory::join(Directory::join(root, path), c), c));
+        }
+        CORRADE_VERIFY(Directory::writeString(Directory::join(Directory::join(root, a), "file"), a));
+    }
+
+    Containers::Optional<Directory::Tree> sequential = Directory::walk(root, Directory::WalkFlag::SortAscending, 1);
+    Containers::Optional<Directory::Tree> parallel = Directory::walk(root, Directory::WalkFlag::SortAscending, 4);
+    CORRADE_VERIFY(sequential);
+    CORRADE_VERIFY(parallel);
+
+    /* 3 + 3*(2 + 1) + 3*2*(1 + 3) */
+    CORRADE_COMPARE(sequential->size(), 36);
+    CORRADE_COMPARE_AS(walkPaths(*parallel), walkPaths(*sequential),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE(walkPaths(*sequential)[0], "a");
+    CORRADE_COMPARE(walkPaths(*sequential)[1], "a/d");
+    CORRADE_COMPARE(walkPaths(*sequential)[2], "a/d/f");
+    CORRADE_COMPARE(walkPaths(*sequential)[3], "a/d/f/0");
+    CORRADE_COMPARE(walkPaths(*sequential)[11], "a/file");
+    CORRADE_COMPARE(walkPaths(*sequential)[12], "b");
+    CORRADE_COMPARE(walkPaths(*sequential)[35], "c/file");
+}
+
+void DirectoryTest::walkSymlink() {
+    #ifndef CORRADE_TARGET_UNIX
+    CORRADE_SKIP("Symlinks are tested only on Unix.");
+    #else
+    const std::string root = Directory::join(_writeTestDir, "walkSymlink");
+    CORRADE_VERIFY(Directory::mkpath(root));
+    const std::string link = Directory::join(root, "link");
+    Directory::rm(link);
+    CORRADE_COMPARE(symlink(_testDir.data(), link.data()), 0);
+
+    Containers::Optional<Directory::Tree> tree = Directory::walk(root);
+    CORRADE_VERIFY(tree);
+    CORRADE_COMPARE_AS(walkPaths(*tree),
+        std::vector<std::string>{"link"},
+        TestSuite::Compare::Container);
+    CORRADE_VERIFY((*tree)[0].type == Directory::EntryType::Symlink);
+    #endif
+}
+
+void DirectoryTest::walkNonexistent() {
+    std::ostringstream out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!Directory::walk("nonexistent"));
+    CORRADE_COMPARE(out.str(), "Utility::Directory::walk(): can't open nonexistent\n");
+}
+
+void DirectoryTest::walkUtf8() {
+    #if defined(CORRADE_TARGET_IOS) && defined(CORRADE_TESTSUITE_TARGET_XCTEST)
+    CORRADE_EXPECT_FAIL_IF(!std::getenv("SIMULATOR_UDID"),
+        "CTest is not able to run XCTest executables properly in the simulator.");
+    #endif
+
+    Containers::Optional<Directory::Tree> tree = Directory::walk(_testDirUtf8, Directory::WalkFlag::SortAscending);
+    CORRADE_VERIFY(tree);
+    CORRADE_COMPARE_AS(walkPaths(*tree),
+        (std::vector<std::string>{"hýždě", "šňůra", "šňůra/dummy"}),
+        TestSuite::Compare::Container);
+}
+
 void DirectoryTest::read() {
     /* Existing file, check if we are reading it as binary (CR+LF is not
        converted to LF) and nothing after \0 gets lost */
@@ -740,6 +1010,81 @@ void DirectoryTest::readUtf8() {
         TestSuite::Compare::Container);
 }
 
+namespace {
+    struct Chunks {
+        Containers::Array<char> data;
+        std::size_t count;
+        std::size_t stopAfter;
+    };
+
+    bool appendChunk(Containers::ArrayView<const char> chunk, void* state) {
+        Chunks& chunks = *static_cast<Chunks*>(state);
+        arrayAppend(chunks.data, chunk);
+        return ++chunks.count != chunks.stopAfter;
+    }
+}
+
+void DirectoryTest::readChunks() {
+    for(Directory::ReadChunksFlags flags: {Directory::ReadChunksFlags{}, Directory::ReadChunksFlags{Directory::ReadChunksFlag::ReadAhead}}) {
+        for(std::size_t chunkSize: {1, 3, 11, 4096}) {
+            Chunks chunks{nullptr, 0, 0};
+            CORRADE_VERIFY(Directory::readChunks(Directory::join(_testDir, "file"), chunkSize, appendChunk, &chunks, flags));
+            CORRADE_COMPARE(chunks.count, (11 + chunkSize - 1)/chunkSize);
+            CORRADE_COMPARE_AS(chunks.data,
+                (Containers::Array<char>{Containers::InPlaceInit,
+                    {'\xCA', '\xFE', '\xBA', '\xBE', '\x0D', '\x0A', '\x00', '\xDE', '\xAD', '\xBE', '\xEF'}}),
+                TestSuite::Compare::Container);
+        }
+    }
+}
+
+void DirectoryTest::readChunksLarge() {
+    Containers::Array<char> data{Containers::NoInit, 1000003};
+    for(std::size_t i = 0; i != data.size(); ++i) data[i] = char(i*2654435761u >> 24);
+
+    const std::string filename = Directory::join(_writeTestDir, "chunks");
+    CORRADE_VERIFY(Directory::write(filename, data));
+
+    for(Directory::ReadChunksFlags flags: {Directory::ReadChunksFlags{}, Directory::ReadChunksFlags{Directory::ReadChunksFlag::ReadAhead}}) {
+        Chunks chunks{nullptr, 0, 0};
+        CORRADE_VERIFY(Directory::readChunks(filename, 4096, appendChunk, &chunks, flags));
+        CORRADE_COMPARE(chunks.count, 245);
+        CORRADE_COMPARE_AS(chunks.data, data, TestSuite::Compare::Container);
+    }
+}
+
+void DirectoryTest::readChunksStop() {
+    for(Directory::ReadChunksFlags flags: {Directory::ReadChunksFlags{}, Directory::ReadChunksFlags{Directory::ReadChunksFlag::ReadAhead}}) {
+        Chunks chunks{nullptr, 0, 2};
+        CORRADE_VERIFY(Directory::readChunks(Directory::join(_testDir, "file"), 4, appendChunk, &chunks, flags));
+        CORRADE_COMPARE(chunks.count, 2);
+        CORRADE_COMPARE_AS(chunks.data,
+            (Containers::Array<char>{Containers::InPlaceInit,
+                {'\xCA', '\xFE', '\xBA', '\xBE', '\x0D', '\x0A', '\x00', '\xDE'}}),
+            TestSuite::Compare::Container);
+    }
+}
+
+void DirectoryTest::readChunksEmpty() {
+    const std::string empty = Directory::join(_testDir, "dir/dummy");
+    CORRADE_VERIFY(Directory::fileExists(empty));
+
+    for(Directory::ReadChunksFlags flags: {Directory::ReadChunksFlags{}, Directory::ReadChunksFlags{Directory::ReadChunksFlag::ReadAhead}}) {
+        Chunks chunks{nullptr, 0, 0};
+        CORRADE_VERIFY(Directory::readChunks(empty, 4096, appendChunk, &chunks, flags));
+        CORRADE_COMPARE(chunks.count, 0);
+    }
+}
+
+void DirectoryTest::readChunksNonexistent() {
+    std::ostringstream out;
+    Error err{&out};
+    Chunks chunks{nullptr, 0, 0};
+    CORRADE_VERIFY(!Directory::readChunks("nonexistent", 4096, appendChunk, &chunks));
+    CORRADE_COMPARE(chunks.count, 0);
+    CORRADE_COMPARE(out.str(), "Utility::Directory::readChunks(): can't open nonexistent\n");
+}
+
 void DirectoryTest::write() {
     constexpr char data[] = {'\xCA', '\xFE', '\xBA', '\xBE', '\x0D', '\x0A', '\x00', '\xDE', '\xAD', '\xBE', '\xEF'};
     CORRADE_VERIFY(Directory::write(Directory::join(_writeTestDir, "file"), data));
@@ -769,6 +1114,82 @@ void DirectoryTest::writeUtf8() {
         TestSuite::Compare::File);
 }
 
+void DirectoryTest::writeMultiple() {
+    constexpr char header[] = {'\xCA', '\xFE', '\xBA', '\xBE'};
+    constexpr char body[] = {'\x0D', '\x0A', '\x00'};
+    constexpr char footer[] = {'\xDE', '\xAD', '\xBE', '\xEF'};
+    const std::string filename = Directory::join(_writeTestDir, "writeMultiple");
+
+    /* Empty views in between shouldn't break anything */
+    CORRADE_VERIFY(Directory::write(filename, {header, nullptr, body, footer, nullptr}));
+    CORRADE_COMPARE_AS(filename, Directory::join(_testDir, "file"),
+        TestSuite::Compare::File);
+
+    /* Runtime-sized list, overwriting the previous contents */
+    const Containers::ArrayView<const void> views[]{footer, header};
+    CORRADE_VERIFY(Directory::write(filename, views));
+    CORRADE_COMPARE_AS(filename, std::string("\xDE\xAD\xBE\xEF\xCA\xFE\xBA\xBE"),
+        TestSuite::Compare::FileToString);
+}
+
+void DirectoryTest::writeMultipleMany() {
+    /* More than IOV_MAX on all sane systems, so it has to be split into
+       multiple writev() calls */
+    std::string expected;
+    std::vector<std::string> strings;
+    for(std::size_t i = 0; i != 3000; ++i) {
+        strings.push_back(std::to_string(i) + ",");
+        expected += strings.back();
+    }
+    std::vector<Containers::ArrayView<const void>> views;
+    for(const std::string& string: strings)
+        views.push_back({string.data(), string.size()});
+
+    const std::string filename = Directory::join(_writeTestDir, "writeMultipleMany");
+    CORRADE_VERIFY(Directory::write(filename, Containers::ArrayView<const Containers::ArrayView<const void>>{views.data(), views.size()}));
+    CORRADE_COMPARE_AS(filename, expected,
+        TestSuite::Compare::FileToString);
+}
+
+void DirectoryTest::writeSync() {
+    const std::string filename = Directory::join(_writeTestDir, "writeSync");
+    CORRADE_VERIFY(Directory::write(filename, {"hello", 5}, Directory::WriteFlag::Sync));
+    CORRADE_VERIFY(Directory::write(filename, {Containers::ArrayView<const void>{"hello", 5}, Containers::ArrayView<const void>{" world", 6}}, Directory::WriteFlag::Sync));
+    CORRADE_COMPARE_AS(filename, "hello world",
+        TestSuite::Compare::FileToString);
+}
+
+void DirectoryTest::append() {
+    const std::string filename = Directory::join(_writeTestDir, "append");
+    CORRADE_VERIFY(Directory::writeString(filename, "hello"));
+    CORRADE_VERIFY(Directory::append(filename, {" world", 6}));
+    CORRADE_VERIFY(Directory::appendString(filename, "!"));
+    CORRADE_VERIFY(Directory::append(filename, nullptr));
+    CORRADE_COMPARE_AS(filename, "hello world!",
+        TestSuite::Compare::FileToString);
+}
+
+void DirectoryTest::appendMultiple() {
+    const std::string filename = Directory::join(_writeTestDir, "appendMultiple");
+    CORRADE_VERIFY(Directory::writeString(filename, "a"));
+
+    const Containers::ArrayView<const void> views[]{{"bc", 2}, {"d", 1}};
+    CORRADE_VERIFY(Directory::append(filename, views));
+    CORRADE_VERIFY(Directory::append(filename, {Containers::ArrayView<const void>{"ef", 2}, Containers::ArrayView<const void>{"g", 1}}, Directory::WriteFlag::Sync));
+    CORRADE_COMPARE_AS(filename, "abcdefg",
+        TestSuite::Compare::FileToString);
+}
+
+void DirectoryTest::appendNonexistent() {
+    const std::string filename = Directory::join(_writeTestDir, "appendNonexistent");
+    if(Directory::fileExists(filename))
+        CORRADE_VERIFY(Directory::rm(filename));
+
+    CORRADE_VERIFY(Directory::append(filename, {"hello", 5}));
+    CORRADE_COMPARE_AS(filename, "hello",
+        TestSuite::Compare::FileToString);
+}
+
 void DirectoryTest::map() {
     #if defined(CORRADE_TARGET_UNIX) || (defined(CORRADE_TARGET_WINDOWS) && !defined(CORRADE_TARGET_WINDOWS_RT))
     std::string data{"\xCA\xFE\xBA\xBE\x0D\x0A\x00\xDE\xAD\xBE\xEF", 11};
@@ -786,6 +1207,23 @@ void DirectoryTest::map() {
     #endif
 }
 
+void DirectoryTest::mapFlags() {
+    #if defined(CORRADE_TARGET_UNIX) || (defined(CORRADE_TARGET_WINDOWS) && !defined(CORRADE_TARGET_WINDOWS_RT))
+    std::string data{"\xCA\xFE\xBA\xBE\x0D\x0A\x00\xDE\xAD\xBE\xEF", 11};
+    {
+        auto mappedFile = Directory::map(Directory::join(_writeTestDir, "mappedFile"), data.size(), Directory::MapFlag::Sequential|Directory::MapFlag::Populate|Directory::MapFlag::HugePages);
+        CORRADE_VERIFY(mappedFile);
+        CORRADE_COMPARE(mappedFile.size(), data.size());
+        std::copy(std::begin(data), std::end(data), mappedFile.begin());
+    }
+    CORRADE_COMPARE_AS(Directory::join(_writeTestDir, "mappedFile"),
+        data,
+        TestSuite::Compare::FileToString);
+    #else
+    CORRADE_SKIP("Not implemented on this platform.");
+    #endif
+}
+
 void DirectoryTest::mapNoPermission() {
     #if defined(CORRADE_TARGET_UNIX) || (defined(CORRADE_TARGET_WINDOWS) && !defined(CORRADE_TARGET_WINDOWS_RT))
     {
@@ -831,6 +1269,99 @@ void DirectoryTest::mapRead() {
     #endif
 }
 
+void DirectoryTest::mapReadFlags() {
+    #if defined(CORRADE_TARGET_UNIX) || (defined(CORRADE_TARGET_WINDOWS) && !defined(CORRADE_TARGET_WINDOWS_RT))
+    /* The flags are just hints, the contents should be always the same */
+    for(Directory::MapFlags flags: {
+        Directory::MapFlags{Directory::MapFlag::Sequential},
+        Directory::MapFlags{Directory::MapFlag::Random},
+        Directory::MapFlags{Directory::MapFlag::WillNeed},
+        Directory::MapFlags{Directory::MapFlag::Populate},
+        Directory::MapFlags{Directory::MapFlag::HugePages},
+        Directory::MapFlag::Sequential|Directory::MapFlag::Random|Directory::MapFlag::WillNeed|Directory::MapFlag::Populate|Directory::MapFlag::HugePages})
+    {
+        const auto mappedFile = Directory::mapRead(Directory::join(_testDir, "file"), flags);
+        CORRADE_COMPARE_AS(Containers::ArrayView<const char>(mappedFile),
+            (Containers::Array<char>{Containers::InPlaceInit,
+                {'\xCA', '\xFE', '\xBA', '\xBE', '\x0D', '\x0A', '\x00', '\xDE', '\xAD', '\xBE', '\xEF'}}),
+            TestSuite::Compare::Container);
+    }
+    #else
+    CORRADE_SKIP("Not implemented on this platform.");
+    #endif
+}
+
+void DirectoryTest::mapReadRange() {
+    #if defined(CORRADE_TARGET_UNIX) || (defined(CORRADE_TARGET_WINDOWS) && !defined(CORRADE_TARGET_WINDOWS_RT))
+    {
+        const auto mappedFile = Directory::mapRead(Directory::join(_testDir, "file"), 2, 5);
+        CORRADE_COMPARE_AS(Containers::ArrayView<const char>(mappedFile),
+            (Containers::Array<char>{Containers::InPlaceInit,
+                {'\xBA', '\xBE', '\x0D', '\x0A', '\x00'}}),
+            TestSuite::Compare::Container);
+    }
+
+    /* Offset that's past the first page (or allocation granularity unit) and
+       not aligned to it */
+    Containers::Array<char> data{Containers::NoInit, 200000};
+    for(std::size_t i = 0; i != data.size(); ++i) data[i] = char(i*2654435761u >> 24);
+    const std::string filename = Directory::join(_writeTestDir, "mappedRange");
+    CORRADE_VERIFY(Directory::write(filename, data));
+    {
+        const auto mappedFile = Directory::mapRead(filename, 70001, 12345, Directory::MapFlag::Sequential);
+        CORRADE_COMPARE_AS(Containers::ArrayView<const char>(mappedFile),
+            data.slice(70001, 82346),
+            TestSuite::Compare::Container);
+    }
+
+    /* Range ending at the end of the file */
+    {
+        const auto mappedFile = Directory::mapRead(filename, 199999, 1);
+        CORRADE_COMPARE(mappedFile.size(), 1);
+        CORRADE_COMPARE(mappedFile[0], data[199999]);
+    }
+
+    /* Everything from an offset to the end of the file */
+    {
+        const auto mappedFile = Directory::mapRead(filename, 170001, ~std::size_t{});
+        CORRADE_COMPARE_AS(Containers::ArrayView<const char>(mappedFile),
+            data.suffix(170001),
+            TestSuite::Compare::Container);
+    }
+    #else
+    CORRADE_SKIP("Not implemented on this platform.");
+    #endif
+}
+
+void DirectoryTest::mapReadRangeOutOfRange() {
+    #if defined(CORRADE_TARGET_UNIX) || (defined(CORRADE_TARGET_WINDOWS) && !defined(CORRADE_TARGET_WINDOWS_RT))
+    {
+        std::ostringstream out;
+        Error err{&out};
+        CORRADE_VERIFY(!Directory::mapRead(Directory::join(_testDir, "file"), 7, 5));
+        CORRADE_COMPARE(out.str(), "Utility::Directory::mapRead(): range [7:12] out of range for a file of 11 bytes\n");
+    }
+
+    /* Offset past the end with a to-the-end size */
+    {
+        std::ostringstream out;
+        Error err{&out};
+        CORRADE_VERIFY(!Directory::mapRead(Directory::join(_testDir, "file"), 12, ~std::size_t{}));
+        CORRADE_COMPARE(out.str(), "Utility::Directory::mapRead(): range [12:end] out of range for a file of 11 bytes\n");
+    }
+
+    /* Size so large the end would overflow and wrap around */
+    {
+        std::ostringstream out;
+        Error err{&out};
+        CORRADE_VERIFY(!Directory::mapRead(Directory::join(_testDir, "file"), 7, ~std::size_t{} - 2));
+        CORRADE_COMPARE(out.str(), "Utility::Directory::mapRead(): range [7:7+" + std::to_string(~std::size_t{} - 2) + "] out of range for a file of 11 bytes\n");
+    }
+    #else
+    CORRADE_SKIP("Not implemented on this platform.");
+    #endif
+}
+
 void DirectoryTest::mapReadNonexistent() {
     #if defined(CORRADE_TARGET_UNIX) || (defined(CORRADE_TARGET_WINDOWS) && !defined(CORRADE_TARGET_WINDOWS_RT))
     {
@@ -0,0 +1,149 @@
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <cstdint>
+
+#include "Corrade/TestSuite/Tester.h"
+#include "Corrade/Utility/Memory.h"
+
+namespace Corrade { namespace Utility { namespace Test {
+
+struct MemoryBenchmark: TestSuite::Tester {
+    explicit MemoryBenchmark();
+
+    void streamingReadArray();
+    void streamingReadPages();
+    void streamingReadHugePages();
+
+    void pageStridedReadArray();
+    void pageStridedReadPages();
+    void pageStridedReadHugePages();
+};
+
+enum: std::size_t {
+    /* 32 MB, large enough to not fit into caches and to need several
+       thousand of regular TLB entries */
+    Size = 8*1024*1024,
+
+    /* One item per 4 kB page */
+    PageStride = 4096/sizeof(std::uint32_t)
+};
+
+MemoryBenchmark::MemoryBenchmark() {
+    addBenchmarks({&MemoryBenchmark::streamingReadArray,
+                   &MemoryBenchmark::streamingReadPages,
+                   &MemoryBenchmark::streamingReadHugePages,
+
+                   &MemoryBenchmark::pageStridedReadArray,
+                   &MemoryBenchmark::pageStridedReadPages,
+                   &MemoryBenchmark::pageStridedReadHugePages}, 5);
+}
+
+namespace {
+
+void fill(Containers::Array<std::uint32_t>& data) {
+    /* Touching everything so page faults don't get into the measurement */
+    for(std::size_t i = 0; i != data.size(); ++i)
+        data[i] = std::uint32_t(i & 0xff);
+}
+
+std::uint32_t streamingRead(const Containers::Array<std::uint32_t>& data) {
+    std::uint32_t sum = 0;
+    for(std::uint32_t i: data) sum += i;
+    return sum;
+}
+
+std::uint32_t pageStridedRead(const Containers::Array<std::uint32_t>& data) {
+    /* Every read touches a different page, so the throughput is dominated
+       by TLB misses unless the pages are huge */
+    std::uint32_t sum = 0;
+    for(std::size_t offset = 0; offset != PageStride; offset += 64/sizeof(std::uint32_t))
+        for(std::size_t i = offset; i < data.size(); i += PageStride)
+            sum += data[i];
+    return sum;
+}
+
+}
+
+constexpr std::uint32_t StreamingSum = Size/256*(255*256/2);
+constexpr std::uint32_t PageStridedSum = Size/PageStride*(0 + 16 + 32 + 48 + 64 + 80 + 96 + 112 + 128 + 144 + 160 + 176 + 192 + 208 + 224 + 240)*4;
+
+void MemoryBenchmark::streamingReadArray() {
+    Containers::Array<std::uint32_t> data{Containers::NoInit, Size};
+    fill(data);
+
+    std::uint32_t sum{};
+    CORRADE_BENCHMARK(1) sum = streamingRead(data);
+    CORRADE_COMPARE(sum, StreamingSum);
+}
+
+void MemoryBenchmark::streamingReadPages() {
+    Containers::Array<std::uint32_t> data = allocatePages<std::uint32_t>(Containers::NoInit, Size);
+    fill(data);
+
+    std::uint32_t sum{};
+    CORRADE_BENCHMARK(1) sum = streamingRead(data);
+    CORRADE_COMPARE(sum, StreamingSum);
+}
+
+void MemoryBenchmark::streamingReadHugePages() {
+    Containers::Array<std::uint32_t> data = allocateHugePages<std::uint32_t>(Containers::NoInit, Size);
+    fill(data);
+
+    std::uint32_t sum{};
+    CORRADE_BENCHMARK(1) sum = streamingRead(data);
+    CORRADE_COMPARE(sum, StreamingSum);
+}
+
+void MemoryBenchmark::pageStridedReadArray() {
+    Containers::Array<std::uint32_t> data{Containers::NoInit, Size};
+    fill(data);
+
+    std::uint32_t sum{};
+    CORRADE_BENCHMARK(1) sum = pageStridedRead(data);
+    CORRADE_COMPARE(sum, PageStridedSum);
+}
+
+void MemoryBenchmark::pageStridedReadPages() {
+    Containers::Array<std::uint32_t> data = allocatePages<std::uint32_t>(Containers::NoInit, Size);
+    fill(data);
+
+    std::uint32_t sum{};
+    CORRADE_BENCHMARK(1) sum = pageStridedRead(data);
+    CORRADE_COMPARE(sum, PageStridedSum);
+}
+
+void MemoryBenchmark::pageStridedReadHugePages() {
+    Containers::Array<std::uint32_t> data = allocateHugePages<std::uint32_t>(Containers::NoInit, Size);
+    fill(data);
+
+    std::uint32_t sum{};
+    CORRADE_BENCHMARK(1) sum = pageStridedRead(data);
+    CORRADE_COMPARE(sum, PageStridedSum);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Corrade::Utility::Test::MemoryBenchmark)
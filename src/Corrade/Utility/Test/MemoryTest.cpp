@@ -0,0 +1,223 @@
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <cstdint>
+#include <sstream>
+
+#include "Corrade/TestSuite/Tester.h"
+#include "Corrade/Utility/Memory.h"
+
+namespace Corrade { namespace Utility { namespace Test {
+
+struct MemoryTest: TestSuite::Tester {
+    explicit MemoryTest();
+
+    template<std::size_t alignment> void allocateAligned();
+    void allocateAlignedValueInit();
+    void allocateAlignedNoInit();
+    void allocateAlignedNonTrivial();
+    void allocateAlignedZeroSize();
+    void allocateAlignedMove();
+
+    void allocatePages();
+    void allocatePagesValueInit();
+    void allocatePagesNonTrivial();
+    void allocatePagesZeroSize();
+    void allocateHugePages();
+};
+
+MemoryTest::MemoryTest() {
+    addTests<MemoryTest>({&MemoryTest::allocateAligned<1>,
+              &MemoryTest::allocateAligned<16>,
+              &MemoryTest::allocateAligned<32>,
+              &MemoryTest::allocateAligned<64>,
+              &MemoryTest::allocateAligned<4096>,
+              &MemoryTest::allocateAlignedValueInit,
+              &MemoryTest::allocateAlignedNoInit,
+              &MemoryTest::allocateAlignedNonTrivial,
+              &MemoryTest::allocateAlignedZeroSize,
+              &MemoryTest::allocateAlignedMove,
+
+              &MemoryTest::allocatePages,
+              &MemoryTest::allocatePagesValueInit,
+              &MemoryTest::allocatePagesNonTrivial,
+              &MemoryTest::allocatePagesZeroSize,
+              &MemoryTest::allocateHugePages});
+}
+
+namespace {
+
+bool isAligned(const void* data, std::size_t alignment) {
+    return reinterpret_cast<std::uintptr_t>(data) % alignment == 0;
+}
+
+struct Counted {
+    static int constructed;
+    static int destructed;
+
+    Counted(): a{1337} { ++constructed; }
+    ~Counted() { ++destructed; }
+
+    int a;
+};
+
+int Counted::constructed = 0;
+int Counted::destructed = 0;
+
+}
+
+template<std::size_t alignment> void MemoryTest::allocateAligned() {
+    setTestCaseName("allocateAligned<" + std::to_string(alignment) + ">");
+
+    /* Allocate a few times to not pass just by accident */
+    for(std::size_t i = 0; i != 5; ++i) {
+        Containers::Array<char> a = Utility::allocateAligned<char, alignment>(333);
+        CORRADE_VERIFY(a);
+        CORRADE_COMPARE(a.size(), 333);
+        CORRADE_VERIFY(a.deleter());
+        CORRADE_VERIFY(isAligned(a.data(), alignment));
+
+        /* Should be writable all the way */
+        a[0] = 'a';
+        a[332] = 'z';
+        CORRADE_COMPARE(a[332], 'z');
+    }
+}
+
+void MemoryTest::allocateAlignedValueInit() {
+    Containers::Array<std::uint64_t> a = Utility::allocateAligned<std::uint64_t, 64>(Containers::ValueInit, 100);
+    CORRADE_COMPARE(a.size(), 100);
+    CORRADE_VERIFY(isAligned(a.data(), 64));
+    for(std::uint64_t i: a) CORRADE_COMPARE(i, 0);
+}
+
+void MemoryTest::allocateAlignedNoInit() {
+    Counted::constructed = Counted::destructed = 0;
+    {
+        Containers::Array<Counted> a = Utility::allocateAligned<Counted, 32>(Containers::NoInit, 3);
+        CORRADE_COMPARE(a.size(), 3);
+        CORRADE_VERIFY(isAligned(a.data(), 32));
+        CORRADE_COMPARE(Counted::constructed, 0);
+
+        for(Counted& i: a) new(&i) Counted;
+        CORRADE_COMPARE(Counted::constructed, 3);
+    }
+
+    CORRADE_COMPARE(Counted::destructed, 3);
+}
+
+void MemoryTest::allocateAlignedNonTrivial() {
+    Counted::constructed = Counted::destructed = 0;
+    {
+        Containers::Array<Counted> a = Utility::allocateAligned<Counted, 64>(5);
+        CORRADE_COMPARE(a.size(), 5);
+        CORRADE_VERIFY(isAligned(a.data(), 64));
+        CORRADE_COMPARE(Counted::constructed, 5);
+        CORRADE_COMPARE(a[4].a, 1337);
+    }
+
+    CORRADE_COMPARE(Counted::destructed, 5);
+}
+
+void MemoryTest::allocateAlignedZeroSize() {
+    Containers::Array<int> a = Utility::allocateAligned<int, 64>(0);
+    CORRADE_VERIFY(!a);
+    CORRADE_VERIFY(!a.deleter());
+}
+
+void MemoryTest::allocateAlignedMove() {
+    Containers::Array<int> a = Utility::allocateAligned<int, 64>(Containers::ValueInit, 3);
+    int* const data = a.data();
+    const auto deleter = a.deleter();
+
+    /* Ownership is transferred together with the deleter */
+    Containers::Array<int> b = std::move(a);
+    CORRADE_VERIFY(!a);
+    CORRADE_COMPARE(b.data(), data);
+    CORRADE_VERIFY(b.deleter() == deleter);
+
+    /* Releasing and deleting manually works as expected */
+    const std::size_t size = b.size();
+    deleter(b.release(), size);
+}
+
+void MemoryTest::allocatePages() {
+    Containers::Array<char> a = Utility::allocatePages<char>(Containers::NoInit, 5000);
+    CORRADE_COMPARE(a.size(), 5000);
+    CORRADE_VERIFY(isAligned(a.data(), 4096));
+    a[0] = 'a';
+    a[4999] = 'z';
+    CORRADE_COMPARE(a[4999], 'z');
+}
+
+void MemoryTest::allocatePagesValueInit() {
+    Containers::Array<int> a = Utility::allocatePages<int>(Containers::ValueInit, 3000);
+    CORRADE_COMPARE(a.size(), 3000);
+    for(int i: a) CORRADE_COMPARE(i, 0);
+}
+
+void MemoryTest::allocatePagesNonTrivial() {
+    Counted::constructed = Counted::destructed = 0;
+    {
+        Containers::Array<Counted> a = Utility::allocatePages<Counted>(Containers::ValueInit, 3);
+        CORRADE_COMPARE(Counted::constructed, 3);
+        CORRADE_COMPARE(a[2].a, 1337);
+    }
+
+    CORRADE_COMPARE(Counted::destructed, 3);
+}
+
+void MemoryTest::allocatePagesZeroSize() {
+    Containers::Array<int> a = Utility::allocatePages<int>(0);
+    CORRADE_VERIFY(!a);
+    CORRADE_VERIFY(!a.deleter());
+
+    Containers::Array<int> b = Utility::allocateHugePages<int>(0);
+    CORRADE_VERIFY(!b);
+    CORRADE_VERIFY(!b.deleter());
+}
+
+void MemoryTest::allocateHugePages() {
+    /* Allocate a few times to not pass just by accident */
+    for(std::size_t i = 0; i != 3; ++i) {
+        Containers::Array<std::uint32_t> a = Utility::allocateHugePages<std::uint32_t>(Containers::ValueInit, 1024*1024);
+        CORRADE_COMPARE(a.size(), 1024*1024);
+        #ifdef CORRADE_TARGET_UNIX
+        CORRADE_VERIFY(isAligned(a.data(), 2*1024*1024));
+        #else
+        CORRADE_VERIFY(isAligned(a.data(), 4096));
+        #endif
+
+        /* Should be zero-filled and writable all the way */
+        CORRADE_COMPARE(a[0], 0);
+        CORRADE_COMPARE(a[1024*1024 - 1], 0);
+        a[1024*1024 - 1] = 0xdeadbeef;
+        CORRADE_COMPARE(a[1024*1024 - 1], 0xdeadbeef);
+    }
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Corrade::Utility::Test::MemoryTest)
@@ -0,0 +1,218 @@
+/*
+    This file is part of Corrade.
+
+    Copyright © 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016,
+                2017, 2018 Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include "Corrade/TestSuite/Tester.h"
+#include "Corrade/Utility/Directory.h"
+#include "Corrade/Utility/Resource.h"
+
+#include "configure.h"
+
+namespace Corrade { namespace Utility { namespace Test {
+
+struct ResourceBenchmark: TestSuite::Tester {
+    explicit ResourceBenchmark();
+
+    void registerData();
+    void getRaw();
+    void mountPack();
+
+    void compileHex();
+    void compileIncbin();
+    void buildHex();
+    void buildIncbin();
+
+    private:
+        std::vector<std::string> _names;
+        std::vector<unsigned int> _positions;
+        std::string _filenames, _data;
+        std::vector<std::pair<std::string, std::string>> _files;
+};
+
+namespace {
+
+enum: std::size_t {
+    FileCount = 10000,
+    FileSize = 16,
+    CompileFileSize = 1024*1024
+};
+
+}
+
+ResourceBenchmark::ResourceBenchmark() {
+    addBenchmarks({&ResourceBenchmark::registerData,
+                   &ResourceBenchmark::getRaw,
+                   &ResourceBenchmark::mountPack,
+
+                   &ResourceBenchmark::compileHex,
+                   &ResourceBenchmark::compileIncbin}, 10);
+
+    /* Running the compiler takes long, so do just a few iterations */
+    addBenchmarks({&ResourceBenchmark::buildHex,
+                   &ResourceBenchmark::buildIncbin}, 2);
+
+    /* Data laid out the same way as in a file produced by Resource::compile(),
+       the zero-padded names are already sorted */
+    for(std::size_t i = 0; i != FileCount; ++i) {
+        std::string name = std::to_string(i);
+        name = "data/file" + std::string(5 - name.size(), '0') + name + ".bin";
+        _filenames += name;
+        _data += std::string(FileSize, char(i));
+        _positions.push_back(_filenames.size());
+        _positions.push_back(_data.size());
+        _names.push_back(std::move(name));
+    }
+
+    /* A pseudorandom file for measuring compile times, so the compiler can't
+       take any shortcuts with repeated values */
+    std::string compileData(CompileFileSize, '\0');
+    unsigned int state = 0x12345678;
+    for(char& c: compileData) {
+        state = state*1103515245 + 12345;
+        c = char(state >> 24);
+    }
+    _files.emplace_back("data.bin", std::move(compileData));
+
+    Directory::mkpath(RESOURCE_WRITE_TEST_DIR);
+}
+
+void ResourceBenchmark::registerData() {
+    CORRADE_BENCHMARK(1) {
+        Resource::registerData("benchmark", FileCount,
+            reinterpret_cast<const unsigned char*>(_positions.data()),
+            reinterpret_cast<const unsigned char*>(_filenames.data()),
+            reinterpret_cast<const unsigned char*>(_data.data()));
+        Resource::unregisterData("benchmark");
+    }
+
+    CORRADE_VERIFY(!Resource::hasGroup("benchmark"));
+}
+
+void ResourceBenchmark::getRaw() {
+    Resource::registerData("benchmark", FileCount,
+        reinterpret_cast<const unsigned char*>(_positions.data()),
+        reinterpret_cast<const unsigned char*>(_filenames.data()),
+        reinterpret_cast<const unsigned char*>(_data.data()));
+
+    std::size_t size = 0;
+    {
+        Resource resource{"benchmark"};
+        CORRADE_BENCHMARK(1)
+            for(const std::string& name: _names)
+                size += resource.getRaw(name).size();
+    }
+
+    Resource::unregisterData("benchmark");
+    CORRADE_COMPARE(size, FileCount*FileSize);
+}
+
+void ResourceBenchmark::mountPack() {
+    std::vector<std::pair<std::string, std::string>> files;
+    for(std::size_t i = 0; i != FileCount; ++i)
+        files.emplace_back(_names[i], _data.substr(i*FileSize, FileSize));
+    const std::string filename = Directory::join(RESOURCE_WRITE_TEST_DIR, "benchmark.pack");
+    CORRADE_VERIFY(Directory::writeString(filename, Resource::compilePack("benchmark", files)));
+
+    /* Mount, look up all files and unmount again */
+    std::size_t size = 0;
+    CORRADE_BENCHMARK(1) {
+        Resource::mountPack(filename);
+        {
+            Resource resource{"benchmark"};
+            for(const std::string& name: _names)
+                size += resource.getRaw(name).size();
+        }
+        Resource::unmountPack("benchmark");
+    }
+
+    CORRADE_COMPARE(size, FileCount*FileSize);
+}
+
+void ResourceBenchmark::compileHex() {
+    std::size_t size = 0;
+    CORRADE_BENCHMARK(1)
+        size += Resource::compile("ResourceBenchmarkData", "benchmark", _files).size();
+
+    CORRADE_VERIFY(size > CompileFileSize);
+}
+
+void ResourceBenchmark::compileIncbin() {
+    const std::string dataFilename = Directory::join(RESOURCE_WRITE_TEST_DIR, "benchmark-incbin.bin");
+
+    std::size_t size = 0;
+    CORRADE_BENCHMARK(1)
+        size += Resource::compileIncbin("ResourceBenchmarkData", "benchmark", _files, dataFilename).size();
+
+    CORRADE_VERIFY(size);
+    CORRADE_VERIFY(size < CompileFileSize);
+}
+
+namespace {
+
+#ifdef RESOURCE_BENCHMARK_CXX_COMPILER
+int build(const std::string& filename) {
+    const std::string command = RESOURCE_BENCHMARK_CXX_COMPILER " -std=c++11 " RESOURCE_BENCHMARK_INCLUDE_FLAGS " -c " + filename + " -o " + filename + ".o";
+    return std::system(command.data());
+}
+#endif
+
+}
+
+void ResourceBenchmark::buildHex() {
+    #ifndef RESOURCE_BENCHMARK_CXX_COMPILER
+    CORRADE_SKIP("Measuring build times is not supported with this compiler.");
+    #else
+    const std::string filename = Directory::join(RESOURCE_WRITE_TEST_DIR, "benchmark-hex.cpp");
+    CORRADE_VERIFY(Directory::writeString(filename, Resource::compile("ResourceBenchmarkData", "benchmark", _files)));
+
+    int result = 0;
+    CORRADE_BENCHMARK(1)
+        result |= build(filename);
+
+    CORRADE_COMPARE(result, 0);
+    #endif
+}
+
+void ResourceBenchmark::buildIncbin() {
+    #ifndef RESOURCE_BENCHMARK_CXX_COMPILER
+    CORRADE_SKIP("Measuring build times is not supported with this compiler.");
+    #else
+    const std::string filename = Directory::join(RESOURCE_WRITE_TEST_DIR, "benchmark-incbin.cpp");
+    CORRADE_VERIFY(Directory::writeString(filename, Resource::compileIncbin("ResourceBenchmarkData", "benchmark", _files, Directory::join(RESOURCE_WRITE_TEST_DIR, "benchmark-incbin.bin"))));
+
+    int result = 0;
+    CORRADE_BENCHMARK(1)
+        result |= build(filename);
+
+    CORRADE_COMPARE(result, 0);
+    #endif
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Corrade::Utility::Test::ResourceBenchmark)
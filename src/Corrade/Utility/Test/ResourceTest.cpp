@@ -27,6 +27,7 @@
 
 #include "Corrade/TestSuite/Tester.h"
 #include "Corrade/TestSuite/Compare/Container.h"
+#include "Corrade/TestSuite/Compare/FileToString.h"
 #include "Corrade/TestSuite/Compare/StringToFile.h"
 #include "Corrade/Utility/Directory.h"
 #include "Corrade/Utility/Resource.h"
@@ -41,14 +42,21 @@ struct ResourceTest: TestSuite::Tester {
     void compile();
     void compileNothing();
     void compileEmptyFile();
+    void compileIncbin();
+    void compileIncbinNothing();
+    void compileIncbinCannotWrite();
 
     void compileFrom();
     void compileFromUtf8Filenames();
+    void compileFromCompressed();
+    void compilePackFrom();
     void compileFromNonexistentResource();
     void compileFromNonexistentFile();
     void compileFromEmptyGroup();
     void compileFromEmptyFilename();
     void compileFromEmptyAlias();
+    void compileFromAligned();
+    void compileFromInvalidAlignment();
 
     void hasGroup();
     void list();
@@ -56,26 +64,48 @@ struct ResourceTest: TestSuite::Tester {
     void getEmptyFile();
     void getNonexistent();
     void getNothing();
+    void getCompressed();
+    void evictCache();
+    void getAligned();
+
+    void mountPack();
+    void mountPackAligned();
+    void mountPackNonexistent();
+    void mountPackInvalid();
+    void mountPackUnsupportedVersion();
+    void mountPackCorrupted();
+    void mountPackAlreadyRegistered();
+    void unmountPackNotPack();
 
     void overrideGroup();
     void overrideGroupFallback();
     void overrideNonexistentFile();
     void overrideNonexistentGroup();
     void overrideDifferentGroup();
+
+    private:
+        void verifyAligned(const Resource& r);
 };
 
 ResourceTest::ResourceTest() {
     addTests({&ResourceTest::compile,
               &ResourceTest::compileNothing,
               &ResourceTest::compileEmptyFile,
+              &ResourceTest::compileIncbin,
+              &ResourceTest::compileIncbinNothing,
+              &ResourceTest::compileIncbinCannotWrite,
 
               &ResourceTest::compileFrom,
               &ResourceTest::compileFromUtf8Filenames,
+              &ResourceTest::compileFromCompressed,
+              &ResourceTest::compilePackFrom,
               &ResourceTest::compileFromNonexistentResource,
               &ResourceTest::compileFromNonexistentFile,
               &ResourceTest::compileFromEmptyGroup,
               &ResourceTest::compileFromEmptyFilename,
               &ResourceTest::compileFromEmptyAlias,
+              &ResourceTest::compileFromAligned,
+              &ResourceTest::compileFromInvalidAlignment,
 
               &ResourceTest::hasGroup,
               &ResourceTest::list,
@@ -83,6 +113,18 @@ ResourceTest::ResourceTest() {
               &ResourceTest::getEmptyFile,
               &ResourceTest::getNonexistent,
               &ResourceTest::getNothing,
+              &ResourceTest::getCompressed,
+              &ResourceTest::evictCache,
+              &ResourceTest::getAligned,
+
+              &ResourceTest::mountPack,
+              &ResourceTest::mountPackAligned,
+              &ResourceTest::mountPackNonexistent,
+              &ResourceTest::mountPackInvalid,
+              &ResourceTest::mountPackUnsupportedVersion,
+              &ResourceTest::mountPackCorrupted,
+              &ResourceTest::mountPackAlreadyRegistered,
+              &ResourceTest::unmountPackNotPack,
 
               &ResourceTest::overrideGroup,
               &ResourceTest::overrideGroupFallback,
@@ -115,6 +157,57 @@ void ResourceTest::compileEmptyFile() {
                        TestSuite::Compare::StringToFile);
 }
 
+void ResourceTest::compileIncbin() {
+    CORRADE_VERIFY(Directory::mkpath(RESOURCE_WRITE_TEST_DIR));
+    const std::string dataFilename = Directory::join(RESOURCE_WRITE_TEST_DIR, "compiled-incbin.bin");
+    if(Directory::fileExists(dataFilename))
+        CORRADE_VERIFY(Directory::rm(dataFilename));
+
+    std::vector<std::pair<std::string, std::string>> input{
+        {"predisposition.bin", Directory::readString(Directory::join(RESOURCE_TEST_DIR, "predisposition.bin"))},
+        {"consequence.bin", Directory::readString(Directory::join(RESOURCE_TEST_DIR, "consequence.bin"))}};
+    std::string compiled = Resource::compileIncbin("ResourceTestData", "test", input, dataFilename);
+
+    /* The data file path is embedded verbatim, replace it with something
+       predictable */
+    for(std::size_t pos; (pos = compiled.find(dataFilename)) != std::string::npos; )
+        compiled.replace(pos, dataFilename.size(), "compiled-incbin.bin");
+    CORRADE_COMPARE_AS(compiled,
+                       Directory::join(RESOURCE_TEST_DIR, "compiled-incbin.cpp"),
+                       TestSuite::Compare::StringToFile);
+
+    /* The data are sorted the same way as the filenames */
+    CORRADE_COMPARE_AS(dataFilename,
+                       input[1].second + input[0].second,
+                       TestSuite::Compare::FileToString);
+}
+
+void ResourceTest::compileIncbinNothing() {
+    CORRADE_VERIFY(Directory::mkpath(RESOURCE_WRITE_TEST_DIR));
+    const std::string dataFilename = Directory::join(RESOURCE_WRITE_TEST_DIR, "compiled-incbin-nothing.bin");
+    if(Directory::fileExists(dataFilename))
+        CORRADE_VERIFY(Directory::rm(dataFilename));
+
+    /* Same output as with compile(), but the data file is still written so
+       the build system doesn't complain */
+    CORRADE_COMPARE_AS(Resource::compileIncbin("ResourceTestNothingData", "nothing", {}, dataFilename),
+                       Directory::join(RESOURCE_TEST_DIR, "compiled-nothing.cpp"),
+                       TestSuite::Compare::StringToFile);
+    CORRADE_COMPARE_AS(dataFilename, "",
+                       TestSuite::Compare::FileToString);
+}
+
+void ResourceTest::compileIncbinCannotWrite() {
+    const std::string dataFilename = Directory::join(RESOURCE_WRITE_TEST_DIR, "nonexistent/data.bin");
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(Resource::compileIncbin("ResourceTestData", "test", {{"empty.bin", ""}}, dataFilename).empty());
+    CORRADE_COMPARE(out.str(),
+        "Utility::Directory::write(): can't open " + dataFilename + "\n"
+        "    Error: cannot write data file " + dataFilename + "\n");
+}
+
 void ResourceTest::compileFrom() {
     const std::string compiled = Resource::compileFrom("ResourceTestData",
         Directory::join(RESOURCE_TEST_DIR, "resources.conf"));
@@ -129,6 +222,20 @@ void ResourceTest::compileFromUtf8Filenames() {
                        TestSuite::Compare::StringToFile);
 }
 
+void ResourceTest::compileFromCompressed() {
+    const std::string compiled = Resource::compileFrom("ResourceTestCompressedData",
+        Directory::join(RESOURCE_TEST_DIR, "resources-compressed.conf"));
+    CORRADE_COMPARE_AS(compiled, Directory::join(RESOURCE_TEST_DIR, "compiled-compressed.cpp"),
+                       TestSuite::Compare::StringToFile);
+}
+
+void ResourceTest::compilePackFrom() {
+    const std::string compiled = Resource::compilePackFrom(
+        Directory::join(RESOURCE_TEST_DIR, "resources-pack.conf"));
+    CORRADE_COMPARE_AS(compiled, Directory::join(RESOURCE_TEST_DIR, "compiled.pack"),
+                       TestSuite::Compare::StringToFile);
+}
+
 void ResourceTest::compileFromNonexistentResource() {
     std::ostringstream out;
     Error redirectError{&out};
@@ -179,6 +286,22 @@ void ResourceTest::compileFromEmptyAlias() {
     CORRADE_COMPARE(out.str(), "    Error: filename or alias of file 1 in group name is empty\n");
 }
 
+void ResourceTest::compileFromAligned() {
+    const std::string compiled = Resource::compileFrom("ResourceTestAlignedData",
+        Directory::join(RESOURCE_TEST_DIR, "resources-aligned.conf"));
+    CORRADE_COMPARE_AS(compiled, Directory::join(RESOURCE_TEST_DIR, "compiled-aligned.cpp"),
+                       TestSuite::Compare::StringToFile);
+}
+
+void ResourceTest::compileFromInvalidAlignment() {
+    std::ostringstream out;
+    Error redirectError{&out};
+
+    CORRADE_VERIFY(Resource::compileFrom("ResourceTestData",
+        Directory::join(RESOURCE_TEST_DIR, "resources-invalid-alignment.conf")).empty());
+    CORRADE_COMPARE(out.str(), "    Error: alignment of file 1 in group test is not a power of two between 1 and 4096\n");
+}
+
 void ResourceTest::hasGroup() {
     CORRADE_VERIFY(Resource::hasGroup("test"));
     CORRADE_VERIFY(!Resource::hasGroup("nonexistent"));
@@ -239,6 +362,205 @@ void ResourceTest::getNothing() {
     CORRADE_VERIFY(r.get("nonexistentFile").empty());
 }
 
+void ResourceTest::getCompressed() {
+    Resource r("compressed");
+    r.evictCache();
+
+    /* Nothing is decompressed until accessed */
+    CORRADE_COMPARE(r.cacheSize(), 0);
+    CORRADE_COMPARE_AS(r.get("compressible.txt"),
+                       Directory::join(RESOURCE_TEST_DIR, "compressible.txt"),
+                       TestSuite::Compare::StringToFile);
+    CORRADE_COMPARE(r.cacheSize(), 1961);
+
+    /* Second access returns the cached data, also for other instances */
+    Resource r2("compressed");
+    CORRADE_VERIFY(r2.getRaw("compressible.txt").data() == r.getRaw("compressible.txt").data());
+    CORRADE_COMPARE(r.cacheSize(), 1961);
+
+    /* Files that were too small to be compressed and uncompressed files are
+       not cached */
+    CORRADE_COMPARE_AS(r.get("predisposition.bin"),
+                       Directory::join(RESOURCE_TEST_DIR, "predisposition.bin"),
+                       TestSuite::Compare::StringToFile);
+    CORRADE_COMPARE_AS(r.get("consequence.bin"),
+                       Directory::join(RESOURCE_TEST_DIR, "consequence.bin"),
+                       TestSuite::Compare::StringToFile);
+    CORRADE_COMPARE(r.cacheSize(), 1961);
+}
+
+void ResourceTest::evictCache() {
+    Resource r("compressed");
+    CORRADE_VERIFY(!r.get("compressible.txt").empty());
+    CORRADE_COMPARE(r.cacheSize(), 1961);
+
+    r.evictCache();
+    CORRADE_COMPARE(r.cacheSize(), 0);
+
+    /* The file gets decompressed again */
+    CORRADE_COMPARE_AS(r.get("compressible.txt"),
+                       Directory::join(RESOURCE_TEST_DIR, "compressible.txt"),
+                       TestSuite::Compare::StringToFile);
+    CORRADE_COMPARE(r.cacheSize(), 1961);
+
+    /* Evicting a group without compressed files does nothing */
+    Resource r2("test");
+    r2.evictCache();
+    CORRADE_COMPARE(r2.cacheSize(), 0);
+}
+
+void ResourceTest::verifyAligned(const Resource& r) {
+    CORRADE_COMPARE_AS(r.list(), (std::vector<std::string>{
+        "compressible.txt",
+        "consequence.bin",
+        "predisposition.bin"}), TestSuite::Compare::Container);
+
+    /* Compressed file is decompressed to an aligned location */
+    Containers::ArrayView<const char> compressible = r.getRaw("compressible.txt");
+    CORRADE_COMPARE(reinterpret_cast<std::uintptr_t>(compressible.data()) % 64, 0);
+    CORRADE_COMPARE_AS(std::string(compressible.data(), compressible.size()),
+                       Directory::join(RESOURCE_TEST_DIR, "compressible.txt"),
+                       TestSuite::Compare::StringToFile);
+
+    /* Padding is inserted after this one */
+    CORRADE_COMPARE_AS(r.get("consequence.bin"),
+                       Directory::join(RESOURCE_TEST_DIR, "consequence.bin"),
+                       TestSuite::Compare::StringToFile);
+
+    Containers::ArrayView<const char> predisposition = r.getRaw("predisposition.bin");
+    CORRADE_COMPARE(reinterpret_cast<std::uintptr_t>(predisposition.data()) % 16, 0);
+    CORRADE_COMPARE_AS(std::string(predisposition.data(), predisposition.size()),
+                       Directory::join(RESOURCE_TEST_DIR, "predisposition.bin"),
+                       TestSuite::Compare::StringToFile);
+}
+
+void ResourceTest::getAligned() {
+    verifyAligned(Resource{"aligned"});
+}
+
+void ResourceTest::mountPack() {
+    CORRADE_VERIFY(Directory::mkpath(RESOURCE_WRITE_TEST_DIR));
+    const std::string filename = Directory::join(RESOURCE_WRITE_TEST_DIR, "mount.pack");
+    CORRADE_VERIFY(Directory::writeString(filename, Resource::compilePackFrom(Directory::join(RESOURCE_TEST_DIR, "resources-pack.conf"))));
+
+    CORRADE_VERIFY(!Resource::hasGroup("pack"));
+    CORRADE_VERIFY(Resource::mountPack(filename));
+    CORRADE_VERIFY(Resource::hasGroup("pack"));
+
+    {
+        Resource r("pack");
+        CORRADE_COMPARE_AS(r.list(), (std::vector<std::string>{
+            "compressible.txt",
+            "consequence.bin",
+            "data/predisposition.bin",
+            "empty.bin"}), TestSuite::Compare::Container);
+
+        Containers::ArrayView<const char> consequence = r.getRaw("consequence.bin");
+        CORRADE_COMPARE_AS(std::string(consequence.data(), consequence.size()),
+                           Directory::join(RESOURCE_TEST_DIR, "consequence.bin"),
+                           TestSuite::Compare::StringToFile);
+        CORRADE_COMPARE_AS(r.get("data/predisposition.bin"),
+                           Directory::join(RESOURCE_TEST_DIR, "predisposition.bin"),
+                           TestSuite::Compare::StringToFile);
+        CORRADE_VERIFY(r.get("empty.bin").empty());
+
+        /* Compressed files get decompressed on access */
+        CORRADE_COMPARE(r.cacheSize(), 0);
+        CORRADE_COMPARE_AS(r.get("compressible.txt"),
+                           Directory::join(RESOURCE_TEST_DIR, "compressible.txt"),
+                           TestSuite::Compare::StringToFile);
+        CORRADE_COMPARE(r.cacheSize(), 1961);
+    }
+
+    Resource::unmountPack("pack");
+    CORRADE_VERIFY(!Resource::hasGroup("pack"));
+
+    /* The data start at an aligned offset */
+    CORRADE_VERIFY(Directory::writeString(filename, Resource::compilePack("packDataAligned", {{"a.bin", "data"}})));
+    CORRADE_VERIFY(Resource::mountPack(filename));
+    CORRADE_COMPARE(reinterpret_cast<std::uintptr_t>(Resource{"packDataAligned"}.getRaw("a.bin").data()) % 16, 0);
+    Resource::unmountPack("packDataAligned");
+}
+
+void ResourceTest::mountPackAligned() {
+    CORRADE_VERIFY(Directory::mkpath(RESOURCE_WRITE_TEST_DIR));
+    const std::string filename = Directory::join(RESOURCE_WRITE_TEST_DIR, "aligned.pack");
+    CORRADE_VERIFY(Directory::writeString(filename, Resource::compilePackFrom(Directory::join(RESOURCE_TEST_DIR, "resources-aligned-pack.conf"))));
+
+    CORRADE_VERIFY(Resource::mountPack(filename));
+    verifyAligned(Resource{"alignedPack"});
+    Resource::unmountPack("alignedPack");
+}
+
+void ResourceTest::mountPackNonexistent() {
+    std::ostringstream out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!Resource::mountPack("nonexistent.pack"));
+    CORRADE_COMPARE(out.str(),
+        "Utility::Directory::mapRead(): can't open nonexistent.pack\n"
+        "Utility::Resource::mountPack(): can't read nonexistent.pack\n");
+}
+
+void ResourceTest::mountPackInvalid() {
+    const std::string filename = Directory::join(RESOURCE_TEST_DIR, "resources.conf");
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!Resource::mountPack(filename));
+    CORRADE_COMPARE(out.str(), "Utility::Resource::mountPack(): " + filename + " is not a resource pack\n");
+}
+
+void ResourceTest::mountPackUnsupportedVersion() {
+    CORRADE_VERIFY(Directory::mkpath(RESOURCE_WRITE_TEST_DIR));
+    const std::string filename = Directory::join(RESOURCE_WRITE_TEST_DIR, "version.pack");
+    std::string pack = Resource::compilePack("version", {{"a.bin", "data"}});
+    const unsigned int version = 2;
+    pack.replace(8, 4, reinterpret_cast<const char*>(&version), 4);
+    CORRADE_VERIFY(Directory::writeString(filename, pack));
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!Resource::mountPack(filename));
+    CORRADE_COMPARE(out.str(), "Utility::Resource::mountPack(): unsupported version 2 of " + filename + "\n");
+}
+
+void ResourceTest::mountPackCorrupted() {
+    CORRADE_VERIFY(Directory::mkpath(RESOURCE_WRITE_TEST_DIR));
+    const std::string filename = Directory::join(RESOURCE_WRITE_TEST_DIR, "corrupted.pack");
+
+    /* Truncated, so the data go past the end */
+    std::string pack = Resource::compilePack("corrupted", {{"a.bin", "data"}});
+    CORRADE_VERIFY(Directory::writeString(filename, pack.substr(0, pack.size() - 1)));
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!Resource::mountPack(filename));
+    CORRADE_COMPARE(out.str(), "Utility::Resource::mountPack(): " + filename + " is corrupted\n");
+    CORRADE_VERIFY(!Resource::hasGroup("corrupted"));
+}
+
+void ResourceTest::mountPackAlreadyRegistered() {
+    CORRADE_VERIFY(Directory::mkpath(RESOURCE_WRITE_TEST_DIR));
+    const std::string filename = Directory::join(RESOURCE_WRITE_TEST_DIR, "registered.pack");
+    CORRADE_VERIFY(Directory::writeString(filename, Resource::compilePack("test", {{"a.bin", "data"}})));
+
+    std::ostringstream out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!Resource::mountPack(filename));
+    CORRADE_COMPARE(out.str(), "Utility::Resource::mountPack(): group 'test' is already registered\n");
+}
+
+void ResourceTest::unmountPackNotPack() {
+    std::ostringstream out;
+    Error redirectError{&out};
+    Resource::unmountPack("test");
+    Resource::unmountPack("nonexistent");
+    CORRADE_COMPARE(out.str(),
+        "Utility::Resource::unmountPack(): group 'test' is not a mounted pack\n"
+        "Utility::Resource::unmountPack(): group 'nonexistent' is not a mounted pack\n");
+    CORRADE_VERIFY(Resource::hasGroup("test"));
+}
+
 void ResourceTest::overrideGroup() {
     std::ostringstream out;
     Debug redirectDebug{&out};
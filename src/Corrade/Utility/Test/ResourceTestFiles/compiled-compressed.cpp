@@ -0,0 +1,78 @@
+/* Compiled resource file. DO NOT EDIT! */
+
+#include "Corrade/Corrade.h"
+#include "Corrade/Utility/Macros.h"
+#include "Corrade/Utility/Resource.h"
+
+CORRADE_ALIGNAS(4) static const unsigned char resourcePositions[] = {
+    0x10,0x00,0x00,0x00,
+    0x52,0x01,0x00,0x00,
+    0x1f,0x00,0x00,0x00,
+    0x5a,0x01,0x00,0x00,
+    0x31,0x00,0x00,0x00,
+    0x62,0x01,0x00,0x00
+};
+
+static const unsigned char resourceFilenames[] = {
+    /* compressible.txt */
+    0x63,0x6f,0x6d,0x70,0x72,0x65,0x73,0x73,0x69,0x62,0x6c,0x65,0x2e,0x74,0x78,
+    0x74,
+
+    /* consequence.bin */
+    0x63,0x6f,0x6e,0x73,0x65,0x71,0x75,0x65,0x6e,0x63,0x65,0x2e,0x62,0x69,0x6e,
+
+    /* predisposition.bin */
+    0x70,0x72,0x65,0x64,0x69,0x73,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x2e,
+    0x62,0x69,0x6e
+};
+
+static const unsigned char resourceData[] = {
+    /* compressible.txt */
+    0xfc,0x0c,0x30,0x30,0x3a,0x20,0x74,0x68,0x65,0x20,0x70,0x72,0x65,0x64,0x69,
+    0x73,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x20,0x6f,0x66,0x20,0x61,0x14,
+    0x00,0xf2,0x04,0x69,0x73,0x20,0x61,0x20,0x63,0x6f,0x6e,0x73,0x65,0x71,0x75,
+    0x65,0x6e,0x63,0x65,0x0a,0x30,0x31,0x3c,0x00,0x07,0x14,0x00,0x02,0x39,0x00,
+    0x52,0x72,0x65,0x70,0x65,0x74,0x49,0x00,0x01,0x35,0x00,0x06,0x10,0x00,0x34,
+    0x0a,0x30,0x32,0x34,0x00,0x65,0x6d,0x70,0x72,0x65,0x73,0x73,0x6d,0x00,0x08,
+    0x45,0x00,0x01,0x35,0x00,0x0a,0x92,0x00,0x32,0x0a,0x30,0x33,0x39,0x00,0x06,
+    0x4c,0x00,0x02,0x6c,0x00,0x46,0x64,0x65,0x63,0x6f,0x4b,0x00,0x01,0x3a,0x00,
+    0x07,0x11,0x00,0x32,0x0a,0x30,0x34,0x37,0x00,0x0a,0x27,0x00,0x01,0xdf,0x00,
+    0x07,0x27,0x00,0x11,0x20,0x38,0x00,0x09,0x24,0x00,0x32,0x0a,0x30,0x35,0x3a,
+    0x00,0x0a,0x88,0x00,0x02,0x75,0x00,0x0b,0x14,0x00,0x01,0x3e,0x00,0x07,0xc1,
+    0x00,0x32,0x0a,0x30,0x36,0x3c,0x00,0x07,0x14,0x00,0x02,0x39,0x00,0x07,0xbe,
+    0x00,0x01,0x35,0x00,0x06,0x10,0x00,0x34,0x0a,0x30,0x37,0x34,0x00,0x06,0xcf,
+    0x00,0x03,0xa8,0x00,0x05,0x73,0x01,0x02,0xa8,0x00,0x0a,0x7e,0x00,0x32,0x0a,
+    0x30,0x38,0x39,0x00,0x06,0x4c,0x00,0x02,0x6c,0x00,0x09,0xcf,0x00,0x02,0x3a,
+    0x00,0x07,0xf3,0x00,0x32,0x0a,0x30,0x39,0x37,0x00,0x0a,0x27,0x00,0x03,0x72,
+    0x00,0x06,0x83,0x00,0x01,0xa7,0x00,0x09,0x24,0x00,0x2f,0x0a,0x31,0x34,0x02,
+    0x28,0x1f,0x31,0x34,0x02,0x20,0x1f,0x31,0x34,0x02,0x25,0x1f,0x31,0x34,0x02,
+    0x23,0x1f,0x31,0x34,0x02,0x26,0x1f,0x31,0x34,0x02,0x28,0x1f,0x31,0x34,0x02,
+    0x20,0x1f,0x31,0x34,0x02,0x25,0x1f,0x31,0x34,0x02,0x23,0x1f,0x31,0x34,0x02,
+    0x26,0x1f,0x32,0x34,0x02,0x28,0x1f,0x32,0x34,0x02,0x20,0x1f,0x32,0x34,0x02,
+    0x25,0x1f,0x32,0x34,0x02,0x23,0x1f,0x3d,0x01,0x00,0xff,0xff,0x46,0x90,0x0a,
+    0x74,0x68,0x65,0x20,0x65,0x6e,0x64,0x0a,
+
+    /* consequence.bin */
+    0xd1,0x5e,0xa5,0xed,0xea,0xdd,0x00,0x0d,
+
+    /* predisposition.bin */
+    0xba,0xdc,0x0f,0xfe,0xeb,0xad,0xf0,0x0d
+};
+
+CORRADE_ALIGNAS(4) static const unsigned char resourceUncompressedSizes[] = {
+    0xa9,0x07,0x00,0x00,
+    0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00
+};
+
+int resourceInitializer_ResourceTestCompressedData();
+int resourceInitializer_ResourceTestCompressedData() {
+    Corrade::Utility::Resource::registerData("compressed", 3, resourcePositions, resourceFilenames, resourceData, resourceUncompressedSizes);
+    return 1;
+} CORRADE_AUTOMATIC_INITIALIZER(resourceInitializer_ResourceTestCompressedData)
+
+int resourceFinalizer_ResourceTestCompressedData();
+int resourceFinalizer_ResourceTestCompressedData() {
+    Corrade::Utility::Resource::unregisterData("compressed");
+    return 1;
+} CORRADE_AUTOMATIC_FINALIZER(resourceFinalizer_ResourceTestCompressedData)
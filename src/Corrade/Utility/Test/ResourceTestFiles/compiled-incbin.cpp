@@ -0,0 +1,52 @@
+/* Compiled resource file. DO NOT EDIT! */
+
+#include "Corrade/Corrade.h"
+#include "Corrade/Utility/Macros.h"
+#include "Corrade/Utility/Resource.h"
+
+CORRADE_ALIGNAS(4) static const unsigned char resourcePositions[] = {
+    0x0f,0x00,0x00,0x00,
+    0x08,0x00,0x00,0x00,
+    0x21,0x00,0x00,0x00,
+    0x10,0x00,0x00,0x00
+};
+
+static const unsigned char resourceFilenames[] = {
+    /* consequence.bin */
+    0x63,0x6f,0x6e,0x73,0x65,0x71,0x75,0x65,0x6e,0x63,0x65,0x2e,0x62,0x69,0x6e,
+
+    /* predisposition.bin */
+    0x70,0x72,0x65,0x64,0x69,0x73,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x2e,
+    0x62,0x69,0x6e
+};
+
+#if defined(CORRADE_TARGET_APPLE)
+__asm__(".pushsection __TEXT,__const\n"
+        ".globl _corradeResourceData_ResourceTestData\n"
+        ".private_extern _corradeResourceData_ResourceTestData\n"
+        "_corradeResourceData_ResourceTestData:\n"
+        ".incbin \"compiled-incbin.bin\"\n"
+        ".popsection\n");
+#elif defined(__ELF__)
+__asm__(".pushsection .rodata\n"
+        ".globl corradeResourceData_ResourceTestData\n"
+        ".hidden corradeResourceData_ResourceTestData\n"
+        "corradeResourceData_ResourceTestData:\n"
+        ".incbin \"compiled-incbin.bin\"\n"
+        ".popsection\n");
+#else
+#error resources embedded with .incbin are supported only with GCC and Clang on ELF and Apple platforms
+#endif
+extern "C" const unsigned char corradeResourceData_ResourceTestData[];
+
+int resourceInitializer_ResourceTestData();
+int resourceInitializer_ResourceTestData() {
+    Corrade::Utility::Resource::registerData("test", 2, resourcePositions, resourceFilenames, corradeResourceData_ResourceTestData);
+    return 1;
+} CORRADE_AUTOMATIC_INITIALIZER(resourceInitializer_ResourceTestData)
+
+int resourceFinalizer_ResourceTestData();
+int resourceFinalizer_ResourceTestData() {
+    Corrade::Utility::Resource::unregisterData("test");
+    return 1;
+} CORRADE_AUTOMATIC_FINALIZER(resourceFinalizer_ResourceTestData)
@@ -31,3 +31,6 @@
 #define DIRECTORY_WRITE_TEST_DIR "${UTILITY_BINARY_TEST_DIR}/DirectoryTestFiles"
 
 #define RESOURCE_TEST_DIR "${UTILITY_TEST_DIR}/ResourceTestFiles/"
+#define RESOURCE_WRITE_TEST_DIR "${UTILITY_BINARY_TEST_DIR}/ResourceTestFiles/"
+#cmakedefine RESOURCE_BENCHMARK_CXX_COMPILER "${RESOURCE_BENCHMARK_CXX_COMPILER}"
+#define RESOURCE_BENCHMARK_INCLUDE_FLAGS "-I${PROJECT_SOURCE_DIR}/src -I${PROJECT_BINARY_DIR}/src"
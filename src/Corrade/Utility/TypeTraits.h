@@ -26,10 +26,11 @@
 */
 
 /** @file
- * @brief Macros @ref CORRADE_HAS_TYPE(), alias @ref Corrade::Utility::IsIterable
+ * @brief Macros @ref CORRADE_HAS_TYPE(), alias @ref Corrade::Utility::IsIterable, @ref Corrade::Utility::IsTriviallyCopyable, @ref Corrade::Utility::IsTriviallyDestructible
  */
 
 #include <iterator> /* for std::begin() in libc++ */
+#include <type_traits>
 #include <utility>
 
 #include "Corrade/configure.h"
@@ -107,6 +108,34 @@ template<class T> using IsIterable = std::integral_constant<bool,
     #endif
     Implementation::HasStdEnd<T>::value)>;
 
+/**
+@brief Traits class for checking whether given type is trivially copyable
+
+Equivalent to @ref std::is_trivially_copyable. On GCC 4.x, whose standard
+library doesn't provide the trait yet, it's emulated using compiler builtins
+for trivial copy and trivial destruction. Used by containers to decide whether
+contents can be moved around with @ref std::memcpy() or @ref std::realloc()
+instead of calling move constructors and destructors on each element.
+*/
+#if defined(__GNUC__) && !defined(__clang__) && __GNUC__ < 5
+template<class T> using IsTriviallyCopyable = std::integral_constant<bool, __has_trivial_copy(T) && __has_trivial_destructor(T)>;
+#else
+template<class T> using IsTriviallyCopyable = std::is_trivially_copyable<T>;
+#endif
+
+/**
+@brief Traits class for checking whether given type is trivially destructible
+
+Equivalent to @ref std::is_trivially_destructible. On GCC 4.x, whose standard
+library doesn't provide the trait yet, it's emulated using a compiler builtin.
+Used by containers to skip calling destructors on each element.
+*/
+#if defined(__GNUC__) && !defined(__clang__) && __GNUC__ < 5
+template<class T> using IsTriviallyDestructible = std::integral_constant<bool, __has_trivial_destructor(T)>;
+#else
+template<class T> using IsTriviallyDestructible = std::is_trivially_destructible<T>;
+#endif
+
 }}
 
 #endif
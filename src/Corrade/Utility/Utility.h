@@ -38,6 +38,7 @@
 namespace Corrade { namespace Utility {
 
 class Arguments;
+class AsyncFileQueue;
 
 template<std::size_t> class HashDigest;
 /* AbstractHash is not used directly */
@@ -26,8 +26,13 @@
 /** @file
 @brief Utility for compiling data resources via command-line.
 
-Produces compiled C++ file with data in hexadecimal representation. Status
-messages are printed to standard output, errors are printed to error output.
+Produces compiled C++ file with data in hexadecimal representation. With
+`--incbin` the data are written to a separate file instead and the C++ file
+embeds them using the `.incbin` assembler directive, see
+@ref Utility::Resource::compileIncbin() for details. With `--pack` it produces
+a binary resource pack instead, which can be loaded at runtime using
+@ref Utility::Resource::mountPack(). Status messages are printed to standard
+output, errors are printed to error output.
 See `corrade-rc --help` for command-line parameters, see @ref resource-management
 for brief introduction.
 */
@@ -45,15 +50,25 @@ int main(int argc, char** argv) {
     args.addArgument("name")
         .addArgument("conf").setHelp("conf", "resource configuration file", "resources.conf")
         .addArgument("out").setHelp("out", "output file", "outfile.cpp")
+        .addBooleanOption("pack").setHelp("pack", "produce a resource pack for Utility::Resource::mountPack() instead of a C++ file, the name is ignored")
+        .addOption("incbin").setHelp("incbin", "write the data to a separate file and embed it using the .incbin assembler directive", "data.bin")
         .setCommand("corrade-rc")
         .setHelp("Resource compiler for Corrade.")
         .parse(argc, argv);
 
-    /* Remove previous output file */
+    /* Remove previous output files */
+    const std::string incbin = args.value("incbin");
     Corrade::Utility::Directory::rm(args.value("out"));
+    if(!incbin.empty()) Corrade::Utility::Directory::rm(incbin);
 
     /* Compile file */
-    const std::string compiled = Corrade::Utility::Resource::compileFrom(args.value("name"), args.value("conf"));
+    std::string compiled;
+    if(args.isSet("pack"))
+        compiled = Corrade::Utility::Resource::compilePackFrom(args.value("conf"));
+    else if(!incbin.empty())
+        compiled = Corrade::Utility::Resource::compileIncbinFrom(args.value("name"), args.value("conf"), incbin);
+    else
+        compiled = Corrade::Utility::Resource::compileFrom(args.value("name"), args.value("conf"));
 
     /* Compilation failed */
     if(compiled.empty()) return 2;
@@ -64,6 +64,12 @@
    Utility/Test/SystemTest.cpp */
 #endif
 
+/* SSE2 is implicitly enabled on all x86_64 compilers, on 32-bit x86 only if
+   explicitly requested (-msse2 on GCC/Clang, /arch:SSE2 on MSVC) */
+#if defined(CORRADE_TARGET_X86) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP == 2))
+#define CORRADE_TARGET_SSE2
+#endif
+
 /* Sanity checks */
 #if defined(CORRADE_TARGET_EMSCRIPTEN) && (defined(CORRADE_TARGET_X86) || defined(CORRADE_TARGET_ARM))
 #error CORRADE_TARGET_X86 or CORRADE_TARGET_ARM defined on Emscripten